@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <time.h>
+
+// Minimal benchmark harness for the cuckoo_bench executable.
+// Each benchmark registers itself with CUCKOO_BENCH and reports named results.
+namespace cuckoo_bench {
+
+class Context
+{
+public:
+    Context(const std::string &name, int scale, const std::string &dumpDir = "")
+        : name_(name), scale_(scale), dumpDir_(dumpDir) {}
+
+    // Multiplier for iteration counts (--scale N), so slow targets can run shorter
+    inline int Scale() const { return scale_; }
+    inline const std::string &Name() const { return name_; }
+    // Directory for benchmark artefacts such as rendered frames (--dump-dir DIR), empty if disabled
+    inline const std::string &DumpDir() const { return dumpDir_; }
+
+    void Report(const std::string &metric, double value, const std::string &unit);
+
+    static inline uint64_t NowNs()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+    }
+
+private:
+    std::string name_;
+    int scale_;
+    std::string dumpDir_;
+};
+
+typedef std::function<void(Context &)> BenchFn;
+
+inline std::vector<std::pair<std::string, BenchFn>> &Registry()
+{
+    static std::vector<std::pair<std::string, BenchFn>> entries;
+    return entries;
+}
+
+struct Registrar
+{
+    Registrar(const char *name, BenchFn fn) { Registry().push_back(std::make_pair(std::string(name), fn)); }
+};
+
+// Defeat dead-store elimination of benchmark results
+void DoNotOptimize(const void *p);
+
+} // namespace cuckoo_bench
+
+#define CUCKOO_BENCH(name) \
+    static void bench_##name(cuckoo_bench::Context &ctx); \
+    static cuckoo_bench::Registrar registrar_##name(#name, bench_##name); \
+    static void bench_##name(cuckoo_bench::Context &ctx)
@@ -0,0 +1,125 @@
+// Cold start configuration load: json11 parse of config.json (with comments)
+// against the compiled ConfigCache image, both producing the same AppConfig.
+// The config is synthetic but shaped like a real one: a home screen, menus
+// with icons, and a switch or dimmer screen per integration.
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "Bench.hpp"
+#include "ConfigCache.hpp"
+#include "ConfigurationReader.hpp"
+#include "logger.h"
+
+namespace {
+
+const int Integrations = 24;
+const int Menus = 6;
+const int MenuItems = 8;
+
+std::string SyntheticConfig()
+{
+    std::ostringstream out;
+    out << "{\n  // generated by cuckoo_bench\n";
+    out << "  \"hal\": { \"display_device\": \"/dev/fb0\", \"backlight_active_seconds\": 10 },\n";
+    out << "  \"homeAssistant\": { \"baseURL\": \"http://ha.local:8123\", \"token\": \"0123456789abcdef\", \"entityId\": \"switch.s0\" },\n";
+    out << "  \"integrations\": [\n";
+    for (int i = 0; i < Integrations; ++i)
+        out << "    { \"id\": " << 100 + i << ", \"name\": \"Device " << i << "\", \"type\": \"HomeAssistant\", \"entityId\": \""
+            << (i % 2 ? "light.l" : "switch.s") << i << "\" }" << (i + 1 < Integrations ? "," : "") << "\n";
+    out << "  ],\n  \"firstScreen\": 1,\n  \"screens\": [\n";
+    out << "    { \"id\": 1, \"name\": \"Home\", \"type\": \"Home\", \"nextScreen\": 2 },\n";
+    for (int m = 0; m < Menus; ++m)
+    {
+        out << "    // menu " << m << "\n";
+        out << "    { \"id\": " << 2 + m << ", \"name\": \"Menu " << m << "\", \"type\": \"Menu\", \"menuItems\": [\n";
+        for (int i = 0; i < MenuItems; ++i)
+            out << "      { \"name\": \"Item " << i << "\", \"icon\": \"light\", \"nextScreen\": " << 100 + (m * MenuItems + i) % Integrations << " }"
+                << (i + 1 < MenuItems ? "," : "") << "\n";
+        out << "    ] },\n";
+    }
+    for (int i = 0; i < Integrations; ++i)
+        out << "    { \"id\": " << 100 + i << ", \"name\": \"Device " << i << "\", \"type\": \"" << (i % 2 ? "Dimmer" : "Switch")
+            << "\", \"integrationId\": " << 100 + i << " }" << (i + 1 < Integrations ? "," : "") << "\n";
+    out << "  ]\n}\n";
+    return out.str();
+}
+
+double Percentile(std::vector<uint64_t> &samples, double p)
+{
+    std::sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(p * (samples.size() - 1));
+    return samples[index] / 1e3;
+}
+
+} // namespace
+
+CUCKOO_BENCH(config_startup)
+{
+    char dir_template[] = "/tmp/cuckoo_bench_XXXXXX";
+    if (mkdtemp(dir_template) == nullptr)
+        return;
+    const std::string config_path = std::string(dir_template) + "/config.json";
+    const std::string cache_path = ConfigCache::PathFor(config_path);
+
+    const std::string content = SyntheticConfig();
+    {
+        std::ofstream file(config_path.c_str());
+        file << content;
+    }
+
+    // the readers log every load
+    cuckoo_log::Logger::set_level(cuckoo_log::Level::Warn);
+
+    const int loads = 200 * ctx.Scale();
+    std::vector<uint64_t> json_ns, cache_ns;
+    json_ns.reserve(loads);
+    cache_ns.reserve(loads);
+    size_t screens = 0;
+
+    // prime the image, then alternate so both paths see the same cache state
+    {
+        ConfigurationReader reader(config_path);
+        reader.load_with_cache(cache_path);
+    }
+    for (int i = 0; i < loads; ++i)
+    {
+        uint64_t t0 = cuckoo_bench::Context::NowNs();
+        {
+            ConfigurationReader reader(config_path);
+            reader.load();
+            screens += reader.get_app_config().screens.size();
+        }
+        uint64_t t1 = cuckoo_bench::Context::NowNs();
+        {
+            ConfigurationReader reader(config_path);
+            reader.load_with_cache(cache_path);
+            screens += reader.get_app_config().screens.size();
+        }
+        uint64_t t2 = cuckoo_bench::Context::NowNs();
+        json_ns.push_back(t1 - t0);
+        cache_ns.push_back(t2 - t1);
+    }
+    cuckoo_bench::DoNotOptimize(&screens);
+
+    std::ifstream cache_file(cache_path.c_str(), std::ios::binary | std::ios::ate);
+    double cache_bytes = static_cast<double>(cache_file.tellg());
+
+    double json_p50 = Percentile(json_ns, 0.5);
+    double cache_p50 = Percentile(cache_ns, 0.5);
+    ctx.Report("config bytes json", static_cast<double>(content.size()), "B");
+    ctx.Report("config bytes cache", cache_bytes, "B");
+    ctx.Report("load json p50", json_p50, "us");
+    ctx.Report("load json p99", Percentile(json_ns, 0.99), "us");
+    ctx.Report("load cache p50", cache_p50, "us");
+    ctx.Report("load cache p99", Percentile(cache_ns, 0.99), "us");
+    ctx.Report("load speedup json/cache", json_p50 / cache_p50, "x");
+
+    std::remove(cache_path.c_str());
+    std::remove(config_path.c_str());
+    rmdir(dir_template);
+}
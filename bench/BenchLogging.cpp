@@ -0,0 +1,134 @@
+// Cost of log statements that produce no output: trace/debug compiled out as
+// on the device, a statement filtered by its level at runtime, and for
+// comparison a message formatted first and filtered afterwards, which is what
+// every LOG_*_STREAM statement used to cost. log_sink compares the text file
+// sink with the binary segment sink, per line written.
+#undef CUCKOO_LOG_MIN_LEVEL
+#define CUCKOO_LOG_MIN_LEVEL 2
+#define CUCKOO_LOG_MODULE "bench"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Bench.hpp"
+#include "logger.h"
+
+namespace {
+
+const std::string PortName = "/dev/ttyO2";
+
+template<typename F>
+double NsPerCall(int calls, F &&body)
+{
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int i = 0; i < calls; ++i)
+        body(i);
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    return static_cast<double>(t1 - t0) / calls;
+}
+
+} // namespace
+
+CUCKOO_BENCH(log_disabled)
+{
+    cuckoo_log::Logger::set_level(cuckoo_log::Level::Warn);
+    const int calls = 2000000 * ctx.Scale();
+    int sink = 0;
+
+    double empty = NsPerCall(calls, [&](int i) {
+        sink += i;
+        cuckoo_bench::DoNotOptimize(&sink);
+    });
+    double compiled_out = NsPerCall(calls, [&](int i) {
+        sink += i;
+        LOG_DEBUG_STREAM("UnixSerialPort: wrote " << i << " bytes to " << PortName);
+        cuckoo_bench::DoNotOptimize(&sink);
+    });
+    double stream = NsPerCall(calls, [&](int i) {
+        sink += i;
+        LOG_INFO_STREAM("UnixSerialPort: wrote " << i << " bytes to " << PortName);
+        cuckoo_bench::DoNotOptimize(&sink);
+    });
+    double printf_style = NsPerCall(calls, [&](int i) {
+        sink += i;
+        LOG_INFO("UnixSerialPort: wrote %d bytes to %s", i, PortName.c_str());
+        cuckoo_bench::DoNotOptimize(&sink);
+    });
+    double format_first = NsPerCall(calls / 20, [&](int i) {
+        sink += i;
+        std::ostringstream oss;
+        oss << "UnixSerialPort: wrote " << i << " bytes to " << PortName;
+        cuckoo_log::Logger::log(cuckoo_log::Level::Info, oss.str());
+        cuckoo_bench::DoNotOptimize(&sink);
+    });
+
+    ctx.Report("loop overhead", empty, "ns/call");
+    ctx.Report("debug compiled out", compiled_out - empty, "ns/call");
+    ctx.Report("info stream, level warn", stream - empty, "ns/call");
+    ctx.Report("info printf, level warn", printf_style - empty, "ns/call");
+    ctx.Report("info formatted then filtered", format_first - empty, "ns/call");
+}
+
+CUCKOO_BENCH(log_sink)
+{
+    char dir_template[] = "/tmp/cuckoo_bench_XXXXXX";
+    if (mkdtemp(dir_template) == nullptr)
+        return;
+    const std::string dir = dir_template;
+    const std::string text_path = dir + "/text.log";
+    const std::string binary_dir = dir + "/binary";
+    const int lines = 20000 * ctx.Scale();
+
+    cuckoo_log::Logger::set_level(cuckoo_log::Level::Info);
+    cuckoo_log::Logger::set_console(false);
+
+    // synchronous, so the cost of each sink lands on the calling thread
+    cuckoo_log::Logger::set_file(text_path);
+    double text_ns = NsPerCall(lines, [&](int i) {
+        LOG_INFO("BackplateComms: burst stage %d, %d bytes from %s", i % 4, i, PortName.c_str());
+    });
+    cuckoo_log::Logger::set_file("");
+
+    cuckoo_log::binary::SegmentConfig config;
+    config.segment_bytes = 16 * 1024 * 1024;
+    config.segment_count = 2;
+    cuckoo_log::Logger::set_binary_sink(binary_dir, config);
+    double binary_ns = NsPerCall(lines, [&](int i) {
+        LOG_INFO("BackplateComms: burst stage %d, %d bytes from %s", i % 4, i, PortName.c_str());
+    });
+    cuckoo_log::Logger::set_binary_sink("");
+    cuckoo_log::Logger::set_console(true);
+
+    struct stat st;
+    double text_bytes = stat(text_path.c_str(), &st) == 0 ? static_cast<double>(st.st_size) : 0;
+    uint32_t sequence;
+    std::vector<cuckoo_log::binary::Line> decoded;
+    double binary_bytes = 0;
+    const std::string segment = cuckoo_log::binary::segment_path(binary_dir, 1);
+    if (cuckoo_log::binary::read_segment(segment, sequence, decoded) && static_cast<int>(decoded.size()) == lines)
+    {
+        // the segment is preallocated; measure up to the end tag
+        FILE *file = std::fopen(segment.c_str(), "rb");
+        std::vector<char> data(config.segment_bytes);
+        size_t n = std::fread(&data[0], 1, data.size(), file);
+        std::fclose(file);
+        while (n > 0 && data[n - 1] == 0)
+            --n;
+        binary_bytes = static_cast<double>(n);
+    }
+
+    ctx.Report("text file", text_ns, "ns/line");
+    ctx.Report("binary segments", binary_ns, "ns/line");
+    ctx.Report("text file", text_bytes / lines, "B/line");
+    ctx.Report("binary segments", binary_bytes / lines, "B/line");
+
+    std::remove(text_path.c_str());
+    for (int i = 0; i < config.segment_count; ++i)
+        std::remove(cuckoo_log::binary::segment_path(binary_dir, i).c_str());
+    rmdir(binary_dir.c_str());
+    rmdir(dir.c_str());
+}
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "Bench.hpp"
+
+namespace cuckoo_bench {
+
+void Context::Report(const std::string &metric, double value, const std::string &unit)
+{
+    std::printf("%-28s %-36s %14.3f %s\n", name_.c_str(), metric.c_str(), value, unit.c_str());
+    std::fflush(stdout);
+}
+
+void DoNotOptimize(const void *p)
+{
+    // The compiler must assume the pointed-to memory is read here
+    asm volatile("" : : "g"(p) : "memory");
+}
+
+} // namespace cuckoo_bench
+
+// Usage: cuckoo_bench [--scale N] [--dump-dir DIR] [--list] [filter...]
+int main(int argc, char *argv[])
+{
+    int scale = 1;
+    bool list = false;
+    std::string dumpDir;
+    std::vector<std::string> filters;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--scale") == 0 && i + 1 < argc)
+            scale = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--dump-dir") == 0 && i + 1 < argc)
+            dumpDir = argv[++i];
+        else if (std::strcmp(argv[i], "--list") == 0)
+            list = true;
+        else
+            filters.push_back(argv[i]);
+    }
+
+    for (auto &entry : cuckoo_bench::Registry())
+    {
+        bool selected = filters.empty();
+        for (auto &f : filters)
+            selected |= (entry.first.find(f) != std::string::npos);
+        if (!selected)
+            continue;
+
+        if (list)
+        {
+            std::cout << entry.first << std::endl;
+            continue;
+        }
+
+        cuckoo_bench::Context ctx(entry.first, scale, dumpDir);
+        entry.second(ctx);
+    }
+
+    return 0;
+}
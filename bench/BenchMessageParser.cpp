@@ -0,0 +1,96 @@
+// MessageParser throughput on a serial stream of valid frames mixed with
+// random noise, fed in the 256-byte reads of BackplateComms. "worst feed" is
+// the slowest single Feed() call. backplate_parse_adversarial fills the line
+// with preambles announcing MaxPayloadLength bytes, which is the most
+// verification work that noise can cause.
+#include <algorithm>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Backplate/MessageParser.hpp"
+#include "Backplate/ResponseMessage.hpp"
+
+namespace {
+
+const size_t StreamBytes = 1 << 20;
+const size_t ReadBytes = 256;
+
+std::vector<uint8_t> MakeStream(int noise_percent, size_t bytes)
+{
+    ResponseMessage frame(MessageType::TempHumidityData);
+    frame.SetPayload(std::vector<uint8_t>{ 0x11, 0x22, 0x33, 0x44 });
+    std::vector<uint8_t> raw = frame.GetRawMessage();
+
+    std::vector<uint8_t> stream;
+    stream.reserve(bytes + raw.size());
+    uint32_t state = 2463534242u;
+    while (stream.size() < bytes)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        if (static_cast<int>(state % 100) < noise_percent)
+        {
+            // A burst of line noise, sometimes starting with a stray preamble
+            size_t burst = 1 + state % 64;
+            if (state & 0x100)
+                stream.insert(stream.end(), raw.begin(), raw.begin() + 4);
+            for (size_t i = 0; i < burst; ++i)
+                stream.push_back(static_cast<uint8_t>(state >> (i % 24)));
+        }
+        else
+            stream.insert(stream.end(), raw.begin(), raw.end());
+    }
+    return stream;
+}
+
+void RunStream(cuckoo_bench::Context &ctx, const std::vector<uint8_t> &stream)
+{
+    MessageParser parser;
+    size_t frames = 0;
+    uint64_t worst_ns = 0;
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int round = 0; round < ctx.Scale(); ++round)
+    {
+        for (size_t offset = 0; offset < stream.size(); offset += ReadBytes)
+        {
+            size_t len = std::min(ReadBytes, stream.size() - offset);
+            uint64_t start = cuckoo_bench::Context::NowNs();
+            frames += parser.Feed(stream.data() + offset, len).size();
+            worst_ns = std::max(worst_ns, cuckoo_bench::Context::NowNs() - start);
+        }
+    }
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+
+    double seconds = static_cast<double>(t1 - t0) / 1000000000.0;
+    ctx.Report("throughput", static_cast<double>(stream.size()) * ctx.Scale() / seconds / (1024.0 * 1024.0), "MiB/s");
+    ctx.Report("worst feed", static_cast<double>(worst_ns) / 1000.0, "us");
+    ctx.Report("frames", static_cast<double>(frames) / ctx.Scale(), "per stream");
+}
+
+} // namespace
+
+CUCKOO_BENCH(backplate_parse_clean)
+{
+    RunStream(ctx, MakeStream(0, StreamBytes));
+}
+
+CUCKOO_BENCH(backplate_parse_noisy)
+{
+    RunStream(ctx, MakeStream(50, StreamBytes));
+}
+
+CUCKOO_BENCH(backplate_parse_adversarial)
+{
+    // Preamble, command, the largest allowed length, then filler that fails the CRC
+    std::vector<uint8_t> stream;
+    while (stream.size() < StreamBytes)
+    {
+        const uint8_t header[] = { 0xd5, 0xd5, 0xaa, 0x96, 0x01, 0x00,
+            static_cast<uint8_t>(MessageParser::MaxPayloadLength & 0xff),
+            static_cast<uint8_t>(MessageParser::MaxPayloadLength >> 8) };
+        stream.insert(stream.end(), header, header + sizeof(header));
+        stream.resize(stream.size() + MessageParser::MaxPayloadLength + 2, 0x00);
+    }
+    RunStream(ctx, stream);
+}
@@ -0,0 +1,90 @@
+// Raw PIR processing per sample: the FIR kernel as built (NEON on the
+// target) against its scalar reference, the whole detector, and what the
+// comms thread pays to hand a sample to the PIR thread instead of filtering
+// it inline. The input is 10 Hz samples around mid-scale with noise and a
+// burst of motion every 20 seconds.
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Bench.hpp"
+#include "Backplate/PirDetector.hpp"
+#include "Backplate/PirProcessor.hpp"
+
+namespace {
+
+const int Samples = 1 << 14;
+
+std::vector<PirSample> MakeSamples()
+{
+    std::vector<PirSample> samples;
+    samples.reserve(Samples);
+    uint32_t state = 2463534242u;
+    for (int i = 0; i < Samples; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        int value = 2048 + static_cast<int>(state % 9) - 4;
+        if (i % 200 < 15)
+            value += static_cast<int>(150 * std::sin(2 * M_PI * i / 20.0));
+        samples.push_back(PirSample{ static_cast<uint64_t>(i) * 100000000ull, static_cast<uint16_t>(value) });
+    }
+    return samples;
+}
+
+template <typename Kernel>
+double KernelNs(cuckoo_bench::Context &ctx, const std::vector<int16_t> &x, std::vector<int16_t> &y, Kernel kernel)
+{
+    size_t outputs = y.size();
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int round = 0; round < ctx.Scale() * 16; ++round)
+        for (size_t i = 0; i + PirDetector::BlockSize <= outputs; i += PirDetector::BlockSize)
+            kernel(x.data() + i, y.data() + i, PirDetector::BlockSize);
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    cuckoo_bench::DoNotOptimize(y.data());
+    return static_cast<double>(t1 - t0) / (static_cast<double>(outputs) * ctx.Scale() * 16);
+}
+
+} // namespace
+
+CUCKOO_BENCH(pir_detector)
+{
+    std::vector<PirSample> samples = MakeSamples();
+
+    std::vector<int16_t> x(Samples + PirDetector::Taps - 1);
+    for (size_t i = 0; i < x.size(); ++i)
+        x[i] = static_cast<int16_t>(samples[i % Samples].value) - 2048;
+    std::vector<int16_t> y(Samples);
+    ctx.Report("fir scalar", KernelNs(ctx, x, y, PirDetector::LowPassScalar), "ns");
+    ctx.Report(PirDetector::HasNeon() ? "fir neon" : "fir (no neon in this build)",
+        KernelNs(ctx, x, y, PirDetector::LowPass), "ns");
+
+    int changes = 0;
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int round = 0; round < ctx.Scale(); ++round)
+    {
+        PirDetector detector;
+        changes += detector.Add(samples.data(), samples.size()) ? 1 : 0;
+    }
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    cuckoo_bench::DoNotOptimize(&changes);
+    ctx.Report("detector, inline", static_cast<double>(t1 - t0) / (static_cast<double>(Samples) * ctx.Scale()), "ns");
+
+    // The comms thread's share: pushes only, drained between batches off the clock
+    PirProcessor processor([]() { return 0ull; });
+    uint64_t pushNs = 0;
+    for (int round = 0; round < ctx.Scale(); ++round)
+    {
+        for (size_t i = 0; i < samples.size(); i += PirProcessor::RingSize)
+        {
+            size_t end = std::min(samples.size(), i + PirProcessor::RingSize);
+            uint64_t start = cuckoo_bench::Context::NowNs();
+            for (size_t j = i; j < end; ++j)
+                processor.Push(samples[j].value, samples[j].ns);
+            pushNs += cuckoo_bench::Context::NowNs() - start;
+            processor.Drain();
+        }
+    }
+    ctx.Report("push to the pir thread", static_cast<double>(pushNs) / (static_cast<double>(Samples) * ctx.Scale()), "ns");
+}
@@ -0,0 +1,134 @@
+// Fill-rate comparison of the RGB565 and XRGB8888 render pipelines.
+// Models what the software renderer does per frame on the 320x320 panel:
+// a solid fill, a 50% blended overlay over part of the frame, then the flush
+// into the framebuffer (plain copy, or RGB565 -> XRGB8888 widening).
+#include <cstring>
+#include <vector>
+
+#include "Bench.hpp"
+#include "HAL/PixelConvert.hpp"
+
+namespace {
+
+const int Width = 320;
+const int Height = 320;
+const int Pixels = Width * Height;
+
+inline void Fill565(uint16_t *buf, int count, uint16_t c)
+{
+    for (int i = 0; i < count; ++i)
+        buf[i] = c;
+}
+
+inline void Fill8888(uint32_t *buf, int count, uint32_t c)
+{
+    for (int i = 0; i < count; ++i)
+        buf[i] = c;
+}
+
+// 50% blend, channel-wise, as the software renderer does for translucent fills
+inline void Blend565(uint16_t *buf, int count, uint16_t c)
+{
+    for (int i = 0; i < count; ++i)
+        buf[i] = static_cast<uint16_t>(((buf[i] & 0xF7DE) >> 1) + ((c & 0xF7DE) >> 1));
+}
+
+inline void Blend8888(uint32_t *buf, int count, uint32_t c)
+{
+    for (int i = 0; i < count; ++i)
+        buf[i] = ((buf[i] & 0xFEFEFEFE) >> 1) + ((c & 0xFEFEFEFE) >> 1);
+}
+
+
+} // namespace
+
+CUCKOO_BENCH(pixel_fill)
+{
+    std::vector<uint16_t> b16(Pixels);
+    std::vector<uint32_t> b32(Pixels);
+    const int frames = 200 * ctx.Scale();
+
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int f = 0; f < frames; ++f)
+        Fill565(b16.data(), Pixels, static_cast<uint16_t>(f));
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    for (int f = 0; f < frames; ++f)
+        Fill8888(b32.data(), Pixels, static_cast<uint32_t>(f));
+    uint64_t t2 = cuckoo_bench::Context::NowNs();
+    cuckoo_bench::DoNotOptimize(b16.data());
+    cuckoo_bench::DoNotOptimize(b32.data());
+
+    double mpix16 = (double)Pixels * frames / ((t1 - t0) / 1e3);
+    double mpix32 = (double)Pixels * frames / ((t2 - t1) / 1e3);
+    ctx.Report("fill rgb565", mpix16, "Mpix/s");
+    ctx.Report("fill xrgb8888", mpix32, "Mpix/s");
+    ctx.Report("fill speedup 565/8888", mpix16 / mpix32, "x");
+}
+
+CUCKOO_BENCH(pixel_convert)
+{
+    std::vector<uint16_t> src(Pixels);
+    std::vector<uint32_t> dst(Pixels);
+    for (int i = 0; i < Pixels; ++i)
+        src[i] = static_cast<uint16_t>(i * 2654435761u >> 16);
+    const int frames = 200 * ctx.Scale();
+
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int f = 0; f < frames; ++f)
+        PixelConvert::Rgb565ToXrgb8888Scalar(src.data(), dst.data(), Pixels);
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    for (int f = 0; f < frames; ++f)
+        PixelConvert::Rgb565ToXrgb8888(src.data(), dst.data(), Pixels);
+    uint64_t t2 = cuckoo_bench::Context::NowNs();
+    cuckoo_bench::DoNotOptimize(dst.data());
+
+    ctx.Report("convert scalar", (double)Pixels * frames / ((t1 - t0) / 1e3), "Mpix/s");
+    ctx.Report(PixelConvert::HasNeon() ? "convert neon" : "convert (no neon)",
+        (double)Pixels * frames / ((t2 - t1) / 1e3), "Mpix/s");
+}
+
+CUCKOO_BENCH(pixel_pipeline)
+{
+    // Framebuffers for both panel depths, plus render buffers for both depths
+    std::vector<uint16_t> fb16(Pixels), r16(Pixels);
+    std::vector<uint32_t> fb32(Pixels), r32(Pixels);
+    const int frames = 200 * ctx.Scale();
+    const int overlay = Pixels / 3;
+
+    // XRGB8888 render, XRGB8888 panel
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int f = 0; f < frames; ++f)
+    {
+        Fill8888(r32.data(), Pixels, 0xFF101010u + f);
+        Blend8888(r32.data() + Pixels / 3, overlay, 0xFFFF8000u);
+        std::memcpy(fb32.data(), r32.data(), Pixels * 4);
+    }
+    // RGB565 render, RGB565 panel
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    for (int f = 0; f < frames; ++f)
+    {
+        Fill565(r16.data(), Pixels, static_cast<uint16_t>(0x1082 + f));
+        Blend565(r16.data() + Pixels / 3, overlay, 0xFC00);
+        std::memcpy(fb16.data(), r16.data(), Pixels * 2);
+    }
+    // RGB565 render, XRGB8888 panel (widened during flush)
+    uint64_t t2 = cuckoo_bench::Context::NowNs();
+    for (int f = 0; f < frames; ++f)
+    {
+        Fill565(r16.data(), Pixels, static_cast<uint16_t>(0x1082 + f));
+        Blend565(r16.data() + Pixels / 3, overlay, 0xFC00);
+        PixelConvert::Rgb565ToXrgb8888(r16.data(), fb32.data(), Pixels);
+    }
+    uint64_t t3 = cuckoo_bench::Context::NowNs();
+    cuckoo_bench::DoNotOptimize(fb16.data());
+    cuckoo_bench::DoNotOptimize(fb32.data());
+
+    double fps32 = frames / ((t1 - t0) / 1e9);
+    double fps16 = frames / ((t2 - t1) / 1e9);
+    double fps16c = frames / ((t3 - t2) / 1e9);
+    ctx.Report("xrgb8888 render+flush", fps32, "frames/s");
+    ctx.Report("rgb565 render+flush", fps16, "frames/s");
+    ctx.Report("rgb565 render+convert flush", fps16c, "frames/s");
+    ctx.Report("speedup rgb565 panel", fps16 / fps32, "x");
+    ctx.Report("speedup rgb565 on 32-bit panel", fps16c / fps32, "x");
+}
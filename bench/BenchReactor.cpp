@@ -0,0 +1,84 @@
+// Idle cost of the two main loop designs. reactor_threaded mimics the
+// threaded mode: comms and input threads sleeping 10 ms between polls and the
+// UI loop 5 ms. reactor_epoll is reactor mode with only its steady timers
+// armed: the LVGL refresh every 33 ms and the 15 s keepalive. Both report the
+// process's context switches and the loops' wakeups per second.
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "Bench.hpp"
+#include "Reactor.hpp"
+#include "TimerService.hpp"
+
+static long ContextSwitches()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+static void ReportRates(cuckoo_bench::Context &ctx, long switches, uint64_t wakeups, uint64_t elapsed_ns)
+{
+    double seconds = static_cast<double>(elapsed_ns) / 1000000000.0;
+    ctx.Report("context switches", switches / seconds, "/s");
+    ctx.Report("wakeups", wakeups / seconds, "/s");
+}
+
+CUCKOO_BENCH(reactor_threaded)
+{
+    const uint64_t duration_ns = TimerService::Sec(1) * ctx.Scale();
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> wakeups(0);
+
+    long switches0 = ContextSwitches();
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    std::vector<std::thread> threads;
+    const int sleeps_us[] = { 10000, 10000 };
+    for (int sleep_us : sleeps_us)
+    {
+        threads.push_back(std::thread([&stop, &wakeups, sleep_us]() {
+            while (!stop.load())
+            {
+                wakeups++;
+                usleep(sleep_us);
+            }
+        }));
+    }
+    while (cuckoo_bench::Context::NowNs() - t0 < duration_ns)
+    {
+        wakeups++;
+        usleep(5000);
+    }
+    stop.store(true);
+    for (auto &thread : threads)
+        thread.join();
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+
+    ReportRates(ctx, ContextSwitches() - switches0, wakeups.load(), t1 - t0);
+}
+
+CUCKOO_BENCH(reactor_epoll)
+{
+    const uint64_t duration_ns = TimerService::Sec(1) * ctx.Scale();
+    TimerService timers;
+    Reactor reactor;
+    reactor.AddTimers(timers);
+
+    int frames = 0;
+    timers.ScheduleEvery(TimerService::Ms(33), [&frames]() { frames++; });
+    timers.ScheduleEvery(TimerService::Sec(15), []() {});
+    timers.ScheduleAfter(duration_ns, [&reactor]() { reactor.Stop(); });
+
+    long switches0 = ContextSwitches();
+    uint64_t wakeups0 = reactor.Wakeups();
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    reactor.Run();
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+
+    ReportRates(ctx, ContextSwitches() - switches0, reactor.Wakeups() - wakeups0, t1 - t0);
+    ctx.Report("frames", frames / (static_cast<double>(t1 - t0) / 1000000000.0), "/s");
+}
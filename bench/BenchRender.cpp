@@ -0,0 +1,255 @@
+// Render cost of each screen type on the headless LVGL backend.
+// Every benchmark focuses one screen, feeds it a scripted input sequence and
+// steps virtual time one refresh period per frame, so runs are repeatable.
+// Reported per screen: frame time percentiles (input handling + timers +
+// render), invalidated pixels per frame, peak LVGL object count and LVGL heap
+// use. With --dump-dir DIR every rendered frame is written as a PNG for diffs.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <json11.hpp>
+
+#include "Bench.hpp"
+#include "PngWriter.hpp"
+#include "logger.h"
+#include "lvgl/lvgl.h"
+
+#include "HAL/HAL.hpp"
+#include "HAL/HeadlessDisplay.hpp"
+#include "ScreenManager.hpp"
+#include "Integrations/IntegrationContainer.hpp"
+#include "Screens/HomeScreen.hpp"
+#include "Screens/MenuScreen.hpp"
+#include "Screens/AnalogClockScreen.hpp"
+#include "Screens/SwitchScreen.hpp"
+#include "Screens/DimmerScreen.hpp"
+
+namespace {
+
+const uint32_t FrameMs = LV_DEF_REFR_PERIOD;
+
+struct ScriptedInput
+{
+    int frame;
+    InputDeviceType device;
+    struct input_event event;
+};
+
+struct input_event MakeEvent(uint16_t type, uint16_t code, int32_t value)
+{
+    struct input_event event;
+    memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    return event;
+}
+
+// Rotary detents of `value` every `every` frames from `first` to `last`
+void AddRotary(std::vector<ScriptedInput> &script, int first, int last, int every, int32_t value)
+{
+    for (int f = first; f < last; f += every)
+    {
+        ScriptedInput input = { f, InputDeviceType::ROTARY, MakeEvent(EV_REL, 0, value) };
+        script.push_back(input);
+    }
+}
+
+HeadlessDisplay *SharedDisplay()
+{
+    // LVGL is initialised once per process; every benchmark reuses the display
+    static std::unique_ptr<HeadlessDisplay> display;
+    if (!display)
+    {
+        cuckoo_log::Logger::set_level(cuckoo_log::Level::Warn);
+        display.reset(new HeadlessDisplay());
+        if (!display->Initialize(false))
+            std::fprintf(stderr, "headless display initialisation failed\n");
+    }
+    return display.get();
+}
+
+size_t CountObjects(lv_obj_t *obj)
+{
+    size_t count = 1;
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; ++i)
+        count += CountObjects(lv_obj_get_child(obj, i));
+    return count;
+}
+
+uint64_t Percentile(const std::vector<uint64_t> &sorted, int pct)
+{
+    if (sorted.empty())
+        return 0;
+    size_t index = (sorted.size() - 1) * pct / 100;
+    return sorted[index];
+}
+
+// Bundles the objects a screen needs to be constructed outside main()
+class RenderRig
+{
+public:
+    RenderRig()
+        : manager_(&hal_, &integrations_, nullptr)
+    {
+        hal_.display = SharedDisplay();
+    }
+
+    inline ScreenManager *Manager() { return &manager_; }
+
+    void Run(cuckoo_bench::Context &ctx, ScreenBase *screen, int frames, const std::vector<ScriptedInput> &script)
+    {
+        HeadlessDisplay *display = SharedDisplay();
+        std::string id = screen->GetId();
+        manager_.AddScreen(std::unique_ptr<ScreenBase>(screen));
+        manager_.GoToFirstScreen(id);
+
+        std::vector<uint64_t> frameNs;
+        std::vector<uint64_t> framePixels;
+        std::vector<uint8_t> rgb;
+        size_t maxObjects = 0;
+        size_t peakHeap = 0;
+        size_t next = 0;
+
+        for (int f = 0; f < frames; ++f)
+        {
+            uint64_t renderedBefore = display->GetFrameStats().frames;
+            uint64_t t0 = cuckoo_bench::Context::NowNs();
+            for (; next < script.size() && script[next].frame <= f; ++next)
+                manager_.ProcessInputEvent(script[next].device, script[next].event);
+            display->AdvanceTime(FrameMs);
+            display->TimerHandler();
+            uint64_t t1 = cuckoo_bench::Context::NowNs();
+
+            lv_mem_monitor_t mon;
+            lv_mem_monitor(&mon);
+            peakHeap = std::max(peakHeap, mon.total_size - mon.free_size);
+            maxObjects = std::max(maxObjects, CountObjects(lv_screen_active()));
+
+            if (display->GetFrameStats().frames == renderedBefore)
+                continue;
+            frameNs.push_back(t1 - t0);
+            framePixels.push_back(display->GetFrameStats().last_frame_pixels);
+
+            if (!ctx.DumpDir().empty())
+            {
+                char path[512];
+                snprintf(path, sizeof(path), "%s/%s_%04d.png", ctx.DumpDir().c_str(), ctx.Name().c_str(), f);
+                display->CopyRgb888(rgb);
+                if (!cuckoo_bench::WritePng(path, display->width(), display->height(), rgb))
+                    std::fprintf(stderr, "failed to write %s\n", path);
+            }
+        }
+
+        // Stop the screen's timers before its objects go away
+        screen->OnChangeFocus(false);
+        lv_obj_clean(lv_screen_active());
+        display->TimerHandler();
+
+        std::vector<uint64_t> sorted(frameNs);
+        std::sort(sorted.begin(), sorted.end());
+        uint64_t totalPixels = 0;
+        uint64_t maxPixels = 0;
+        for (uint64_t px : framePixels)
+        {
+            totalPixels += px;
+            maxPixels = std::max(maxPixels, px);
+        }
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+
+        ctx.Report("frames_rendered", frameNs.size(), "frames");
+        ctx.Report("frame_p50", Percentile(sorted, 50) / 1000.0, "us");
+        ctx.Report("frame_p90", Percentile(sorted, 90) / 1000.0, "us");
+        ctx.Report("frame_p99", Percentile(sorted, 99) / 1000.0, "us");
+        ctx.Report("frame_max", (sorted.empty() ? 0 : sorted.back()) / 1000.0, "us");
+        ctx.Report("invalidated_px_avg", frameNs.empty() ? 0.0 : static_cast<double>(totalPixels) / frameNs.size(), "px/frame");
+        ctx.Report("invalidated_px_max", maxPixels, "px/frame");
+        ctx.Report("objects_max", maxObjects, "objects");
+        ctx.Report("lvgl_heap_peak", peakHeap / 1024.0, "KiB");
+        ctx.Report("lvgl_heap_high_water", mon.max_used / 1024.0, "KiB (process)");
+    }
+
+private:
+    HAL hal_;
+    IntegrationContainer integrations_;
+    ScreenManager manager_;
+};
+
+json11::Json ScreenJson(const std::string &name)
+{
+    return json11::Json(json11::Json::object { { "name", name }, { "id", name } });
+}
+
+void RunMenu(cuckoo_bench::Context &ctx, int items)
+{
+    static const MenuIcon icons[] = {
+        MenuIcon::HOME, MenuIcon::LIGHT, MenuIcon::FAN, MenuIcon::TEMPERATURE,
+        MenuIcon::SETTINGS, MenuIcon::WIFI, MenuIcon::BELL, MenuIcon::NONE,
+    };
+    RenderRig rig;
+    MenuScreen *menu = new MenuScreen(rig.Manager(), ScreenJson("menu"));
+    for (int i = 0; i < items; ++i)
+        menu->AddMenuItem(MenuItem("Item " + std::to_string(i), "", icons[i % 8]));
+
+    // Spin through the whole list and back, a detent every other frame
+    const int frames = 120 * ctx.Scale();
+    std::vector<ScriptedInput> script;
+    AddRotary(script, 0, frames / 2, 2, -50);
+    AddRotary(script, frames / 2, frames, 2, 50);
+    rig.Run(ctx, menu, frames, script);
+}
+
+} // namespace
+
+CUCKOO_BENCH(render_home)
+{
+    // Idle home screen: the 250 ms timer redraws time and sensor values
+    RenderRig rig;
+    rig.Run(ctx, new HomeScreen(rig.Manager(), ScreenJson("home")), 300 * ctx.Scale(), std::vector<ScriptedInput>());
+}
+
+CUCKOO_BENCH(render_menu_4)
+{
+    RunMenu(ctx, 4);
+}
+
+CUCKOO_BENCH(render_menu_16)
+{
+    RunMenu(ctx, 16);
+}
+
+CUCKOO_BENCH(render_analog_clock)
+{
+    // Intro animation followed by steady-state hand updates
+    RenderRig rig;
+    rig.Run(ctx, new AnalogClockScreen(rig.Manager(), ScreenJson("clock")), 300 * ctx.Scale(), std::vector<ScriptedInput>());
+}
+
+CUCKOO_BENCH(render_switch)
+{
+    // Move the selection between toggle and back
+    RenderRig rig;
+    const int frames = 120 * ctx.Scale();
+    std::vector<ScriptedInput> script;
+    for (int f = 0; f < frames; f += 10)
+    {
+        ScriptedInput input = { f, InputDeviceType::ROTARY, MakeEvent(EV_REL, 0, (f / 10) % 2 ? 100 : -100) };
+        script.push_back(input);
+    }
+    rig.Run(ctx, new SwitchScreen(rig.Manager(), ScreenJson("switch")), frames, script);
+}
+
+CUCKOO_BENCH(render_dimmer)
+{
+    // Sweep the level down to 0% and back up, one detent per frame
+    RenderRig rig;
+    const int frames = 200 * ctx.Scale();
+    std::vector<ScriptedInput> script;
+    AddRotary(script, 0, frames / 2, 1, 50);
+    AddRotary(script, frames / 2, frames, 1, -50);
+    rig.Run(ctx, new DimmerScreen(rig.Manager(), ScreenJson("dimmer")), frames, script);
+}
@@ -0,0 +1,150 @@
+// Screen attribute access as the input and render paths do it: the typed
+// ScreenBase fields against the std::map<std::string, std::string> they
+// replaced (kept here as MapAttributes), plus a navigation step through the
+// resolved screen graph against a lookup by ID. "bytes per screen" is the
+// object plus its heap, for the four attributes of a typical switch screen.
+#include <malloc.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+#include "ScreenManager.hpp"
+#include "Screens/ScreenBase.hpp"
+#include "logger.h"
+
+namespace {
+
+const int Screens = 32;
+const int Accesses = 1000000;
+
+// ScreenBase's former storage, with the same getters
+class MapAttributes
+{
+public:
+    explicit MapAttributes(const json11::Json &jsonConfig)
+    {
+        for (const char *name : { "name", "id", "nextScreen", "integrationId" })
+        {
+            const json11::Json &value = jsonConfig[name];
+            attribs_[name] = value.is_number() ? std::to_string(value.int_value()) : value.string_value();
+        }
+    }
+    inline const std::string &GetId() const { return attribs_["id"]; }
+    inline const std::string &GetName() const { return attribs_["name"]; }
+    inline const std::string &GetIntegrationId() const { return attribs_["integrationId"]; }
+    inline const std::string &GetNextScreenId() const { return attribs_["nextScreen"]; }
+
+private:
+    mutable std::map<std::string, std::string> attribs_;
+};
+
+class BenchScreen : public ScreenBase
+{
+public:
+    BenchScreen(ScreenManager *screenManager, const json11::Json &jsonConfig) : ScreenBase(screenManager, jsonConfig) {}
+    void handle_input_event(const InputDeviceType, const struct input_event &) override {}
+};
+
+json11::Json ScreenJson(int i)
+{
+    return json11::Json::object {
+        { "id", 100 + i },
+        { "name", "Porch light " + std::to_string(i) },
+        { "nextScreen", 100 + (i + 1) % Screens },
+        { "integrationId", 200 + i },
+    };
+}
+
+// What a screen's input handler and Render read per event
+template <typename Screen>
+size_t TouchAttributes(const Screen &screen)
+{
+    return screen.GetId().size() + screen.GetName().size()
+        + (screen.GetNextScreenId() != "" ? 1 : 0) + screen.GetIntegrationId().size();
+}
+
+template <typename Screen>
+double AccessNs(const std::vector<std::unique_ptr<Screen>> &screens)
+{
+    size_t sum = 0;
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int i = 0; i < Accesses; ++i)
+        sum += TouchAttributes(*screens[i % Screens]);
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    cuckoo_bench::DoNotOptimize(&sum);
+    return static_cast<double>(t1 - t0) / Accesses;
+}
+
+size_t HeapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return mallinfo().uordblks;
+#endif
+}
+
+template <typename Screen, typename Make>
+double BytesPerScreen(Make make)
+{
+    const int count = 1000;
+    std::vector<std::unique_ptr<Screen>> screens;
+    screens.reserve(count);
+    size_t before = HeapInUse();
+    for (int i = 0; i < count; ++i)
+        screens.push_back(std::unique_ptr<Screen>(make(i)));
+    return static_cast<double>(HeapInUse() - before) / count;
+}
+
+} // namespace
+
+CUCKOO_BENCH(screen_attribute_access)
+{
+    std::vector<std::unique_ptr<MapAttributes>> mapped;
+    std::vector<std::unique_ptr<BenchScreen>> typed;
+    for (int i = 0; i < Screens; ++i)
+    {
+        mapped.push_back(std::unique_ptr<MapAttributes>(new MapAttributes(ScreenJson(i))));
+        typed.push_back(std::unique_ptr<BenchScreen>(new BenchScreen(nullptr, ScreenJson(i))));
+    }
+
+    double map_ns = 0, typed_ns = 0;
+    for (int round = 0; round < ctx.Scale(); ++round)
+    {
+        map_ns += AccessNs(mapped);
+        typed_ns += AccessNs(typed);
+    }
+    ctx.Report("map, 4 attributes", map_ns / ctx.Scale(), "ns");
+    ctx.Report("typed, 4 attributes", typed_ns / ctx.Scale(), "ns");
+
+    ctx.Report("map bytes per screen", BytesPerScreen<MapAttributes>([](int i) {
+        return new MapAttributes(ScreenJson(i)); }), "B");
+    ctx.Report("typed bytes per screen", BytesPerScreen<BenchScreen>([](int i) {
+        return new BenchScreen(nullptr, ScreenJson(i)); }), "B");
+}
+
+CUCKOO_BENCH(screen_navigation)
+{
+    // every step logs at info
+    cuckoo_log::Logger::set_level(cuckoo_log::Level::Warn);
+
+    ScreenManager manager(nullptr, nullptr, nullptr);
+    for (int i = 0; i < Screens; ++i)
+        manager.AddScreen(std::unique_ptr<ScreenBase>(new BenchScreen(&manager, ScreenJson(i))));
+    manager.GoToNextScreen("100");
+
+    const int steps = 200000 * ctx.Scale();
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int i = 0; i < steps; ++i)
+        manager.GoToNextScreen();
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    for (int i = 0; i < steps; ++i)
+        manager.GoToNextScreen(manager.GetCurrentScreen()->GetNextScreenId());
+    uint64_t t2 = cuckoo_bench::Context::NowNs();
+
+    ctx.Report("resolved link step", static_cast<double>(t1 - t0) / steps, "ns");
+    ctx.Report("lookup by ID step", static_cast<double>(t2 - t1) / steps, "ns");
+    ctx.Report("history entries", static_cast<double>(manager.CountHistory()), "");
+}
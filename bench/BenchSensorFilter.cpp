@@ -0,0 +1,85 @@
+// Backplate sensor filtering per TempHumidityData frame: the fixed-point
+// filters against a float EMA over the same samples, plus how many frames a
+// deadband lets through to subscribers. The input is a slow temperature ramp
+// with +-0.05 C of noise and a rare spike, in centi-degrees as the backplate
+// sends it. The float row is the cost the ARM build avoids; on a host with
+// hardware floating point the difference is small.
+#include <vector>
+
+#include "Bench.hpp"
+#include "Backplate/SensorFilter.hpp"
+#include "TimerService.hpp"
+
+namespace {
+
+const int Samples = 1 << 16;
+
+std::vector<int32_t> MakeSamples()
+{
+    std::vector<int32_t> samples;
+    samples.reserve(Samples);
+    uint32_t state = 2463534242u;
+    for (int i = 0; i < Samples; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        int32_t value = 2100 + i / 600 + static_cast<int32_t>(state % 11) - 5;
+        if (state % 997 == 0)
+            value += 300;
+        samples.push_back(value);
+    }
+    return samples;
+}
+
+template <typename Filter>
+double FilterNs(cuckoo_bench::Context &ctx, const std::vector<int32_t> &samples, Filter filter)
+{
+    int64_t sum = 0;
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int round = 0; round < ctx.Scale(); ++round)
+        for (int32_t sample : samples)
+            sum += filter(sample);
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    cuckoo_bench::DoNotOptimize(&sum);
+    return static_cast<double>(t1 - t0) / (static_cast<double>(samples.size()) * ctx.Scale());
+}
+
+} // namespace
+
+CUCKOO_BENCH(sensor_filter)
+{
+    std::vector<int32_t> samples = MakeSamples();
+
+    float state = 0.0f;
+    bool first = true;
+    ctx.Report("float ema", FilterNs(ctx, samples, [&](int32_t sample) {
+        float value = static_cast<float>(sample) / 100.0f;
+        state = first ? value : state + (value - state) * 0.25f;
+        first = false;
+        return static_cast<int32_t>(state * 100.0f);
+    }), "ns");
+
+    for (const char *kind : { "ema", "median", "kalman" })
+    {
+        SensorFilterConfig config;
+        config.filter = kind;
+        SensorFilter filter(config, 100);
+        ctx.Report(std::string(kind) + " (fixed point)", FilterNs(ctx, samples, [&](int32_t sample) {
+            return filter.Add(sample);
+        }), "ns");
+    }
+
+    // One frame a second, as the backplate sends them
+    for (const char *kind : { "none", "ema", "median", "kalman" })
+    {
+        SensorFilterConfig config;
+        config.filter = kind;
+        SensorFilter filter(config, 100);
+        DeadbandGate gate(10, TimerService::Sec(60));
+        int passed = 0;
+        for (int i = 0; i < Samples; ++i)
+            passed += gate.Pass(filter.Add(samples[i]), TimerService::Sec(i)) ? 1 : 0;
+        ctx.Report(std::string(kind) + ", 0.1 C deadband", 1000.0 * passed / Samples, "per 1000 frames");
+    }
+}
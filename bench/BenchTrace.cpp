@@ -0,0 +1,51 @@
+// Cost of a TRACE_SCOPE span: two clock reads and three stores into the
+// thread's ring, against an empty loop. trace_export times one Chrome JSON
+// export of a full ring, which runs on the HTTP server thread.
+#undef CUCKOO_TRACE
+#define CUCKOO_TRACE 1
+
+#include <sstream>
+
+#include "Bench.hpp"
+#include "trace.h"
+
+CUCKOO_BENCH(trace_span)
+{
+    const int calls = 1000000 * ctx.Scale();
+    int sink = 0;
+
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    for (int i = 0; i < calls; ++i)
+    {
+        sink += i;
+        cuckoo_bench::DoNotOptimize(&sink);
+    }
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+    for (int i = 0; i < calls; ++i)
+    {
+        TRACE_SCOPE("bench_span");
+        sink += i;
+        cuckoo_bench::DoNotOptimize(&sink);
+    }
+    uint64_t t2 = cuckoo_bench::Context::NowNs();
+
+    double empty = static_cast<double>(t1 - t0) / calls;
+    ctx.Report("loop overhead", empty, "ns/call");
+    ctx.Report("span", static_cast<double>(t2 - t1) / calls - empty, "ns/call");
+}
+
+CUCKOO_BENCH(trace_export)
+{
+    for (uint32_t i = 0; i < cuckoo_trace::TraceRing::Capacity; ++i)
+    {
+        TRACE_SCOPE("bench_export");
+    }
+
+    std::ostringstream out;
+    uint64_t t0 = cuckoo_bench::Context::NowNs();
+    cuckoo_trace::Tracer::write_chrome_json(out);
+    uint64_t t1 = cuckoo_bench::Context::NowNs();
+
+    ctx.Report("export", static_cast<double>(t1 - t0) / 1000000.0, "ms");
+    ctx.Report("json size", static_cast<double>(out.str().size()) / 1024.0, "KiB");
+}
@@ -0,0 +1,116 @@
+#include "PngWriter.hpp"
+
+#include <cstdio>
+
+namespace cuckoo_bench {
+
+namespace {
+
+uint32_t Crc32(const uint8_t *data, size_t len, uint32_t crc = 0)
+{
+    static uint32_t table[256];
+    static bool tableReady = false;
+    if (!tableReady)
+    {
+        for (uint32_t n = 0; n < 256; n++)
+        {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        tableReady = true;
+    }
+
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+void PutBE32(std::vector<uint8_t> &out, uint32_t v)
+{
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+void PutChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data)
+{
+    PutBE32(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    PutBE32(out, Crc32(&out[start], out.size() - start));
+}
+
+} // namespace
+
+bool WritePng(const std::string &path, int width, int height, const std::vector<uint8_t> &rgb)
+{
+    if (width <= 0 || height <= 0 || rgb.size() < static_cast<size_t>(width) * height * 3)
+        return false;
+
+    // Raw scanlines, each prefixed with filter type 0 (none)
+    size_t rowBytes = static_cast<size_t>(width) * 3;
+    std::vector<uint8_t> raw;
+    raw.reserve((rowBytes + 1) * height);
+    for (int y = 0; y < height; y++)
+    {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgb.begin() + y * rowBytes, rgb.begin() + (y + 1) * rowBytes);
+    }
+
+    // zlib stream of stored blocks, at most 65535 bytes each
+    std::vector<uint8_t> idat;
+    idat.push_back(0x78);
+    idat.push_back(0x01);
+    size_t offset = 0;
+    do
+    {
+        size_t len = raw.size() - offset;
+        if (len > 65535)
+            len = 65535;
+        bool final = (offset + len == raw.size());
+        idat.push_back(final ? 1 : 0);
+        idat.push_back(len & 0xFF);
+        idat.push_back(len >> 8);
+        idat.push_back(~len & 0xFF);
+        idat.push_back((~len >> 8) & 0xFF);
+        idat.insert(idat.end(), raw.begin() + offset, raw.begin() + offset + len);
+        offset += len;
+    } while (offset < raw.size());
+
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < raw.size(); i++)
+    {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    PutBE32(idat, (b << 16) | a);
+
+    std::vector<uint8_t> ihdr;
+    PutBE32(ihdr, width);
+    PutBE32(ihdr, height);
+    ihdr.push_back(8);  // bit depth
+    ihdr.push_back(2);  // color type: truecolor
+    ihdr.push_back(0);  // compression
+    ihdr.push_back(0);  // filter
+    ihdr.push_back(0);  // no interlace
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<uint8_t> png(signature, signature + 8);
+    PutChunk(png, "IHDR", ihdr);
+    PutChunk(png, "IDAT", idat);
+    PutChunk(png, "IEND", std::vector<uint8_t>());
+
+    FILE *f = std::fopen(path.c_str(), "wb");
+    if (f == NULL)
+        return false;
+    bool ok = (std::fwrite(png.data(), 1, png.size(), f) == png.size());
+    ok &= (std::fclose(f) == 0);
+    return ok;
+}
+
+} // namespace cuckoo_bench
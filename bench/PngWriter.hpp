@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cuckoo_bench {
+
+// Writes packed 8-bit RGB pixels as an uncompressed PNG (stored deflate blocks).
+// Frames are only dumped for regression diffs, so size does not matter and the
+// bench stays free of a zlib/libpng dependency.
+bool WritePng(const std::string &path, int width, int height, const std::vector<uint8_t> &rgb);
+
+} // namespace cuckoo_bench
@@ -0,0 +1,605 @@
+// Compact binary log records and the rotating segment files that hold them
+//
+// A line is stored as the id of its format string plus its raw arguments,
+// not as formatted text. Module names and format strings are written once per
+// segment, ahead of the first line that uses them, so every segment decodes
+// on its own. Segments are preallocated and reused round-robin, which bounds
+// the flash used by the log to segment_bytes * segment_count.
+//
+// Segment file layout, little endian:
+//   header (32 bytes): "CKLG", u16 version, u16 header size, u32 sequence,
+//                      u32 segment bytes, i64 base time (us since epoch), 8 reserved
+//   records, each starting with a tag byte:
+//     TagModule:       varint id, varint length, name
+//     TagFormat:       varint id, varint module id, varint length, format string
+//     TagLine | level: varint us since the previous line, varint length, payload
+//     TagEnd:          end of data (unwritten space reads as zero)
+//   payload: varint format id, then per argument a type byte and its value:
+//     'i' zigzag varint, 'u' varint, 'f' 8-byte double, 's' varint length + bytes
+//
+// tools/cuckoo_logdump turns segments back into text.
+#pragma once
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cuckoo_log {
+namespace binary {
+
+const char Magic[4] = { 'C', 'K', 'L', 'G' };
+const uint16_t Version = 1;
+const size_t HeaderSize = 32;
+
+const uint8_t TagEnd = 0x00;
+const uint8_t TagModule = 0x01;
+const uint8_t TagFormat = 0x02;
+const uint8_t TagLine = 0x10;   // | level
+const uint8_t LevelMask = 0x07;
+
+inline void put_varint(std::string &out, uint64_t v) {
+    while (v >= 0x80) {
+        out += static_cast<char>((v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+    out += static_cast<char>(v);
+}
+
+inline bool get_varint(const char *&p, const char *end, uint64_t &v) {
+    v = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(*p++);
+        v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+inline void put_bytes(std::string &out, const char *data, size_t len) {
+    put_varint(out, len);
+    out.append(data, len);
+}
+
+// Arguments of the printf-style macros; anything else a printf call accepts
+// (enums, bool, char) goes through the integer overloads
+inline void put_arg(std::string &out, const char *s) {
+    if (s == nullptr) s = "(null)";
+    out += 's';
+    put_bytes(out, s, std::strlen(s));
+}
+
+inline void put_arg(std::string &out, const void *p) {
+    out += 'u';
+    put_varint(out, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p)));
+}
+
+inline void put_arg(std::string &out, double v) {
+    char bytes[sizeof(double)];
+    std::memcpy(bytes, &v, sizeof(bytes));
+    out += 'f';
+    out.append(bytes, sizeof(bytes));
+}
+
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+put_arg(std::string &out, T v) {
+    if (std::is_enum<T>::value || std::is_signed<T>::value) {
+        int64_t s = static_cast<int64_t>(v);
+        out += 'i';
+        put_varint(out, (static_cast<uint64_t>(s) << 1) ^ static_cast<uint64_t>(s >> 63));
+    } else {
+        out += 'u';
+        put_varint(out, static_cast<uint64_t>(v));
+    }
+}
+
+inline void put_args(std::string &) {}
+
+template<typename T, typename... Rest>
+void put_args(std::string &out, const T &v, const Rest &... rest) {
+    put_arg(out, v);
+    put_args(out, rest...);
+}
+
+// Appends a printf conversion of one value
+inline void append_printf(std::string &out, const char *spec, ...) {
+    char buf[128];
+    va_list ap;
+    va_start(ap, spec);
+    int n = std::vsnprintf(buf, sizeof(buf), spec, ap);
+    va_end(ap);
+    if (n < 0) return;
+    if (static_cast<size_t>(n) < sizeof(buf)) {
+        out.append(buf, n);
+        return;
+    }
+    std::vector<char> heap(static_cast<size_t>(n) + 1);
+    va_start(ap, spec);
+    std::vsnprintf(&heap[0], heap.size(), spec, ap);
+    va_end(ap);
+    out.append(&heap[0], n);
+}
+
+// One decoded argument
+struct Arg {
+    char type = 0;
+    uint64_t u = 0;
+    double f = 0;
+    std::string s;
+
+    int64_t as_int() const {
+        if (type == 'i') return static_cast<int64_t>((u >> 1) ^ (~(u & 1) + 1));
+        if (type == 'f') return static_cast<int64_t>(f);
+        return static_cast<int64_t>(u);
+    }
+};
+
+inline bool get_arg(const char *&p, const char *end, Arg &arg) {
+    if (p >= end) return false;
+    arg.type = *p++;
+    switch (arg.type) {
+    case 'i':
+    case 'u':
+        return get_varint(p, end, arg.u);
+    case 'f':
+        if (end - p < static_cast<ptrdiff_t>(sizeof(double))) return false;
+        std::memcpy(&arg.f, p, sizeof(double));
+        p += sizeof(double);
+        return true;
+    case 's': {
+        uint64_t len;
+        if (!get_varint(p, end, len) || len > static_cast<uint64_t>(end - p)) return false;
+        arg.s.assign(p, static_cast<size_t>(len));
+        p += len;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// Splits a payload into its format id and encoded arguments
+inline bool split_payload(const char *data, size_t len, uint32_t &format_id, const char *&args, size_t &args_len) {
+    const char *p = data;
+    const char *end = data + len;
+    uint64_t id;
+    if (!get_varint(p, end, id) || id > UINT32_MAX) return false;
+    format_id = static_cast<uint32_t>(id);
+    args = p;
+    args_len = static_cast<size_t>(end - p);
+    return true;
+}
+
+// Formats the encoded arguments with a printf format string. Length
+// modifiers in the format are ignored: integers are stored widened to 64 bits.
+inline void render(const std::string &format, const char *args, size_t args_len, std::string &out) {
+    const char *p = args;
+    const char *end = args + args_len;
+    const char *f = format.c_str();
+    Arg arg;
+    while (*f) {
+        if (*f != '%') {
+            const char *next = std::strchr(f, '%');
+            size_t n = next ? static_cast<size_t>(next - f) : std::strlen(f);
+            out.append(f, n);
+            f += n;
+            continue;
+        }
+        if (f[1] == '%') {
+            out += '%';
+            f += 2;
+            continue;
+        }
+
+        // flags, width and precision are kept; '*' takes its value from the arguments
+        std::string spec = "%";
+        ++f;
+        while (*f && std::strchr("-+ #0", *f)) spec += *f++;
+        for (int part = 0; part < 2; ++part) {
+            if (part == 1) {
+                if (*f != '.') break;
+                spec += *f++;
+            }
+            if (*f == '*') {
+                ++f;
+                int star = get_arg(p, end, arg) ? static_cast<int>(arg.as_int()) : 0;
+                spec += std::to_string(star);
+            }
+            while (*f >= '0' && *f <= '9') spec += *f++;
+        }
+        while (*f && std::strchr("hlLqjzt", *f)) ++f;
+        char conv = *f;
+        if (conv == '\0') break;
+        ++f;
+
+        if (!get_arg(p, end, arg)) {
+            out += "<?>";
+            continue;
+        }
+        switch (conv) {
+        case 'd': case 'i':
+            append_printf(out, (spec + "lld").c_str(), static_cast<long long>(arg.as_int()));
+            break;
+        case 'o': case 'u': case 'x': case 'X':
+            append_printf(out, (spec + "ll" + conv).c_str(),
+                          static_cast<unsigned long long>(arg.type == 'u' ? arg.u : static_cast<uint64_t>(arg.as_int())));
+            break;
+        case 'c':
+            append_printf(out, (spec + "c").c_str(), static_cast<int>(arg.as_int()));
+            break;
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+            append_printf(out, (spec + conv).c_str(), arg.type == 'f' ? arg.f : static_cast<double>(arg.as_int()));
+            break;
+        case 's':
+            if (arg.type == 's') append_printf(out, (spec + "s").c_str(), arg.s.c_str());
+            else append_printf(out, "%lld", static_cast<long long>(arg.as_int()));
+            break;
+        case 'p':
+            append_printf(out, "%p", reinterpret_cast<void *>(static_cast<uintptr_t>(arg.u)));
+            break;
+        default:
+            out += "<?>";
+            break;
+        }
+    }
+}
+
+// Process-wide ids of modules and format strings. Entries are never removed,
+// so the pointers returned stay valid.
+class Registry {
+public:
+    struct Format {
+        uint32_t module;
+        std::string text;
+    };
+
+    static Registry &instance() {
+        static Registry *registry = new Registry();
+        return *registry;
+    }
+
+    uint32_t module_id(const std::string &name) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return module_id_locked(name);
+    }
+
+    uint32_t format_id(const std::string &module, const char *format) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        std::pair<uint32_t, std::string> key(module_id_locked(module), format);
+        auto it = format_ids_.find(key);
+        if (it != format_ids_.end()) return it->second;
+        uint32_t id = static_cast<uint32_t>(formats_.size());
+        Format entry = { key.first, key.second };
+        formats_.push_back(entry);
+        format_ids_[key] = id;
+        return id;
+    }
+
+    const Format *format(uint32_t id) const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return id < formats_.size() ? &formats_[id] : nullptr;
+    }
+
+    const std::string *module(uint32_t id) const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return id < modules_.size() ? &modules_[id] : nullptr;
+    }
+
+private:
+    uint32_t module_id_locked(const std::string &name) {
+        auto it = module_ids_.find(name);
+        if (it != module_ids_.end()) return it->second;
+        uint32_t id = static_cast<uint32_t>(modules_.size());
+        modules_.push_back(name);
+        module_ids_[name] = id;
+        return id;
+    }
+
+    mutable std::mutex mutex_;
+    std::map<std::string, uint32_t> module_ids_;
+    std::deque<std::string> modules_;
+    std::map<std::pair<uint32_t, std::string>, uint32_t> format_ids_;
+    std::deque<Format> formats_;
+};
+
+// A printf-style log statement, registered once. Statements built with
+// operator<< log their text through the "%s" format of their module.
+struct FormatSite {
+    FormatSite(const char *module, const char *format)
+        : format(format),
+          id(Registry::instance().format_id(module, format)),
+          text_id(Registry::instance().format_id(module, "%s")) {}
+
+    const char *format;
+    uint32_t id;
+    uint32_t text_id;
+};
+
+// Renders a payload encoded in this process
+inline bool render_payload(const char *data, size_t len, std::string &out) {
+    uint32_t id;
+    const char *args;
+    size_t args_len;
+    if (!split_payload(data, len, id, args, args_len)) return false;
+    const Registry::Format *format = Registry::instance().format(id);
+    if (format == nullptr) return false;
+    render(format->text, args, args_len, out);
+    return true;
+}
+
+struct SegmentConfig {
+    size_t segment_bytes = 256 * 1024;
+    // Oldest segment is overwritten when all are full
+    int segment_count = 4;
+};
+
+inline std::string segment_path(const std::string &dir, int index) {
+    return dir + "/log." + std::to_string(index) + ".bin";
+}
+
+// Appends records to the current segment and moves on to the next one when
+// it is full. Records are buffered until flush(), which writes them with a
+// single pwrite followed by an end tag.
+class SegmentWriter {
+public:
+    SegmentWriter(const std::string &dir, const SegmentConfig &config)
+        : dir_(dir), config_(config), fd_(-1), sequence_(0), offset_(0), pending_offset_(0), last_time_us_(0) {
+        config_.segment_count = std::max(config_.segment_count, 1);
+        config_.segment_bytes = std::max(config_.segment_bytes, static_cast<size_t>(1024));
+    }
+
+    ~SegmentWriter() { close(); }
+
+    // Starts a new segment after the newest one already in the directory
+    bool open(int64_t time_us) {
+        ::mkdir(dir_.c_str(), 0755);
+        uint32_t newest = 0;
+        for (int i = 0; i < config_.segment_count; ++i) {
+            uint32_t sequence;
+            if (read_sequence(segment_path(dir_, i), sequence))
+                newest = std::max(newest, sequence);
+        }
+        sequence_ = newest;
+        return start_segment(time_us);
+    }
+
+    // Lines that cannot fit an empty segment are dropped
+    void append(uint8_t level, int64_t time_us, const char *payload, size_t len) {
+        if (fd_ < 0) return;
+        uint32_t format_id;
+        const char *args;
+        size_t args_len;
+        if (!split_payload(payload, len, format_id, args, args_len)) return;
+
+        std::string defs;
+        definitions(format_id, defs);
+        size_t line_max = 1 + 10 + 10 + len;
+        if (offset_ + defs.size() + line_max + 1 > config_.segment_bytes) {
+            flush(false);
+            if (!start_segment(time_us)) return;
+            defs.clear();
+            definitions(format_id, defs);
+            if (offset_ + defs.size() + line_max + 1 > config_.segment_bytes) return;
+        }
+
+        size_t before = pending_.size();
+        pending_ += defs;
+        pending_ += static_cast<char>(TagLine | (level & LevelMask));
+        put_varint(pending_, static_cast<uint64_t>(std::max<int64_t>(time_us - last_time_us_, 0)));
+        put_bytes(pending_, payload, len);
+        offset_ += pending_.size() - before;
+        last_time_us_ = std::max(time_us, last_time_us_);
+        mark_defined(format_id);
+    }
+
+    void flush(bool sync) {
+        if (fd_ < 0) return;
+        if (!pending_.empty()) {
+            pending_ += static_cast<char>(TagEnd);
+            write_at(pending_.data(), pending_.size(), pending_offset_);
+            pending_.clear();
+            pending_offset_ = offset_;
+        }
+        if (sync) ::fdatasync(fd_);
+    }
+
+    void close() {
+        if (fd_ < 0) return;
+        flush(false);
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    uint32_t sequence() const { return sequence_; }
+
+private:
+    static bool read_sequence(const std::string &path, uint32_t &sequence) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        char header[HeaderSize];
+        bool ok = ::pread(fd, header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                  std::memcmp(header, Magic, sizeof(Magic)) == 0;
+        ::close(fd);
+        if (ok) std::memcpy(&sequence, header + 8, sizeof(sequence));
+        return ok;
+    }
+
+    bool start_segment(int64_t time_us) {
+        if (fd_ >= 0) ::close(fd_);
+        ++sequence_;
+        int index = static_cast<int>(sequence_ % static_cast<uint32_t>(config_.segment_count));
+        // not truncated: the blocks stay allocated, and stale records after the end tag are never read
+        fd_ = ::open(segment_path(dir_, index).c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ < 0) return false;
+#ifdef __linux__
+        if (::posix_fallocate(fd_, 0, static_cast<off_t>(config_.segment_bytes)) != 0)
+#endif
+            if (::ftruncate(fd_, static_cast<off_t>(config_.segment_bytes)) != 0) {
+                ::close(fd_);
+                fd_ = -1;
+                return false;
+            }
+
+        char header[HeaderSize];
+        std::memset(header, 0, sizeof(header));
+        uint32_t segment_bytes = static_cast<uint32_t>(config_.segment_bytes);
+        uint16_t header_size = static_cast<uint16_t>(HeaderSize);
+        std::memcpy(header, Magic, sizeof(Magic));
+        std::memcpy(header + 4, &Version, sizeof(Version));
+        std::memcpy(header + 6, &header_size, sizeof(header_size));
+        std::memcpy(header + 8, &sequence_, sizeof(sequence_));
+        std::memcpy(header + 12, &segment_bytes, sizeof(segment_bytes));
+        std::memcpy(header + 16, &time_us, sizeof(time_us));
+
+        pending_.assign(header, sizeof(header));
+        pending_offset_ = 0;
+        offset_ = HeaderSize;
+        last_time_us_ = time_us;
+        modules_defined_.clear();
+        formats_defined_.clear();
+        return true;
+    }
+
+    // Module and format records the segment still lacks for this format id
+    void definitions(uint32_t format_id, std::string &out) const {
+        if (is_set(formats_defined_, format_id)) return;
+        const Registry::Format *format = Registry::instance().format(format_id);
+        if (format == nullptr) return;
+        if (!is_set(modules_defined_, format->module)) {
+            const std::string *name = Registry::instance().module(format->module);
+            out += static_cast<char>(TagModule);
+            put_varint(out, format->module);
+            put_bytes(out, name->data(), name->size());
+        }
+        out += static_cast<char>(TagFormat);
+        put_varint(out, format_id);
+        put_varint(out, format->module);
+        put_bytes(out, format->text.data(), format->text.size());
+    }
+
+    void mark_defined(uint32_t format_id) {
+        const Registry::Format *format = Registry::instance().format(format_id);
+        if (format == nullptr) return;
+        set(formats_defined_, format_id);
+        set(modules_defined_, format->module);
+    }
+
+    static bool is_set(const std::vector<bool> &bits, uint32_t i) { return i < bits.size() && bits[i]; }
+    static void set(std::vector<bool> &bits, uint32_t i) {
+        if (i >= bits.size()) bits.resize(i + 1, false);
+        bits[i] = true;
+    }
+
+    void write_at(const char *data, size_t len, size_t offset) {
+        while (len > 0) {
+            ssize_t n = ::pwrite(fd_, data, len, static_cast<off_t>(offset));
+            if (n <= 0) {
+                if (n < 0 && errno == EINTR) continue;
+                return;
+            }
+            data += n;
+            len -= static_cast<size_t>(n);
+            offset += static_cast<size_t>(n);
+        }
+    }
+
+    const std::string dir_;
+    SegmentConfig config_;
+    int fd_;
+    uint32_t sequence_;
+    size_t offset_;           // end of the data, including pending_
+    size_t pending_offset_;   // file offset of pending_
+    std::string pending_;
+    int64_t last_time_us_;
+    std::vector<bool> modules_defined_;
+    std::vector<bool> formats_defined_;
+};
+
+// A decoded line, for tools and tests
+struct Line {
+    int64_t time_us;
+    uint8_t level;
+    std::string module;
+    std::string text;
+};
+
+// Decodes one segment file with the definitions it carries. False when the
+// file is not a segment; a damaged record ends the segment early.
+inline bool read_segment(const std::string &path, uint32_t &sequence, std::vector<Line> &lines) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    std::string data;
+    char buf[16 * 1024];
+    ssize_t n;
+    while ((n = ::read(fd, buf, sizeof(buf))) > 0)
+        data.append(buf, static_cast<size_t>(n));
+    ::close(fd);
+    if (data.size() < HeaderSize || std::memcmp(data.data(), Magic, sizeof(Magic)) != 0) return false;
+
+    uint16_t version, header_size;
+    int64_t time_us;
+    std::memcpy(&version, &data[4], sizeof(version));
+    std::memcpy(&header_size, &data[6], sizeof(header_size));
+    std::memcpy(&sequence, &data[8], sizeof(sequence));
+    std::memcpy(&time_us, &data[16], sizeof(time_us));
+    if (version != Version || header_size < HeaderSize || header_size > data.size()) return false;
+
+    std::map<uint64_t, std::string> modules;
+    std::map<uint64_t, std::pair<uint64_t, std::string>> formats;
+    const char *p = data.data() + header_size;
+    const char *end = data.data() + data.size();
+    while (p < end) {
+        uint8_t tag = static_cast<uint8_t>(*p++);
+        uint64_t id, value, len;
+        if (tag == TagModule) {
+            if (!get_varint(p, end, id) || !get_varint(p, end, len) || len > static_cast<uint64_t>(end - p)) break;
+            modules[id].assign(p, static_cast<size_t>(len));
+            p += len;
+        } else if (tag == TagFormat) {
+            if (!get_varint(p, end, id) || !get_varint(p, end, value) || !get_varint(p, end, len) ||
+                len > static_cast<uint64_t>(end - p)) break;
+            formats[id] = std::make_pair(value, std::string(p, static_cast<size_t>(len)));
+            p += len;
+        } else if ((tag & ~LevelMask) == TagLine) {
+            if (!get_varint(p, end, value) || !get_varint(p, end, len) || len > static_cast<uint64_t>(end - p)) break;
+            time_us += static_cast<int64_t>(value);
+            Line line;
+            line.time_us = time_us;
+            line.level = tag & LevelMask;
+            uint32_t format_id;
+            const char *args;
+            size_t args_len;
+            auto format = formats.end();
+            if (split_payload(p, static_cast<size_t>(len), format_id, args, args_len))
+                format = formats.find(format_id);
+            if (format != formats.end()) {
+                line.module = modules[format->second.first];
+                render(format->second.second, args, args_len, line.text);
+            } else {
+                line.text = "<unknown format>";
+            }
+            lines.push_back(line);
+            p += len;
+        } else {
+            break;
+        }
+    }
+    return true;
+}
+
+} // namespace binary
+} // namespace cuckoo_log
@@ -1,7 +1,26 @@
 // Simple lightweight header-only logger for cuckoo_nest
+//
+// Logging is synchronous until Logger::start_async() is called. After that,
+// every thread appends its lines to its own lock-free ring buffer and a
+// background writer thread formats timestamps and writes the lines in
+// batches with writev().
+//
+// Logger::set_binary_sink() adds compact binary segment files (log_binary.h):
+// printf-style statements then store their raw arguments, and text is only
+// formatted for the console and the text file sink, on the writer thread.
+//
+// The LOG_* macros test the level before anything is formatted. Statements
+// below CUCKOO_LOG_MIN_LEVEL are compiled out; the rest are filtered at
+// runtime by the level of their module. A translation unit names its module
+// by defining CUCKOO_LOG_MODULE before its first include.
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
@@ -11,7 +30,26 @@
 #include <cstdlib>
 #include <cstdarg>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <thread>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "log_binary.h"
+
+// Levels below this never generate code (0 = trace ... 6 = off)
+#ifndef CUCKOO_LOG_MIN_LEVEL
+#define CUCKOO_LOG_MIN_LEVEL 0
+#endif
+
+#ifndef CUCKOO_LOG_MODULE
+#define CUCKOO_LOG_MODULE "app"
+#endif
 
 namespace cuckoo_log {
 
@@ -29,6 +67,511 @@ inline const char* level_name(Level l) {
     }
 }
 
+// Accepts the names printed by level_name(), in any case, plus "warning" and "off"
+inline bool parse_level(const std::string &text, Level &out) {
+    std::string s(text);
+    for (auto &c : s) c = static_cast<char>(tolower(c));
+    if (s == "trace") out = Level::Trace;
+    else if (s == "debug") out = Level::Debug;
+    else if (s == "info") out = Level::Info;
+    else if (s == "warn" || s == "warning") out = Level::Warn;
+    else if (s == "error") out = Level::Error;
+    else if (s == "critical") out = Level::Critical;
+    else if (s == "off") out = Level::Off;
+    else return false;
+    return true;
+}
+
+class Logger;
+
+// Runtime level of one module. Follows the global level until the module is
+// given its own with Logger::set_module_level(). Checking it is one relaxed
+// load, so a disabled statement costs a compare and a branch.
+class ModuleLevel {
+public:
+    ModuleLevel(const std::string &name, Level global)
+        : name_(name), threshold_(static_cast<int>(global)), override_(-1) {}
+
+    bool enabled(Level lv) const {
+        return static_cast<int>(lv) >= threshold_.load(std::memory_order_relaxed);
+    }
+
+    const std::string &name() const { return name_; }
+    Level level() const { return static_cast<Level>(threshold_.load(std::memory_order_relaxed)); }
+    bool overridden() const { return override_ >= 0; }
+
+private:
+    friend class Logger;
+
+    const std::string name_;
+    std::atomic<int> threshold_;
+    int override_;  // -1 while following the global level; guarded by the module registry mutex
+};
+
+// When the async writer pushes lines out
+struct FlushPolicy {
+    // Longest a line waits in its ring before the writer wakes up on its own
+    int interval_ms = 100;
+    // Lines at or above this level wake the writer at once and are fdatasync'ed to the file sink
+    Level sync_level = Level::Error;
+};
+
+// Counters of the async backend, summed over all threads
+struct AsyncStats {
+    uint64_t enqueued = 0;  // lines accepted into a ring
+    uint64_t dropped = 0;   // lines lost because their ring was full
+    uint64_t written = 0;   // lines written by the writer thread
+    uint64_t batches = 0;   // writer passes that wrote at least one line
+};
+
+namespace detail {
+
+inline int64_t realtime_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Writes every iovec, retrying short writes and EINTR
+inline void write_all(int fd, struct iovec *iov, int count) {
+    while (count > 0) {
+        ssize_t n = ::writev(fd, iov, std::min(count, IOV_MAX));
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            return;
+        }
+        while (n > 0 && count > 0) {
+            if (static_cast<size_t>(n) >= iov->iov_len) {
+                n -= iov->iov_len;
+                ++iov;
+                --count;
+            } else {
+                iov->iov_base = static_cast<char *>(iov->iov_base) + n;
+                iov->iov_len -= n;
+                n = 0;
+            }
+        }
+        while (count > 0 && iov->iov_len == 0) {
+            ++iov;
+            --count;
+        }
+    }
+}
+
+// Byte ring with one producer (the owning thread) and one consumer (the
+// writer thread). Records are 16-byte aligned: a header, then the message
+// and its newline. A record that would straddle the end of the buffer is
+// preceded by a wrap marker and starts again at offset 0.
+class LogRing {
+public:
+    static const size_t Capacity = 32 * 1024;   // power of two
+    static const size_t MaxMessage = Capacity / 4;
+    static const uint32_t WrapMarker = 0xFFFFFFFFu;
+    // Set in Record::level when the message is a binary payload, not text
+    static const uint32_t BinaryFlag = 0x100;
+    static const uint32_t LevelMask = 0xFF;
+
+    struct Record {
+        uint32_t length;    // message bytes including the newline
+        uint32_t level;
+        int64_t time_us;
+    };
+
+    LogRing() : enqueued(0), dropped(0), owned(true), head_(0), tail_(0) {}
+
+    // Never blocks; a full ring drops the line and counts it
+    bool push(Level level, int64_t time_us, const char *msg, size_t len, bool binary = false) {
+        if (len > MaxMessage - 1) len = MaxMessage - 1;
+        size_t size = align(sizeof(Record) + len + 1);
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t pos = head & (Capacity - 1);
+        size_t contiguous = Capacity - pos;
+        size_t needed = (size <= contiguous) ? size : contiguous + size;
+        if (Capacity - (head - tail) < needed) {
+            dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        if (size > contiguous) {
+            reinterpret_cast<Record *>(buf_ + pos)->length = WrapMarker;
+            head += contiguous;
+            pos = 0;
+        }
+        Record *record = reinterpret_cast<Record *>(buf_ + pos);
+        record->length = static_cast<uint32_t>(len + 1);
+        record->level = static_cast<uint32_t>(level) | (binary ? BinaryFlag : 0);
+        record->time_us = time_us;
+        char *text = buf_ + pos + sizeof(Record);
+        std::memcpy(text, msg, len);
+        text[len] = '\n';
+        head_.store(head + size, std::memory_order_release);
+        enqueued.store(enqueued.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    size_t used() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    // Consumer side: walk [read_begin(), read_end()) with next(), then release()
+    size_t read_begin() const { return tail_.load(std::memory_order_relaxed); }
+    size_t read_end() const { return head_.load(std::memory_order_acquire); }
+
+    const Record *next(size_t &pos, size_t end) const {
+        while (pos != end) {
+            size_t offset = pos & (Capacity - 1);
+            const Record *record = reinterpret_cast<const Record *>(buf_ + offset);
+            if (record->length == WrapMarker) {
+                pos += Capacity - offset;
+                continue;
+            }
+            pos += align(sizeof(Record) + record->length);
+            return record;
+        }
+        return nullptr;
+    }
+
+    static const char *text(const Record *record) { return reinterpret_cast<const char *>(record + 1); }
+
+    void release(size_t pos) { tail_.store(pos, std::memory_order_release); }
+
+    std::atomic<uint64_t> enqueued;
+    std::atomic<uint64_t> dropped;
+    // Cleared when the owning thread exits, so a new thread can take the ring over
+    std::atomic<bool> owned;
+
+private:
+    static size_t align(size_t n) { return (n + 15) & ~static_cast<size_t>(15); }
+
+    alignas(8) char buf_[Capacity];
+    std::atomic<size_t> head_;
+    std::atomic<size_t> tail_;
+};
+
+// Where lines go; shared by the synchronous path and the writer thread
+struct Outputs {
+    Outputs() : file_fd(-1), console(true), binary_enabled(false) {}
+
+    std::atomic<int> file_fd;   // text file sink, -1 when disabled
+    std::atomic<bool> console;
+    std::atomic<bool> binary_enabled;
+    // Guards binary, its use and its replacement
+    std::mutex binary_mutex;
+    std::unique_ptr<binary::SegmentWriter> binary;
+};
+
+// Drains the per-thread rings on a background thread
+class AsyncWriter {
+public:
+    static const int MaxThreads = 32;
+    static const int MaxBatch = 256;
+    static const size_t PrefixSize = 48;
+
+    AsyncWriter() : running_(false), ring_count_(0), outputs_(nullptr), stopping_(false), wake_pending_(false),
+                    written_(0), batches_(0), reported_drops_(0), cached_second_(-1) {
+        for (int i = 0; i < MaxThreads; ++i)
+            rings_[i].store(nullptr, std::memory_order_relaxed);
+        std::memset(cached_time_, 0, sizeof(cached_time_));
+    }
+
+    ~AsyncWriter() { stop(); }
+
+    bool running() const { return running_.load(std::memory_order_acquire); }
+
+    void start(const FlushPolicy &policy, Outputs *outputs) {
+        std::lock_guard<std::mutex> lk(control_mutex_);
+        if (running()) return;
+        policy_ = policy;
+        outputs_ = outputs;
+        stopping_ = false;
+        thread_ = std::thread(&AsyncWriter::run, this);
+        running_.store(true, std::memory_order_release);
+    }
+
+    // Writes out everything still queued, then joins the writer
+    void stop() {
+        std::lock_guard<std::mutex> lk(control_mutex_);
+        if (!running()) return;
+        {
+            std::lock_guard<std::mutex> wlk(wake_mutex_);
+            stopping_ = true;
+        }
+        // new lines go the synchronous way from here on
+        running_.store(false, std::memory_order_release);
+        wake_cv_.notify_one();
+        thread_.join();
+        // lines queued while the writer was finishing; this thread is the only consumer now
+        drain();
+    }
+
+    // False when there is no ring for this thread; the caller logs synchronously then
+    bool enqueue(Level level, const char *msg, size_t len, bool binary = false) {
+        LogRing *ring = thread_ring();
+        if (ring == nullptr) return false;
+        ring->push(level, realtime_us(), msg, len, binary);
+        if (level >= policy_.sync_level || ring->used() > LogRing::Capacity / 2)
+            wake();
+        return true;
+    }
+
+    // Blocks until every line queued before the call has been written
+    void flush() {
+        if (!running()) return;
+        for (int attempt = 0; attempt < 1000 && pending(); ++attempt) {
+            wake();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    AsyncStats stats() const {
+        AsyncStats s;
+        int count = ring_count_.load(std::memory_order_acquire);
+        for (int i = 0; i < count; ++i) {
+            const LogRing *ring = rings_[i].load(std::memory_order_acquire);
+            s.enqueued += ring->enqueued.load(std::memory_order_relaxed);
+            s.dropped += ring->dropped.load(std::memory_order_relaxed);
+        }
+        s.written = written_.load(std::memory_order_relaxed);
+        s.batches = batches_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    struct Entry {
+        int64_t time_us;
+        const LogRing::Record *record;
+    };
+
+    // Rings are never freed: threads are few and long-lived, and a ring left
+    // behind by an exited thread is reused by the next new one
+    LogRing *thread_ring() {
+        struct Handle {
+            LogRing *ring = nullptr;
+            ~Handle() { if (ring) ring->owned.store(false, std::memory_order_release); }
+        };
+        static thread_local Handle handle;
+        if (handle.ring) return handle.ring;
+
+        std::lock_guard<std::mutex> lk(register_mutex_);
+        int count = ring_count_.load(std::memory_order_relaxed);
+        for (int i = 0; i < count; ++i) {
+            LogRing *ring = rings_[i].load(std::memory_order_relaxed);
+            bool expected = false;
+            if (ring->owned.compare_exchange_strong(expected, true)) {
+                handle.ring = ring;
+                return ring;
+            }
+        }
+        if (count == MaxThreads) return nullptr;
+        LogRing *ring = new LogRing();
+        rings_[count].store(ring, std::memory_order_release);
+        ring_count_.store(count + 1, std::memory_order_release);
+        handle.ring = ring;
+        return ring;
+    }
+
+    void wake() {
+        {
+            std::lock_guard<std::mutex> lk(wake_mutex_);
+            wake_pending_ = true;
+        }
+        wake_cv_.notify_one();
+    }
+
+    bool pending() const {
+        int count = ring_count_.load(std::memory_order_acquire);
+        for (int i = 0; i < count; ++i)
+            if (rings_[i].load(std::memory_order_acquire)->used() != 0) return true;
+        return false;
+    }
+
+    void run() {
+        while (true) {
+            bool stopping;
+            {
+                std::unique_lock<std::mutex> lk(wake_mutex_);
+                wake_cv_.wait_for(lk, std::chrono::milliseconds(policy_.interval_ms),
+                                  [this] { return wake_pending_ || stopping_; });
+                wake_pending_ = false;
+                stopping = stopping_;
+            }
+            drain();
+            report_drops();
+            if (stopping) break;
+        }
+    }
+
+    // Cached "YYYY-MM-DD HH:MM:SS"; localtime_r and strftime run once per second
+    size_t format_prefix(char *out, int64_t time_us, Level level) {
+        time_t second = static_cast<time_t>(time_us / 1000000);
+        if (second != cached_second_) {
+            std::tm tm{};
+            localtime_r(&second, &tm);
+            if (std::strftime(cached_time_, sizeof(cached_time_), "%Y-%m-%d %H:%M:%S", &tm) == 0)
+                cached_time_[0] = '\0';
+            cached_second_ = second;
+        }
+        int ms = static_cast<int>((time_us / 1000) % 1000);
+        size_t n = std::strlen(cached_time_);
+        std::memcpy(out, cached_time_, n);
+        out[n++] = '.';
+        out[n++] = static_cast<char>('0' + ms / 100);
+        out[n++] = static_cast<char>('0' + ms / 10 % 10);
+        out[n++] = static_cast<char>('0' + ms % 10);
+        out[n++] = ' ';
+        out[n++] = '[';
+        const char *name = level_name(level);
+        size_t name_len = std::strlen(name);
+        std::memcpy(out + n, name, name_len);
+        n += name_len;
+        out[n++] = ']';
+        out[n++] = ' ';
+        return n;
+    }
+
+    void drain() {
+        std::vector<Entry> entries;
+        std::vector<char> prefixes(MaxBatch * PrefixSize);
+        std::vector<struct iovec> out_iov, err_iov, file_iov;
+        std::vector<std::string> texts;
+        size_t ends[MaxThreads];
+
+        while (true) {
+            entries.clear();
+            int count = ring_count_.load(std::memory_order_acquire);
+            for (int i = 0; i < count; ++i) {
+                const LogRing *ring = rings_[i].load(std::memory_order_acquire);
+                size_t pos = ring->read_begin();
+                size_t end = ring->read_end();
+                const LogRing::Record *record;
+                while (entries.size() < static_cast<size_t>(MaxBatch) && (record = ring->next(pos, end)) != nullptr) {
+                    Entry entry = { record->time_us, record };
+                    entries.push_back(entry);
+                }
+                ends[i] = pos;
+            }
+            if (entries.empty()) return;
+
+            // lines from different threads come out in time order
+            std::stable_sort(entries.begin(), entries.end(),
+                             [](const Entry &a, const Entry &b) { return a.time_us < b.time_us; });
+
+            int file_fd = outputs_->file_fd.load(std::memory_order_acquire);
+            bool console = outputs_->console.load(std::memory_order_relaxed);
+            bool sync = false;
+            out_iov.clear();
+            err_iov.clear();
+            file_iov.clear();
+            texts.clear();
+            // iovecs point into texts, which must not reallocate
+            texts.reserve(entries.size());
+
+            std::unique_lock<std::mutex> binary_lock(outputs_->binary_mutex, std::defer_lock);
+            binary::SegmentWriter *segments = nullptr;
+            if (outputs_->binary_enabled.load(std::memory_order_acquire)) {
+                binary_lock.lock();
+                segments = outputs_->binary.get();
+            }
+
+            for (size_t i = 0; i < entries.size(); ++i) {
+                const LogRing::Record *record = entries[i].record;
+                Level level = static_cast<Level>(record->level & LogRing::LevelMask);
+                if (level >= policy_.sync_level)
+                    sync = true;
+
+                struct iovec line[2];
+                line[1].iov_base = const_cast<char *>(LogRing::text(record));
+                line[1].iov_len = record->length;
+                if (record->level & LogRing::BinaryFlag) {
+                    // the ring added a newline after the payload
+                    size_t payload_len = record->length - 1;
+                    if (segments)
+                        segments->append(static_cast<uint8_t>(level), record->time_us, LogRing::text(record), payload_len);
+                    if (!console && file_fd < 0) continue;
+                    texts.push_back(std::string());
+                    if (!binary::render_payload(LogRing::text(record), payload_len, texts.back()))
+                        texts.back() = "<bad binary log record>";
+                    texts.back() += '\n';
+                    line[1].iov_base = &texts.back()[0];
+                    line[1].iov_len = texts.back().size();
+                }
+
+                char *prefix = &prefixes[i * PrefixSize];
+                line[0].iov_base = prefix;
+                line[0].iov_len = format_prefix(prefix, record->time_us, level);
+                if (console) {
+                    std::vector<struct iovec> &stream = (level >= Level::Error) ? err_iov : out_iov;
+                    stream.insert(stream.end(), line, line + 2);
+                }
+                if (file_fd >= 0)
+                    file_iov.insert(file_iov.end(), line, line + 2);
+            }
+            if (segments)
+                segments->flush(sync);
+            if (binary_lock.owns_lock())
+                binary_lock.unlock();
+
+            if (!out_iov.empty()) write_all(STDOUT_FILENO, &out_iov[0], static_cast<int>(out_iov.size()));
+            if (!err_iov.empty()) write_all(STDERR_FILENO, &err_iov[0], static_cast<int>(err_iov.size()));
+            if (!file_iov.empty()) {
+                write_all(file_fd, &file_iov[0], static_cast<int>(file_iov.size()));
+                if (sync) ::fdatasync(file_fd);
+            }
+
+            for (int i = 0; i < count; ++i)
+                rings_[i].load(std::memory_order_acquire)->release(ends[i]);
+            written_.fetch_add(entries.size(), std::memory_order_relaxed);
+            batches_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Lost lines are reported in the log itself, once per writer pass
+    void report_drops() {
+        uint64_t dropped = stats().dropped;
+        if (dropped == reported_drops_) return;
+
+        char line[160];
+        size_t n = format_prefix(line, realtime_us(), Level::Warn);
+        n += std::snprintf(line + n, sizeof(line) - n, "Logger: %llu lines dropped, ring buffer full\n",
+                           static_cast<unsigned long long>(dropped - reported_drops_));
+        reported_drops_ = dropped;
+
+        struct iovec iov = { line, std::min(n, sizeof(line) - 1) };
+        if (outputs_->console.load(std::memory_order_relaxed))
+            write_all(STDOUT_FILENO, &iov, 1);
+        int file_fd = outputs_->file_fd.load(std::memory_order_acquire);
+        if (file_fd >= 0) {
+            iov.iov_base = line;
+            iov.iov_len = std::min(n, sizeof(line) - 1);
+            write_all(file_fd, &iov, 1);
+        }
+    }
+
+    std::atomic<bool> running_;
+    std::atomic<LogRing *> rings_[MaxThreads];
+    std::atomic<int> ring_count_;
+    std::mutex register_mutex_;
+    std::mutex control_mutex_;
+    Outputs *outputs_;
+    FlushPolicy policy_;
+    std::thread thread_;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    bool stopping_;
+    bool wake_pending_;
+
+    std::atomic<uint64_t> written_;
+    std::atomic<uint64_t> batches_;
+
+    // writer thread only
+    uint64_t reported_drops_;
+    time_t cached_second_;
+    char cached_time_[32];
+};
+
+} // namespace detail
+
 class Logger {
 public:
     // C++11-compatible header-only storage: use function-local statics
@@ -42,14 +585,97 @@ public:
         return m;
     }
 
-    static std::unique_ptr<std::ofstream> &file_out_ref() {
-        static std::unique_ptr<std::ofstream> f;
-        return f;
+    static detail::Outputs &outputs_ref() {
+        static detail::Outputs outputs;
+        return outputs;
+    }
+
+    // File sink descriptor, -1 when disabled
+    static std::atomic<int> &file_fd_ref() { return outputs_ref().file_fd; }
+
+    // Lines logged without a call site of their own (log(), log_printf())
+    static const binary::FormatSite &default_site() {
+        static const binary::FormatSite *site = new binary::FormatSite("app", "%s");
+        return *site;
     }
 
+    static detail::AsyncWriter &async_ref() {
+        static detail::AsyncWriter writer;
+        return writer;
+    }
+
+    // Modules by name; entries are never removed, so references stay valid
+    static std::map<std::string, ModuleLevel *> &modules_ref() {
+        static std::map<std::string, ModuleLevel *> *modules = new std::map<std::string, ModuleLevel *>();
+        return *modules;
+    }
+
+    static std::mutex &modules_mtx_ref() {
+        static std::mutex m;
+        return m;
+    }
+
+    // Checks the global level; the LOG_* macros check the module level instead
     static void log(Level lv, const std::string &msg) {
         if (lv < level_ref()) return;
+        emit(lv, msg.data(), msg.size());
+    }
+
+    template<typename F>
+    static void log_stream(Level lv, F &&f) {
+        if (lv < level_ref()) return;
+        write_stream(lv, std::forward<F>(f));
+    }
+
+    static void log_printf(Level lv, const char* fmt, ...) {
+        if (lv < level_ref()) return;
+        va_list ap;
+        va_start(ap, fmt);
+        write_vprintf(lv, default_site(), fmt, ap);
+        va_end(ap);
+    }
+
+    // The emit and write functions skip the level check; the caller has done it
+    static void emit(Level lv, const char *msg, size_t len) { emit_text(lv, default_site(), msg, len); }
+
+    static void emit_text(Level lv, const binary::FormatSite &site, const char *msg, size_t len) {
+        if (binary_enabled()) {
+            static thread_local std::string payload;
+            payload.clear();
+            binary::put_varint(payload, site.text_id);
+            payload += 's';
+            binary::put_bytes(payload, msg, len);
+            emit_binary(lv, payload.data(), payload.size());
+            return;
+        }
+        detail::AsyncWriter &writer = async_ref();
+        if (writer.running() && writer.enqueue(lv, msg, len)) return;
+
+        std::lock_guard<std::mutex> lk(mtx_ref());
+        write_text_locked(lv, msg, len);
+    }
+
+    static void emit_binary(Level lv, const char *payload, size_t len) {
+        detail::AsyncWriter &writer = async_ref();
+        if (writer.running() && writer.enqueue(lv, payload, len, true)) return;
+
         std::lock_guard<std::mutex> lk(mtx_ref());
+        detail::Outputs &out = outputs_ref();
+        {
+            std::lock_guard<std::mutex> blk(out.binary_mutex);
+            if (out.binary) {
+                out.binary->append(static_cast<uint8_t>(lv), detail::realtime_us(), payload, len);
+                out.binary->flush(lv >= Level::Error);
+            }
+        }
+        if (!out.console.load(std::memory_order_relaxed) && !file_enabled()) return;
+        std::string text;
+        if (!binary::render_payload(payload, len, text)) return;
+        write_text_locked(lv, text.data(), text.size());
+    }
+
+    // Synchronous console and text file output; mtx_ref() is held
+    static void write_text_locked(Level lv, const char *msg, size_t len) {
         auto now = std::chrono::system_clock::now();
         auto t = std::chrono::system_clock::to_time_t(now);
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
@@ -65,63 +691,154 @@ public:
         }
         std::ostringstream oss;
         oss << timebuf << '.' << std::setfill('0') << std::setw(3) << ms.count()
-            << " [" << level_name(lv) << "] " << msg << '\n';
+            << " [" << level_name(lv) << "] ";
+        oss.write(msg, static_cast<std::streamsize>(len));
+        oss << '\n';
         const std::string line = oss.str();
-        if (lv >= Level::Error) std::cerr << line;
-        else std::cout << line;
+        if (outputs_ref().console.load(std::memory_order_relaxed)) {
+            if (lv >= Level::Error) std::cerr << line;
+            else std::cout << line;
+        }
 
-        auto &fo = file_out_ref();
-        if (fo && fo->is_open()) {
-            (*fo) << line;
-            fo->flush();
+        int fd = file_fd_ref().load(std::memory_order_acquire);
+        if (fd >= 0) {
+            struct iovec iov = { const_cast<char *>(line.data()), line.size() };
+            detail::write_all(fd, &iov, 1);
         }
     }
 
     template<typename F>
-    static void log_stream(Level lv, F &&f) {
-        std::ostringstream oss;
+    static void write_stream(Level lv, F &&f) { write_stream(lv, default_site(), std::forward<F>(f)); }
+
+    // Formats into a per-thread stream that keeps its buffer between lines
+    template<typename F>
+    static void write_stream(Level lv, const binary::FormatSite &site, F &&f) {
+        static thread_local std::ostringstream oss;
+        static thread_local int depth = 0;
+        if (depth > 0) {
+            // a streamed value logged something itself
+            std::ostringstream nested;
+            f(nested);
+            const std::string msg = nested.str();
+            emit_text(lv, site, msg.data(), msg.size());
+            return;
+        }
+        ++depth;
+        oss.str(std::string());
+        oss.clear();
+        oss.flags(std::ios_base::fmtflags(std::ios_base::dec | std::ios_base::skipws));
+        oss.fill(' ');
+        oss.precision(6);
+        oss.width(0);
         f(oss);
-        log(lv, oss.str());
+        const std::string msg = oss.str();
+        --depth;
+        emit_text(lv, site, msg.data(), msg.size());
     }
 
-    static void log_printf(Level lv, const char* fmt, ...) {
-        if (lv < level_ref()) return;
+    // With a binary sink, stores the site's format id and the raw arguments
+    // and leaves formatting to whoever reads them
+    template<typename... Args>
+    static void write_format(Level lv, const binary::FormatSite &site, const char *fmt, const Args &... args) {
+        bool same_format = fmt == site.format || std::strcmp(fmt, site.format) == 0;
+        if (!binary_enabled() || !same_format) {
+            write_printf(lv, site, fmt, args...);
+            return;
+        }
+        static thread_local std::string payload;
+        payload.clear();
+        binary::put_varint(payload, site.id);
+        binary::put_args(payload, args...);
+        emit_binary(lv, payload.data(), payload.size());
+    }
+
+    static void write_printf(Level lv, const binary::FormatSite &site, const char *fmt, ...) {
         va_list ap;
         va_start(ap, fmt);
-        int size = std::vsnprintf(nullptr, 0, fmt, ap);
+        write_vprintf(lv, site, fmt, ap);
         va_end(ap);
+    }
+
+    // One vsnprintf into a stack buffer; only longer lines format twice
+    static void write_vprintf(Level lv, const binary::FormatSite &site, const char *fmt, va_list ap) {
+        char buf[256];
+        va_list copy;
+        va_copy(copy, ap);
+        int size = std::vsnprintf(buf, sizeof(buf), fmt, copy);
+        va_end(copy);
         if (size < 0) return;
-        std::string buf(size + 1, '\0');
-        va_start(ap, fmt);
-        std::vsnprintf(&buf[0], buf.size(), fmt, ap);
-        va_end(ap);
-        if (!buf.empty() && buf.back() == '\0') buf.pop_back();
-        log(lv, buf);
+        if (static_cast<size_t>(size) < sizeof(buf)) {
+            emit_text(lv, site, buf, static_cast<size_t>(size));
+            return;
+        }
+        std::vector<char> heap(static_cast<size_t>(size) + 1);
+        va_copy(copy, ap);
+        std::vsnprintf(&heap[0], heap.size(), fmt, copy);
+        va_end(copy);
+        emit_text(lv, site, &heap[0], static_cast<size_t>(size));
+    }
+
+    // Returns the module, registering it at the global level on first use
+    static ModuleLevel &module(const std::string &name) {
+        std::lock_guard<std::mutex> lk(modules_mtx_ref());
+        std::map<std::string, ModuleLevel *> &modules = modules_ref();
+        auto it = modules.find(name);
+        if (it != modules.end()) return *it->second;
+        ModuleLevel *m = new ModuleLevel(name, level_ref());
+        modules[name] = m;
+        return *m;
+    }
+
+    // Only levels at or above CUCKOO_LOG_MIN_LEVEL can be turned back on at runtime
+    static void set_module_level(const std::string &name, Level lv) {
+        ModuleLevel &m = module(name);
+        std::lock_guard<std::mutex> lk(modules_mtx_ref());
+        m.override_ = static_cast<int>(lv);
+        m.threshold_.store(m.override_, std::memory_order_relaxed);
+    }
+
+    // Puts the module back on the global level
+    static void clear_module_level(const std::string &name) {
+        ModuleLevel &m = module(name);
+        std::lock_guard<std::mutex> lk(modules_mtx_ref());
+        m.override_ = -1;
+        m.threshold_.store(static_cast<int>(level_ref()), std::memory_order_relaxed);
     }
 
-    static void set_level(Level lv) { level_ref() = lv; }
+    static void set_level(Level lv) {
+        std::lock_guard<std::mutex> lk(modules_mtx_ref());
+        level_ref() = lv;
+        for (auto &entry : modules_ref()) {
+            if (!entry.second->overridden())
+                entry.second->threshold_.store(static_cast<int>(lv), std::memory_order_relaxed);
+        }
+    }
+
+    // "debug" sets the global level; "info,backplate=debug,hal=warn" also
+    // sets per-module levels. Unknown levels are ignored.
     static void set_level_from_env(const char* envvar = "CUCKOO_LOG_LEVEL") {
         const char* v = std::getenv(envvar);
         if (!v) return;
-        std::string s(v);
-        for (auto &c : s) c = tolower(c);
-        if (s == "trace") set_level(Level::Trace);
-        else if (s == "debug") set_level(Level::Debug);
-        else if (s == "info") set_level(Level::Info);
-        else if (s == "warn" || s == "warning") set_level(Level::Warn);
-        else if (s == "error") set_level(Level::Error);
-        else if (s == "critical") set_level(Level::Critical);
+        std::istringstream items{std::string(v)};
+        std::string item;
+        while (std::getline(items, item, ',')) {
+            size_t eq = item.find('=');
+            Level lv;
+            if (eq == std::string::npos) {
+                if (parse_level(item, lv)) set_level(lv);
+            } else if (eq > 0 && parse_level(item.substr(eq + 1), lv)) {
+                set_module_level(item.substr(0, eq), lv);
+            }
+        }
     }
 
     static void set_file(const std::string &path) {
-        try {
-            // C++11 doesn't have make_unique
-            file_out_ref().reset(new std::ofstream(path, std::ios::app));
-            if (!file_out_ref()->is_open()) {
-                file_out_ref().reset();
-            }
-        } catch (...) {
-            file_out_ref().reset();
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        int old = file_fd_ref().exchange(fd);
+        if (old >= 0) {
+            // the writer may be mid-batch on the old descriptor
+            async_ref().flush();
+            ::close(old);
         }
     }
 
@@ -133,24 +850,112 @@ public:
 
     // Query whether a file sink is configured and open
     static bool file_enabled() {
-        auto &fo = file_out_ref();
-        return (fo && fo->is_open());
+        return file_fd_ref().load(std::memory_order_acquire) >= 0;
+    }
+
+    // Binary segment files in dir, at most config.segment_bytes *
+    // config.segment_count bytes in total; an empty dir turns them off
+    static bool set_binary_sink(const std::string &dir, const binary::SegmentConfig &config = binary::SegmentConfig()) {
+        std::unique_ptr<binary::SegmentWriter> segments;
+        if (!dir.empty()) {
+            segments.reset(new binary::SegmentWriter(dir, config));
+            if (!segments->open(detail::realtime_us())) return false;
+        }
+        detail::Outputs &out = outputs_ref();
+        // lines already queued go to the sink they were logged for
+        async_ref().flush();
+        std::lock_guard<std::mutex> lk(out.binary_mutex);
+        out.binary.swap(segments);
+        out.binary_enabled.store(out.binary != nullptr, std::memory_order_release);
+        return true;
+    }
+
+    static bool set_binary_sink_from_env(const char* envvar = "CUCKOO_LOG_DIR") {
+        const char* v = std::getenv(envvar);
+        if (!v) return false;
+        return set_binary_sink(std::string(v));
+    }
+
+    static bool binary_enabled() {
+        return outputs_ref().binary_enabled.load(std::memory_order_relaxed);
+    }
+
+    // Console output can be turned off when a file or binary sink is enough
+    static void set_console(bool enabled) { outputs_ref().console.store(enabled, std::memory_order_relaxed); }
+
+    // "0", "off" or "false" turn the console off
+    static void set_console_from_env(const char* envvar = "CUCKOO_LOG_CONSOLE") {
+        const char* v = std::getenv(envvar);
+        if (!v) return;
+        std::string s(v);
+        for (auto &c : s) c = static_cast<char>(tolower(c));
+        set_console(!(s == "0" || s == "off" || s == "false"));
     }
+
+    // Moves formatting and output to a background writer thread; queued
+    // lines are written out at exit or by stop_async()
+    static void start_async(const FlushPolicy &policy = FlushPolicy()) {
+        detail::AsyncWriter &writer = async_ref();
+        if (writer.running()) return;
+        writer.start(policy, &outputs_ref());
+        static bool registered = false;
+        if (!registered) {
+            registered = true;
+            std::atexit([] { async_ref().stop(); });
+        }
+    }
+
+    static void stop_async() { async_ref().stop(); }
+    static bool async_enabled() { return async_ref().running(); }
+
+    // Waits until every line logged so far has been written
+    static void flush() { async_ref().flush(); }
+
+    static AsyncStats async_stats() { return async_ref().stats(); }
 };
 
 } // namespace cuckoo_log
 
+namespace {
+// The module of the including translation unit, looked up once
+inline const cuckoo_log::ModuleLevel &cuckoo_log_module() {
+    static const cuckoo_log::ModuleLevel &m = cuckoo_log::Logger::module(CUCKOO_LOG_MODULE);
+    return m;
+}
+} // namespace
+
+// True when a statement at this level would be written. The first operand is
+// a constant, so below CUCKOO_LOG_MIN_LEVEL the whole statement is dead code.
+#define CUCKOO_LOG_ENABLED(lv) \
+    (static_cast<int>(lv) >= CUCKOO_LOG_MIN_LEVEL && cuckoo_log_module().enabled(lv))
+
+// Each statement registers its format string once, for the binary sink
+#define CUCKOO_LOG_STREAM_AT(lv, expr) \
+    do { \
+        if (CUCKOO_LOG_ENABLED(lv)) { \
+            static const cuckoo_log::binary::FormatSite cuckoo_log_site(CUCKOO_LOG_MODULE, "%s"); \
+            cuckoo_log::Logger::write_stream(lv, cuckoo_log_site, [&](std::ostream &o){ o << expr; }); \
+        } \
+    } while (0)
+#define CUCKOO_LOG_PRINTF_AT(lv, fmt, ...) \
+    do { \
+        if (CUCKOO_LOG_ENABLED(lv)) { \
+            static const cuckoo_log::binary::FormatSite cuckoo_log_site(CUCKOO_LOG_MODULE, fmt); \
+            cuckoo_log::Logger::write_format(lv, cuckoo_log_site, fmt, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
 // Convenience macros
-#define LOG_TRACE_STREAM(expr) cuckoo_log::Logger::log_stream(cuckoo_log::Level::Trace, [&](std::ostream &o){ o << expr; })
-#define LOG_DEBUG_STREAM(expr) cuckoo_log::Logger::log_stream(cuckoo_log::Level::Debug, [&](std::ostream &o){ o << expr; })
-#define LOG_INFO_STREAM(expr)  cuckoo_log::Logger::log_stream(cuckoo_log::Level::Info,  [&](std::ostream &o){ o << expr; })
-#define LOG_WARN_STREAM(expr)  cuckoo_log::Logger::log_stream(cuckoo_log::Level::Warn,  [&](std::ostream &o){ o << expr; })
-#define LOG_ERROR_STREAM(expr) cuckoo_log::Logger::log_stream(cuckoo_log::Level::Error, [&](std::ostream &o){ o << expr; })
-#define LOG_CRIT_STREAM(expr)  cuckoo_log::Logger::log_stream(cuckoo_log::Level::Critical, [&](std::ostream &o){ o << expr; })
-
-#define LOG_TRACE(fmt, ...) cuckoo_log::Logger::log_printf(cuckoo_log::Level::Trace, fmt, ##__VA_ARGS__)
-#define LOG_DEBUG(fmt, ...) cuckoo_log::Logger::log_printf(cuckoo_log::Level::Debug, fmt, ##__VA_ARGS__)
-#define LOG_INFO(fmt, ...)  cuckoo_log::Logger::log_printf(cuckoo_log::Level::Info,  fmt, ##__VA_ARGS__)
-#define LOG_WARN(fmt, ...)  cuckoo_log::Logger::log_printf(cuckoo_log::Level::Warn,  fmt, ##__VA_ARGS__)
-#define LOG_ERROR(fmt, ...) cuckoo_log::Logger::log_printf(cuckoo_log::Level::Error, fmt, ##__VA_ARGS__)
-#define LOG_CRIT(fmt, ...)  cuckoo_log::Logger::log_printf(cuckoo_log::Level::Critical, fmt, ##__VA_ARGS__)
+#define LOG_TRACE_STREAM(expr) CUCKOO_LOG_STREAM_AT(cuckoo_log::Level::Trace, expr)
+#define LOG_DEBUG_STREAM(expr) CUCKOO_LOG_STREAM_AT(cuckoo_log::Level::Debug, expr)
+#define LOG_INFO_STREAM(expr)  CUCKOO_LOG_STREAM_AT(cuckoo_log::Level::Info,  expr)
+#define LOG_WARN_STREAM(expr)  CUCKOO_LOG_STREAM_AT(cuckoo_log::Level::Warn,  expr)
+#define LOG_ERROR_STREAM(expr) CUCKOO_LOG_STREAM_AT(cuckoo_log::Level::Error, expr)
+#define LOG_CRIT_STREAM(expr)  CUCKOO_LOG_STREAM_AT(cuckoo_log::Level::Critical, expr)
+
+#define LOG_TRACE(fmt, ...) CUCKOO_LOG_PRINTF_AT(cuckoo_log::Level::Trace, fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(fmt, ...) CUCKOO_LOG_PRINTF_AT(cuckoo_log::Level::Debug, fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...)  CUCKOO_LOG_PRINTF_AT(cuckoo_log::Level::Info,  fmt, ##__VA_ARGS__)
+#define LOG_WARN(fmt, ...)  CUCKOO_LOG_PRINTF_AT(cuckoo_log::Level::Warn,  fmt, ##__VA_ARGS__)
+#define LOG_ERROR(fmt, ...) CUCKOO_LOG_PRINTF_AT(cuckoo_log::Level::Error, fmt, ##__VA_ARGS__)
+#define LOG_CRIT(fmt, ...)  CUCKOO_LOG_PRINTF_AT(cuckoo_log::Level::Critical, fmt, ##__VA_ARGS__)
@@ -0,0 +1,225 @@
+// Scoped trace spans for finding UI stutters
+//
+// TRACE_SCOPE("name") records the time from the statement to the end of the
+// enclosing block into a ring buffer owned by the calling thread. The spans
+// are compiled in only when CUCKOO_TRACE is 1 (cmake -DCUCKOO_TRACE=ON);
+// otherwise the macros expand to nothing.
+//
+// Tracer::write_chrome_json() exports the latest spans of every thread as
+// Chrome trace JSON, which chrome://tracing and ui.perfetto.dev display as
+// one timeline per thread. Span and thread names must be string literals.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef CUCKOO_TRACE
+#define CUCKOO_TRACE 0
+#endif
+
+namespace cuckoo_trace {
+
+inline uint64_t now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// One thread's latest spans. Only the owning thread writes; the exporter
+// reads concurrently and drops whatever may have been overwritten meanwhile.
+struct TraceRing {
+    static const uint32_t Capacity = 4096; // power of two
+
+    struct Span {
+        std::atomic<const char*> name;
+        std::atomic<uint64_t> begin_ns;
+        std::atomic<uint64_t> end_ns;
+    };
+
+    Span spans[Capacity];
+    std::atomic<uint32_t> head;    // spans ever written
+    std::atomic<uint32_t> first;   // first span of the current owner
+    std::atomic<bool> owned;
+    std::atomic<int> tid;
+    std::atomic<const char*> thread_name;
+
+    TraceRing() : head(0), first(0), owned(true), tid(0), thread_name(nullptr) {}
+
+    void record(const char *name, uint64_t begin_ns, uint64_t end_ns) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        Span &span = spans[h & (Capacity - 1)];
+        span.name.store(name, std::memory_order_relaxed);
+        span.begin_ns.store(begin_ns, std::memory_order_relaxed);
+        span.end_ns.store(end_ns, std::memory_order_relaxed);
+        head.store(h + 1, std::memory_order_release);
+    }
+};
+
+struct SpanRecord {
+    const char *name;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+};
+
+class Tracer {
+public:
+    static const int MaxThreads = 16;
+
+    static void record(const char *name, uint64_t begin_ns, uint64_t end_ns) {
+        TraceRing *ring = instance().thread_ring();
+        if (ring) ring->record(name, begin_ns, end_ns);
+    }
+
+    // Labels the calling thread's track in the exported timeline
+    static void set_thread_name(const char *name) {
+        TraceRing *ring = instance().thread_ring();
+        if (ring) ring->thread_name.store(name, std::memory_order_relaxed);
+    }
+
+    // Copies the spans of ring that are still intact, oldest first
+    static void read(const TraceRing &ring, std::vector<SpanRecord> &out) {
+        uint32_t end = ring.head.load(std::memory_order_acquire);
+        uint32_t start = ring.first.load(std::memory_order_relaxed);
+        if (end - start > TraceRing::Capacity) start = end - TraceRing::Capacity;
+
+        std::vector<SpanRecord> copy;
+        copy.reserve(end - start);
+        for (uint32_t i = start; i != end; ++i) {
+            const TraceRing::Span &span = ring.spans[i & (TraceRing::Capacity - 1)];
+            SpanRecord record = {
+                span.name.load(std::memory_order_relaxed),
+                span.begin_ns.load(std::memory_order_relaxed),
+                span.end_ns.load(std::memory_order_relaxed)
+            };
+            copy.push_back(record);
+        }
+
+        // The writer may have lapped the copy; its next span can overwrite one more slot
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint32_t now = ring.head.load(std::memory_order_relaxed);
+        uint32_t valid = now - start + 1 > TraceRing::Capacity ? now - start + 1 - TraceRing::Capacity : 0;
+        for (uint32_t i = valid; i < copy.size(); ++i)
+            out.push_back(copy[i]);
+    }
+
+    // Chrome trace event format: one complete ("X") event per span, timestamps in microseconds
+    static void write_chrome_json(std::ostream &out) {
+        Tracer &tracer = instance();
+        int pid = static_cast<int>(getpid());
+        std::vector<SpanRecord> spans;
+        bool first_event = true;
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        int count = tracer.ring_count_.load(std::memory_order_acquire);
+        for (int r = 0; r < count; ++r) {
+            const TraceRing *ring = tracer.rings_[r].load(std::memory_order_acquire);
+            int tid = ring->tid.load(std::memory_order_relaxed);
+            const char *thread_name = ring->thread_name.load(std::memory_order_relaxed);
+            if (thread_name) {
+                out << (first_event ? "" : ",")
+                    << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << tid
+                    << ",\"args\":{\"name\":\"" << thread_name << "\"}}";
+                first_event = false;
+            }
+
+            spans.clear();
+            read(*ring, spans);
+            for (const SpanRecord &span : spans) {
+                out << (first_event ? "" : ",")
+                    << "{\"name\":\"" << span.name << "\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << tid
+                    << ",\"ts\":" << span.begin_ns / 1000 << "." << fraction(span.begin_ns)
+                    << ",\"dur\":" << (span.end_ns - span.begin_ns) / 1000 << "." << fraction(span.end_ns - span.begin_ns)
+                    << "}";
+                first_event = false;
+            }
+        }
+        out << "]}\n";
+    }
+
+private:
+    Tracer() : ring_count_(0) {
+        for (int i = 0; i < MaxThreads; ++i) rings_[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Never destroyed: threads may still record while the process exits
+    static Tracer &instance() {
+        static Tracer *tracer = new Tracer();
+        return *tracer;
+    }
+
+    // Three digits of nanoseconds after the microsecond point
+    static std::string fraction(uint64_t ns) {
+        char digits[4] = { char('0' + ns / 100 % 10), char('0' + ns / 10 % 10), char('0' + ns % 10), 0 };
+        return digits;
+    }
+
+    // Rings are never freed; a ring left behind by an exited thread is
+    // reused by the next new one, starting after the old thread's spans
+    TraceRing *thread_ring() {
+        struct Handle {
+            TraceRing *ring = nullptr;
+            ~Handle() { if (ring) ring->owned.store(false, std::memory_order_release); }
+        };
+        static thread_local Handle handle;
+        if (handle.ring) return handle.ring;
+
+        std::lock_guard<std::mutex> lk(register_mutex_);
+        int tid = static_cast<int>(syscall(SYS_gettid));
+        int count = ring_count_.load(std::memory_order_relaxed);
+        for (int i = 0; i < count; ++i) {
+            TraceRing *ring = rings_[i].load(std::memory_order_relaxed);
+            bool expected = false;
+            if (ring->owned.compare_exchange_strong(expected, true)) {
+                ring->first.store(ring->head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                ring->tid.store(tid, std::memory_order_relaxed);
+                ring->thread_name.store(nullptr, std::memory_order_relaxed);
+                handle.ring = ring;
+                return ring;
+            }
+        }
+        if (count == MaxThreads) return nullptr;
+        TraceRing *ring = new TraceRing();
+        ring->tid.store(tid, std::memory_order_relaxed);
+        rings_[count].store(ring, std::memory_order_release);
+        ring_count_.store(count + 1, std::memory_order_release);
+        handle.ring = ring;
+        return ring;
+    }
+
+    std::mutex register_mutex_;
+    std::atomic<TraceRing*> rings_[MaxThreads];
+    std::atomic<int> ring_count_;
+};
+
+// Records its own lifetime as a span
+class Span {
+public:
+    explicit Span(const char *name) : name_(name), begin_ns_(now_ns()) {}
+    ~Span() { Tracer::record(name_, begin_ns_, now_ns()); }
+
+private:
+    Span(const Span &) = delete;
+    Span &operator=(const Span &) = delete;
+
+    const char *name_;
+    uint64_t begin_ns_;
+};
+
+} // namespace cuckoo_trace
+
+#if CUCKOO_TRACE
+#define CUCKOO_TRACE_CONCAT_INNER(a, b) a##b
+#define CUCKOO_TRACE_CONCAT(a, b) CUCKOO_TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) ::cuckoo_trace::Span CUCKOO_TRACE_CONCAT(cuckoo_trace_span_, __LINE__)(name)
+#define TRACE_THREAD_NAME(name) ::cuckoo_trace::Tracer::set_thread_name(name)
+#else
+#define TRACE_SCOPE(name) do {} while (0)
+#define TRACE_THREAD_NAME(name) do {} while (0)
+#endif
@@ -25,8 +25,14 @@
    COLOR SETTINGS
  *====================*/
 
-/** Color depth: 1 (I1), 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888) */
-#define LV_COLOR_DEPTH 32
+/** Color depth: 1 (I1), 8 (L8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888)
+ *  Cuckoo profile: CUCKOO_COLOR_DEPTH is set by CMake (default 16) so LVGL renders
+ *  RGB565 end to end; the display converts on flush if the panel is 32-bit. */
+#ifdef CUCKOO_COLOR_DEPTH
+    #define LV_COLOR_DEPTH CUCKOO_COLOR_DEPTH
+#else
+    #define LV_COLOR_DEPTH 32
+#endif
 
 /*=========================
    STDLIB WRAPPER SETTINGS
@@ -1038,7 +1044,7 @@
 /* Documentation for several of the below items can be found here: https://docs.lvgl.io/master/details/auxiliary-modules/index.html . */
 
 /** 1: Enable API to take snapshot for object */
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /** 1: Enable system monitor component */
 #define LV_USE_SYSMON   0
@@ -0,0 +1,3125 @@
+// Generated by tools/pack_image_rle.py from CuckooLogoNest.cpp, do not edit.
+// 300x300 RGB565, 180000 bytes raw, 49739 bytes packed
+#include "CuckooLogoNest.hpp"
+
+static const uint8_t CuckooLogoNest_rle[] = {
+  0xa6, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa2, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xa1, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x96, 0x61, 0x08, 0x00, 0x61, 0x10, 0x97, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10, 0xda, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xff, 0x61, 0x08, 0x95, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x9a, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xcb, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xa4, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xca, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0x8a, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff,
+  0x61, 0x08, 0xaa, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xa7, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xbf, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff,
+  0x61, 0x08, 0xb3, 0x61, 0x08, 0x00, 0x62, 0x08, 0xa5, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xe1, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xd0, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xc1, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff,
+  0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xab, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0xc7, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0x9e, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xad, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9e,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x8a, 0x61, 0x08, 0x00, 0x62, 0x08, 0xbe, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xdc, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x90, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xc1, 0x61, 0x08, 0x8b, 0x60, 0x08, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x98,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xaa, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xc1, 0x61,
+  0x08, 0x85, 0x60, 0x08, 0x04, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x63, 0x10, 0x64, 0x10, 0x83,
+  0x65, 0x18, 0x83, 0x66, 0x18, 0x82, 0x65, 0x18, 0x04, 0x64, 0x18, 0x63, 0x10, 0x62, 0x10, 0x62,
+  0x08, 0x61, 0x08, 0x85, 0x60, 0x08, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x95, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xff, 0x61, 0x08, 0xe7, 0x61, 0x08, 0x81, 0x60, 0x08, 0x0d, 0x60, 0x00, 0x80, 0x08,
+  0x61, 0x08, 0x62, 0x10, 0x64, 0x10, 0x66, 0x18, 0x68, 0x20, 0x6a, 0x28, 0x6c, 0x38, 0x6e, 0x38,
+  0x6f, 0x40, 0x70, 0x40, 0x71, 0x48, 0x72, 0x48, 0x82, 0x73, 0x50, 0x89, 0x74, 0x50, 0x00, 0x73,
+  0x50, 0x81, 0x72, 0x48, 0x0c, 0x71, 0x48, 0x70, 0x40, 0x6f, 0x40, 0x6e, 0x38, 0x6c, 0x30, 0x6a,
+  0x28, 0x68, 0x20, 0x66, 0x20, 0x84, 0x10, 0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x60, 0x00, 0x81,
+  0x60, 0x08, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xf2, 0x61, 0x08, 0x82, 0x60,
+  0x08, 0x08, 0x62, 0x08, 0x65, 0x18, 0x67, 0x20, 0x6a, 0x30, 0x6d, 0x38, 0x70, 0x40, 0x72, 0x48,
+  0x73, 0x50, 0x74, 0x50, 0x81, 0x74, 0x58, 0x82, 0x74, 0x50, 0x83, 0x73, 0x50, 0x01, 0x93, 0x50,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x88, 0x73, 0x50, 0x0e, 0x74,
+  0x50, 0x94, 0x58, 0x74, 0x50, 0x74, 0x58, 0x75, 0x58, 0x74, 0x50, 0x73, 0x50, 0x72, 0x48, 0x70,
+  0x40, 0x6e, 0x38, 0x6a, 0x30, 0x68, 0x20, 0x65, 0x18, 0x62, 0x10, 0x61, 0x08, 0x82, 0x60, 0x08,
+  0x9c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xc5,
+  0x61, 0x08, 0x08, 0x60, 0x08, 0x80, 0x08, 0x62, 0x08, 0x64, 0x18, 0x68, 0x20, 0x6c, 0x30, 0x6f,
+  0x40, 0x72, 0x48, 0x74, 0x50, 0x82, 0x74, 0x58, 0x83, 0x73, 0x50, 0x02, 0x72, 0x50, 0x92, 0x50,
+  0x72, 0x50, 0x81, 0x93, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x83, 0x73, 0x50, 0x83, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x74, 0x50, 0x81, 0x74, 0x58,
+  0x09, 0x74, 0x50, 0x52, 0x50, 0x70, 0x40, 0x6c, 0x30, 0x69, 0x28, 0x66, 0x18, 0x62, 0x10, 0x60,
+  0x08, 0x60, 0x00, 0x60, 0x08, 0xfe, 0x61, 0x08, 0x00, 0x61, 0x10, 0xd9, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x8c, 0x61, 0x08, 0x81, 0x60, 0x08, 0x05, 0x61, 0x08, 0x64, 0x18, 0x69, 0x28, 0x6e, 0x38,
+  0x71, 0x48, 0x73, 0x50, 0x81, 0x74, 0x58, 0x01, 0x74, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x84, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x86, 0x73, 0x50, 0x81, 0x72, 0x50, 0x89, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x82, 0x74, 0x50, 0x07,
+  0x72, 0x48, 0x6f, 0x40, 0x6b, 0x30, 0x66, 0x18, 0x62, 0x10, 0x60, 0x08, 0x60, 0x00, 0x60, 0x08,
+  0x95, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0xbc,
+  0x61, 0x08, 0x81, 0x60, 0x08, 0x07, 0x63, 0x10, 0x68, 0x20, 0x6d, 0x38, 0x71, 0x48, 0x74, 0x50,
+  0x75, 0x58, 0x74, 0x58, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x84,
+  0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x72,
+  0x50, 0x89, 0x73, 0x50, 0x02, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x89, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x84, 0x73, 0x50, 0x00, 0x93, 0x50, 0x83, 0x73, 0x50, 0x82, 0x72, 0x50, 0x08, 0x73, 0x50,
+  0x74, 0x50, 0x74, 0x58, 0x74, 0x50, 0x72, 0x50, 0x6f, 0x40, 0x6a, 0x28, 0x65, 0x18, 0x61, 0x08,
+  0x81, 0x60, 0x08, 0x01, 0x61, 0x08, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0xce, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08, 0x03, 0x64, 0x10,
+  0x69, 0x28, 0x6f, 0x40, 0x73, 0x50, 0x81, 0x74, 0x58, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x85,
+  0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x8b, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x86, 0x73, 0x50, 0x00, 0x72, 0x50, 0x97, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x07, 0x73, 0x50, 0x74, 0x50, 0x75, 0x58, 0x74, 0x50, 0x71, 0x48, 0x6c, 0x30,
+  0x66, 0x18, 0x62, 0x08, 0x81, 0x60, 0x08, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x98, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0xff, 0x61, 0x08, 0x9a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08, 0x01,
+  0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08, 0x07, 0x63, 0x10,
+  0x69, 0x28, 0x6f, 0x40, 0x73, 0x50, 0x75, 0x58, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x00, 0x72, 0x50, 0x88, 0x73, 0x50, 0x00, 0x72, 0x50, 0x87, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x93, 0x50, 0x82, 0x73, 0x50, 0x00, 0x93, 0x50, 0x82, 0x73, 0x50, 0x87, 0x74, 0x50, 0x85,
+  0x73, 0x50, 0x83, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x8f, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x05, 0x74, 0x58, 0x74, 0x50, 0x72, 0x48, 0x6c, 0x30, 0x66, 0x20, 0x62,
+  0x08, 0x81, 0x60, 0x08, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0xff, 0x61, 0x08, 0xa1, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xa7, 0x61, 0x08, 0x0a, 0x61, 0x10, 0x61, 0x08, 0x60, 0x00, 0x61, 0x08, 0x67,
+  0x20, 0x6e, 0x38, 0x73, 0x50, 0x75, 0x58, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x00, 0x72, 0x50, 0x88, 0x73, 0x50, 0x04, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x08, 0x93, 0x50, 0x73, 0x50, 0x93, 0x50, 0x74, 0x50, 0x74, 0x58, 0x74,
+  0x50, 0x94, 0x58, 0x94, 0x50, 0x74, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x48, 0x71, 0x48, 0x70,
+  0x48, 0x70, 0x40, 0x87, 0x6f, 0x40, 0x04, 0x70, 0x40, 0x71, 0x48, 0x72, 0x48, 0x72, 0x50, 0x73,
+  0x50, 0x81, 0x74, 0x50, 0x82, 0x74, 0x58, 0x00, 0x74, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x84, 0x73, 0x50, 0x82, 0x72, 0x50, 0x84, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x09, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58, 0x72, 0x48, 0x6c, 0x30, 0x85, 0x18, 0x61,
+  0x08, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0x88, 0x61, 0x08, 0x82, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x92, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xa4, 0x61, 0x08, 0x81,
+  0x60, 0x08, 0x02, 0x84, 0x10, 0x8b, 0x30, 0x71, 0x48, 0x81, 0x74, 0x50, 0x01, 0x73, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x88, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x74, 0x58, 0x0d, 0x94, 0x58, 0x74, 0x50, 0x72, 0x50,
+  0x71, 0x48, 0x6f, 0x40, 0x6d, 0x38, 0x6b, 0x30, 0x69, 0x28, 0x67, 0x20, 0x86, 0x18, 0x84, 0x18,
+  0x63, 0x10, 0x62, 0x10, 0x82, 0x10, 0x81, 0x61, 0x08, 0x82, 0x60, 0x08, 0x00, 0x80, 0x08, 0x83,
+  0x60, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x63, 0x10, 0x09, 0x65, 0x18, 0x67, 0x20,
+  0x68, 0x20, 0x69, 0x28, 0x6b, 0x30, 0x6d, 0x38, 0x70, 0x40, 0x72, 0x48, 0x73, 0x50, 0x74, 0x50,
+  0x81, 0x74, 0x58, 0x00, 0x74, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x8d, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x05, 0x73, 0x50, 0x74, 0x58, 0x74, 0x50, 0x71, 0x40, 0x6a, 0x28, 0x63, 0x10, 0x81,
+  0x60, 0x08, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xba, 0x61, 0x08, 0x08, 0x61,
+  0x10, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x67, 0x20, 0x6f, 0x40, 0x74, 0x50, 0x74, 0x58, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x85, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x01, 0x73, 0x50, 0x74, 0x50, 0x81, 0x74, 0x58, 0x07, 0x73,
+  0x50, 0x71, 0x48, 0x6e, 0x40, 0x6b, 0x30, 0x68, 0x20, 0x65, 0x18, 0x63, 0x10, 0x61, 0x08, 0x82,
+  0x60, 0x08, 0x00, 0x80, 0x08, 0x82, 0x60, 0x08, 0x85, 0x61, 0x08, 0x86, 0x61, 0x10, 0x84, 0x61,
+  0x08, 0x85, 0x60, 0x08, 0x08, 0x61, 0x08, 0x62, 0x08, 0x64, 0x10, 0x66, 0x18, 0x6a, 0x28, 0x6c,
+  0x30, 0x6f, 0x40, 0x72, 0x48, 0x74, 0x50, 0x81, 0x74, 0x58, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x03, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x74, 0x50, 0x75, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x66, 0x18,
+  0x81, 0x60, 0x08, 0x02, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xff, 0x61, 0x08, 0xb6, 0x61, 0x08, 0x03, 0x60, 0x08, 0x62, 0x08, 0x69, 0x28, 0x71, 0x48, 0x81,
+  0x74, 0x58, 0x01, 0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x00, 0x72, 0x50, 0x85, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x02, 0x93, 0x50, 0x73, 0x50, 0x74, 0x50, 0x81, 0x74, 0x58, 0x05, 0x72, 0x48,
+  0x8f, 0x40, 0x6b, 0x30, 0x67, 0x20, 0x64, 0x10, 0x62, 0x08, 0x83, 0x60, 0x08, 0x82, 0x61, 0x08,
+  0x83, 0x61, 0x10, 0x03, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8b, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x83, 0x60, 0x08, 0x07, 0x62, 0x10, 0x65, 0x18, 0x68, 0x28, 0x6d, 0x38, 0x70, 0x40, 0x73,
+  0x50, 0x74, 0x50, 0x74, 0x58, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x84, 0x73, 0x50, 0x02, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x07, 0x72, 0x50, 0x73, 0x50, 0x74, 0x58, 0x94,
+  0x58, 0x70, 0x40, 0x68, 0x20, 0x61, 0x08, 0x60, 0x08, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x85,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xb2, 0x61, 0x08, 0x05, 0x60, 0x00, 0x62, 0x10,
+  0x6b, 0x28, 0x72, 0x48, 0x75, 0x58, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x73, 0x50, 0x74, 0x58, 0x75, 0x58, 0x72, 0x50,
+  0x6f, 0x40, 0x6a, 0x30, 0x66, 0x18, 0x62, 0x10, 0x82, 0x60, 0x08, 0x81, 0x61, 0x08, 0x03, 0x61,
+  0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x02, 0x61, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x03, 0x61, 0x08, 0x61, 0x10,
+  0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x60, 0x08, 0x81, 0x80, 0x08, 0x05, 0x61, 0x08,
+  0x63, 0x10, 0x67, 0x20, 0x6b, 0x30, 0x70, 0x40, 0x73, 0x50, 0x81, 0x74, 0x58, 0x00, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x88, 0x73, 0x50, 0x81, 0x72, 0x50, 0x09, 0x74,
+  0x50, 0x75, 0x58, 0x72, 0x48, 0x6a, 0x28, 0x62, 0x10, 0x60, 0x00, 0x61, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xb1, 0x61, 0x08, 0x05,
+  0x60, 0x00, 0x63, 0x10, 0x6b, 0x30, 0x73, 0x50, 0x75, 0x58, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x84, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x74,
+  0x58, 0x03, 0x71, 0x48, 0x6d, 0x38, 0x87, 0x20, 0x63, 0x10, 0x82, 0x60, 0x08, 0x00, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x06, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x61, 0x08,
+  0x61, 0x10, 0x95, 0x61, 0x08, 0x81, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x81, 0x60, 0x08, 0x06, 0x61, 0x08, 0x64, 0x10, 0x68, 0x20, 0x6d, 0x38, 0x72,
+  0x48, 0x74, 0x50, 0x75, 0x58, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x58,
+  0x72, 0x48, 0x6b, 0x30, 0x63, 0x10, 0x60, 0x08, 0x86, 0x61, 0x08, 0x81, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0xa8, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x04, 0x60, 0x08, 0x62, 0x08, 0x6b,
+  0x30, 0x72, 0x50, 0x74, 0x58, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x82, 0x73, 0x50, 0x07, 0x72, 0x50, 0x73, 0x50, 0x74, 0x58, 0x74, 0x50, 0x71, 0x48, 0x6b,
+  0x30, 0x65, 0x18, 0x61, 0x08, 0x81, 0x80, 0x08, 0x04, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61,
+  0x10, 0x62, 0x10, 0x81, 0x61, 0x10, 0x83, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x89, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x95, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x07, 0x80, 0x08, 0x60, 0x08, 0x62, 0x08, 0x66, 0x18, 0x6c, 0x30,
+  0x71, 0x48, 0x74, 0x50, 0x74, 0x58, 0x8d, 0x73, 0x50, 0x07, 0x93, 0x50, 0x75, 0x58, 0x93, 0x50,
+  0x6b, 0x30, 0x62, 0x10, 0x60, 0x00, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0xad, 0x61, 0x08,
+  0x08, 0x62, 0x10, 0x61, 0x10, 0x60, 0x08, 0x61, 0x08, 0x6a, 0x28, 0x72, 0x48, 0x75, 0x58, 0x73,
+  0x50, 0x72, 0x50, 0x86, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x93, 0x50, 0x73,
+  0x50, 0x81, 0x74, 0x58, 0x06, 0x71, 0x48, 0x6c, 0x30, 0x85, 0x18, 0x61, 0x08, 0x60, 0x08, 0x80,
+  0x08, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x92, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x07, 0x61, 0x10,
+  0x61, 0x08, 0x60, 0x08, 0x60, 0x00, 0x61, 0x08, 0x65, 0x18, 0x6b, 0x30, 0x71, 0x48, 0x81, 0x74,
+  0x58, 0x01, 0x73, 0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x00, 0x72, 0x50, 0x83, 0x73, 0x50, 0x06,
+  0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x72, 0x50, 0x6a, 0x28, 0x61, 0x08, 0x60, 0x08, 0x95, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xa5, 0x61, 0x08, 0x00, 0x61, 0x10, 0xef, 0x61, 0x08, 0x81, 0x60, 0x08,
+  0x06, 0x67, 0x20, 0x71, 0x48, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x00, 0x72, 0x50, 0x86, 0x73, 0x50, 0x09, 0x75, 0x58, 0x73, 0x50, 0x6e, 0x38, 0x67,
+  0x20, 0x61, 0x08, 0x60, 0x08, 0x80, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x62, 0x08, 0x8d,
+  0x61, 0x08, 0x03, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x85, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x82, 0x61,
+  0x10, 0x09, 0x61, 0x08, 0x60, 0x08, 0x80, 0x08, 0x61, 0x08, 0x66, 0x20, 0x6d, 0x38, 0x73, 0x50,
+  0x75, 0x58, 0x74, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50,
+  0x84, 0x73, 0x50, 0x04, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x72, 0x48, 0x68, 0x20, 0x81, 0x60,
+  0x08, 0x00, 0x61, 0x10, 0xc0, 0x61, 0x08, 0x00, 0x61, 0x10, 0xe7, 0x61, 0x08, 0x05, 0x60, 0x08,
+  0x65, 0x18, 0x6f, 0x40, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x85, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x74, 0x50, 0x75, 0x58, 0x71, 0x48, 0x6a, 0x28, 0x63,
+  0x10, 0x81, 0x60, 0x08, 0x00, 0x61, 0x08, 0x82, 0x61, 0x10, 0x82, 0x61, 0x08, 0x82, 0x61, 0x10,
+  0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xa7, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x05, 0x61, 0x08, 0x60, 0x08, 0x60, 0x00, 0x63, 0x10, 0x69, 0x28, 0x70,
+  0x40, 0x81, 0x74, 0x58, 0x01, 0x73, 0x50, 0x93, 0x50, 0x84, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x08, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x70, 0x40, 0x65, 0x18, 0x60, 0x00, 0x61,
+  0x08, 0x62, 0x10, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x92, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x62, 0x10, 0x6c, 0x30,
+  0x81, 0x74, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x84, 0x73, 0x50, 0x01,
+  0x72, 0x50, 0x73, 0x50, 0x81, 0x74, 0x58, 0x05, 0x6f, 0x40, 0x67, 0x20, 0x61, 0x08, 0x60, 0x08,
+  0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x61,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x03, 0x62,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x99, 0x61, 0x08, 0x00, 0x61, 0x10, 0x92, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x85, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08, 0x05,
+  0x65, 0x18, 0x6d, 0x38, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x00,
+  0x72, 0x50, 0x83, 0x73, 0x50, 0x04, 0x74, 0x50, 0x74, 0x58, 0x6d, 0x30, 0x62, 0x10, 0x60, 0x08,
+  0x82, 0x61, 0x10, 0x83, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08,
+  0x9a, 0x61, 0x08, 0x04, 0x60, 0x08, 0x68, 0x20, 0x72, 0x48, 0x75, 0x58, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x02, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72,
+  0x50, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x65, 0x18, 0x81, 0x60, 0x08, 0x81, 0x61,
+  0x10, 0x02, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa0, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x9d, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x60, 0x08, 0x05, 0x64, 0x10, 0x6c, 0x30, 0x73,
+  0x50, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x87, 0x73, 0x50, 0x07, 0x72, 0x50, 0x73, 0x50, 0x74,
+  0x58, 0x73, 0x50, 0x69, 0x28, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0x9f, 0x61,
+  0x08, 0x06, 0x60, 0x00, 0x63, 0x10, 0x6f, 0x38, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x03, 0x74, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x64, 0x10, 0x81, 0x60, 0x08, 0x02, 0x61, 0x10,
+  0x62, 0x10, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0xae, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00,
+  0x62, 0x08, 0x85, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61, 0x10, 0x81, 0x62,
+  0x10, 0x82, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x0b, 0x61, 0x10, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x61, 0x08, 0x60, 0x00, 0x63, 0x10, 0x6b, 0x30, 0x73, 0x50, 0x75, 0x58, 0x73,
+  0x50, 0x92, 0x50, 0x87, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x6f, 0x40, 0x63,
+  0x10, 0x60, 0x08, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x8c, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x83, 0x61, 0x08, 0x05, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x68, 0x20, 0x73, 0x50,
+  0x74, 0x50, 0x8a, 0x73, 0x50, 0x05, 0x74, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x64, 0x10, 0x80, 0x00,
+  0x60, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x9c, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08, 0x81, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81,
+  0x62, 0x08, 0x87, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x83, 0x61, 0x10, 0x03, 0x62,
+  0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x82, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x07, 0x61, 0x08, 0x80, 0x00, 0x62, 0x10, 0x6b, 0x30, 0x72, 0x50, 0x75, 0x58,
+  0x73, 0x50, 0x72, 0x50, 0x88, 0x73, 0x50, 0x03, 0x74, 0x58, 0x73, 0x50, 0x69, 0x28, 0x60, 0x08,
+  0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x86,
+  0x61, 0x08, 0x04, 0x60, 0x00, 0x62, 0x10, 0x6e, 0x38, 0x75, 0x58, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x07, 0x93, 0x50, 0x92, 0x50, 0x94, 0x58,
+  0x74, 0x50, 0x6d, 0x38, 0x84, 0x10, 0x60, 0x00, 0x60, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa8, 0x61, 0x08, 0x00, 0x62, 0x08, 0x89,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x83, 0x61, 0x10, 0x07, 0x61, 0x08, 0x61, 0x10,
+  0x61, 0x08, 0x60, 0x08, 0x63, 0x10, 0x6b, 0x30, 0x73, 0x50, 0x74, 0x58, 0x81, 0x73, 0x50, 0x00,
+  0x72, 0x50, 0x85, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x6f, 0x40, 0x63, 0x10,
+  0x60, 0x00, 0xff, 0x61, 0x08, 0x96, 0x61, 0x08, 0x06, 0x62, 0x08, 0x61, 0x08, 0x60, 0x00, 0x67,
+  0x20, 0x73, 0x48, 0x74, 0x58, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x83, 0x73, 0x50,
+  0x07, 0x92, 0x50, 0x94, 0x50, 0x74, 0x58, 0x6e, 0x40, 0x65, 0x18, 0x60, 0x00, 0x60, 0x08, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0xad, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86,
+  0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x81, 0x62, 0x08, 0x00, 0x61, 0x08, 0x85, 0x61, 0x10,
+  0x07, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x63, 0x10, 0x6d,
+  0x38, 0x81, 0x74, 0x50, 0x00, 0x72, 0x50, 0x87, 0x73, 0x50, 0x06, 0x72, 0x50, 0x74, 0x58, 0x73,
+  0x50, 0x68, 0x20, 0x60, 0x00, 0x61, 0x08, 0x62, 0x08, 0xc7, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc9,
+  0x61, 0x08, 0x05, 0x62, 0x10, 0x60, 0x08, 0x61, 0x08, 0x6c, 0x30, 0x75, 0x58, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x84, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x75, 0x58, 0x71, 0x48, 0x67,
+  0x20, 0x81, 0x60, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x00, 0x62, 0x08, 0x8b,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x04, 0x62, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62,
+  0x08, 0x62, 0x10, 0x84, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x83, 0x61, 0x10, 0x06, 0x61, 0x08,
+  0x60, 0x00, 0x85, 0x18, 0x70, 0x40, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x86, 0x73, 0x50, 0x06,
+  0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x61, 0x08, 0x60, 0x08, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x03, 0x60, 0x08, 0x63, 0x10, 0x70,
+  0x40, 0x75, 0x58, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73,
+  0x50, 0x81, 0x93, 0x50, 0x04, 0x94, 0x58, 0x73, 0x50, 0x6a, 0x28, 0x61, 0x08, 0x60, 0x08, 0x81,
+  0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x84, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x02, 0x61, 0x08, 0x62, 0x08, 0x62,
+  0x10, 0x83, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01,
+  0x61, 0x08, 0x61, 0x10, 0x88, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x82, 0x61, 0x10,
+  0x81, 0x60, 0x08, 0x04, 0x69, 0x28, 0x72, 0x50, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x85, 0x73, 0x50, 0x03, 0x75, 0x58, 0x71, 0x48, 0x64, 0x10, 0x60, 0x00, 0xff, 0x61, 0x08,
+  0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x06,
+  0x62, 0x10, 0x61, 0x08, 0x60, 0x00, 0x67, 0x20, 0x73, 0x50, 0x74, 0x50, 0x72, 0x50, 0x82, 0x73,
+  0x50, 0x0a, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x92, 0x50, 0x73, 0x50, 0x74, 0x58,
+  0x6e, 0x38, 0x63, 0x10, 0x60, 0x08, 0x61, 0x08, 0x81, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08,
+  0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x03, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61,
+  0x08, 0x82, 0x62, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x02, 0x62, 0x08, 0x61, 0x10, 0x62,
+  0x10, 0x82, 0x61, 0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x05,
+  0x80, 0x08, 0x62, 0x08, 0x6d, 0x38, 0x74, 0x58, 0x74, 0x50, 0x72, 0x50, 0x86, 0x73, 0x50, 0x00,
+  0x72, 0x50, 0x81, 0x74, 0x50, 0x03, 0x68, 0x20, 0x60, 0x00, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0x8c, 0x61, 0x08, 0x04, 0x60, 0x08, 0x6b, 0x30, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x85,
+  0x73, 0x50, 0x07, 0x72, 0x50, 0x73, 0x50, 0x94, 0x58, 0x72, 0x48, 0x67, 0x20, 0x60, 0x08, 0x61,
+  0x08, 0x62, 0x10, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x03, 0x61, 0x10, 0x62,
+  0x08, 0x61, 0x10, 0x62, 0x08, 0x8a, 0x61, 0x08, 0x03, 0x62, 0x08, 0x61, 0x10, 0x62, 0x08, 0x62,
+  0x10, 0x81, 0x62, 0x08, 0x00, 0x61, 0x08, 0x82, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08,
+  0x82, 0x62, 0x10, 0x04, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10,
+  0x84, 0x61, 0x08, 0x07, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x60, 0x00, 0x66, 0x18, 0x71, 0x48,
+  0x75, 0x58, 0x93, 0x50, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x05, 0x72, 0x50,
+  0x93, 0x50, 0x75, 0x58, 0x6c, 0x30, 0x61, 0x08, 0x60, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xfb, 0x61, 0x08, 0x82, 0x61, 0x10, 0x87, 0x61, 0x08, 0x04, 0x60, 0x08, 0x61, 0x08, 0x6e, 0x38,
+  0x75, 0x58, 0x93, 0x50, 0x81, 0x72, 0x50, 0x84, 0x73, 0x50, 0x07, 0x72, 0x50, 0x73, 0x50, 0x74,
+  0x58, 0x6d, 0x38, 0x62, 0x10, 0x60, 0x08, 0x61, 0x10, 0x61, 0x08, 0x82, 0x61, 0x10, 0x95, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x02, 0x61, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x83, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81,
+  0x62, 0x08, 0x01, 0x61, 0x08, 0x62, 0x08, 0x83, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08,
+  0x00, 0x62, 0x10, 0x81, 0x62, 0x08, 0x02, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10,
+  0x81, 0x62, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x83, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x08,
+  0x83, 0x61, 0x08, 0x03, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x05, 0x60, 0x08, 0x61, 0x08,
+  0x6c, 0x30, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x85, 0x73, 0x50, 0x06, 0x93, 0x50, 0x72, 0x50,
+  0x75, 0x58, 0x70, 0x40, 0x62, 0x10, 0x60, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x10,
+  0x61, 0x10, 0xff, 0x61, 0x08, 0x82, 0x61, 0x08, 0x04, 0x60, 0x08, 0x63, 0x10, 0x71, 0x48, 0x74,
+  0x58, 0x93, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x06, 0x93, 0x50, 0x72,
+  0x50, 0x74, 0x58, 0x72, 0x50, 0x67, 0x20, 0x60, 0x08, 0x61, 0x08, 0x81, 0x61, 0x10, 0x97, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x62, 0x08, 0x82, 0x61, 0x08, 0x03, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81,
+  0x62, 0x08, 0x02, 0x82, 0x08, 0x62, 0x08, 0x82, 0x10, 0x81, 0x62, 0x08, 0x01, 0x61, 0x08, 0x62,
+  0x08, 0x82, 0x62, 0x10, 0x01, 0x62, 0x08, 0x61, 0x08, 0x81, 0x62, 0x08, 0x81, 0x61, 0x10, 0x00,
+  0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10,
+  0x04, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62,
+  0x10, 0x83, 0x61, 0x08, 0x82, 0x61, 0x10, 0x0a, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x60, 0x00,
+  0x66, 0x18, 0x72, 0x48, 0x74, 0x58, 0x72, 0x50, 0x93, 0x50, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x03, 0x74, 0x58, 0x72, 0x48, 0x65, 0x18, 0x60, 0x08, 0xfd, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x06, 0x60, 0x08, 0x66,
+  0x18, 0x73, 0x50, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x05, 0x72,
+  0x50, 0x73, 0x50, 0x75, 0x58, 0x6e, 0x38, 0x82, 0x10, 0x60, 0x08, 0x83, 0x61, 0x10, 0xb8, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08,
+  0x84, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x04, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08,
+  0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x41, 0x10, 0x82, 0x00, 0x10, 0x82, 0x20, 0x10,
+  0x83, 0x00, 0x10, 0x01, 0x20, 0x08, 0x61, 0x10, 0x81, 0x62, 0x08, 0x84, 0x62, 0x10, 0x00, 0x62,
+  0x08, 0x81, 0x61, 0x08, 0x07, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x62, 0x08, 0x61, 0x10, 0x84, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x03, 0x60, 0x08, 0x62, 0x08, 0x6d, 0x38, 0x75, 0x58, 0x87,
+  0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x74, 0x50, 0x01, 0x67, 0x20, 0x60, 0x00, 0xff, 0x61, 0x08,
+  0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x04, 0x60, 0x00, 0x68, 0x20, 0x74, 0x50,
+  0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x81, 0x74, 0x50, 0x04, 0x69, 0x28, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x94, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x62, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x84, 0x62, 0x08,
+  0x0f, 0x20, 0x08, 0x00, 0x10, 0x41, 0x10, 0x25, 0x11, 0x49, 0x0a, 0x4d, 0x0b, 0x51, 0x0c, 0xd4,
+  0x0c, 0xf4, 0x0c, 0x15, 0x0d, 0xf4, 0x0c, 0x93, 0x0c, 0xcf, 0x0b, 0x0c, 0x0b, 0xc7, 0x09, 0xa3,
+  0x10, 0x81, 0x00, 0x10, 0x01, 0x61, 0x08, 0x82, 0x10, 0x82, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62,
+  0x10, 0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x08, 0x83, 0x62, 0x10, 0x81, 0x61,
+  0x08, 0x00, 0x62, 0x10, 0x86, 0x61, 0x08, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08,
+  0x60, 0x00, 0x68, 0x20, 0x73, 0x50, 0x94, 0x58, 0x92, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x04, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x6a, 0x28, 0x60, 0x00, 0xff, 0x61,
+  0x08, 0x07, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x60, 0x00, 0x6a, 0x28, 0x75, 0x58, 0x73, 0x50,
+  0x72, 0x50, 0x85, 0x73, 0x50, 0x05, 0x72, 0x50, 0x74, 0x58, 0x71, 0x48, 0x64, 0x10, 0x60, 0x08,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x87, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x62, 0x08, 0x09, 0x82, 0x10, 0x61, 0x10, 0x20, 0x10, 0x00, 0x10,
+  0x66, 0x11, 0x6e, 0x0b, 0x35, 0x0d, 0x3a, 0x0e, 0x9b, 0x0e, 0xbc, 0x0e, 0x81, 0x9b, 0x0e, 0x81,
+  0x7b, 0x0e, 0x81, 0x9b, 0x0e, 0x0a, 0xbb, 0x0e, 0xbc, 0x0e, 0x7b, 0x0e, 0xd8, 0x0d, 0x72, 0x0c,
+  0x4a, 0x12, 0x82, 0x10, 0x00, 0x10, 0x41, 0x08, 0x82, 0x08, 0x62, 0x08, 0x82, 0x62, 0x10, 0x02,
+  0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x82, 0x62, 0x10, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x02,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01,
+  0x61, 0x10, 0x62, 0x10, 0x83, 0x61, 0x10, 0x05, 0x60, 0x08, 0x64, 0x10, 0x71, 0x48, 0x95, 0x58,
+  0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x75, 0x58, 0x6c,
+  0x30, 0x60, 0x08, 0xfd, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x08, 0x60, 0x08, 0x6b,
+  0x30, 0x75, 0x58, 0x93, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x05, 0x73, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x61, 0x08, 0x60, 0x08, 0x62, 0x10, 0x82,
+  0x61, 0x10, 0x83, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x99, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8f, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x89, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x81, 0x62, 0x08,
+  0x0d, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x82, 0x08, 0x20, 0x10, 0x00, 0x10, 0xa7, 0x09, 0x93,
+  0x0c, 0x5a, 0x0e, 0xbc, 0x0e, 0x7b, 0x0e, 0x3a, 0x0e, 0x39, 0x0e, 0x19, 0x0e, 0x86, 0x39, 0x0e,
+  0x81, 0x19, 0x0e, 0x07, 0x5a, 0x0e, 0x9b, 0x0e, 0x9c, 0x0e, 0xb8, 0x0d, 0x4d, 0x0b, 0xa2, 0x10,
+  0x00, 0x10, 0x61, 0x08, 0x81, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10,
+  0x03, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x82, 0x61, 0x10, 0x06, 0x61,
+  0x08, 0x62, 0x10, 0x60, 0x08, 0x81, 0x08, 0x6d, 0x38, 0x75, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x01, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02, 0x93, 0x50, 0x75, 0x58, 0x6e, 0x38, 0xfd,
+  0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x8d, 0x38, 0x75, 0x58, 0x85, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x69, 0x28, 0x60, 0x08, 0x85, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa2, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x89, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x00, 0x62, 0x10, 0x81, 0x61, 0x10, 0x02, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x82, 0x62, 0x08, 0x81, 0x61, 0x08, 0x09, 0x62, 0x08, 0x61, 0x08, 0x00, 0x10, 0x24, 0x11, 0x72,
+  0x0c, 0x7b, 0x0e, 0x9b, 0x0e, 0x3a, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x8e, 0x39, 0x0e, 0x07, 0x5a,
+  0x0e, 0xdc, 0x06, 0xd8, 0x0d, 0xab, 0x0a, 0x00, 0x10, 0x21, 0x10, 0x82, 0x08, 0x61, 0x08, 0x83,
+  0x62, 0x10, 0x84, 0x62, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x81, 0x62, 0x10, 0x02, 0x61, 0x10,
+  0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x05, 0x61, 0x08, 0x60, 0x08, 0x69, 0x28, 0x74, 0x50, 0x73, 0x50, 0x92, 0x50, 0x81, 0x72, 0x50,
+  0x83, 0x73, 0x50, 0x04, 0x72, 0x50, 0x75, 0x58, 0x6f, 0x40, 0x61, 0x08, 0x60, 0x08, 0xf9, 0x61,
+  0x08, 0x05, 0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x6e, 0x38, 0x75, 0x58, 0x92, 0x50, 0x82, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x05, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50, 0x73, 0x50, 0x66, 0x18, 0x60,
+  0x00, 0xad, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x81, 0x62,
+  0x08, 0x06, 0x61, 0x10, 0x82, 0x08, 0x41, 0x08, 0x00, 0x10, 0xec, 0x12, 0x3a, 0x0e, 0xbc, 0x0e,
+  0x83, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8f, 0x39, 0x0e, 0x06, 0x19, 0x0e, 0x5a, 0x0e, 0xbc, 0x0e,
+  0xb3, 0x0c, 0xc3, 0x10, 0x00, 0x10, 0x82, 0x10, 0x83, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x08, 0x82, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x86, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08,
+  0x66, 0x18, 0x73, 0x50, 0x74, 0x50, 0x81, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73,
+  0x50, 0x04, 0x72, 0x50, 0x75, 0x58, 0x70, 0x40, 0x61, 0x08, 0x60, 0x08, 0xf7, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x0e, 0x6e, 0x38, 0x75, 0x58, 0x72, 0x50, 0x93, 0x50, 0x73, 0x50,
+  0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x71, 0x48, 0x63, 0x10,
+  0x60, 0x08, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xa4, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x84, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x81, 0x62, 0x08, 0x00,
+  0x61, 0x08, 0x82, 0x62, 0x10, 0x05, 0x82, 0x08, 0x20, 0x10, 0x61, 0x10, 0x72, 0x0c, 0xdc, 0x0e,
+  0x5a, 0x0e, 0x97, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0xbc, 0x0e, 0xd8, 0x0d, 0x66, 0x11, 0x00, 0x10,
+  0x82, 0x08, 0x86, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x05, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x87, 0x61,
+  0x08, 0x07, 0x61, 0x10, 0x60, 0x08, 0x63, 0x10, 0x71, 0x48, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50,
+  0x72, 0x50, 0x83, 0x73, 0x50, 0x05, 0x72, 0x50, 0x75, 0x58, 0x70, 0x40, 0x62, 0x08, 0x60, 0x08,
+  0x61, 0x10, 0xbc, 0x61, 0x08, 0x00, 0x61, 0x10, 0xb6, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x02, 0x6e, 0x38, 0x75, 0x58, 0x72, 0x50, 0x84, 0x73, 0x50, 0x06, 0x72, 0x50, 0x73, 0x50,
+  0x75, 0x58, 0x6f, 0x40, 0x61, 0x08, 0x60, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x92, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x94, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x08, 0x01, 0x61,
+  0x08, 0x62, 0x08, 0x85, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62,
+  0x08, 0x61, 0x08, 0x83, 0x62, 0x08, 0x04, 0x82, 0x10, 0x20, 0x10, 0xc3, 0x10, 0x56, 0x0d, 0xdc,
+  0x0e, 0x9a, 0x39, 0x0e, 0x06, 0x19, 0x0e, 0x7b, 0x0e, 0x39, 0x0e, 0x45, 0x11, 0x00, 0x10, 0x82,
+  0x08, 0x82, 0x10, 0x82, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x62, 0x10, 0x01, 0x62, 0x08, 0x61,
+  0x10, 0x82, 0x62, 0x10, 0x81, 0x61, 0x08, 0x02, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x09, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x60,
+  0x08, 0x61, 0x08, 0x6e, 0x38, 0x75, 0x58, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x03, 0x74, 0x58, 0x70, 0x40, 0x62, 0x08, 0x60, 0x08, 0xc8, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xab, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x75, 0x58, 0x82, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x75, 0x58, 0x6d, 0x38, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8b, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x62, 0x08, 0x89, 0x61, 0x08, 0x01, 0x62, 0x10,
+  0x61, 0x08, 0x81, 0x62, 0x10, 0x02, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x62, 0x08, 0x00,
+  0x61, 0x10, 0x82, 0x62, 0x10, 0x06, 0x82, 0x10, 0x20, 0x10, 0xe3, 0x10, 0x97, 0x0d, 0xbb, 0x0e,
+  0x19, 0x0e, 0x3a, 0x0e, 0x9a, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0x9b, 0x0e, 0xb7, 0x0d, 0x82, 0x10,
+  0x20, 0x10, 0x81, 0x61, 0x10, 0x01, 0x82, 0x10, 0x62, 0x10, 0x83, 0x62, 0x08, 0x81, 0x62, 0x10,
+  0x04, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x06, 0x61,
+  0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x83, 0x61, 0x10,
+  0x03, 0x61, 0x08, 0x80, 0x08, 0x6d, 0x38, 0x75, 0x58, 0x86, 0x73, 0x50, 0x02, 0x72, 0x50, 0x74,
+  0x58, 0x50, 0x40, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x92, 0x61, 0x08, 0x00, 0x61, 0x10, 0xd9,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6d, 0x38, 0x75, 0x58, 0x81,
+  0x72, 0x50, 0x82, 0x73, 0x50, 0x08, 0x72, 0x50, 0x73, 0x50, 0x92, 0x50, 0x75, 0x58, 0x6b, 0x30,
+  0x60, 0x00, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xab, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x08, 0x81, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x82, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x61, 0x08,
+  0x81, 0x62, 0x10, 0x83, 0x62, 0x08, 0x05, 0x62, 0x10, 0x82, 0x10, 0x21, 0x10, 0xc3, 0x10, 0xb7,
+  0x0d, 0x9b, 0x0e, 0x9e, 0x39, 0x0e, 0x02, 0x19, 0x0e, 0xbc, 0x0e, 0x72, 0x0c, 0x81, 0xa3, 0x10,
+  0x01, 0x62, 0x10, 0x20, 0x10, 0x82, 0x00, 0x10, 0x03, 0x41, 0x10, 0x61, 0x08, 0x82, 0x08, 0x82,
+  0x10, 0x82, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10,
+  0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x82, 0x61, 0x10, 0x04,
+  0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x6b, 0x30, 0x75, 0x58, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01, 0x74, 0x58, 0x6f, 0x40, 0x81, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x98, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc7, 0x61, 0x08,
+  0x02, 0x60, 0x00, 0x6c, 0x38, 0x75, 0x58, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x02, 0x75, 0x58, 0x6a, 0x28, 0x60, 0x00, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x9e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x03,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x83, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62, 0x10,
+  0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x62,
+  0x10, 0x00, 0x82, 0x10, 0x81, 0x41, 0x10, 0x03, 0x15, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x3a, 0x0e,
+  0x82, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8b, 0x39, 0x0e, 0x81, 0x7b, 0x0e, 0x00, 0x5a, 0x0e, 0x89,
+  0x39, 0x0e, 0x0c, 0x3a, 0x0e, 0x39, 0x0e, 0x19, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0xd8, 0x0d, 0x56,
+  0x0d, 0xb3, 0x0c, 0x31, 0x0c, 0x2d, 0x0b, 0x29, 0x12, 0x45, 0x11, 0x82, 0x10, 0x81, 0x00, 0x10,
+  0x03, 0x41, 0x10, 0x61, 0x10, 0x62, 0x10, 0x82, 0x10, 0x82, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81,
+  0x62, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x82, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x03, 0x80, 0x08, 0x6a, 0x28, 0x75, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50,
+  0x02, 0x92, 0x50, 0x75, 0x58, 0x4f, 0x40, 0xf1, 0x61, 0x08, 0x05, 0x60, 0x00, 0x6b, 0x30, 0x75,
+  0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x02, 0x74, 0x58, 0x69, 0x28, 0x60,
+  0x00, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0xad, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08,
+  0x01, 0x62, 0x10, 0x61, 0x10, 0x89, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x81,
+  0x62, 0x10, 0x06, 0x82, 0x10, 0x61, 0x08, 0x00, 0x10, 0xf0, 0x0b, 0xbc, 0x06, 0x19, 0x0e, 0x3a,
+  0x0e, 0x8d, 0x39, 0x0e, 0x08, 0x19, 0x0e, 0x7b, 0x0e, 0x5a, 0x0e, 0x15, 0x0d, 0xb3, 0x0c, 0x56,
+  0x0d, 0x7b, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x8a, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x5a, 0x0e,
+  0x13, 0x9b, 0x0e, 0xbb, 0x0e, 0xbc, 0x0e, 0x9b, 0x0e, 0x5a, 0x0e, 0x97, 0x0d, 0x52, 0x0c, 0xcb,
+  0x0a, 0x25, 0x11, 0x20, 0x10, 0x00, 0x10, 0x41, 0x10, 0x62, 0x08, 0x62, 0x10, 0x82, 0x10, 0x61,
+  0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61,
+  0x10, 0x84, 0x61, 0x08, 0x05, 0x62, 0x10, 0x61, 0x10, 0x60, 0x00, 0x69, 0x28, 0x74, 0x58, 0x73,
+  0x50, 0x84, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x80, 0x08, 0xee,
+  0x61, 0x08, 0x04, 0x60, 0x00, 0x6a, 0x28, 0x75, 0x58, 0x93, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x06, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x58, 0x68, 0x20, 0x60, 0x00, 0x61, 0x10, 0xa6,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x04, 0x62,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x83, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61,
+  0x10, 0x81, 0x62, 0x10, 0x81, 0x62, 0x08, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08,
+  0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0x6a, 0x0a, 0xbc, 0x0e, 0x85, 0x39, 0x0e, 0x00, 0x3a, 0x0e,
+  0x87, 0x39, 0x0e, 0x0a, 0x3a, 0x0e, 0x19, 0x0e, 0x9b, 0x06, 0x56, 0x0d, 0x66, 0x11, 0x21, 0x10,
+  0x20, 0x10, 0x61, 0x10, 0x09, 0x12, 0xd8, 0x0d, 0x5a, 0x0e, 0x8d, 0x39, 0x0e, 0x00, 0x3a, 0x0e,
+  0x82, 0x39, 0x0e, 0x0c, 0x3a, 0x0e, 0x5a, 0x0e, 0x9b, 0x0e, 0xbc, 0x0e, 0x3a, 0x0e, 0x15, 0x0d,
+  0x2d, 0x0b, 0x25, 0x11, 0x00, 0x10, 0x00, 0x08, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x83, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x03, 0x80, 0x00, 0x69, 0x28, 0x75, 0x58, 0x73, 0x50, 0x86, 0x72, 0x50, 0x02, 0x75, 0x58, 0x6b,
+  0x30, 0x60, 0x00, 0xeb, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x68, 0x20, 0x75, 0x58, 0x82,
+  0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x68,
+  0x20, 0x60, 0x00, 0x61, 0x10, 0xa7, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x88, 0x61, 0x08, 0x01, 0x62, 0x08, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x62, 0x10, 0x01, 0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x10,
+  0x04, 0x82, 0x10, 0x41, 0x10, 0xc3, 0x10, 0xf9, 0x0d, 0x5a, 0x0e, 0x8f, 0x39, 0x0e, 0x08, 0x7a,
+  0x0e, 0x77, 0x0d, 0x82, 0x10, 0x00, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x00, 0x10, 0x45,
+  0x11, 0x81, 0x3a, 0x0e, 0x90, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x83, 0x39, 0x0e, 0x09, 0x7b, 0x0e,
+  0xbc, 0x0e, 0x5a, 0x0e, 0xb3, 0x0c, 0x49, 0x0a, 0x61, 0x10, 0x00, 0x10, 0x61, 0x08, 0x82, 0x08,
+  0x62, 0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x06, 0x60, 0x00, 0x69, 0x28, 0x75, 0x58,
+  0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03, 0x72, 0x50, 0x75, 0x58,
+  0x69, 0x28, 0x60, 0x00, 0xe9, 0x61, 0x08, 0x06, 0x61, 0x10, 0x60, 0x08, 0x65, 0x18, 0x74, 0x50,
+  0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02, 0x75, 0x58, 0x69,
+  0x28, 0x80, 0x00, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x9b, 0x61, 0x08, 0x00, 0x62, 0x08, 0x8a, 0x61, 0x08, 0x04, 0x62,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x82, 0x62, 0x10, 0x03, 0x61, 0x08, 0x62,
+  0x10, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x62,
+  0x10, 0x04, 0x82, 0x08, 0x00, 0x10, 0x11, 0x0c, 0xbc, 0x0e, 0x19, 0x0e, 0x8f, 0x39, 0x0e, 0x02,
+  0x9b, 0x0e, 0x29, 0x12, 0x00, 0x10, 0x81, 0x82, 0x10, 0x00, 0x62, 0x10, 0x81, 0x82, 0x08, 0x02,
+  0x00, 0x10, 0xaf, 0x0b, 0x9b, 0x0e, 0x8c, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x88, 0x39, 0x0e, 0x0c,
+  0x19, 0x0e, 0x3a, 0x0e, 0x9b, 0x0e, 0xbc, 0x0e, 0x76, 0x0d, 0xcb, 0x0a, 0x61, 0x10, 0x00, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x83, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x05, 0x60, 0x00, 0x69, 0x28, 0x75, 0x58, 0x72, 0x50, 0x73,
+  0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x02, 0x74, 0x50, 0x67, 0x20, 0x60, 0x00, 0xe7, 0x61, 0x08,
+  0x05, 0x61, 0x10, 0x60, 0x08, 0x64, 0x10, 0x73, 0x50, 0x93, 0x50, 0x72, 0x50, 0x85, 0x73, 0x50,
+  0x04, 0x75, 0x58, 0x6a, 0x28, 0x80, 0x00, 0x61, 0x08, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x92, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62,
+  0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x81, 0x62, 0x08, 0x81, 0x61, 0x08, 0x01,
+  0x62, 0x08, 0x62, 0x10, 0x81, 0x62, 0x08, 0x03, 0x20, 0x10, 0xa7, 0x11, 0x7b, 0x0e, 0x3a, 0x0e,
+  0x8c, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x39, 0x0e, 0x03, 0x5a, 0x0e, 0xf8, 0x0d, 0xa3, 0x10,
+  0x41, 0x10, 0x84, 0x62, 0x10, 0x02, 0x00, 0x10, 0x4a, 0x0a, 0x9b, 0x0e, 0x92, 0x39, 0x0e, 0x00,
+  0x3a, 0x0e, 0x85, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0x5a, 0x06, 0xbc, 0x0e, 0x77, 0x0d, 0x4a, 0x0a,
+  0x20, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x84, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x05, 0x61, 0x08, 0x60, 0x00, 0x6a, 0x28, 0x75, 0x58, 0x72, 0x50, 0x93,
+  0x50, 0x82, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60,
+  0x08, 0xe8, 0x61, 0x08, 0x01, 0x71, 0x48, 0x74, 0x50, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x03,
+  0x72, 0x50, 0x75, 0x58, 0x6b, 0x30, 0x60, 0x00, 0xa7, 0x61, 0x08, 0x00, 0x62, 0x08, 0x8a, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x03, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x81, 0x62, 0x08, 0x04, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x05, 0x62, 0x08, 0x82, 0x08, 0x00,
+  0x10, 0xb3, 0x0c, 0x9b, 0x0e, 0x19, 0x0e, 0x8f, 0x39, 0x0e, 0x05, 0x5a, 0x0e, 0xb7, 0x0d, 0xa2,
+  0x10, 0x61, 0x10, 0x62, 0x10, 0x82, 0x10, 0x82, 0x62, 0x10, 0x02, 0x00, 0x10, 0x6a, 0x0a, 0x9b,
+  0x06, 0x8e, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x84, 0x39, 0x0e, 0x02, 0x19, 0x0e, 0x39, 0x0e, 0x3a,
+  0x0e, 0x81, 0x5a, 0x0e, 0x06, 0x7b, 0x0e, 0x9b, 0x0e, 0xbb, 0x06, 0xfd, 0x0e, 0x3e, 0x0f, 0x6e,
+  0x0b, 0x20, 0x10, 0x8f, 0x61, 0x08, 0x05, 0x60, 0x00, 0x6b, 0x30, 0x95, 0x58, 0x92, 0x50, 0x72,
+  0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50, 0x72, 0x48, 0x62,
+  0x08, 0xe6, 0x61, 0x08, 0x0e, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x60, 0x08, 0x61,
+  0x08, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x05, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x62, 0x10, 0x82, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x04, 0x62, 0x08, 0x62, 0x10, 0x20, 0x10, 0xa7, 0x11, 0x7b, 0x0e, 0x81, 0x39, 0x0e, 0x00,
+  0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x03, 0x3a, 0x0e, 0x5a, 0x0e,
+  0x25, 0x11, 0x21, 0x10, 0x82, 0x82, 0x10, 0x04, 0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0xf0, 0x0b,
+  0x9b, 0x0e, 0x90, 0x39, 0x0e, 0x0e, 0x3a, 0x0e, 0x5a, 0x0e, 0x9b, 0x0e, 0xbb, 0x06, 0x9b, 0x06,
+  0x7b, 0x0e, 0x19, 0x06, 0xd8, 0x0d, 0x77, 0x0d, 0xd4, 0x0c, 0x31, 0x0c, 0x2d, 0x0b, 0xab, 0x12,
+  0xa7, 0x11, 0x25, 0x11, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x85, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x0b, 0x80, 0x08, 0x8c, 0x38, 0x75, 0x58,
+  0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x94, 0x58,
+  0x6f, 0x40, 0xe5, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6a, 0x30, 0x75, 0x58, 0x81, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6e, 0x40, 0x60, 0x08, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x62,
+  0x10, 0x93, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x02, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x04, 0x62, 0x08, 0x62,
+  0x10, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x81, 0x62, 0x08, 0x84, 0x62, 0x10, 0x03, 0x82, 0x10,
+  0x00, 0x10, 0x72, 0x0c, 0x9b, 0x06, 0x92, 0x39, 0x0e, 0x03, 0x9b, 0x0e, 0xd0, 0x0b, 0x00, 0x10,
+  0x62, 0x10, 0x82, 0x82, 0x10, 0x03, 0x00, 0x10, 0x25, 0x11, 0x5a, 0x0e, 0x3a, 0x0e, 0x8c, 0x39,
+  0x0e, 0x01, 0x19, 0x0e, 0x5a, 0x0e, 0x81, 0x9b, 0x0e, 0x09, 0x19, 0x0e, 0x36, 0x0d, 0x31, 0x0c,
+  0x4e, 0x0b, 0x4a, 0x12, 0xc8, 0x11, 0x24, 0x11, 0xc3, 0x10, 0x62, 0x10, 0x20, 0x10, 0x82, 0x00,
+  0x10, 0x01, 0x20, 0x10, 0x41, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x86, 0x61, 0x08, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x03, 0x61, 0x08,
+  0x60, 0x08, 0x6e, 0x40, 0x74, 0x58, 0x84, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58,
+  0x6c, 0x30, 0x60, 0x00, 0xe2, 0x61, 0x08, 0x04, 0x60, 0x08, 0x66, 0x18, 0x74, 0x58, 0x73, 0x50,
+  0x72, 0x50, 0x83, 0x73, 0x50, 0x02, 0x72, 0x50, 0x74, 0x50, 0x70, 0x40, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xad, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8e, 0x61,
+  0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x03, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10,
+  0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x62, 0x10, 0x01, 0x41, 0x10, 0x04, 0x11, 0x81, 0x3a,
+  0x0e, 0x90, 0x39, 0x0e, 0x81, 0x3a, 0x0e, 0x02, 0x39, 0x0e, 0x7b, 0x0e, 0xec, 0x12, 0x83, 0x00,
+  0x10, 0x02, 0x04, 0x11, 0x76, 0x0d, 0x7b, 0x0e, 0x8c, 0x39, 0x0e, 0x06, 0x5a, 0x0e, 0xbc, 0x0e,
+  0xf9, 0x0d, 0x31, 0x0c, 0x49, 0x12, 0x04, 0x11, 0x41, 0x10, 0x82, 0x00, 0x10, 0x00, 0x20, 0x10,
+  0x81, 0x41, 0x10, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x04, 0x61, 0x08, 0x62, 0x08,
+  0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x02,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x81, 0x08, 0x02, 0x70, 0x40, 0x74, 0x50, 0x72, 0x50,
+  0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x75, 0x58, 0x68, 0x20, 0x60, 0x00, 0xe0, 0x61, 0x08,
+  0x01, 0x60, 0x08, 0x63, 0x10, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x04, 0x73, 0x50, 0x72, 0x48, 0x63, 0x10, 0x60, 0x08, 0x62, 0x10, 0x9f, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x92, 0x61, 0x08, 0x00, 0x62, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x08, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x62, 0x08, 0x00, 0x61, 0x08, 0x82, 0x62, 0x08, 0x02, 0x62, 0x10,
+  0x62, 0x08, 0x61, 0x08, 0x84, 0x62, 0x10, 0x02, 0x00, 0x10, 0x4d, 0x0b, 0xbc, 0x0e, 0x94, 0x39,
+  0x0e, 0x08, 0x3a, 0x0e, 0x9b, 0x0e, 0xd4, 0x0c, 0xec, 0x0a, 0x6a, 0x12, 0xaf, 0x0b, 0x19, 0x0e,
+  0x7b, 0x0e, 0x19, 0x0e, 0x8a, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e, 0x19, 0x0e, 0x2d, 0x0b,
+  0xc3, 0x10, 0x81, 0x00, 0x10, 0x00, 0x41, 0x10, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61,
+  0x10, 0x82, 0x62, 0x10, 0x00, 0x61, 0x08, 0x83, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x81, 0x61, 0x10, 0x06,
+  0x61, 0x08, 0x62, 0x10, 0x80, 0x08, 0x83, 0x10, 0x72, 0x48, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x64, 0x10, 0x60, 0x08, 0x90, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xce, 0x61, 0x08, 0x02, 0x70, 0x40, 0x74, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x82, 0x72, 0x50, 0x05, 0x73, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x62, 0x10, 0x61, 0x10,
+  0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xaa, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81, 0x62, 0x08, 0x01, 0x61,
+  0x10, 0x61, 0x08, 0x81, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00,
+  0x62, 0x10, 0x81, 0x62, 0x08, 0x82, 0x62, 0x10, 0x82, 0x61, 0x10, 0x01, 0x56, 0x0d, 0x5a, 0x0e,
+  0x93, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x39, 0x0e, 0x01, 0x9b, 0x0e, 0xbc, 0x0e, 0x81, 0x9b,
+  0x0e, 0x00, 0x3a, 0x0e, 0x8b, 0x39, 0x0e, 0x07, 0x3a, 0x0e, 0xbc, 0x0e, 0x72, 0x0c, 0xc3, 0x10,
+  0x00, 0x10, 0x41, 0x08, 0x82, 0x10, 0x62, 0x08, 0x84, 0x62, 0x10, 0x01, 0x62, 0x08, 0x61, 0x08,
+  0x82, 0x62, 0x10, 0x81, 0x62, 0x08, 0x90, 0x61, 0x08, 0x83, 0x61, 0x10, 0x81, 0x61, 0x08, 0x05,
+  0x62, 0x10, 0x60, 0x08, 0x64, 0x18, 0x74, 0x50, 0x93, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03,
+  0x72, 0x50, 0x73, 0x50, 0x74, 0x50, 0x71, 0x48, 0xde, 0x61, 0x08, 0x0d, 0x61, 0x10, 0x60, 0x00,
+  0x6b, 0x30, 0x75, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50,
+  0x92, 0x50, 0x74, 0x58, 0x68, 0x20, 0x60, 0x08, 0x81, 0x61, 0x10, 0xb2, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08, 0x85, 0x61, 0x08, 0x00, 0x62, 0x10, 0x89, 0x61, 0x08,
+  0x01, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61,
+  0x08, 0x62, 0x10, 0x81, 0x62, 0x08, 0x82, 0x62, 0x10, 0x03, 0x82, 0x10, 0x20, 0x10, 0xe8, 0x11,
+  0x9b, 0x0e, 0x85, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x91, 0x39, 0x0e, 0x81, 0x19, 0x0e, 0x8c, 0x39,
+  0x0e, 0x06, 0x5a, 0x0e, 0x9b, 0x06, 0xec, 0x0a, 0x00, 0x10, 0x21, 0x10, 0x82, 0x10, 0x62, 0x08,
+  0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x81, 0x61, 0x08, 0x02, 0x62,
+  0x08, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x08, 0x91, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x03, 0x60, 0x08, 0x68, 0x20, 0x74, 0x58, 0x72, 0x50,
+  0x84, 0x73, 0x50, 0x03, 0x72, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x60, 0x00, 0xdb, 0x61, 0x08, 0x05,
+  0x61, 0x10, 0x60, 0x08, 0x66, 0x18, 0x74, 0x58, 0x73, 0x50, 0x93, 0x50, 0x81, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x02, 0x95, 0x58, 0x6c, 0x30, 0x60, 0x08, 0x81, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x9c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8b, 0x61,
+  0x08, 0x07, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x62, 0x08, 0x61, 0x08,
+  0x62, 0x08, 0x82, 0x62, 0x10, 0x02, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x03,
+  0x82, 0x10, 0x00, 0x10, 0x31, 0x0c, 0x9b, 0x0e, 0x91, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x93, 0x39,
+  0x0e, 0x05, 0x3a, 0x0e, 0x9b, 0x06, 0x6a, 0x12, 0x00, 0x10, 0x61, 0x10, 0x82, 0x10, 0x81, 0x62,
+  0x10, 0x81, 0x62, 0x08, 0x02, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62,
+  0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x81, 0x62, 0x08, 0x84, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x81, 0x61, 0x10, 0x02, 0x60, 0x00, 0x6b, 0x30, 0x95, 0x58,
+  0x85, 0x73, 0x50, 0x03, 0x72, 0x50, 0x75, 0x58, 0x68, 0x20, 0x60, 0x00, 0xdb, 0x61, 0x08, 0x02,
+  0x62, 0x08, 0x72, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x04, 0x72, 0x50, 0x74,
+  0x58, 0x6f, 0x40, 0x60, 0x08, 0x61, 0x08, 0x83, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x97, 0x61, 0x08, 0x00, 0x61, 0x10, 0x96, 0x61, 0x08, 0x00, 0x62, 0x10, 0x8c, 0x61, 0x08, 0x00,
+  0x62, 0x08, 0x81, 0x61, 0x08, 0x03, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x82, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x62, 0x08, 0x82, 0x62, 0x10, 0x04, 0x62, 0x08,
+  0x62, 0x10, 0x21, 0x10, 0x25, 0x11, 0x5a, 0x0e, 0x96, 0x39, 0x0e, 0x81, 0x3a, 0x0e, 0x00, 0x39,
+  0x0e, 0x81, 0x3a, 0x0e, 0x8a, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e, 0xcb, 0x12, 0x00, 0x10,
+  0x61, 0x10, 0x81, 0x82, 0x10, 0x85, 0x62, 0x10, 0x04, 0x61, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62,
+  0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x87, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x58, 0x72, 0x50,
+  0x83, 0x73, 0x50, 0x04, 0x72, 0x50, 0x93, 0x50, 0x73, 0x50, 0x63, 0x10, 0x60, 0x08, 0xb3, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x58,
+  0x72, 0x50, 0x82, 0x73, 0x50, 0x05, 0x72, 0x50, 0x92, 0x50, 0x73, 0x50, 0x72, 0x50, 0x62, 0x10,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x90, 0x61, 0x08, 0x04, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x85,
+  0x61, 0x08, 0x09, 0x62, 0x10, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08, 0x62,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x62, 0x08, 0x83, 0x62, 0x10,
+  0x05, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0x11, 0x0c, 0xbc, 0x0e, 0x90, 0x39, 0x0e,
+  0x00, 0x3a, 0x0e, 0x93, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0xbc, 0x0e, 0x31, 0x0c, 0x00, 0x10, 0x62,
+  0x10, 0x82, 0x10, 0x83, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x82, 0x61, 0x08, 0x02,
+  0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08, 0x85, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x87, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61,
+  0x08, 0x03, 0x62, 0x10, 0x72, 0x48, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x03, 0x93, 0x50, 0x74, 0x58, 0x6f, 0x40, 0x60, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xd4,
+  0x61, 0x08, 0x03, 0x62, 0x10, 0x60, 0x08, 0x67, 0x20, 0x74, 0x58, 0x81, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x50, 0x66, 0x20, 0x60, 0x08, 0x61, 0x10, 0x8b,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x85, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x05, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61,
+  0x10, 0x62, 0x08, 0x85, 0x62, 0x10, 0x04, 0x82, 0x10, 0x00, 0x10, 0xa7, 0x11, 0x7b, 0x0e, 0x39,
+  0x0e, 0x81, 0x3a, 0x0e, 0x99, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x88, 0x39, 0x0e, 0x04, 0x5a, 0x0e,
+  0xd8, 0x0d, 0xa2, 0x10, 0x41, 0x10, 0x82, 0x08, 0x81, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x62,
+  0x10, 0x08, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08,
+  0x61, 0x10, 0x62, 0x08, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x03, 0x62, 0x10,
+  0x60, 0x08, 0x65, 0x18, 0x74, 0x50, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04,
+  0x72, 0x50, 0x75, 0x58, 0x69, 0x28, 0x60, 0x00, 0x61, 0x10, 0xd6, 0x61, 0x08, 0x02, 0x62, 0x10,
+  0x72, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x92, 0x50, 0x75,
+  0x58, 0x6c, 0x30, 0x60, 0x00, 0x82, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x98, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x05, 0x61, 0x10, 0x62, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10,
+  0x81, 0x62, 0x10, 0x02, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x02, 0x82, 0x10,
+  0x62, 0x10, 0x82, 0x10, 0x81, 0x41, 0x10, 0x02, 0x56, 0x0d, 0x7b, 0x0e, 0x39, 0x0e, 0x81, 0x3a,
+  0x0e, 0xa2, 0x39, 0x0e, 0x03, 0x19, 0x0e, 0xbc, 0x0e, 0xcb, 0x0a, 0x00, 0x10, 0x81, 0x82, 0x10,
+  0x86, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x02, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x02,
+  0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x03, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x61, 0x08, 0x82, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x05, 0x61, 0x08, 0x61, 0x10, 0x80, 0x08, 0x6a, 0x28, 0x74, 0x58, 0x92, 0x50, 0x81, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x03, 0x93, 0x50, 0x73, 0x50, 0x64, 0x10, 0x60, 0x08, 0x84, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xcc, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x05, 0x60, 0x00, 0x6d,
+  0x38, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x94,
+  0x50, 0x70, 0x40, 0x81, 0x08, 0x61, 0x08, 0x82, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x62, 0x08, 0x85, 0x61, 0x08, 0x82,
+  0x61, 0x10, 0x84, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x03, 0x61, 0x10, 0x62, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10, 0x82, 0x61, 0x08, 0x04, 0x61, 0x10, 0x62, 0x10, 0x61,
+  0x10, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x62,
+  0x10, 0x00, 0x62, 0x08, 0x84, 0x62, 0x10, 0x81, 0x82, 0x10, 0x03, 0x61, 0x10, 0x00, 0x10, 0xf0,
+  0x0b, 0xbc, 0x06, 0xa6, 0x39, 0x0e, 0x03, 0x5a, 0x0e, 0x97, 0x0d, 0x82, 0x10, 0x61, 0x10, 0x86,
+  0x62, 0x10, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x62, 0x08, 0x06, 0x61, 0x08, 0x62, 0x08,
+  0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x8a, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x62, 0x10, 0x83, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x92, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08,
+  0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xce, 0x61, 0x08, 0x03, 0x60, 0x08, 0x86, 0x18, 0x74, 0x58,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03, 0x93, 0x50, 0x73, 0x50, 0x64, 0x18, 0x60,
+  0x08, 0x82, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x90, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82,
+  0x61, 0x08, 0x00, 0x62, 0x10, 0x86, 0x61, 0x08, 0x81, 0x61, 0x10, 0x02, 0x61, 0x08, 0x62, 0x08,
+  0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x62, 0x10, 0x02, 0x61, 0x10, 0x61, 0x08,
+  0x62, 0x08, 0x83, 0x62, 0x10, 0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x85, 0x62, 0x10, 0x00,
+  0x61, 0x10, 0x83, 0x62, 0x10, 0x06, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0x0d, 0x0b, 0xbc, 0x0e,
+  0x39, 0x0e, 0x3a, 0x0e, 0x83, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8b, 0x39, 0x0e, 0x00, 0x3a, 0x0e,
+  0x89, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x88, 0x39, 0x0e, 0x03, 0xbc, 0x0e, 0x6e, 0x0b, 0x00, 0x10,
+  0x82, 0x10, 0x87, 0x62, 0x10, 0x08, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0x8c, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x63, 0x10, 0x85, 0x73, 0x50, 0x05, 0x92,
+  0x50, 0x72, 0x50, 0x75, 0x58, 0x68, 0x20, 0x60, 0x08, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc6, 0x61, 0x08, 0x02, 0x71, 0x48, 0x73, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x06, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x69, 0x28, 0x60,
+  0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61, 0x10, 0x92,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x83, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x86, 0x61, 0x08, 0x03, 0x62,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x82, 0x62, 0x10, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08,
+  0x85, 0x62, 0x10, 0x00, 0x62, 0x08, 0x83, 0x62, 0x10, 0x04, 0x82, 0x10, 0x61, 0x08, 0x00, 0x10,
+  0x0d, 0x0b, 0xbc, 0x06, 0x81, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x39, 0x0e, 0x81, 0x3a, 0x0e,
+  0x82, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x9d, 0x39, 0x0e, 0x02, 0x7b, 0x0e, 0xa6, 0x11, 0x20, 0x10,
+  0x83, 0x62, 0x10, 0x00, 0x61, 0x08, 0x82, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x83, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x84, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x02, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x87, 0x61, 0x08, 0x03, 0x62, 0x10, 0x60, 0x00, 0x68, 0x20, 0x75, 0x58, 0x81, 0x72, 0x50, 0x83,
+  0x73, 0x50, 0x02, 0x93, 0x50, 0x72, 0x48, 0x62, 0x10, 0xd2, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6b,
+  0x30, 0x75, 0x58, 0x72, 0x50, 0x84, 0x73, 0x50, 0x02, 0x74, 0x58, 0x6f, 0x40, 0x60, 0x08, 0x8d,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x97, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x10, 0x87, 0x61, 0x08, 0x00, 0x62, 0x08, 0x85, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62,
+  0x08, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x62, 0x10, 0x00, 0x61, 0x10, 0x84, 0x62, 0x10,
+  0x09, 0x62, 0x08, 0x62, 0x10, 0x82, 0x10, 0x41, 0x10, 0x00, 0x10, 0x8e, 0x0b, 0xbc, 0x0e, 0x3a,
+  0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x89, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x92, 0x39, 0x0e, 0x04, 0x5a, 0x0e, 0x97, 0x0d, 0x82, 0x10, 0x61, 0x10, 0x82, 0x10, 0x82,
+  0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x81, 0x62, 0x08, 0x82, 0x62, 0x10, 0x81, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x93, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x6e, 0x38,
+  0x74, 0x58, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x6d, 0x38, 0x60,
+  0x08, 0xd0, 0x61, 0x08, 0x01, 0x60, 0x08, 0x63, 0x10, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x03, 0x93, 0x50, 0x74, 0x50, 0x64, 0x10, 0x60, 0x08, 0xa0, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x8a, 0x61, 0x08,
+  0x04, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x62, 0x08, 0x82, 0x61, 0x08, 0x03, 0x61,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x83, 0x61, 0x08, 0x81, 0x62, 0x08, 0x01, 0x61, 0x08,
+  0x61, 0x10, 0x86, 0x62, 0x10, 0x00, 0x82, 0x10, 0x81, 0x62, 0x10, 0x05, 0x62, 0x08, 0x82, 0x08,
+  0x00, 0x10, 0x62, 0x10, 0x72, 0x0c, 0xbc, 0x0e, 0x90, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x83, 0x39,
+  0x0e, 0x00, 0x3a, 0x0e, 0x92, 0x39, 0x0e, 0x02, 0x7b, 0x0e, 0x93, 0x0c, 0x00, 0x10, 0x84, 0x62,
+  0x10, 0x01, 0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10, 0x81, 0x62, 0x08, 0x00, 0x62, 0x10, 0x81,
+  0x62, 0x08, 0x00, 0x62, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x08, 0x61, 0x10, 0x61, 0x08, 0x63,
+  0x10, 0x73, 0x50, 0x93, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x02, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0xce, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x6e,
+  0x38, 0x74, 0x58, 0x72, 0x50, 0x83, 0x73, 0x50, 0x04, 0x72, 0x50, 0x75, 0x58, 0x6a, 0x30, 0x60,
+  0x08, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x04, 0x62,
+  0x10, 0x61, 0x10, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x02, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x81,
+  0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x07, 0x82,
+  0x10, 0x62, 0x10, 0x82, 0x10, 0x62, 0x08, 0x00, 0x10, 0x25, 0x11, 0x77, 0x0d, 0xbc, 0x0e, 0x88,
+  0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x98, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x02, 0xbb,
+  0x0e, 0x8f, 0x0b, 0x00, 0x10, 0x85, 0x62, 0x10, 0x07, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x62,
+  0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x82, 0x61,
+  0x10, 0x84, 0x61, 0x08, 0x03, 0x62, 0x10, 0x80, 0x08, 0x68, 0x28, 0x74, 0x58, 0x82, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x02, 0x74, 0x50, 0x70, 0x40, 0x60, 0x08, 0x99, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa6, 0x61, 0x08, 0x02, 0x60, 0x08, 0x66, 0x18, 0x74, 0x58,
+  0x83, 0x72, 0x50, 0x04, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x71, 0x48, 0x81, 0x08, 0x84, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x99, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x98, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61,
+  0x10, 0x00, 0x62, 0x08, 0x82, 0x62, 0x10, 0x00, 0x61, 0x10, 0x85, 0x62, 0x10, 0x06, 0x82, 0x10,
+  0x41, 0x10, 0x00, 0x10, 0x6a, 0x12, 0x3a, 0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0x98, 0x39, 0x0e, 0x00,
+  0x3a, 0x0e, 0x87, 0x39, 0x0e, 0x81, 0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x02, 0xbc, 0x0e, 0xec, 0x0a,
+  0x00, 0x10, 0x86, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x90, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x0d, 0x61, 0x10, 0x61, 0x08,
+  0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50,
+  0x92, 0x50, 0x75, 0x58, 0x68, 0x20, 0x60, 0x08, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc8, 0x61,
+  0x08, 0x02, 0x60, 0x08, 0x70, 0x40, 0x94, 0x50, 0x81, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50,
+  0x81, 0x93, 0x50, 0x03, 0x74, 0x58, 0x66, 0x18, 0x60, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x04, 0x62, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x03,
+  0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08, 0x81, 0x62, 0x10, 0x02, 0x62,
+  0x08, 0x62, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x06, 0x00, 0x10, 0x62, 0x10, 0x10, 0x0c, 0xbc,
+  0x06, 0x5a, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0xaa, 0x39, 0x0e, 0x02, 0x9b, 0x0e, 0x29, 0x12, 0x20,
+  0x10, 0x86, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0xa4, 0x61, 0x08, 0x04, 0x62, 0x10, 0x60,
+  0x08, 0x65, 0x18, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x72, 0x48, 0x62, 0x08, 0xcc, 0x61, 0x08, 0x0b, 0x60, 0x08, 0x68, 0x20, 0x75, 0x58, 0x92,
+  0x50, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6e, 0x38, 0x60,
+  0x08, 0x9a, 0x61, 0x08, 0x81, 0x62, 0x08, 0x90, 0x61, 0x08, 0x00, 0x62, 0x08, 0x8d, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x84, 0x61, 0x08, 0x05, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x62,
+  0x08, 0x61, 0x08, 0x81, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x08, 0x81,
+  0x62, 0x10, 0x81, 0x62, 0x08, 0x81, 0x62, 0x10, 0x05, 0x82, 0x10, 0x61, 0x08, 0x00, 0x10, 0xa7,
+  0x11, 0x97, 0x0d, 0xbc, 0x0e, 0x8c, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0xa0, 0x39, 0x0e, 0x02, 0x7a,
+  0x0e, 0xa7, 0x11, 0x20, 0x10, 0x84, 0x62, 0x10, 0x04, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x00, 0x6c, 0x30, 0x74, 0x58, 0x72,
+  0x50, 0x83, 0x73, 0x50, 0x03, 0x72, 0x48, 0x75, 0x58, 0x6a, 0x28, 0x60, 0x00, 0xcc, 0x61, 0x08,
+  0x01, 0x71, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x93,
+  0x50, 0x73, 0x50, 0x63, 0x10, 0x60, 0x08, 0x89, 0x61, 0x08, 0x81, 0x61, 0x10, 0xa4, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x84,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x02, 0x62, 0x08, 0x61, 0x10,
+  0x62, 0x10, 0x81, 0x61, 0x08, 0x85, 0x62, 0x10, 0x07, 0x61, 0x10, 0x82, 0x10, 0x00, 0x10, 0x41,
+  0x10, 0x6e, 0x0b, 0x9b, 0x0e, 0x7b, 0x0e, 0x19, 0x0e, 0x87, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8f,
+  0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8d, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x85, 0x39, 0x0e, 0x03, 0x5a,
+  0x0e, 0x86, 0x09, 0x20, 0x10, 0x62, 0x10, 0x82, 0x62, 0x08, 0x82, 0x62, 0x10, 0x05, 0x61, 0x08,
+  0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x01, 0x61, 0x10,
+  0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08, 0x97, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x63, 0x10,
+  0x84, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x73, 0x50, 0x73, 0x48, 0x62, 0x08, 0xca, 0x61, 0x08,
+  0x02, 0x60, 0x08, 0x69, 0x28, 0x75, 0x58, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x03, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x08, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa2,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08, 0x03, 0x62,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x08, 0x81,
+  0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61,
+  0x08, 0x84, 0x62, 0x10, 0x06, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0x66, 0x11, 0x56, 0x0d, 0xbc,
+  0x0e, 0x3a, 0x0e, 0x88, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x90, 0x39, 0x0e, 0x02, 0xd8, 0x0d, 0x5a,
+  0x0e, 0x19, 0x0e, 0x92, 0x39, 0x0e, 0x02, 0x7a, 0x0e, 0x86, 0x11, 0x20, 0x10, 0x81, 0x62, 0x10,
+  0x82, 0x62, 0x08, 0x84, 0x62, 0x10, 0x02, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x88, 0x61, 0x08,
+  0x01, 0x62, 0x10, 0x62, 0x08, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x00, 0x69,
+  0x28, 0x75, 0x58, 0x72, 0x50, 0x81, 0x73, 0x50, 0x06, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74,
+  0x58, 0x6b, 0x30, 0x60, 0x00, 0x62, 0x10, 0xc9, 0x61, 0x08, 0x03, 0x71, 0x48, 0x73, 0x50, 0x72,
+  0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x48, 0x62, 0x08, 0xb4, 0x61, 0x08,
+  0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x89, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x10,
+  0x81, 0x62, 0x10, 0x02, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x83, 0x62, 0x10, 0x00, 0x82, 0x10, 0x81, 0x20, 0x10, 0x03, 0x2d, 0x0b, 0x7b,
+  0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0x82, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x91, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x83, 0x39, 0x0e, 0x04, 0x5a, 0x0e, 0x35, 0x0d, 0xd3, 0x14, 0x9b, 0x0e, 0x19, 0x0e, 0x91,
+  0x39, 0x0e, 0x06, 0x7a, 0x0e, 0x86, 0x11, 0x20, 0x10, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x61,
+  0x08, 0x82, 0x62, 0x10, 0x02, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x85, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x85, 0x61, 0x08, 0x00, 0x62, 0x10, 0x97, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x01, 0x71, 0x48, 0x73, 0x50, 0x84, 0x72, 0x50, 0x02, 0x93,
+  0x50, 0x73, 0x50, 0x63, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc2, 0x61, 0x08, 0x02, 0x60,
+  0x08, 0x69, 0x28, 0x74, 0x58, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x74,
+  0x58, 0x69, 0x28, 0x60, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0xb0, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x86, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x82, 0x61, 0x08, 0x06, 0x61, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x84, 0x62, 0x08, 0x84, 0x62,
+  0x10, 0x06, 0x61, 0x10, 0x00, 0x10, 0xe4, 0x10, 0xd4, 0x0c, 0xdc, 0x0e, 0x3a, 0x0e, 0x19, 0x0e,
+  0x9c, 0x39, 0x0e, 0x03, 0x9b, 0x0e, 0xcb, 0x12, 0x15, 0x0d, 0x7b, 0x0e, 0x91, 0x39, 0x0e, 0x02,
+  0x7b, 0x0e, 0x86, 0x09, 0x20, 0x10, 0x82, 0x62, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x61,
+  0x08, 0x81, 0x62, 0x08, 0x01, 0x61, 0x08, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81,
+  0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x92, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61,
+  0x08, 0x06, 0x60, 0x08, 0x67, 0x20, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x00, 0xc8, 0x61, 0x08, 0x00, 0x71, 0x48,
+  0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x71, 0x48, 0x84,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0x8b, 0x61, 0x08, 0x01, 0x62, 0x08, 0x62, 0x10, 0x85, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61,
+  0x08, 0x81, 0x62, 0x10, 0x04, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x61, 0x08, 0x81,
+  0x62, 0x08, 0x00, 0x61, 0x08, 0x82, 0x62, 0x10, 0x04, 0x61, 0x10, 0x00, 0x10, 0x49, 0x12, 0x19,
+  0x0e, 0xbc, 0x0e, 0x81, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8e,
+  0x39, 0x0e, 0x02, 0x3a, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x04, 0x9b, 0x0e, 0x72,
+  0x0c, 0x04, 0x11, 0x5a, 0x0e, 0x3a, 0x0e, 0x8a, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x84, 0x39, 0x0e,
+  0x02, 0x7b, 0x0e, 0xa6, 0x09, 0x20, 0x10, 0x81, 0x62, 0x08, 0x03, 0x62, 0x10, 0x62, 0x08, 0x62,
+  0x10, 0x62, 0x08, 0x86, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x96,
+  0x61, 0x08, 0x02, 0x70, 0x40, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00,
+  0x63, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0xb6, 0x61, 0x08, 0x03, 0x60, 0x08, 0x68, 0x20,
+  0x75, 0x58, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x75, 0x58, 0x69, 0x28, 0x60,
+  0x08, 0xae, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x88,
+  0x61, 0x08, 0x81, 0x62, 0x08, 0x84, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x10, 0x82, 0x62, 0x10,
+  0x00, 0x62, 0x08, 0x86, 0x62, 0x10, 0x06, 0x82, 0x10, 0x20, 0x10, 0x41, 0x10, 0xd0, 0x0b, 0xbc,
+  0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x9f, 0x39, 0x0e, 0x04, 0x3a, 0x0e, 0x39, 0x0e, 0x41, 0x10, 0x8e,
+  0x0b, 0xbc, 0x0e, 0x90, 0x39, 0x0e, 0x03, 0x7b, 0x0e, 0xc7, 0x11, 0x20, 0x10, 0x62, 0x10, 0x82,
+  0x62, 0x08, 0x08, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61,
+  0x08, 0x62, 0x08, 0x62, 0x10, 0x81, 0x62, 0x08, 0x83, 0x61, 0x08, 0x04, 0x62, 0x10, 0x61, 0x08,
+  0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9c, 0x61, 0x08, 0x03,
+  0x62, 0x10, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04, 0x72,
+  0x50, 0x75, 0x58, 0x6b, 0x30, 0x60, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc2,
+  0x61, 0x08, 0x02, 0x70, 0x40, 0x74, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02, 0x72, 0x50, 0x73,
+  0x50, 0x71, 0x48, 0x83, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x99, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x62, 0x08,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x81, 0x62, 0x10, 0x04, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08,
+  0x85, 0x62, 0x10, 0x08, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0x04, 0x11, 0x35, 0x0d,
+  0xbc, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x87, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x98, 0x39, 0x0e, 0x02,
+  0x9b, 0x0e, 0xc7, 0x11, 0xa2, 0x10, 0x81, 0x3a, 0x0e, 0x8f, 0x39, 0x0e, 0x02, 0x9b, 0x0e, 0x29,
+  0x12, 0x00, 0x10, 0x81, 0x62, 0x10, 0x81, 0x62, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x81, 0x62,
+  0x10, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x02, 0x61, 0x10,
+  0x61, 0x08, 0x62, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x03, 0x60, 0x08, 0x70, 0x40, 0x74, 0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x01,
+  0x72, 0x48, 0x62, 0x08, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0xbf, 0x61, 0x08, 0x03, 0x60, 0x08,
+  0x67, 0x20, 0x74, 0x58, 0x72, 0x50, 0x83, 0x73, 0x50, 0x04, 0x92, 0x50, 0x75, 0x58, 0x68, 0x28,
+  0x60, 0x08, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x87, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x87, 0x61, 0x08, 0x07, 0x61, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x82, 0x62,
+  0x10, 0x01, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x10, 0x81, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00,
+  0x82, 0x10, 0x81, 0x62, 0x10, 0x05, 0x61, 0x10, 0x00, 0x10, 0x29, 0x0a, 0x19, 0x0e, 0x9b, 0x0e,
+  0x19, 0x0e, 0x8b, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8c, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x88, 0x39,
+  0x0e, 0x04, 0xbc, 0x0e, 0xab, 0x12, 0x00, 0x10, 0x72, 0x0c, 0x9b, 0x0e, 0x8f, 0x39, 0x0e, 0x03,
+  0xbb, 0x0e, 0xab, 0x12, 0x00, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x01, 0x62, 0x08, 0x61, 0x08,
+  0x82, 0x62, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10,
+  0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x82, 0x61, 0x08, 0x03, 0x62, 0x08, 0x60, 0x08, 0x67, 0x20, 0x74, 0x58, 0x81, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x69, 0x28, 0x60, 0x08, 0x84,
+  0x61, 0x08, 0x00, 0x62, 0x08, 0x98, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xa1,
+  0x61, 0x08, 0x03, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x01, 0x71, 0x48, 0x81, 0x08, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0xab,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x05, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62,
+  0x10, 0x61, 0x10, 0x62, 0x10, 0x81, 0x62, 0x08, 0x86, 0x62, 0x10, 0x07, 0x82, 0x10, 0x41, 0x10,
+  0x00, 0x10, 0x4e, 0x0b, 0x9c, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x99, 0x39, 0x0e, 0x00,
+  0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x07, 0x3a, 0x0e, 0x39, 0x0e, 0xbc, 0x0e, 0xec, 0x0a, 0x00, 0x10,
+  0x6a, 0x12, 0x9b, 0x0e, 0x19, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0xbc, 0x0e, 0x0c, 0x0b, 0x00, 0x10,
+  0x81, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x61, 0x08, 0x81, 0x62, 0x10, 0x03,
+  0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x03, 0x70, 0x40, 0x74, 0x50,
+  0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x00, 0x71, 0x48, 0xc3, 0x61, 0x08, 0x02, 0x60, 0x08,
+  0x65, 0x18, 0x74, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x94, 0x58,
+  0x69, 0x28, 0x60, 0x00, 0x62, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x62, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x85, 0x62, 0x10, 0x81, 0x82, 0x10, 0x04, 0x20,
+  0x10, 0x61, 0x10, 0x72, 0x0c, 0xdc, 0x06, 0x3a, 0x0e, 0xa6, 0x39, 0x0e, 0x05, 0xbb, 0x0e, 0x4e,
+  0x0b, 0x00, 0x10, 0x04, 0x11, 0x19, 0x0e, 0x3a, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0xbc, 0x0e, 0x4d,
+  0x0b, 0x00, 0x10, 0x85, 0x62, 0x10, 0x02, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x82, 0x62, 0x10,
+  0x03, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0xa2, 0x61, 0x08, 0x05, 0x61, 0x10, 0x61, 0x08, 0x61,
+  0x10, 0x60, 0x08, 0x67, 0x20, 0x74, 0x58, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x02, 0x74, 0x58, 0x67, 0x20, 0x60, 0x08, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa0, 0x61, 0x08,
+  0x02, 0x60, 0x00, 0x6c, 0x30, 0x74, 0x58, 0x82, 0x72, 0x50, 0x82, 0x73, 0x50, 0x01, 0x72, 0x48,
+  0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x83, 0x61, 0x10, 0x83, 0x61, 0x08, 0x03,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x62, 0x08,
+  0x88, 0x62, 0x10, 0x05, 0x82, 0x08, 0x00, 0x10, 0xe4, 0x10, 0x56, 0x0d, 0xbc, 0x0e, 0x19, 0x0e,
+  0x93, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x92, 0x39, 0x0e, 0x05, 0xbc, 0x0e, 0x0d, 0x0b, 0x00, 0x10,
+  0x41, 0x10, 0x35, 0x0d, 0x7b, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0xbc, 0x0e, 0x6e, 0x0b, 0x00, 0x10,
+  0x86, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x62,
+  0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x10, 0x92, 0x61, 0x08, 0x81, 0x61, 0x10, 0x86,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x71, 0x48, 0x81, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x02, 0x74, 0x58, 0x6f, 0x40, 0x60, 0x08, 0xc1, 0x61, 0x08, 0x02, 0x63,
+  0x10, 0x72, 0x48, 0x73, 0x50, 0x84, 0x72, 0x50, 0x05, 0x75, 0x58, 0x6b, 0x30, 0x60, 0x00, 0x61,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x84, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x83, 0x62, 0x08, 0x87, 0x62, 0x10, 0x04, 0x00, 0x10, 0xa6, 0x11, 0xf9, 0x0d, 0x9b,
+  0x0e, 0x19, 0x0e, 0xa8, 0x39, 0x0e, 0x01, 0xbc, 0x0e, 0xcb, 0x0a, 0x81, 0x00, 0x10, 0x01, 0x52,
+  0x0c, 0x9b, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0xbc, 0x0e, 0xaf, 0x0b, 0x00, 0x10, 0x86, 0x62, 0x10,
+  0x81, 0x62, 0x08, 0x00, 0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xa8, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x06, 0x61, 0x10,
+  0x60, 0x08, 0x69, 0x28, 0x75, 0x58, 0x92, 0x50, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02,
+  0x74, 0x50, 0x64, 0x18, 0x60, 0x08, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xb4, 0x61, 0x08, 0x02, 0x60, 0x08, 0x69, 0x28, 0x74, 0x58, 0x82, 0x72, 0x50, 0x01,
+  0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x63, 0x10, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x8e, 0x61, 0x08, 0x00, 0x62, 0x10, 0x87, 0x61, 0x08, 0x81, 0x62, 0x08, 0x02, 0x61, 0x08, 0x62,
+  0x08, 0x62, 0x10, 0x81, 0x62, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x84, 0x62,
+  0x10, 0x05, 0x61, 0x08, 0x00, 0x10, 0x4a, 0x0a, 0x7a, 0x0e, 0x7b, 0x0e, 0x19, 0x0e, 0x8d, 0x39,
+  0x0e, 0x00, 0x3a, 0x0e, 0x8e, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8a, 0x39, 0x0e, 0x01, 0xbc, 0x0e,
+  0x8b, 0x0a, 0x81, 0x00, 0x10, 0x01, 0x8f, 0x0b, 0xbc, 0x0e, 0x8e, 0x39, 0x0e, 0x03, 0x9b, 0x0e,
+  0xf0, 0x0b, 0x00, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x07, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10,
+  0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x94, 0x61, 0x08, 0x00, 0x62, 0x08,
+  0x94, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x01, 0x62, 0x10, 0x72, 0x48, 0x84, 0x73,
+  0x50, 0x03, 0x72, 0x50, 0x74, 0x58, 0x6c, 0x30, 0x60, 0x08, 0xbc, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x01, 0x70, 0x40, 0x74, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50,
+  0x72, 0x50, 0x74, 0x50, 0x6d, 0x38, 0x60, 0x00, 0xa2, 0x61, 0x08, 0x00, 0x62, 0x08, 0x8f, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x04, 0x61, 0x10, 0x62, 0x08, 0x61, 0x10, 0x61, 0x08,
+  0x62, 0x08, 0x82, 0x61, 0x08, 0x84, 0x62, 0x10, 0x00, 0x62, 0x08, 0x85, 0x62, 0x10, 0x05, 0x82,
+  0x10, 0x61, 0x10, 0x00, 0x10, 0x0d, 0x0b, 0x9b, 0x0e, 0x5a, 0x0e, 0x8f, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x8e, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x87, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x39, 0x0e,
+  0x05, 0x9b, 0x0e, 0x29, 0x12, 0x20, 0x10, 0x00, 0x10, 0x2d, 0x0b, 0xbc, 0x0e, 0x8a, 0x39, 0x0e,
+  0x00, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x05, 0x9b, 0x0e, 0x11, 0x0c, 0x00, 0x10, 0x61, 0x10, 0x62,
+  0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x03, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x61, 0x10, 0x81,
+  0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x03, 0x60, 0x00, 0x6b, 0x30, 0x75, 0x58, 0x72, 0x50,
+  0x84, 0x73, 0x50, 0x01, 0x72, 0x48, 0x62, 0x08, 0xbe, 0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18,
+  0x74, 0x50, 0x84, 0x72, 0x50, 0x03, 0x92, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x90, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08,
+  0x91, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08, 0x81, 0x62, 0x08, 0x83, 0x61, 0x08, 0x82,
+  0x62, 0x08, 0x01, 0x62, 0x10, 0x61, 0x08, 0x84, 0x62, 0x10, 0x07, 0x82, 0x10, 0x62, 0x10, 0x82,
+  0x10, 0x41, 0x10, 0x00, 0x10, 0xf0, 0x0b, 0xbc, 0x0e, 0x3a, 0x0e, 0x8f, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x90, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x84, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x83, 0x39, 0x0e,
+  0x05, 0x3a, 0x0e, 0x45, 0x11, 0x41, 0x10, 0x00, 0x10, 0x0d, 0x0b, 0xbc, 0x0e, 0x8e, 0x39, 0x0e,
+  0x0d, 0x9b, 0x0e, 0x31, 0x0c, 0x00, 0x10, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62,
+  0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08,
+  0x81, 0x62, 0x10, 0xa2, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x01, 0x64, 0x10, 0x74,
+  0x50, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x68, 0x20, 0x60, 0x08, 0xbc, 0x61,
+  0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6c, 0x30, 0x74, 0x58, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50,
+  0x02, 0x74, 0x50, 0x70, 0x40, 0x60, 0x08, 0x9a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x62, 0x08, 0x85, 0x61, 0x08, 0x03, 0x62, 0x08, 0x62,
+  0x10, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x08, 0x82, 0x62, 0x08,
+  0x01, 0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x07, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x20,
+  0x10, 0x61, 0x10, 0x93, 0x0c, 0xbc, 0x0e, 0x19, 0x0e, 0x8a, 0x39, 0x0e, 0x02, 0x3a, 0x0e, 0x39,
+  0x0e, 0x3a, 0x0e, 0x94, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x88, 0x39, 0x0e, 0x06, 0x5a, 0x0e, 0xb8,
+  0x0d, 0xa3, 0x10, 0x61, 0x10, 0x00, 0x10, 0x0d, 0x0b, 0xbc, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0xbb,
+  0x0e, 0x10, 0x0c, 0x00, 0x10, 0x84, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x83, 0x62,
+  0x10, 0x00, 0x62, 0x08, 0x86, 0x61, 0x08, 0x81, 0x61, 0x10, 0x98, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x91, 0x61, 0x08, 0x05, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x02, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0xaf, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x8c, 0x61, 0x08, 0x03, 0x62, 0x08, 0x72, 0x48, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x04,
+  0x72, 0x50, 0x75, 0x58, 0x68, 0x28, 0x60, 0x08, 0x61, 0x10, 0x96, 0x61, 0x08, 0x00, 0x62, 0x08,
+  0x82, 0x61, 0x08, 0x00, 0x62, 0x10, 0x88, 0x61, 0x08, 0x81, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08,
+  0x62, 0x08, 0x82, 0x61, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x81, 0x62, 0x08, 0x81, 0x61, 0x08,
+  0x81, 0x62, 0x08, 0x84, 0x62, 0x10, 0x81, 0x82, 0x10, 0x04, 0x00, 0x10, 0xa3, 0x10, 0x15, 0x0d,
+  0xbc, 0x0e, 0x19, 0x0e, 0x8d, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x95, 0x39, 0x0e, 0x00, 0x3a, 0x0e,
+  0x87, 0x39, 0x0e, 0x06, 0x7b, 0x0e, 0xb3, 0x0c, 0x20, 0x10, 0x82, 0x10, 0x00, 0x10, 0x2e, 0x0b,
+  0xbc, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0x9b, 0x0e, 0xf0, 0x0b, 0x00, 0x10, 0x82, 0x62, 0x10, 0x00,
+  0x61, 0x08, 0x85, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x10, 0x08, 0x62, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x8c, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x10, 0x8e,
+  0x61, 0x08, 0x05, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x67, 0x20, 0x74, 0x58, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x63, 0x10, 0x9d, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x9c, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50, 0x72, 0x50, 0x84,
+  0x73, 0x50, 0x01, 0x72, 0x48, 0x62, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x92, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x62, 0x08, 0x83,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x84,
+  0x62, 0x10, 0x06, 0x82, 0x10, 0x62, 0x08, 0x00, 0x10, 0x04, 0x11, 0x97, 0x0d, 0xbb, 0x0e, 0x19,
+  0x0e, 0x87, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x83, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x39, 0x0e,
+  0x00, 0x3a, 0x0e, 0x83, 0x39, 0x0e, 0x81, 0x3a, 0x0e, 0x8b, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81,
+  0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x86, 0x39, 0x0e, 0x07, 0x19, 0x0e, 0x9c, 0x0e, 0x4e, 0x0b, 0x00,
+  0x10, 0x82, 0x10, 0x00, 0x10, 0xd0, 0x0b, 0x9b, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0xbb, 0x0e, 0x8e,
+  0x0b, 0x00, 0x10, 0x87, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x85,
+  0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x98, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x71, 0x48, 0x81,
+  0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x94, 0x58, 0x6a, 0x28, 0x60,
+  0x08, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9b, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x03, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x58, 0x72, 0x50, 0x82, 0x73, 0x50, 0x04,
+  0x72, 0x50, 0x74, 0x58, 0x6d, 0x38, 0x60, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10,
+  0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x85, 0x61, 0x08, 0x83, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x08, 0x00, 0x62,
+  0x10, 0x82, 0x62, 0x08, 0x82, 0x62, 0x10, 0x81, 0x82, 0x10, 0x04, 0x00, 0x10, 0xa6, 0x11, 0xf9,
+  0x0d, 0x7b, 0x0e, 0x19, 0x0e, 0x8d, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x84, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x99, 0x39, 0x0e, 0x07, 0x19, 0x0e, 0x9b, 0x0e, 0xc7, 0x11, 0x20, 0x10, 0x82, 0x10, 0x20,
+  0x10, 0xb4, 0x0c, 0x7b, 0x0e, 0x8e, 0x39, 0x0e, 0x02, 0xdc, 0x0e, 0x2d, 0x0b, 0x00, 0x10, 0x89,
+  0x62, 0x10, 0x81, 0x62, 0x08, 0x01, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10,
+  0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0xa9, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x6b, 0x30,
+  0x74, 0x58, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x94, 0x50, 0x70, 0x40, 0x60,
+  0x08, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0xb2, 0x61, 0x08, 0x01, 0x62, 0x10, 0x72,
+  0x48, 0x82, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50, 0x66, 0x18, 0x60,
+  0x08, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x04, 0x62, 0x08, 0x61,
+  0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x84, 0x62, 0x10, 0x05, 0x82, 0x10, 0x62, 0x08, 0x00,
+  0x10, 0x29, 0x0a, 0x5a, 0x0e, 0x7b, 0x0e, 0x87, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x99, 0x39, 0x0e,
+  0x00, 0x3a, 0x0e, 0x8c, 0x39, 0x0e, 0x02, 0x5a, 0x0e, 0x97, 0x0d, 0x82, 0x10, 0x81, 0x61, 0x10,
+  0x02, 0x62, 0x10, 0x77, 0x0d, 0x5a, 0x0e, 0x87, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x85, 0x39, 0x0e,
+  0x02, 0xbb, 0x06, 0xab, 0x0a, 0x00, 0x10, 0x84, 0x62, 0x10, 0x04, 0x61, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x62, 0x10, 0x62, 0x08, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa0, 0x61, 0x08, 0x01, 0x64, 0x18, 0x74, 0x50, 0x81,
+  0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01, 0x73, 0x50, 0x64, 0x10, 0x82,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xb6, 0x61, 0x08, 0x03, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50, 0x72,
+  0x50, 0x84, 0x73, 0x50, 0x00, 0x71, 0x48, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xa2, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x62, 0x08, 0x02, 0x62, 0x10, 0x82,
+  0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x06, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0xcc, 0x0a, 0x9b,
+  0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x85, 0x39, 0x0e, 0x82, 0x3a, 0x0e, 0xa7, 0x39, 0x0e, 0x05, 0xbc,
+  0x0e, 0xaf, 0x0b, 0x00, 0x10, 0x82, 0x10, 0x41, 0x10, 0x25, 0x11, 0x81, 0x3a, 0x0e, 0x8e, 0x39,
+  0x0e, 0x03, 0x7b, 0x0e, 0xe7, 0x11, 0x20, 0x10, 0x82, 0x10, 0x85, 0x62, 0x10, 0x81, 0x61, 0x08,
+  0x02, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08,
+  0x81, 0x62, 0x08, 0x01, 0x61, 0x08, 0x62, 0x10, 0x88, 0x61, 0x08, 0x81, 0x61, 0x10, 0xa1, 0x61,
+  0x08, 0x02, 0x60, 0x08, 0x70, 0x40, 0x74, 0x50, 0x83, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x58,
+  0x6a, 0x28, 0x60, 0x08, 0xb8, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x58,
+  0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x00, 0x62,
+  0x10, 0x97, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08,
+  0x01, 0x62, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x62, 0x10, 0x81, 0x82,
+  0x10, 0x04, 0x41, 0x10, 0x00, 0x10, 0x6e, 0x0b, 0xbc, 0x0e, 0x3a, 0x0e, 0xb2, 0x39, 0x0e, 0x07,
+  0x5a, 0x0e, 0x66, 0x11, 0x21, 0x10, 0x82, 0x10, 0x00, 0x10, 0x6a, 0x12, 0x9b, 0x0e, 0x19, 0x0e,
+  0x8e, 0x39, 0x0e, 0x05, 0x3a, 0x06, 0x66, 0x11, 0x41, 0x10, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08,
+  0x84, 0x62, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x88, 0x61, 0x08, 0x81, 0x62, 0x08, 0x01, 0x61,
+  0x08, 0x61, 0x10, 0xab, 0x61, 0x08, 0x05, 0x61, 0x10, 0x60, 0x08, 0x69, 0x28, 0x74, 0x58, 0x72,
+  0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0xb9,
+  0x61, 0x08, 0x02, 0x62, 0x08, 0x72, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02,
+  0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0xa0, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8f, 0x61, 0x08, 0x81, 0x62, 0x08, 0x85, 0x61, 0x08, 0x00, 0x62, 0x08, 0x84, 0x62,
+  0x10, 0x00, 0x82, 0x10, 0x81, 0x41, 0x10, 0x01, 0x32, 0x0c, 0xbc, 0x0e, 0x81, 0x39, 0x0e, 0x00,
+  0x3a, 0x0e, 0xb0, 0x39, 0x0e, 0x07, 0x9b, 0x0e, 0xd4, 0x0c, 0x00, 0x10, 0x62, 0x10, 0x82, 0x10,
+  0x00, 0x10, 0x11, 0x0c, 0x9b, 0x0e, 0x8e, 0x39, 0x0e, 0x03, 0x5a, 0x0e, 0xb8, 0x0d, 0xa3, 0x10,
+  0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x62, 0x08, 0x84, 0x62, 0x10, 0x02, 0x62, 0x08, 0x61, 0x08,
+  0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0xab, 0x61,
+  0x08, 0x03, 0x64, 0x10, 0x73, 0x50, 0x93, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50,
+  0x00, 0x63, 0x10, 0xb8, 0x61, 0x08, 0x03, 0x60, 0x08, 0x66, 0x20, 0x74, 0x58, 0x72, 0x50, 0x83,
+  0x73, 0x50, 0x01, 0x93, 0x50, 0x70, 0x48, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa3, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x8f, 0x61, 0x08, 0x82, 0x62, 0x08, 0x00, 0x61, 0x10, 0x86, 0x62, 0x10, 0x06,
+  0x62, 0x08, 0x82, 0x10, 0x20, 0x10, 0x82, 0x10, 0xd4, 0x0c, 0xbc, 0x06, 0x19, 0x0e, 0xb3, 0x39,
+  0x0e, 0x07, 0x9b, 0x0e, 0xe8, 0x11, 0x20, 0x10, 0x82, 0x10, 0x61, 0x10, 0x82, 0x10, 0xb8, 0x0d,
+  0x5a, 0x0e, 0x8e, 0x39, 0x0e, 0x03, 0x7a, 0x0e, 0x15, 0x0d, 0x41, 0x10, 0x61, 0x10, 0x86, 0x62,
+  0x10, 0x04, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x88, 0x61, 0x08, 0x01,
+  0x62, 0x08, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x96, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x8f, 0x61, 0x08, 0x04, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72,
+  0x50, 0x02, 0x74, 0x58, 0x69, 0x28, 0x60, 0x08, 0xb7, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6b, 0x30,
+  0x74, 0x58, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6b, 0x30,
+  0x60, 0x00, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa5, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x02, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x81, 0x62, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61,
+  0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x05, 0x82, 0x08, 0x00, 0x10, 0xe4, 0x10, 0x56, 0x0d, 0xbc,
+  0x0e, 0x19, 0x0e, 0xb3, 0x39, 0x0e, 0x07, 0x9b, 0x0e, 0xb3, 0x0c, 0x00, 0x10, 0x62, 0x10, 0x82,
+  0x10, 0x00, 0x10, 0x49, 0x12, 0xbb, 0x0e, 0x8f, 0x39, 0x0e, 0x02, 0x9b, 0x0e, 0x11, 0x0c, 0x00,
+  0x10, 0x88, 0x62, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8c, 0x61,
+  0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x10, 0x98, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6a, 0x28, 0x74,
+  0x58, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02, 0x74, 0x50, 0x6e, 0x38, 0x60, 0x08, 0x89, 0x61,
+  0x08, 0x00, 0x62, 0x08, 0xa5, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x70, 0x40,
+  0x84, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0xa7, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x89, 0x61, 0x08, 0x03, 0x62, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x86, 0x62, 0x10, 0x06, 0x62, 0x08, 0x62, 0x10, 0x00, 0x10, 0x86, 0x11,
+  0xf8, 0x0d, 0x7b, 0x0e, 0x19, 0x0e, 0xb3, 0x39, 0x0e, 0x03, 0x3a, 0x0e, 0x5a, 0x0e, 0x46, 0x11,
+  0x20, 0x10, 0x81, 0x82, 0x10, 0x02, 0x00, 0x10, 0xb3, 0x0c, 0x9b, 0x0e, 0x8e, 0x39, 0x0e, 0x03,
+  0x19, 0x0e, 0xbc, 0x0e, 0xec, 0x0a, 0x00, 0x10, 0x83, 0x62, 0x10, 0x00, 0x62, 0x08, 0x84, 0x62,
+  0x10, 0x03, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08, 0x02, 0x61, 0x10,
+  0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x01,
+  0x60, 0x08, 0x64, 0x18, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x83, 0x73, 0x50, 0x01, 0x72, 0x48,
+  0x62, 0x10, 0xb7, 0x61, 0x08, 0x02, 0x64, 0x10, 0x73, 0x50, 0x93, 0x50, 0x84, 0x73, 0x50, 0x01,
+  0x72, 0x48, 0x62, 0x08, 0xa8, 0x61, 0x08, 0x00, 0x62, 0x10, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x85, 0x62, 0x10, 0x06, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0x29, 0x12, 0x5a, 0x0e, 0x7b, 0x0e,
+  0x19, 0x0e, 0xb3, 0x39, 0x0e, 0x03, 0x19, 0x0e, 0xbc, 0x0e, 0x8f, 0x0b, 0x00, 0x10, 0x81, 0x82,
+  0x10, 0x02, 0x21, 0x10, 0x66, 0x11, 0x7a, 0x0e, 0x8f, 0x39, 0x0e, 0x03, 0x19, 0x0e, 0x7b, 0x0e,
+  0xa7, 0x11, 0x20, 0x10, 0x84, 0x62, 0x10, 0x82, 0x62, 0x08, 0x01, 0x61, 0x08, 0x62, 0x08, 0x81,
+  0x62, 0x10, 0x95, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa4, 0x61, 0x08, 0x00, 0x70, 0x48, 0x82, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x02, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x87, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xac, 0x61, 0x08, 0x05, 0x60, 0x08, 0x69, 0x28, 0x95, 0x58, 0x92, 0x50, 0x73, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x03, 0x74, 0x58, 0x8d, 0x38, 0x80, 0x08, 0x61, 0x10, 0xb1, 0x61, 0x08,
+  0x81, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x86, 0x62, 0x10, 0x05, 0x82, 0x10, 0x61,
+  0x08, 0x00, 0x10, 0xec, 0x0a, 0x9b, 0x0e, 0x5a, 0x0e, 0xb5, 0x39, 0x0e, 0x03, 0x7b, 0x0e, 0x76,
+  0x0d, 0x61, 0x10, 0x41, 0x10, 0x81, 0x82, 0x10, 0x02, 0x00, 0x10, 0x31, 0x0c, 0x9b, 0x0e, 0x8f,
+  0x39, 0x0e, 0x03, 0x5a, 0x0e, 0xb8, 0x0d, 0x82, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x02, 0x61,
+  0x10, 0x62, 0x10, 0x61, 0x10, 0x82, 0x62, 0x10, 0x81, 0x62, 0x08, 0x01, 0x61, 0x08, 0x62, 0x08,
+  0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x88, 0x61,
+  0x08, 0x00, 0x62, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9b, 0x61, 0x08, 0x04, 0x61, 0x10,
+  0x60, 0x08, 0x6b, 0x30, 0x74, 0x58, 0x72, 0x50, 0x83, 0x73, 0x50, 0x02, 0x74, 0x58, 0x6b, 0x30,
+  0x60, 0x08, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa9, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x50, 0x72, 0x50,
+  0x83, 0x73, 0x50, 0x02, 0x94, 0x58, 0x68, 0x20, 0x60, 0x08, 0xa9, 0x61, 0x08, 0x06, 0x62, 0x08,
+  0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10, 0x03,
+  0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x87, 0x62, 0x10, 0x05, 0x82, 0x10, 0x41, 0x10,
+  0x20, 0x10, 0xd0, 0x0b, 0xbc, 0x0e, 0x5a, 0x0e, 0x81, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0xb2, 0x39,
+  0x0e, 0x03, 0x3a, 0x0e, 0x7a, 0x0e, 0x66, 0x11, 0x20, 0x10, 0x81, 0x82, 0x10, 0x02, 0x20, 0x10,
+  0x66, 0x11, 0x7b, 0x0e, 0x90, 0x39, 0x0e, 0x02, 0x9b, 0x0e, 0x92, 0x0c, 0x00, 0x10, 0x87, 0x62,
+  0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x10, 0x01,
+  0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x05, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x62, 0x08, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x03,
+  0x61, 0x10, 0x60, 0x08, 0x66, 0x20, 0x74, 0x58, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x03, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0x61, 0x10, 0x96, 0x61, 0x08, 0x02, 0x61, 0x10,
+  0x61, 0x08, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x02, 0x71, 0x48,
+  0x73, 0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x00, 0x63, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x08, 0x83, 0x61,
+  0x08, 0x09, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10,
+  0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x62, 0x08, 0x82, 0x62, 0x10, 0x81,
+  0x82, 0x10, 0x03, 0x20, 0x10, 0x62, 0x10, 0x93, 0x0c, 0xdc, 0x0e, 0x84, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0xa3, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8c, 0x39, 0x0e, 0x02, 0xbc, 0x0e, 0xab, 0x12, 0x00,
+  0x10, 0x81, 0x82, 0x10, 0x04, 0x62, 0x10, 0x00, 0x10, 0x93, 0x0c, 0x9b, 0x0e, 0x19, 0x0e, 0x8f,
+  0x39, 0x0e, 0x02, 0x9b, 0x0e, 0x8b, 0x12, 0x00, 0x10, 0x89, 0x62, 0x10, 0x02, 0x62, 0x08, 0x61,
+  0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x62, 0x08, 0x82, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa3, 0x61,
+  0x08, 0x01, 0x62, 0x10, 0x72, 0x48, 0x84, 0x73, 0x50, 0x02, 0x93, 0x50, 0x73, 0x50, 0x63, 0x10,
+  0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x99, 0x61, 0x08, 0x01,
+  0x60, 0x08, 0x65, 0x18, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x70, 0x40,
+  0x98, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x08, 0x84, 0x61,
+  0x08, 0x00, 0x62, 0x10, 0x85, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x08, 0x82, 0x62, 0x10, 0x02,
+  0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x84, 0x62, 0x10, 0x81, 0x82, 0x10, 0x05, 0x00, 0x10, 0xe4,
+  0x10, 0x76, 0x0d, 0xbc, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x92, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0xa0,
+  0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e, 0xaf, 0x0b, 0x00, 0x10, 0x81, 0x10, 0x81, 0x82, 0x10,
+  0x02, 0x00, 0x10, 0x29, 0x12, 0x9b, 0x0e, 0x90, 0x39, 0x0e, 0x03, 0x3a, 0x0e, 0x39, 0x0e, 0xe4,
+  0x10, 0x41, 0x10, 0x83, 0x62, 0x10, 0x81, 0x61, 0x10, 0x04, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10,
+  0x61, 0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x03, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08,
+  0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00,
+  0x62, 0x08, 0x94, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6e, 0x40, 0x74, 0x50, 0x83, 0x73,
+  0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x66, 0x20, 0x60, 0x08, 0xb3, 0x61, 0x08, 0x02, 0x60, 0x08,
+  0x69, 0x28, 0x75, 0x58, 0x84, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x00, 0x96, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08,
+  0x81, 0x61, 0x08, 0x03, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81,
+  0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x08, 0x83, 0x62,
+  0x10, 0x06, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0xa7, 0x11, 0xf8, 0x0d, 0x9b, 0x0e,
+  0x81, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x89, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x84, 0x39, 0x0e, 0x03,
+  0x19, 0x0e, 0x7b, 0x0e, 0x5a, 0x0e, 0xd8, 0x0d, 0x8f, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x39,
+  0x0e, 0x00, 0x3a, 0x0e, 0x8b, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e, 0x72, 0x0c, 0x00, 0x10,
+  0x61, 0x10, 0x81, 0x82, 0x10, 0x03, 0x41, 0x10, 0xa2, 0x10, 0xb8, 0x0d, 0x5a, 0x0e, 0x90, 0x39,
+  0x0e, 0x02, 0x9b, 0x06, 0x92, 0x0c, 0x00, 0x10, 0x81, 0x82, 0x10, 0x82, 0x62, 0x10, 0x00, 0x61,
+  0x08, 0x82, 0x62, 0x10, 0x00, 0x62, 0x08, 0x83, 0x62, 0x10, 0x82, 0x62, 0x08, 0x86, 0x61, 0x08,
+  0x82, 0x62, 0x08, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0xa1,
+  0x61, 0x08, 0x04, 0x60, 0x00, 0x8a, 0x28, 0x94, 0x58, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x03, 0x72, 0x50, 0x74, 0x58, 0x6a, 0x30, 0x60, 0x08, 0xb0, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x02, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x58, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03,
+  0x72, 0x50, 0x74, 0x50, 0x67, 0x20, 0x60, 0x08, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x04, 0x61, 0x08, 0x62, 0x08, 0x61,
+  0x08, 0x62, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x81, 0x62,
+  0x08, 0x00, 0x61, 0x08, 0x83, 0x62, 0x10, 0x03, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0x6a, 0x0a,
+  0x81, 0x7b, 0x0e, 0x86, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x89, 0x39, 0x0e, 0x06, 0x19, 0x0e, 0x7a,
+  0x0e, 0xbc, 0x0e, 0x15, 0x0d, 0x0d, 0x13, 0xb7, 0x0d, 0x5a, 0x0e, 0x8f, 0x39, 0x0e, 0x03, 0x19,
+  0x0e, 0x9b, 0x0e, 0xf9, 0x0d, 0x19, 0x0e, 0x89, 0x39, 0x0e, 0x02, 0x19, 0x0e, 0xbc, 0x0e, 0xb4,
+  0x0c, 0x81, 0x41, 0x10, 0x81, 0x82, 0x10, 0x04, 0x62, 0x10, 0x00, 0x10, 0x52, 0x0c, 0x9c, 0x0e,
+  0x19, 0x0e, 0x8f, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0x9b, 0x0e, 0x08, 0x12, 0x00, 0x10, 0x82, 0x10,
+  0x86, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x62, 0x10, 0x82, 0x61, 0x08, 0x81, 0x62, 0x08, 0x02,
+  0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08, 0x97, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x97, 0x61, 0x08, 0x04, 0x60, 0x08, 0x66, 0x18, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x94, 0x50, 0x6f, 0x40, 0x60, 0x08, 0xb0, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x70, 0x40, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x93,
+  0x50, 0x73, 0x50, 0x63, 0x10, 0x9b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x03, 0x61,
+  0x10, 0x61, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x62, 0x08,
+  0x81, 0x62, 0x10, 0x00, 0x61, 0x08, 0x83, 0x62, 0x10, 0x05, 0x82, 0x10, 0x41, 0x10, 0x00, 0x10,
+  0x6e, 0x0b, 0xbb, 0x0e, 0x5a, 0x0e, 0x90, 0x39, 0x0e, 0x08, 0x19, 0x0e, 0x7a, 0x0e, 0xbc, 0x0e,
+  0x97, 0x0d, 0x8a, 0x12, 0x82, 0x10, 0xd4, 0x0c, 0x7b, 0x0e, 0x19, 0x0e, 0x8d, 0x39, 0x0e, 0x05,
+  0x19, 0x0e, 0x5a, 0x0e, 0x9c, 0x0e, 0x8f, 0x13, 0xaf, 0x13, 0x7b, 0x0e, 0x88, 0x39, 0x0e, 0x02,
+  0x19, 0x0e, 0xbc, 0x0e, 0x93, 0x0c, 0x81, 0x41, 0x10, 0x82, 0x82, 0x10, 0x04, 0x00, 0x10, 0xcb,
+  0x0a, 0xbc, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x8f, 0x39, 0x0e, 0x03, 0x7b, 0x0e, 0x56, 0x0d, 0x41,
+  0x10, 0x61, 0x10, 0x84, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x10, 0x81, 0x62,
+  0x10, 0x02, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0xae, 0x61, 0x08, 0x04, 0x62, 0x10, 0x72, 0x50, 0x73,
+  0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x73, 0x50, 0x71, 0x48, 0x62, 0x08, 0xaf,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x63, 0x10, 0x82, 0x73, 0x50, 0x82, 0x72,
+  0x50, 0x01, 0x73, 0x50, 0x70, 0x40, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x03,
+  0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x08, 0x82, 0x61,
+  0x08, 0x81, 0x62, 0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x84, 0x62, 0x10, 0x05, 0x82, 0x08,
+  0x20, 0x10, 0x61, 0x10, 0x52, 0x0c, 0xbc, 0x0e, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x82, 0x3a, 0x0e,
+  0x01, 0x39, 0x0e, 0x3a, 0x0e, 0x85, 0x39, 0x0e, 0x0c, 0x3a, 0x0e, 0x39, 0x0e, 0x19, 0x0e, 0x7a,
+  0x0e, 0xbc, 0x06, 0x77, 0x0d, 0xcb, 0x12, 0x20, 0x10, 0x00, 0x10, 0x15, 0x0d, 0xbc, 0x0e, 0x19,
+  0x0e, 0x3a, 0x0e, 0x8c, 0x39, 0x0e, 0x07, 0x3a, 0x0e, 0xbc, 0x0e, 0xb7, 0x0d, 0x08, 0x12, 0x82,
+  0x10, 0xf9, 0x0d, 0x5a, 0x0e, 0x3a, 0x0e, 0x87, 0x39, 0x0e, 0x03, 0xdc, 0x0e, 0x31, 0x0c, 0x21,
+  0x10, 0x41, 0x10, 0x82, 0x82, 0x10, 0x03, 0x00, 0x10, 0x86, 0x11, 0x7b, 0x0e, 0x3a, 0x0e, 0x90,
+  0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e, 0xcb, 0x12, 0x00, 0x10, 0x82, 0x10, 0x84, 0x62, 0x10,
+  0x04, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x01, 0x61,
+  0x08, 0x62, 0x10, 0x89, 0x61, 0x08, 0x01, 0x62, 0x10, 0x62, 0x08, 0x83, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08,
+  0x02, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02, 0x74, 0x50,
+  0x64, 0x18, 0x60, 0x08, 0xad, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x0a, 0x60, 0x08,
+  0x66, 0x20, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50,
+  0x6d, 0x38, 0x60, 0x08, 0xa5, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01,
+  0x62, 0x08, 0x61, 0x08, 0x82, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08,
+  0x81, 0x61, 0x08, 0x82, 0x62, 0x10, 0x81, 0x82, 0x10, 0x03, 0x00, 0x10, 0x04, 0x11, 0x56, 0x0d,
+  0xbc, 0x0e, 0x86, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x87, 0x39, 0x0e, 0x0b, 0x19, 0x0e, 0x7b, 0x0e,
+  0xbb, 0x0e, 0x76, 0x0d, 0xab, 0x12, 0x62, 0x10, 0x00, 0x10, 0x41, 0x10, 0xf4, 0x0c, 0xbc, 0x0e,
+  0x19, 0x0e, 0x3a, 0x0e, 0x8b, 0x39, 0x0e, 0x07, 0x19, 0x0e, 0x7a, 0x0e, 0x9b, 0x06, 0xd0, 0x0b,
+  0x82, 0x10, 0x00, 0x10, 0xb3, 0x0c, 0x9b, 0x0e, 0x87, 0x39, 0x0e, 0x0c, 0x5a, 0x0e, 0xbc, 0x0e,
+  0x8f, 0x0b, 0x00, 0x10, 0x41, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x20, 0x10, 0xc3, 0x10,
+  0xf8, 0x0d, 0x7b, 0x0e, 0x19, 0x0e, 0x90, 0x39, 0x0e, 0x03, 0x5a, 0x0e, 0x97, 0x0d, 0x62, 0x10,
+  0x61, 0x10, 0x85, 0x62, 0x10, 0x02, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x01,
+  0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa2, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60,
+  0x08, 0x6c, 0x30, 0x74, 0x58, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74,
+  0x58, 0x68, 0x20, 0x60, 0x08, 0xb0, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6a, 0x28, 0x74,
+  0x58, 0x81, 0x72, 0x50, 0x05, 0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x74, 0x58, 0x69, 0x28, 0x60,
+  0x08, 0x98, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0x85, 0x61, 0x08,
+  0x06, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81,
+  0x62, 0x10, 0x00, 0x61, 0x10, 0x83, 0x62, 0x10, 0x00, 0x61, 0x08, 0x83, 0x62, 0x10, 0x05, 0x00,
+  0x10, 0xe7, 0x09, 0xf9, 0x0d, 0x7b, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x89, 0x39, 0x0e, 0x04, 0x9b, 0x0e, 0xbb, 0x06, 0x35, 0x0d, 0x6a, 0x12, 0x41, 0x10, 0x81,
+  0x00, 0x10, 0x05, 0x82, 0x10, 0x15, 0x0d, 0xbc, 0x0e, 0x19, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x8a,
+  0x39, 0x0e, 0x03, 0x3a, 0x0e, 0xdc, 0x0e, 0x76, 0x0d, 0xc7, 0x11, 0x81, 0x00, 0x10, 0x03, 0x0d,
+  0x0b, 0xdc, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x84, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0x9b, 0x0e, 0x5a,
+  0x0e, 0x8a, 0x12, 0x00, 0x10, 0x61, 0x10, 0x82, 0x82, 0x10, 0x04, 0x21, 0x10, 0x82, 0x10, 0x56,
+  0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x90, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e, 0xab, 0x0a, 0x00,
+  0x10, 0x82, 0x10, 0x85, 0x62, 0x10, 0x03, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x02, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x96, 0x61,
+  0x08, 0x04, 0x60, 0x08, 0x68, 0x20, 0x75, 0x58, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02,
+  0x74, 0x58, 0x6b, 0x30, 0x60, 0x08, 0xb1, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x50,
+  0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x93, 0x50, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x9b,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x82, 0x61, 0x08,
+  0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x87, 0x62, 0x10, 0x06, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10,
+  0xec, 0x0a, 0x9b, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x86, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x85, 0x39,
+  0x0e, 0x81, 0x9b, 0x0e, 0x09, 0xf4, 0x0c, 0x29, 0x12, 0x41, 0x10, 0x00, 0x10, 0x82, 0x10, 0x00,
+  0x10, 0xe4, 0x10, 0x76, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x8b, 0x39, 0x0e, 0x09, 0x19, 0x0e, 0x9b,
+  0x0e, 0x5a, 0x0e, 0x6e, 0x0b, 0x61, 0x10, 0x20, 0x10, 0x00, 0x10, 0xe8, 0x09, 0x9b, 0x0e, 0x3a,
+  0x0e, 0x86, 0x39, 0x0e, 0x04, 0xbc, 0x0e, 0x56, 0x0d, 0x45, 0x11, 0x00, 0x10, 0x62, 0x10, 0x82,
+  0x82, 0x10, 0x05, 0x21, 0x10, 0x62, 0x10, 0x15, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x39, 0x0e, 0x81,
+  0x3a, 0x0e, 0x8e, 0x39, 0x0e, 0x03, 0x7b, 0x0e, 0x36, 0x0d, 0x41, 0x10, 0x61, 0x10, 0x86, 0x62,
+  0x10, 0x06, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10,
+  0x81, 0x61, 0x10, 0x03, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x98, 0x61, 0x08, 0x00,
+  0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x8f, 0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18, 0x74, 0x50, 0x81, 0x73,
+  0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6e, 0x38, 0x60, 0x08, 0xb2, 0x61,
+  0x08, 0x01, 0x70, 0x48, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x48, 0x63, 0x10,
+  0xa5, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x82, 0x62, 0x08, 0x00, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x00, 0x61, 0x08, 0x81, 0x62, 0x08, 0x01, 0x62, 0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x05,
+  0x82, 0x08, 0x20, 0x10, 0x41, 0x10, 0x11, 0x0c, 0xbc, 0x0e, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x00,
+  0x3a, 0x0e, 0x88, 0x39, 0x0e, 0x0c, 0x3a, 0x0e, 0xbb, 0x06, 0x7b, 0x0e, 0x93, 0x0c, 0xe8, 0x11,
+  0x20, 0x10, 0x00, 0x10, 0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0x86, 0x11, 0xd8, 0x0d, 0x9b, 0x0e,
+  0x81, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x84, 0x39, 0x0e, 0x0a,
+  0x19, 0x0e, 0x5a, 0x0e, 0xbc, 0x0e, 0xf4, 0x0c, 0x45, 0x11, 0x00, 0x10, 0x61, 0x10, 0x20, 0x10,
+  0xe4, 0x10, 0x19, 0x0e, 0x7a, 0x0e, 0x84, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0x7b, 0x0e, 0x9b, 0x0e,
+  0xaf, 0x0b, 0x61, 0x10, 0x00, 0x10, 0x83, 0x82, 0x10, 0x04, 0x21, 0x10, 0x62, 0x10, 0x15, 0x0d,
+  0x9c, 0x0e, 0x19, 0x0e, 0x90, 0x39, 0x0e, 0x04, 0x3a, 0x0e, 0x39, 0x0e, 0x9b, 0x0e, 0xc7, 0x11,
+  0x00, 0x10, 0x82, 0x82, 0x10, 0x85, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x04, 0x61,
+  0x10, 0x62, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x81, 0x62, 0x08, 0x00, 0x61, 0x10, 0x86,
+  0x61, 0x08, 0x00, 0x62, 0x08, 0x96, 0x61, 0x08, 0x00, 0x62, 0x08, 0x9a, 0x61, 0x08, 0x01, 0x62,
+  0x10, 0x72, 0x48, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x71,
+  0x48, 0xb0, 0x61, 0x08, 0x03, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x72, 0x50, 0x85, 0x73, 0x50,
+  0x00, 0x70, 0x40, 0x9d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81,
+  0x61, 0x08, 0x04, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x84, 0x62, 0x10,
+  0x04, 0x62, 0x08, 0x00, 0x10, 0xe4, 0x10, 0x35, 0x0d, 0xbc, 0x0e, 0x84, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x85, 0x39, 0x0e, 0x0e, 0x19, 0x0e, 0x5a, 0x0e, 0xbc, 0x0e, 0x3a, 0x0e, 0x11, 0x0c, 0x86,
+  0x11, 0x00, 0x10, 0x20, 0x10, 0x62, 0x10, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0x6a, 0x0a, 0x5a,
+  0x0e, 0x7a, 0x0e, 0x8b, 0x39, 0x0e, 0x03, 0x3a, 0x0e, 0xbc, 0x0e, 0xf8, 0x0d, 0xab, 0x12, 0x81,
+  0x20, 0x10, 0x05, 0x82, 0x10, 0x41, 0x10, 0xa2, 0x10, 0x77, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x82,
+  0x39, 0x0e, 0x06, 0x19, 0x0e, 0x3a, 0x0e, 0xbc, 0x0e, 0x77, 0x0d, 0xc7, 0x11, 0x00, 0x10, 0x41,
+  0x10, 0x83, 0x82, 0x10, 0x04, 0x20, 0x10, 0x82, 0x10, 0x15, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x91,
+  0x39, 0x0e, 0x03, 0x19, 0x0e, 0xbc, 0x0e, 0x11, 0x0c, 0x00, 0x10, 0x81, 0x82, 0x10, 0x01, 0x62,
+  0x10, 0x82, 0x10, 0x81, 0x62, 0x10, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x62, 0x08, 0x62,
+  0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x62, 0x08, 0x9d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x99, 0x61, 0x08, 0x09, 0x60, 0x08, 0x6f, 0x40,
+  0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x63, 0x10,
+  0xaf, 0x61, 0x08, 0x02, 0x61, 0x10, 0x60, 0x08, 0x64, 0x18, 0x83, 0x73, 0x50, 0x04, 0x72, 0x50,
+  0x73, 0x50, 0x74, 0x50, 0x6e, 0x38, 0x60, 0x08, 0x92, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x09, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x82, 0x62, 0x10, 0x04,
+  0x61, 0x10, 0x00, 0x10, 0xe8, 0x11, 0x19, 0x0e, 0x9b, 0x0e, 0x82, 0x39, 0x0e, 0x00, 0x3a, 0x0e,
+  0x86, 0x39, 0x0e, 0x07, 0x19, 0x0e, 0x7a, 0x0e, 0xbc, 0x0e, 0xd8, 0x0d, 0x8f, 0x0b, 0x04, 0x11,
+  0x00, 0x10, 0x20, 0x10, 0x82, 0x82, 0x10, 0x04, 0x41, 0x10, 0x20, 0x10, 0xaf, 0x0b, 0xbc, 0x0e,
+  0x5a, 0x0e, 0x8b, 0x39, 0x0e, 0x06, 0x9b, 0x0e, 0x7b, 0x0e, 0xf0, 0x0b, 0xa3, 0x10, 0x00, 0x10,
+  0x62, 0x10, 0x82, 0x10, 0x81, 0x41, 0x10, 0x02, 0xf5, 0x0c, 0xbb, 0x0e, 0x19, 0x0e, 0x83, 0x39,
+  0x0e, 0x04, 0xbc, 0x0e, 0x39, 0x0e, 0x2d, 0x13, 0x61, 0x10, 0x00, 0x10, 0x82, 0x82, 0x10, 0x06,
+  0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0xe3, 0x10, 0x76, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x92, 0x39,
+  0x0e, 0x03, 0x7a, 0x0e, 0xb8, 0x0d, 0xa2, 0x10, 0x41, 0x10, 0x83, 0x62, 0x10, 0x00, 0x61, 0x10,
+  0x82, 0x62, 0x10, 0x02, 0x61, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x10, 0x81, 0x62, 0x08,
+  0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82,
+  0x61, 0x08, 0x00, 0x62, 0x08, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0x9c, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6c, 0x30, 0x74, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0xaf, 0x61, 0x08, 0x05, 0x60,
+  0x08, 0x67, 0x20, 0x74, 0x58, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74,
+  0x58, 0x6b, 0x30, 0x60, 0x08, 0xa1, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x02, 0x62,
+  0x08, 0x61, 0x10, 0x62, 0x08, 0x82, 0x61, 0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x08, 0x82, 0x62,
+  0x10, 0x05, 0x82, 0x10, 0x41, 0x10, 0x00, 0x10, 0x2d, 0x0b, 0x9b, 0x0e, 0x5a, 0x0e, 0x88, 0x39,
+  0x0e, 0x08, 0x19, 0x0e, 0x39, 0x0e, 0x9b, 0x0e, 0x9c, 0x0e, 0x56, 0x0d, 0xec, 0x12, 0xa3, 0x10,
+  0x00, 0x10, 0x41, 0x10, 0x83, 0x82, 0x10, 0x03, 0x00, 0x10, 0xc3, 0x10, 0xd4, 0x0c, 0xdc, 0x0e,
+  0x8a, 0x39, 0x0e, 0x06, 0x19, 0x0e, 0x5a, 0x0e, 0xbc, 0x06, 0xf4, 0x0c, 0xa7, 0x11, 0x00, 0x10,
+  0x41, 0x10, 0x81, 0x82, 0x10, 0x81, 0x41, 0x10, 0x02, 0xb3, 0x0c, 0xbc, 0x0e, 0x19, 0x0e, 0x82,
+  0x39, 0x0e, 0x05, 0x9b, 0x0e, 0x7b, 0x0e, 0x51, 0x0c, 0x04, 0x11, 0x00, 0x10, 0x61, 0x10, 0x81,
+  0x82, 0x10, 0x07, 0x62, 0x10, 0x82, 0x10, 0x62, 0x10, 0x00, 0x10, 0x66, 0x11, 0xd8, 0x0d, 0x9b,
+  0x0e, 0x19, 0x0e, 0x93, 0x39, 0x0e, 0x02, 0x9b, 0x0e, 0xe8, 0x11, 0x00, 0x10, 0x84, 0x62, 0x10,
+  0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x01, 0x62, 0x08, 0x61, 0x08, 0x82, 0x62, 0x10, 0x02, 0x61,
+  0x08, 0x62, 0x10, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62, 0x10, 0xb2, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60,
+  0x08, 0x6a, 0x28, 0x74, 0x58, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58,
+  0x68, 0x20, 0x60, 0x08, 0xaf, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6a, 0x30, 0x74, 0x58, 0x81, 0x73,
+  0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x68, 0x20, 0x60, 0x08, 0x9c, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08, 0x01, 0x62, 0x08,
+  0x62, 0x10, 0x84, 0x61, 0x10, 0x00, 0x62, 0x08, 0x82, 0x62, 0x10, 0x05, 0x82, 0x10, 0x00, 0x10,
+  0x61, 0x10, 0x52, 0x0c, 0xdc, 0x0e, 0x3a, 0x0e, 0x88, 0x39, 0x0e, 0x07, 0x5a, 0x0e, 0xbc, 0x0e,
+  0x5a, 0x0e, 0x93, 0x0c, 0x29, 0x12, 0x41, 0x10, 0x00, 0x10, 0x61, 0x10, 0x83, 0x82, 0x10, 0x05,
+  0x41, 0x10, 0x00, 0x10, 0x49, 0x12, 0x19, 0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0x89, 0x39, 0x0e, 0x03,
+  0x3a, 0x0e, 0xbc, 0x0e, 0xb8, 0x0d, 0x8a, 0x12, 0x81, 0x20, 0x10, 0x82, 0x82, 0x10, 0x04, 0x20,
+  0x10, 0x82, 0x10, 0xd4, 0x0c, 0xbc, 0x0e, 0x19, 0x0e, 0x81, 0x39, 0x0e, 0x81, 0x9b, 0x0e, 0x03,
+  0x93, 0x0c, 0x86, 0x11, 0x00, 0x10, 0x41, 0x10, 0x84, 0x82, 0x10, 0x05, 0x61, 0x10, 0x00, 0x10,
+  0x49, 0x12, 0x3a, 0x0e, 0x7b, 0x0e, 0x19, 0x0e, 0x92, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e,
+  0x6e, 0x0b, 0x00, 0x10, 0x82, 0x10, 0x87, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61,
+  0x10, 0x01, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x83,
+  0x61, 0x08, 0x00, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x62, 0x08, 0x01, 0x61,
+  0x08, 0x61, 0x10, 0xad, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x67, 0x20, 0x74, 0x58, 0x82,
+  0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6a, 0x30, 0x60, 0x08, 0xaf, 0x61, 0x08,
+  0x02, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x58, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x01, 0x65, 0x18,
+  0x60, 0x08, 0x9c, 0x61, 0x08, 0x00, 0x62, 0x08, 0x86, 0x61, 0x08, 0x03, 0x61, 0x10, 0x62, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x10, 0x01, 0x62, 0x08, 0x61, 0x10, 0x83, 0x62, 0x10, 0x06,
+  0x00, 0x10, 0x45, 0x11, 0x76, 0x0d, 0xbc, 0x0e, 0x19, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x84, 0x39,
+  0x0e, 0x05, 0x3a, 0x0e, 0x9b, 0x0e, 0xbc, 0x06, 0xb8, 0x0d, 0xaf, 0x0b, 0x45, 0x11, 0x81, 0x00,
+  0x10, 0x00, 0x62, 0x10, 0x84, 0x82, 0x10, 0x04, 0x00, 0x10, 0x82, 0x10, 0x11, 0x0c, 0xbb, 0x0e,
+  0x7a, 0x0e, 0x8a, 0x39, 0x0e, 0x05, 0xbc, 0x0e, 0x19, 0x0e, 0x6e, 0x13, 0x82, 0x10, 0x00, 0x10,
+  0x61, 0x10, 0x82, 0x82, 0x10, 0x0b, 0x00, 0x10, 0xe3, 0x10, 0x56, 0x0d, 0xbc, 0x0e, 0x19, 0x0e,
+  0x3a, 0x0e, 0x9b, 0x06, 0x7b, 0x0e, 0x93, 0x0c, 0xc7, 0x11, 0x00, 0x10, 0x20, 0x10, 0x85, 0x82,
+  0x10, 0x05, 0x20, 0x10, 0x21, 0x10, 0x8f, 0x0b, 0x9b, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x92, 0x39,
+  0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x06, 0xb3, 0x0c, 0x20, 0x10, 0x61, 0x10, 0x84, 0x62, 0x10, 0x05,
+  0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x84, 0x62, 0x10, 0x01,
+  0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10, 0x87, 0x61, 0x08, 0x01, 0x62, 0x08, 0x62, 0x10, 0x88,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x03, 0x60,
+  0x08, 0x64, 0x18, 0x74, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74,
+  0x50, 0x6d, 0x38, 0x60, 0x08, 0xaf, 0x61, 0x08, 0x04, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x73,
+  0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x00, 0x63, 0x10, 0xa5, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61,
+  0x08, 0x62, 0x10, 0x62, 0x08, 0x61, 0x08, 0x83, 0x62, 0x10, 0x06, 0x82, 0x10, 0x41, 0x10, 0x00,
+  0x10, 0x6a, 0x0a, 0x3a, 0x0e, 0x7b, 0x0e, 0x19, 0x0e, 0x81, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x82,
+  0x39, 0x0e, 0x07, 0x7a, 0x0e, 0xbc, 0x0e, 0x3a, 0x0e, 0x93, 0x0c, 0x49, 0x0a, 0x82, 0x10, 0x00,
+  0x10, 0x21, 0x10, 0x85, 0x82, 0x10, 0x04, 0x21, 0x10, 0x00, 0x10, 0x29, 0x0a, 0xb8, 0x0d, 0xbc,
+  0x0e, 0x8a, 0x39, 0x0e, 0x14, 0xbb, 0x0e, 0x5a, 0x0e, 0xf0, 0x0b, 0x04, 0x11, 0x00, 0x10, 0x61,
+  0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0xc7, 0x11, 0xf8, 0x0d, 0x9b,
+  0x0e, 0x5a, 0x0e, 0xbc, 0x0e, 0x19, 0x0e, 0x11, 0x0c, 0x86, 0x11, 0x00, 0x10, 0x20, 0x10, 0x81,
+  0x62, 0x10, 0x83, 0x82, 0x10, 0x04, 0x61, 0x10, 0x00, 0x10, 0x25, 0x11, 0x15, 0x0d, 0xbc, 0x0e,
+  0x94, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0x9b, 0x0e, 0x76, 0x0d, 0x82, 0x10, 0x41, 0x10, 0x83, 0x62,
+  0x10, 0x00, 0x62, 0x08, 0x82, 0x62, 0x10, 0x81, 0x61, 0x10, 0x01, 0x81, 0x08, 0x60, 0x08, 0x81,
+  0x80, 0x08, 0x00, 0x60, 0x08, 0x81, 0x80, 0x08, 0x06, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0x98, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x9b, 0x61, 0x08, 0x01, 0x63, 0x10, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0x8d, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x95, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x01, 0x71, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x71,
+  0x48, 0x62, 0x08, 0x99, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x82, 0x61, 0x10, 0x83, 0x62, 0x10, 0x06, 0x82, 0x10, 0x20, 0x10, 0x41, 0x10, 0xd0,
+  0x0b, 0xbc, 0x0e, 0x3a, 0x0e, 0x19, 0x0e, 0x83, 0x39, 0x0e, 0x05, 0x7a, 0x0e, 0xbc, 0x0e, 0x7b,
+  0x0e, 0x35, 0x0d, 0x0d, 0x13, 0x24, 0x11, 0x81, 0x00, 0x10, 0x00, 0x61, 0x10, 0x85, 0x82, 0x10,
+  0x05, 0x61, 0x10, 0x00, 0x10, 0x04, 0x11, 0x52, 0x0c, 0x9b, 0x06, 0x5a, 0x0e, 0x87, 0x39, 0x0e,
+  0x07, 0x19, 0x0e, 0x39, 0x0e, 0xbc, 0x0e, 0x7b, 0x0e, 0x52, 0x0c, 0x45, 0x11, 0x00, 0x10, 0x41,
+  0x10, 0x83, 0x82, 0x10, 0x0b, 0x41, 0x10, 0x00, 0x10, 0x0d, 0x0b, 0x9b, 0x06, 0xdd, 0x06, 0x9b,
+  0x0e, 0x77, 0x0d, 0x2d, 0x0b, 0x04, 0x11, 0x00, 0x10, 0x20, 0x10, 0x62, 0x10, 0x85, 0x82, 0x10,
+  0x81, 0x20, 0x10, 0x03, 0xcc, 0x0a, 0x39, 0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0x93, 0x39, 0x0e, 0x05,
+  0x19, 0x0e, 0x9b, 0x06, 0xd8, 0x0d, 0xc3, 0x10, 0x20, 0x10, 0x82, 0x10, 0x86, 0x62, 0x10, 0x00,
+  0x61, 0x08, 0x81, 0x80, 0x08, 0x0c, 0x64, 0x10, 0x67, 0x20, 0x6b, 0x30, 0x6c, 0x38, 0x6d, 0x38,
+  0x6b, 0x30, 0x67, 0x20, 0x83, 0x10, 0x80, 0x08, 0x60, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10,
+  0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xb0, 0x61, 0x08, 0x01, 0x71, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50,
+  0x00, 0x71, 0x48, 0xb0, 0x61, 0x08, 0x02, 0x62, 0x10, 0x72, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x00, 0x70, 0x40, 0xa5, 0x61, 0x08, 0x0c, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x82, 0x10, 0x00, 0x10, 0x04, 0x11,
+  0x15, 0x0d, 0xbc, 0x0e, 0x81, 0x39, 0x0e, 0x0a, 0x19, 0x0e, 0x3a, 0x0e, 0x7b, 0x0e, 0xbc, 0x0e,
+  0x7a, 0x0e, 0x56, 0x0d, 0x8f, 0x0b, 0xa7, 0x11, 0x41, 0x10, 0x00, 0x10, 0x41, 0x10, 0x81, 0x62,
+  0x10, 0x84, 0x82, 0x10, 0x06, 0x62, 0x10, 0x00, 0x10, 0x61, 0x10, 0x2d, 0x0b, 0x39, 0x0e, 0x9c,
+  0x0e, 0x3a, 0x0e, 0x83, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x07, 0x3a, 0x0e, 0xbc,
+  0x0e, 0x3a, 0x0e, 0x52, 0x0c, 0x66, 0x11, 0x00, 0x10, 0x20, 0x10, 0x82, 0x10, 0x81, 0x62, 0x10,
+  0x0b, 0x82, 0x10, 0x62, 0x10, 0x00, 0x10, 0xe4, 0x10, 0x15, 0x0d, 0x3e, 0x07, 0xf9, 0x0d, 0x32,
+  0x0c, 0x09, 0x12, 0x61, 0x10, 0x00, 0x10, 0x41, 0x10, 0x81, 0x82, 0x10, 0x81, 0x62, 0x10, 0x82,
+  0x82, 0x10, 0x05, 0x41, 0x10, 0x00, 0x10, 0x65, 0x11, 0xd4, 0x0c, 0xbc, 0x0e, 0x5a, 0x0e, 0x94,
+  0x39, 0x0e, 0x05, 0x19, 0x0e, 0x9b, 0x0e, 0xf8, 0x0d, 0x24, 0x11, 0x20, 0x10, 0x82, 0x10, 0x82,
+  0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x05, 0x61, 0x10, 0x80, 0x08, 0x61, 0x08, 0x68,
+  0x20, 0x6f, 0x40, 0x73, 0x50, 0x85, 0x74, 0x58, 0x05, 0x73, 0x50, 0x6e, 0x40, 0x65, 0x18, 0x60,
+  0x08, 0x61, 0x08, 0x62, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x95, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x6f, 0x40, 0x82, 0x73, 0x50,
+  0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x72, 0x48, 0x62, 0x10, 0xab, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x00, 0x63, 0x10, 0x85, 0x73, 0x50, 0x02, 0x74, 0x50, 0x6e, 0x38, 0x60,
+  0x08, 0x9a, 0x61, 0x08, 0x00, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x03, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x62, 0x08, 0x82, 0x62, 0x10, 0x11, 0x82, 0x10, 0x61,
+  0x10, 0x00, 0x10, 0x29, 0x12, 0x19, 0x0e, 0x9b, 0x0e, 0x39, 0x0e, 0x7b, 0x0e, 0xbb, 0x0e, 0xbb,
+  0x06, 0x39, 0x0e, 0xf4, 0x0c, 0x2d, 0x13, 0x86, 0x11, 0x61, 0x10, 0x00, 0x10, 0x20, 0x10, 0x61,
+  0x10, 0x87, 0x82, 0x10, 0x81, 0x20, 0x10, 0x05, 0x49, 0x12, 0x76, 0x0d, 0xbc, 0x0e, 0x5a, 0x0e,
+  0x39, 0x0e, 0x3a, 0x0e, 0x85, 0x39, 0x0e, 0x06, 0x5a, 0x0e, 0xdc, 0x0e, 0x19, 0x0e, 0xf0, 0x0b,
+  0x45, 0x11, 0x00, 0x10, 0x20, 0x10, 0x83, 0x82, 0x10, 0x07, 0x62, 0x10, 0x61, 0x10, 0x82, 0x10,
+  0xaa, 0x0a, 0x97, 0x0d, 0xd4, 0x0c, 0x6a, 0x12, 0xc3, 0x10, 0x81, 0x00, 0x10, 0x00, 0x61, 0x10,
+  0x86, 0x82, 0x10, 0x06, 0x61, 0x10, 0x00, 0x10, 0xa3, 0x10, 0xaf, 0x0b, 0x7a, 0x0e, 0x9b, 0x0e,
+  0x19, 0x0e, 0x94, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0x9b, 0x0e, 0xf9, 0x0d, 0x25, 0x11, 0x00, 0x10,
+  0x82, 0x10, 0x83, 0x62, 0x10, 0x08, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x80, 0x08, 0x67, 0x20,
+  0x71, 0x48, 0x74, 0x58, 0x74, 0x50, 0x73, 0x50, 0x85, 0x72, 0x50, 0x06, 0x73, 0x50, 0x94, 0x58,
+  0x74, 0x58, 0x8b, 0x30, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x10, 0x91, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08,
+  0x6d, 0x38, 0x74, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x63, 0x10, 0xae,
+  0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18, 0x74, 0x50, 0x84, 0x73, 0x50, 0x02, 0x74, 0x58, 0x6c,
+  0x30, 0x60, 0x08, 0x94, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84,
+  0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x10, 0x0c, 0x10, 0x0c, 0x3e, 0x07, 0xdd, 0x0e, 0x7b,
+  0x0e, 0x19, 0x0e, 0x15, 0x0d, 0xaf, 0x0b, 0x69, 0x12, 0x04, 0x11, 0x20, 0x10, 0x00, 0x10, 0x20,
+  0x10, 0x61, 0x10, 0x88, 0x82, 0x10, 0x06, 0x20, 0x10, 0x00, 0x10, 0xc7, 0x09, 0xd4, 0x0c, 0xbb,
+  0x0e, 0x7b, 0x0e, 0x19, 0x0e, 0x86, 0x39, 0x0e, 0x07, 0x9b, 0x0e, 0xbc, 0x0e, 0xb8, 0x0d, 0x6e,
+  0x0b, 0xe4, 0x10, 0x00, 0x10, 0x20, 0x10, 0x82, 0x10, 0x81, 0x62, 0x10, 0x00, 0x82, 0x10, 0x81,
+  0x62, 0x10, 0x04, 0x82, 0x10, 0x41, 0x10, 0x45, 0x11, 0x8a, 0x0a, 0xe3, 0x10, 0x81, 0x00, 0x10,
+  0x00, 0x41, 0x10, 0x83, 0x82, 0x10, 0x00, 0x62, 0x10, 0x82, 0x82, 0x10, 0x06, 0x61, 0x10, 0x00,
+  0x10, 0x61, 0x10, 0xec, 0x0a, 0xd8, 0x0d, 0xbc, 0x0e, 0x3a, 0x0e, 0x93, 0x39, 0x0e, 0x07, 0x3a,
+  0x0e, 0x39, 0x0e, 0x19, 0x0e, 0xbc, 0x06, 0x97, 0x0d, 0x04, 0x11, 0x00, 0x10, 0x82, 0x10, 0x85,
+  0x62, 0x10, 0x04, 0x80, 0x08, 0x62, 0x10, 0x6d, 0x38, 0x74, 0x58, 0x74, 0x50, 0x88, 0x72, 0x50,
+  0x04, 0x93, 0x50, 0x92, 0x50, 0x72, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x83, 0x61, 0x08, 0x01, 0x61,
+  0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9b, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08,
+  0x6c, 0x30, 0x74, 0x58, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x64, 0x18, 0x60,
+  0x08, 0xab, 0x61, 0x08, 0x0c, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6a, 0x30, 0x60, 0x08, 0x95,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61,
+  0x08, 0x08, 0x62, 0x08, 0x61, 0x08, 0x82, 0x10, 0x8e, 0x0b, 0x51, 0x0c, 0xec, 0x12, 0xc7, 0x11,
+  0xe3, 0x10, 0x41, 0x10, 0x81, 0x00, 0x10, 0x00, 0x41, 0x10, 0x8a, 0x82, 0x10, 0x03, 0x20, 0x10,
+  0x00, 0x10, 0xa7, 0x11, 0x93, 0x0c, 0x81, 0x9b, 0x0e, 0x84, 0x39, 0x0e, 0x81, 0x19, 0x0e, 0x08,
+  0x5a, 0x0e, 0xbc, 0x0e, 0x5a, 0x0e, 0xd4, 0x0c, 0x6a, 0x12, 0x82, 0x10, 0x00, 0x10, 0x41, 0x08,
+  0x62, 0x10, 0x81, 0x82, 0x10, 0x85, 0x62, 0x10, 0x04, 0x82, 0x10, 0x61, 0x10, 0x20, 0x10, 0x61,
+  0x10, 0x62, 0x10, 0x85, 0x82, 0x10, 0x0a, 0x62, 0x10, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0x61,
+  0x10, 0xab, 0x12, 0x76, 0x0d, 0xbc, 0x06, 0x5a, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x94, 0x39, 0x0e,
+  0x05, 0x19, 0x0e, 0xbc, 0x0e, 0x35, 0x0d, 0xa2, 0x10, 0x20, 0x10, 0x82, 0x10, 0x85, 0x62, 0x10,
+  0x03, 0x80, 0x08, 0x85, 0x18, 0x72, 0x48, 0x74, 0x58, 0x81, 0x92, 0x50, 0x84, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x86, 0x72, 0x50, 0x02, 0x75, 0x58, 0x6c, 0x30, 0x60, 0x08, 0x87, 0x61, 0x08, 0x00,
+  0x62, 0x08, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0xae, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6a, 0x28,
+  0x74, 0x58, 0x84, 0x72, 0x50, 0x02, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0xad, 0x61, 0x08, 0x02,
+  0x60, 0x08, 0x68, 0x20, 0x74, 0x58, 0x83, 0x73, 0x50, 0x03, 0x93, 0x50, 0x74, 0x58, 0x69, 0x28,
+  0x60, 0x08, 0x9c, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x08,
+  0x81, 0x62, 0x08, 0x04, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61,
+  0x10, 0x82, 0x00, 0x10, 0x02, 0x20, 0x10, 0x41, 0x10, 0x62, 0x10, 0x8a, 0x82, 0x10, 0x06, 0x61,
+  0x10, 0x00, 0x10, 0x21, 0x10, 0xe8, 0x09, 0xb3, 0x0c, 0x7b, 0x0e, 0x9b, 0x0e, 0x85, 0x39, 0x0e,
+  0x00, 0x5a, 0x0e, 0x81, 0x9b, 0x0e, 0x02, 0xb7, 0x0d, 0xaf, 0x0b, 0x66, 0x11, 0x81, 0x00, 0x10,
+  0x02, 0x61, 0x10, 0x82, 0x08, 0x82, 0x10, 0x81, 0x62, 0x10, 0x00, 0x82, 0x10, 0x86, 0x62, 0x10,
+  0x05, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x62, 0x10, 0x83, 0x82, 0x10,
+  0x07, 0x41, 0x10, 0x00, 0x10, 0x82, 0x10, 0xab, 0x12, 0x77, 0x0d, 0xbc, 0x0e, 0x7a, 0x0e, 0x19,
+  0x0e, 0x81, 0x3a, 0x0e, 0x94, 0x39, 0x0e, 0x02, 0x3a, 0x0e, 0xbc, 0x06, 0x31, 0x0c, 0x81, 0x41,
+  0x10, 0x00, 0x82, 0x10, 0x85, 0x62, 0x10, 0x05, 0x60, 0x00, 0x68, 0x20, 0x74, 0x50, 0x73, 0x50,
+  0x92, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x73, 0x50,
+  0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x06, 0x73, 0x50, 0x72, 0x50, 0x95, 0x58, 0x68, 0x20,
+  0x60, 0x08, 0x62, 0x10, 0x61, 0x10, 0x82, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08,
+  0xb2, 0x61, 0x08, 0x02, 0x60, 0x08, 0x68, 0x28, 0x74, 0x58, 0x84, 0x72, 0x50, 0x02, 0x74, 0x50,
+  0x67, 0x20, 0x60, 0x08, 0xad, 0x61, 0x08, 0x03, 0x60, 0x08, 0x69, 0x28, 0x74, 0x58, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x58, 0x67, 0x20, 0x60, 0x08, 0x9f, 0x61, 0x08, 0x00,
+  0x62, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x03, 0x62, 0x08, 0x61, 0x10,
+  0x62, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x85, 0x62, 0x10, 0x01, 0x82, 0x10,
+  0x62, 0x08, 0x81, 0x62, 0x10, 0x82, 0x82, 0x10, 0x05, 0x62, 0x10, 0x20, 0x10, 0x00, 0x10, 0x82,
+  0x10, 0x6a, 0x0a, 0x15, 0x0d, 0x81, 0x9b, 0x0e, 0x01, 0x39, 0x0e, 0x19, 0x0e, 0x82, 0x39, 0x0e,
+  0x0c, 0x5a, 0x0e, 0xbb, 0x0e, 0x9b, 0x0e, 0xd8, 0x0d, 0x32, 0x0c, 0x29, 0x12, 0xa2, 0x10, 0x00,
+  0x10, 0x20, 0x10, 0x62, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x84, 0x62, 0x10, 0x00, 0x82,
+  0x10, 0x84, 0x62, 0x10, 0x03, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x82, 0x10,
+  0x08, 0x61, 0x10, 0x20, 0x10, 0x00, 0x10, 0x04, 0x11, 0x4d, 0x0b, 0xb7, 0x0d, 0xbc, 0x0e, 0x7a,
+  0x0e, 0x19, 0x0e, 0x81, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x93, 0x39, 0x0e, 0x06, 0x19, 0x0e, 0x7a,
+  0x0e, 0x7b, 0x0e, 0x0d, 0x13, 0x00, 0x10, 0x41, 0x10, 0x82, 0x10, 0x84, 0x62, 0x10, 0x06, 0x61,
+  0x10, 0x60, 0x08, 0x69, 0x28, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x89, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x93, 0x50, 0x73, 0x50, 0x83, 0x10, 0x84, 0x61, 0x08,
+  0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x97, 0x61, 0x08, 0x04, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50, 0x73, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x68, 0x28, 0x60, 0x08, 0xa9, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6a, 0x28, 0x74, 0x58, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x96, 0x61, 0x08, 0x02, 0x61,
+  0x10, 0x61, 0x08, 0x62, 0x08, 0x82, 0x61, 0x08, 0x82, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62,
+  0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x81,
+  0x61, 0x10, 0x86, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x82, 0x10, 0x08, 0x62, 0x10, 0x41, 0x10,
+  0x00, 0x10, 0x21, 0x10, 0x66, 0x11, 0x8e, 0x0b, 0x97, 0x0d, 0xbc, 0x0e, 0x7b, 0x0e, 0x82, 0x39,
+  0x0e, 0x07, 0x5a, 0x0e, 0x9b, 0x0e, 0xbc, 0x0e, 0x7a, 0x0e, 0x77, 0x0d, 0x11, 0x0c, 0x49, 0x12,
+  0xc3, 0x10, 0x81, 0x00, 0x10, 0x02, 0x61, 0x10, 0x82, 0x10, 0x62, 0x10, 0x81, 0x82, 0x10, 0x00,
+  0x62, 0x10, 0x81, 0x82, 0x10, 0x8c, 0x62, 0x10, 0x09, 0x82, 0x10, 0x62, 0x10, 0x40, 0x10, 0x00,
+  0x10, 0x61, 0x10, 0xe8, 0x11, 0x31, 0x0c, 0x19, 0x0e, 0xbc, 0x0e, 0x5a, 0x0e, 0x8c, 0x39, 0x0e,
+  0x00, 0x3a, 0x0e, 0x8a, 0x39, 0x0e, 0x06, 0x19, 0x0e, 0x9b, 0x0e, 0xd8, 0x0d, 0xe8, 0x11, 0x00,
+  0x10, 0x61, 0x10, 0x82, 0x10, 0x84, 0x62, 0x10, 0x04, 0x61, 0x10, 0x60, 0x00, 0x6a, 0x28, 0x75,
+  0x58, 0x73, 0x50, 0x81, 0x93, 0x50, 0x81, 0x73, 0x50, 0x02, 0x72, 0x50, 0x92, 0x50, 0x73, 0x50,
+  0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07,
+  0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6c, 0x30, 0x80, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10,
+  0x81, 0x61, 0x10, 0xb4, 0x61, 0x08, 0x02, 0x60, 0x08, 0x66, 0x20, 0x74, 0x58, 0x81, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x08, 0x61, 0x08, 0x61,
+  0x10, 0x93, 0x61, 0x08, 0x00, 0x61, 0x10, 0x96, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6b, 0x30, 0x74,
+  0x58, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x9c, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61,
+  0x08, 0x81, 0x62, 0x10, 0x01, 0x62, 0x08, 0x61, 0x10, 0x83, 0x62, 0x10, 0x83, 0x82, 0x10, 0x02,
+  0x61, 0x08, 0x61, 0x10, 0x41, 0x10, 0x81, 0x00, 0x10, 0x10, 0x61, 0x10, 0x65, 0x11, 0x0c, 0x0b,
+  0x15, 0x0d, 0x5a, 0x0e, 0xbb, 0x0e, 0x5a, 0x0e, 0x39, 0x0e, 0x5a, 0x0e, 0x9b, 0x0e, 0xbb, 0x0e,
+  0x7b, 0x0e, 0xd8, 0x0d, 0xb3, 0x0c, 0x2d, 0x13, 0xa6, 0x11, 0x62, 0x10, 0x81, 0x00, 0x10, 0x00,
+  0x61, 0x10, 0x81, 0x82, 0x10, 0x03, 0x62, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x82, 0x62,
+  0x10, 0x00, 0x82, 0x10, 0x81, 0x62, 0x10, 0x00, 0x82, 0x10, 0x81, 0x62, 0x10, 0x02, 0x82, 0x10,
+  0x62, 0x10, 0x82, 0x10, 0x81, 0x62, 0x10, 0x07, 0x82, 0x10, 0x61, 0x10, 0x20, 0x10, 0x00, 0x10,
+  0x41, 0x10, 0x66, 0x11, 0x4e, 0x0b, 0x76, 0x0d, 0x81, 0x9b, 0x0e, 0x01, 0x3a, 0x0e, 0x19, 0x0e,
+  0x98, 0x39, 0x0e, 0x04, 0x5a, 0x0e, 0xdc, 0x0e, 0x93, 0x0c, 0xc3, 0x10, 0x00, 0x10, 0x87, 0x62,
+  0x10, 0x05, 0x60, 0x08, 0x69, 0x28, 0x75, 0x58, 0x93, 0x50, 0x92, 0x50, 0x72, 0x50, 0x82, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x87, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x02, 0x63, 0x10, 0x61, 0x08, 0x62, 0x10, 0xb7, 0x61, 0x08, 0x02, 0x60, 0x08,
+  0x66, 0x18, 0x74, 0x50, 0x84, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x08, 0xab, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x04, 0x60, 0x08, 0x6c, 0x30, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x64, 0x18, 0xa0, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10,
+  0x82, 0x62, 0x10, 0x01, 0x82, 0x10, 0x41, 0x10, 0x82, 0x00, 0x10, 0x08, 0x40, 0x10, 0xa2, 0x10,
+  0x65, 0x11, 0x6a, 0x0a, 0xd0, 0x0b, 0x56, 0x0d, 0x5a, 0x0e, 0x9c, 0x0e, 0x7b, 0x0e, 0x81, 0x39,
+  0x0e, 0x06, 0x3a, 0x0e, 0xf8, 0x0d, 0xf4, 0x0c, 0x11, 0x0c, 0xec, 0x12, 0xc7, 0x11, 0xa3, 0x10,
+  0x81, 0x00, 0x10, 0x01, 0x20, 0x10, 0x61, 0x10, 0x82, 0x82, 0x10, 0x81, 0x62, 0x10, 0x82, 0x82,
+  0x10, 0x82, 0x62, 0x10, 0x87, 0x82, 0x10, 0x01, 0x61, 0x10, 0x41, 0x10, 0x81, 0x00, 0x10, 0x07,
+  0x20, 0x10, 0xa3, 0x10, 0xe8, 0x11, 0x8f, 0x0b, 0x36, 0x0d, 0x5a, 0x0e, 0xbc, 0x0e, 0x7a, 0x0e,
+  0x9b, 0x39, 0x0e, 0x05, 0xbb, 0x0e, 0x3a, 0x0e, 0xcb, 0x12, 0x00, 0x10, 0x41, 0x10, 0x82, 0x10,
+  0x86, 0x62, 0x10, 0x03, 0x80, 0x08, 0x88, 0x20, 0x74, 0x50, 0x93, 0x50, 0x87, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x8a, 0x72, 0x50, 0x0a, 0x75, 0x58, 0x6a, 0x28,
+  0x60, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x62, 0x08, 0x61, 0x08,
+  0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0xac, 0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18,
+  0x73, 0x50, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x94, 0x58, 0x6b, 0x30, 0x60, 0x08,
+  0xad, 0x61, 0x08, 0x05, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x00, 0x64, 0x10, 0xa0, 0x61, 0x08, 0x00, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x62, 0x10, 0x09, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10, 0x25,
+  0x11, 0xec, 0x0a, 0xaf, 0x0b, 0x52, 0x0c, 0xf4, 0x0c, 0xb8, 0x0d, 0x3a, 0x0e, 0x81, 0x9b, 0x0e,
+  0x00, 0x5a, 0x0e, 0x84, 0x39, 0x0e, 0x04, 0x5a, 0x0e, 0xb8, 0x0d, 0x4e, 0x0b, 0x25, 0x11, 0x20,
+  0x10, 0x81, 0x00, 0x10, 0x01, 0x20, 0x10, 0x41, 0x10, 0x82, 0x61, 0x10, 0x00, 0x62, 0x10, 0x85,
+  0x82, 0x10, 0x82, 0x62, 0x10, 0x82, 0x61, 0x10, 0x01, 0x41, 0x10, 0x20, 0x10, 0x82, 0x00, 0x10,
+  0x08, 0x41, 0x10, 0x04, 0x11, 0x08, 0x12, 0x2d, 0x0b, 0x93, 0x0c, 0xd8, 0x0d, 0x9b, 0x0e, 0xbc,
+  0x0e, 0x5a, 0x0e, 0x9b, 0x39, 0x0e, 0x07, 0x19, 0x0e, 0x7a, 0x0e, 0xbc, 0x06, 0x93, 0x0c, 0x04,
+  0x11, 0x00, 0x10, 0x62, 0x10, 0x82, 0x10, 0x86, 0x62, 0x10, 0x08, 0x60, 0x08, 0x86, 0x18, 0x74,
+  0x50, 0x93, 0x50, 0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x05, 0x73, 0x50, 0x93, 0x50, 0x70, 0x48, 0x81, 0x08, 0x61, 0x08, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0xac,
+  0x61, 0x08, 0x00, 0x64, 0x18, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6c, 0x30,
+  0x60, 0x08, 0xad, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58, 0x82, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x00, 0x63, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x62, 0x08, 0x88, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x8a, 0x61, 0x08, 0x00, 0x62, 0x08, 0x84, 0x61, 0x08, 0x81, 0x62, 0x10, 0x0c, 0x61, 0x10,
+  0x82, 0x10, 0x20, 0x10, 0x00, 0x10, 0xcb, 0x0a, 0x19, 0x0e, 0xdc, 0x0e, 0xbb, 0x0e, 0x9b, 0x0e,
+  0x7b, 0x0e, 0x5a, 0x0e, 0x3a, 0x0e, 0x19, 0x0e, 0x87, 0x39, 0x0e, 0x0b, 0x5a, 0x0e, 0xbb, 0x0e,
+  0x7b, 0x0e, 0xb8, 0x0d, 0x93, 0x0c, 0x6e, 0x0b, 0x49, 0x12, 0x66, 0x11, 0xe3, 0x10, 0x62, 0x10,
+  0x41, 0x10, 0x20, 0x10, 0x87, 0x00, 0x10, 0x0e, 0x20, 0x10, 0x41, 0x10, 0x62, 0x10, 0xa3, 0x10,
+  0x45, 0x11, 0xa7, 0x11, 0x8a, 0x12, 0x6e, 0x0b, 0x72, 0x0c, 0x36, 0x0d, 0x19, 0x0e, 0x9b, 0x0e,
+  0xbb, 0x0e, 0x7b, 0x0e, 0x5a, 0x0e, 0x9d, 0x39, 0x0e, 0x06, 0x3a, 0x0e, 0xbc, 0x0e, 0xb8, 0x0d,
+  0x6a, 0x12, 0x00, 0x10, 0x20, 0x10, 0x82, 0x10, 0x84, 0x62, 0x10, 0x81, 0x61, 0x10, 0x02, 0x62,
+  0x10, 0x61, 0x08, 0x63, 0x10, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x89, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x87, 0x72, 0x50, 0x04, 0x74, 0x50,
+  0x85, 0x18, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa0, 0x61, 0x08, 0x00,
+  0x63, 0x10, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x74, 0x50, 0x6c, 0x38, 0x60, 0x08, 0xad,
+  0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58, 0x82, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02,
+  0x63, 0x10, 0x61, 0x08, 0x61, 0x10, 0x9b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x09,
+  0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x00, 0x10, 0xe4, 0x10, 0xb3, 0x0c, 0xbc, 0x0e,
+  0x5a, 0x0e, 0x19, 0x0e, 0x90, 0x39, 0x0e, 0x09, 0x5a, 0x0e, 0x9b, 0x0e, 0xbc, 0x0e, 0x9b, 0x0e,
+  0x5a, 0x0e, 0xd8, 0x0d, 0x97, 0x0d, 0x36, 0x0d, 0xd4, 0x0c, 0x52, 0x0c, 0x81, 0x11, 0x0c, 0x81,
+  0xf0, 0x0b, 0x81, 0x11, 0x0c, 0x0c, 0x52, 0x0c, 0xb4, 0x0c, 0x35, 0x0d, 0x77, 0x0d, 0xd8, 0x0d,
+  0x5a, 0x0e, 0x7b, 0x0e, 0x9b, 0x0e, 0xbc, 0x0e, 0x9b, 0x0e, 0x7a, 0x0e, 0x3a, 0x0e, 0x19, 0x0e,
+  0x9f, 0x39, 0x0e, 0x05, 0x9b, 0x0e, 0x5a, 0x0e, 0x8f, 0x13, 0x82, 0x10, 0x00, 0x10, 0x61, 0x10,
+  0x85, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x81, 0x61, 0x08, 0x01, 0x70, 0x40, 0x94,
+  0x50, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x93, 0x50, 0x81, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x09, 0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x74, 0x58, 0x6a, 0x28, 0x60,
+  0x08, 0x61, 0x08, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x8d,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xa2, 0x61, 0x08, 0x00, 0x63, 0x10, 0x81, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50, 0x6d, 0x38, 0x60, 0x08, 0xad, 0x61, 0x08, 0x03,
+  0x60, 0x08, 0x6e, 0x38, 0x74, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x73, 0x50,
+  0x72, 0x50, 0x63, 0x10, 0x90, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x62, 0x10, 0x81, 0x61, 0x08, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x86, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x82, 0x62, 0x08, 0x06, 0x62, 0x10, 0x82, 0x08, 0x41, 0x10, 0x00, 0x10, 0x6a,
+  0x12, 0x19, 0x0e, 0x9b, 0x0e, 0x97, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x5a, 0x0e, 0x00, 0x7a,
+  0x0e, 0x82, 0x9b, 0x0e, 0x81, 0xbb, 0x0e, 0x82, 0xbc, 0x0e, 0x02, 0xbb, 0x0e, 0x9b, 0x0e, 0x7b,
+  0x0e, 0x81, 0x5a, 0x0e, 0x00, 0x3a, 0x0e, 0xa4, 0x39, 0x0e, 0x06, 0x9b, 0x0e, 0x7b, 0x0e, 0x31,
+  0x0c, 0x25, 0x11, 0x00, 0x10, 0x61, 0x10, 0x82, 0x10, 0x89, 0x62, 0x10, 0x02, 0x80, 0x08, 0x6c,
+  0x38, 0x75, 0x58, 0x81, 0x92, 0x50, 0x82, 0x72, 0x50, 0x81, 0x93, 0x50, 0x81, 0x72, 0x50, 0x02,
+  0x93, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x93, 0x50, 0x87,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x74, 0x50, 0x6e, 0x38, 0x60, 0x08, 0x62,
+  0x10, 0x81, 0x62, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8b,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x02, 0x63, 0x10, 0x72, 0x48, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x06, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50, 0x6d, 0x38, 0x60, 0x08, 0x61, 0x08, 0x61,
+  0x10, 0xab, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x50, 0x82, 0x73, 0x50, 0x05, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x48, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0x85, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62,
+  0x10, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x62, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x61,
+  0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x0b, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x62, 0x08, 0x82, 0x08, 0x00, 0x10, 0x82, 0x10, 0x31, 0x0c, 0xbc, 0x0e, 0x5a, 0x0e, 0x99,
+  0x39, 0x0e, 0x00, 0x3a, 0x0e, 0xb2, 0x39, 0x0e, 0x81, 0x9b, 0x0e, 0x05, 0x93, 0x0c, 0x86, 0x11,
+  0x00, 0x10, 0x21, 0x10, 0x82, 0x08, 0x82, 0x10, 0x86, 0x62, 0x10, 0x05, 0x62, 0x08, 0x62, 0x10,
+  0x82, 0x10, 0x80, 0x08, 0x68, 0x20, 0x75, 0x58, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x89, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x82, 0x72, 0x50, 0x02, 0x73, 0x50, 0x71, 0x48, 0x61, 0x08, 0x81, 0x61, 0x10, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x62, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x02, 0x63, 0x10, 0x72, 0x48, 0x73, 0x50,
+  0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x50, 0x6d, 0x38, 0x60, 0x08, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xa8, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x50, 0x82, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x01, 0x72, 0x48, 0x63, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x10, 0x00, 0x62, 0x08, 0x82, 0x62, 0x10,
+  0x04, 0x61, 0x10, 0x00, 0x10, 0xa7, 0x11, 0x97, 0x0d, 0xbc, 0x0e, 0xcb, 0x39, 0x0e, 0x08, 0x19,
+  0x0e, 0x39, 0x0e, 0x9b, 0x0e, 0x7b, 0x0e, 0x93, 0x0c, 0xc7, 0x11, 0x00, 0x10, 0x20, 0x10, 0x81,
+  0x10, 0x8b, 0x62, 0x10, 0x03, 0x81, 0x08, 0x63, 0x10, 0x73, 0x50, 0x93, 0x50, 0x85, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x8d, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x63, 0x10, 0x61, 0x08, 0x62, 0x10,
+  0x81, 0x61, 0x10, 0x03, 0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x82, 0x61, 0x10, 0xad,
+  0x61, 0x08, 0x02, 0x62, 0x10, 0x72, 0x48, 0x73, 0x50, 0x83, 0x72, 0x50, 0x03, 0x74, 0x50, 0x6e,
+  0x38, 0x60, 0x08, 0x61, 0x10, 0xac, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x50, 0x83,
+  0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x63, 0x10, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x82, 0x62, 0x10, 0x00, 0x82,
+  0x10, 0x81, 0x20, 0x10, 0x02, 0x2d, 0x0b, 0x7b, 0x0e, 0x7a, 0x0e, 0x9d, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0xab, 0x39, 0x0e, 0x08, 0x19, 0x0e, 0x5a, 0x0e, 0xbc, 0x0e, 0x5a, 0x0e, 0x32, 0x0c, 0x86,
+  0x11, 0x00, 0x10, 0x20, 0x10, 0x81, 0x10, 0x81, 0x82, 0x10, 0x89, 0x62, 0x10, 0x05, 0x61, 0x10,
+  0x62, 0x10, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58, 0x92, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x84, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x89, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x0c, 0x74, 0x50,
+  0x65, 0x18, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x63, 0x10, 0x69, 0x28,
+  0x64, 0x10, 0x80, 0x08, 0x60, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x02, 0x62, 0x10,
+  0x72, 0x48, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x74, 0x50, 0x6e, 0x38, 0x60, 0x08, 0xad, 0x61,
+  0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x50, 0x83, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x63,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x62,
+  0x10, 0x81, 0x62, 0x08, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x00, 0x10, 0xe4,
+  0x10, 0xd4, 0x0c, 0xbc, 0x0e, 0x3a, 0x0e, 0x94, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x87, 0x39, 0x0e,
+  0x00, 0x3a, 0x0e, 0x84, 0x5a, 0x0e, 0x00, 0x3a, 0x0e, 0xa4, 0x39, 0x0e, 0x07, 0x3a, 0x0e, 0x9b,
+  0x0e, 0xbc, 0x06, 0xd8, 0x0d, 0xaf, 0x0b, 0x25, 0x11, 0x00, 0x10, 0x20, 0x10, 0x81, 0x62, 0x10,
+  0x00, 0x82, 0x10, 0x89, 0x62, 0x10, 0x81, 0x61, 0x10, 0x05, 0x62, 0x10, 0x60, 0x08, 0x67, 0x20,
+  0x75, 0x58, 0x72, 0x50, 0x92, 0x50, 0x81, 0x72, 0x50, 0x01, 0x93, 0x50, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x8d, 0x72, 0x50,
+  0x0f, 0x74, 0x58, 0x67, 0x20, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x64,
+  0x18, 0x75, 0x58, 0x73, 0x50, 0x6e, 0x38, 0x86, 0x18, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x61,
+  0x10, 0xaa, 0x61, 0x08, 0x03, 0x62, 0x10, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x03, 0x72, 0x50, 0x74, 0x50, 0x6d, 0x38, 0x60, 0x08, 0xad, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6d,
+  0x38, 0x74, 0x50, 0x82, 0x72, 0x50, 0x03, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x64, 0x10, 0x81,
+  0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x08, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x02, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x10,
+  0x03, 0x62, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10, 0x81, 0x62, 0x10, 0x04, 0x41, 0x10, 0x00,
+  0x10, 0x29, 0x12, 0xf9, 0x0d, 0x9b, 0x0e, 0x9a, 0x39, 0x0e, 0x10, 0x5a, 0x0e, 0x9b, 0x0e, 0xbc,
+  0x0e, 0x9b, 0x0e, 0x7b, 0x0e, 0x3a, 0x0e, 0xf8, 0x0d, 0xb8, 0x0d, 0x97, 0x0d, 0xd8, 0x0d, 0xf9,
+  0x0d, 0x5a, 0x0e, 0x7b, 0x0e, 0x9b, 0x0e, 0xbc, 0x06, 0x9b, 0x0e, 0x5a, 0x0e, 0x9b, 0x39, 0x0e,
+  0x09, 0x19, 0x0e, 0x39, 0x0e, 0x7b, 0x0e, 0xbc, 0x0e, 0x3a, 0x0e, 0xd4, 0x0c, 0xab, 0x0a, 0xa2,
+  0x10, 0x00, 0x10, 0x20, 0x10, 0x81, 0x62, 0x10, 0x00, 0x82, 0x10, 0x85, 0x62, 0x10, 0x00, 0x62,
+  0x08, 0x81, 0x62, 0x10, 0x04, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x01, 0x71, 0x48, 0x93, 0x50, 0x8a, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x93, 0x50, 0x85, 0x72, 0x50, 0x02, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50,
+  0x00, 0x92, 0x50, 0x82, 0x72, 0x50, 0x03, 0x74, 0x58, 0x89, 0x28, 0x60, 0x08, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x03, 0x61, 0x08, 0x65, 0x18, 0x73, 0x50, 0x72, 0x50, 0x81, 0x74, 0x58, 0x01, 0x70,
+  0x40, 0x67, 0x20, 0x81, 0x60, 0x08, 0x03, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x87,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x02, 0x63, 0x10, 0x72, 0x50, 0x73, 0x50, 0x83,
+  0x72, 0x50, 0x03, 0x74, 0x58, 0x6c, 0x30, 0x60, 0x08, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x80,
+  0x08, 0x6c, 0x38, 0x74, 0x50, 0x82, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x65, 0x18, 0x82, 0x61,
+  0x08, 0x01, 0x61, 0x10, 0x62, 0x08, 0x85, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61,
+  0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x05, 0x82, 0x10, 0x20, 0x10, 0x41, 0x10, 0xd0, 0x0b, 0x9b,
+  0x0e, 0x5a, 0x0e, 0x98, 0x39, 0x0e, 0x17, 0x5a, 0x0e, 0xbc, 0x0e, 0x9b, 0x0e, 0xd8, 0x0d, 0x93,
+  0x0c, 0x6e, 0x0b, 0x4a, 0x12, 0xa7, 0x11, 0x45, 0x11, 0xe4, 0x10, 0xa2, 0x10, 0x82, 0x10, 0xa2,
+  0x10, 0xe4, 0x10, 0x66, 0x11, 0xc7, 0x11, 0xab, 0x0a, 0x8f, 0x0b, 0xd4, 0x0c, 0xd8, 0x0d, 0x7b,
+  0x0e, 0xbc, 0x06, 0x9b, 0x0e, 0x5a, 0x0e, 0x94, 0x39, 0x0e, 0x0b, 0x5a, 0x0e, 0x7b, 0x0e, 0xbb,
+  0x06, 0x9b, 0x0e, 0x19, 0x0e, 0xf4, 0x0c, 0x0d, 0x13, 0x25, 0x11, 0x20, 0x10, 0x00, 0x10, 0x41,
+  0x10, 0x82, 0x10, 0x8d, 0x62, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x03, 0x60,
+  0x08, 0x6a, 0x28, 0x75, 0x50, 0x92, 0x50, 0x8a, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02,
+  0x72, 0x50, 0x93, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x8a, 0x28, 0x60, 0x08,
+  0x81, 0x62, 0x10, 0x03, 0x61, 0x08, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50, 0x82, 0x72, 0x50, 0x04,
+  0x73, 0x50, 0x74, 0x58, 0x70, 0x40, 0x67, 0x20, 0x60, 0x08, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10,
+  0xa3, 0x61, 0x08, 0x00, 0x63, 0x10, 0x81, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x03, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x08, 0x61, 0x10, 0xa1, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x89, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6c, 0x30, 0x74, 0x58, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x06, 0x72, 0x50, 0x73, 0x50, 0x65, 0x18, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x89,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x61, 0x08, 0x0a, 0x62,
+  0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x00, 0x10, 0x25,
+  0x11, 0x35, 0x0d, 0xbc, 0x0e, 0x8b, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8b, 0x39, 0x0e, 0x81, 0x9b,
+  0x0e, 0x03, 0x77, 0x0d, 0xaf, 0x0b, 0xe8, 0x09, 0xc3, 0x10, 0x82, 0x00, 0x10, 0x00, 0x20, 0x10,
+  0x81, 0x41, 0x10, 0x82, 0x61, 0x10, 0x02, 0x41, 0x10, 0x40, 0x10, 0x20, 0x10, 0x81, 0x00, 0x10,
+  0x0a, 0x20, 0x10, 0xc3, 0x10, 0xc7, 0x09, 0x2d, 0x0b, 0x93, 0x0c, 0xd8, 0x0d, 0x7b, 0x0e, 0xbc,
+  0x0e, 0x9b, 0x0e, 0x7a, 0x0e, 0x5a, 0x0e, 0x82, 0x39, 0x0e, 0x84, 0x19, 0x0e, 0x01, 0x39, 0x0e,
+  0x3a, 0x0e, 0x85, 0x39, 0x0e, 0x07, 0xf8, 0x0d, 0xf4, 0x0c, 0xaf, 0x0b, 0x69, 0x0a, 0x04, 0x11,
+  0x20, 0x10, 0x00, 0x10, 0x41, 0x10, 0x84, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00,
+  0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x88, 0x62, 0x10, 0x03, 0x61, 0x08, 0x62, 0x10,
+  0x72, 0x48, 0x73, 0x50, 0x8a, 0x72, 0x50, 0x02, 0x92, 0x50, 0x72, 0x50, 0x93, 0x50, 0x8b, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x04, 0x93, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6a, 0x28,
+  0x60, 0x08, 0x81, 0x61, 0x10, 0x05, 0x62, 0x10, 0x60, 0x08, 0x68, 0x20, 0x74, 0x58, 0x72, 0x50,
+  0x73, 0x50, 0x82, 0x72, 0x50, 0x04, 0x74, 0x50, 0x75, 0x58, 0x6f, 0x40, 0x64, 0x10, 0x60, 0x08,
+  0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9b, 0x61, 0x08, 0x00,
+  0x64, 0x18, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x08, 0x61,
+  0x10, 0xac, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6b, 0x30, 0x74, 0x50, 0x83, 0x72, 0x50, 0x03, 0x73,
+  0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x94, 0x61, 0x08, 0x05, 0x62, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x62, 0x10, 0x06, 0x82, 0x10, 0x41, 0x10, 0x00,
+  0x10, 0x6a, 0x0a, 0x19, 0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0x96, 0x39, 0x0e, 0x0a, 0x9b, 0x0e, 0x5a,
+  0x0e, 0x93, 0x0c, 0x08, 0x12, 0x61, 0x10, 0x00, 0x10, 0x20, 0x10, 0x61, 0x10, 0x62, 0x08, 0x62,
+  0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x02, 0x62, 0x08, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x00, 0x62, 0x08, 0x81, 0x61, 0x10, 0x00, 0x20, 0x10, 0x81,
+  0x00, 0x10, 0x0d, 0xa3, 0x10, 0xc7, 0x11, 0x0d, 0x13, 0x52, 0x0c, 0x56, 0x0d, 0xf8, 0x0d, 0x5a,
+  0x0e, 0x7b, 0x0e, 0x9b, 0x0e, 0xbb, 0x0e, 0xbc, 0x0e, 0xdc, 0x0e, 0xbc, 0x0e, 0xbb, 0x0e, 0x85,
+  0x39, 0x0e, 0x03, 0x9b, 0x06, 0xaf, 0x13, 0x41, 0x10, 0x21, 0x10, 0x81, 0x00, 0x10, 0x01, 0x41,
+  0x10, 0x62, 0x10, 0x81, 0x82, 0x10, 0x8b, 0x62, 0x10, 0x81, 0x61, 0x10, 0x83, 0x62, 0x10, 0x00,
+  0x62, 0x08, 0x81, 0x62, 0x10, 0x03, 0x60, 0x08, 0x6a, 0x28, 0x74, 0x58, 0x72, 0x50, 0x81, 0x93,
+  0x50, 0x83, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x8d, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x08, 0x74, 0x58, 0x6a, 0x28, 0x60,
+  0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x60, 0x08, 0x6a, 0x28, 0x75, 0x58, 0x86, 0x72, 0x50,
+  0x04, 0x74, 0x58, 0x74, 0x50, 0x69, 0x28, 0x60, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62,
+  0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x97, 0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18, 0x74,
+  0x50, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x08, 0xad,
+  0x61, 0x08, 0x02, 0x60, 0x08, 0x6a, 0x28, 0x74, 0x58, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x92,
+  0x50, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x94, 0x61, 0x08, 0x03, 0x61, 0x10, 0x62, 0x10, 0x62,
+  0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x06, 0x61, 0x10, 0x82, 0x08, 0x20, 0x10, 0x41, 0x10, 0xf0,
+  0x0b, 0xbc, 0x0e, 0x3a, 0x0e, 0x96, 0x39, 0x0e, 0x03, 0x7b, 0x0e, 0x9b, 0x06, 0x72, 0x0c, 0x66,
+  0x11, 0x81, 0x00, 0x10, 0x82, 0x61, 0x10, 0x05, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08,
+  0x61, 0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x06, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x82, 0x62, 0x10, 0x81, 0x62, 0x08, 0x01, 0x41, 0x10, 0x20,
+  0x10, 0x81, 0x00, 0x10, 0x06, 0x41, 0x10, 0xc3, 0x10, 0x65, 0x11, 0xc7, 0x11, 0x29, 0x12, 0xab,
+  0x12, 0xec, 0x12, 0x81, 0xec, 0x0a, 0x02, 0x2d, 0x13, 0x3a, 0x0e, 0x5a, 0x0e, 0x83, 0x39, 0x0e,
+  0x03, 0x5a, 0x0e, 0xd8, 0x0d, 0xe3, 0x10, 0x21, 0x10, 0x83, 0x82, 0x10, 0x84, 0x62, 0x10, 0x00,
+  0x62, 0x08, 0x82, 0x62, 0x10, 0x00, 0x62, 0x08, 0x84, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x04, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x71, 0x48,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x03, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x8c, 0x72, 0x50, 0x04, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x08, 0x62, 0x08, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x02, 0x65, 0x18, 0x72, 0x50, 0x74, 0x58, 0x81, 0x72, 0x50, 0x00, 0x93, 0x50, 0x83, 0x72,
+  0x50, 0x05, 0x93, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x82, 0x61,
+  0x08, 0x03, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x9b, 0x61, 0x08, 0x02, 0x60, 0x08,
+  0x66, 0x20, 0x74, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x95, 0x58,
+  0x69, 0x28, 0x60, 0x08, 0xad, 0x61, 0x08, 0x02, 0x60, 0x08, 0x69, 0x28, 0x94, 0x58, 0x81, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x67, 0x20, 0x60, 0x08, 0x93, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x84, 0x62, 0x10, 0x04, 0x62, 0x08, 0x00, 0x10, 0x04, 0x11, 0x36, 0x0d, 0xbc,
+  0x0e, 0x96, 0x39, 0x0e, 0x06, 0x5a, 0x0e, 0xbc, 0x0e, 0xf5, 0x0c, 0xc7, 0x11, 0x00, 0x10, 0x20,
+  0x10, 0x61, 0x10, 0x81, 0x62, 0x10, 0x83, 0x61, 0x10, 0x02, 0x81, 0x08, 0x80, 0x08, 0x60, 0x08,
+  0x82, 0x62, 0x10, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x62, 0x10, 0x62, 0x08, 0x61, 0x08,
+  0x88, 0x62, 0x10, 0x03, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x10, 0x85, 0x00, 0x10, 0x01,
+  0xec, 0x12, 0xbc, 0x0e, 0x84, 0x39, 0x0e, 0x03, 0xbb, 0x0e, 0xf4, 0x0c, 0x20, 0x10, 0x61, 0x10,
+  0x82, 0x82, 0x10, 0x83, 0x62, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x62, 0x08, 0x00,
+  0x61, 0x08, 0x81, 0x62, 0x08, 0x00, 0x61, 0x08, 0x84, 0x62, 0x10, 0x07, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x62, 0x10, 0x60, 0x08, 0x68, 0x20, 0x74, 0x58, 0x92, 0x50, 0xa1, 0x72, 0x50, 0x0c,
+  0x74, 0x50, 0x68, 0x20, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x60, 0x08,
+  0x62, 0x08, 0x6d, 0x38, 0x74, 0x50, 0x73, 0x50, 0x92, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x82, 0x72, 0x50, 0x03, 0x75, 0x58, 0x6e, 0x40, 0x81, 0x08, 0x61, 0x08, 0x81, 0x61, 0x10, 0xa0,
+  0x61, 0x08, 0x02, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50, 0x84, 0x72, 0x50, 0x02, 0x74, 0x58, 0x68,
+  0x20, 0x60, 0x08, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x04, 0x60, 0x08, 0x68,
+  0x20, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x74, 0x58, 0x69, 0x28, 0x60,
+  0x08, 0x90, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x81, 0x82, 0x10, 0x05, 0x61, 0x10, 0x00, 0x10, 0x6a, 0x0a, 0x39, 0x0e, 0x7b, 0x0e, 0x19,
+  0x0e, 0x94, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0xcb, 0x12, 0x20, 0x10, 0x00,
+  0x10, 0x82, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08,
+  0x00, 0x62, 0x10, 0x81, 0x66, 0x18, 0x00, 0x81, 0x08, 0x83, 0x62, 0x10, 0x00, 0x61, 0x08, 0x82,
+  0x62, 0x10, 0x00, 0x61, 0x08, 0x92, 0x62, 0x10, 0x03, 0x00, 0x10, 0xf0, 0x0b, 0xbc, 0x06, 0x19,
+  0x0e, 0x82, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x06, 0x4e, 0x0b, 0x00, 0x10, 0x82, 0x10, 0x8a,
+  0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x83, 0x62, 0x10, 0x00, 0x61, 0x08, 0x83, 0x62,
+  0x10, 0x03, 0x80, 0x08, 0x6e, 0x40, 0x74, 0x50, 0x92, 0x50, 0x8e, 0x72, 0x50, 0x01, 0x73, 0x50,
+  0x92, 0x50, 0x84, 0x72, 0x50, 0x01, 0x73, 0x50, 0x93, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x85, 0x72, 0x50, 0x0c, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10,
+  0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x80, 0x08, 0x66, 0x18, 0x71, 0x48, 0x74, 0x58, 0x86, 0x72,
+  0x50, 0x02, 0x95, 0x58, 0x6e, 0x38, 0x60, 0x08, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x97, 0x61,
+  0x08, 0x02, 0x60, 0x08, 0x68, 0x28, 0x74, 0x58, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x74,
+  0x50, 0x67, 0x20, 0x60, 0x08, 0xab, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x66,
+  0x20, 0x74, 0x50, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x94, 0x58, 0x6a, 0x30, 0x60,
+  0x08, 0x92, 0x61, 0x08, 0x0a, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0x82, 0x10, 0x62, 0x08, 0x82,
+  0x10, 0x21, 0x10, 0x20, 0x10, 0xaf, 0x0b, 0xbc, 0x0e, 0x5a, 0x0e, 0x95, 0x39, 0x0e, 0x05, 0x3a,
+  0x0e, 0xbc, 0x0e, 0x93, 0x0c, 0xe4, 0x10, 0x00, 0x10, 0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61,
+  0x08, 0x82, 0x61, 0x10, 0x07, 0x60, 0x08, 0x80, 0x08, 0x66, 0x18, 0x6d, 0x38, 0x72, 0x48, 0x76,
+  0x58, 0x6a, 0x28, 0x60, 0x08, 0x83, 0x61, 0x10, 0x81, 0x62, 0x10, 0x02, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x61, 0x08, 0x84, 0x62, 0x10, 0x05, 0x61, 0x08,
+  0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x82, 0x62, 0x10, 0x05, 0x82, 0x10,
+  0x61, 0x10, 0x21, 0x10, 0xd4, 0x0c, 0x9b, 0x0e, 0x19, 0x0e, 0x82, 0x39, 0x0e, 0x03, 0x3a, 0x0e,
+  0x9b, 0x0e, 0xe8, 0x11, 0x00, 0x10, 0x81, 0x82, 0x10, 0x89, 0x62, 0x10, 0x81, 0x61, 0x10, 0x02,
+  0x62, 0x08, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x83, 0x62, 0x10, 0x01, 0x61, 0x08, 0x63,
+  0x10, 0x81, 0x73, 0x50, 0x8a, 0x72, 0x50, 0x00, 0x73, 0x50, 0x88, 0x72, 0x50, 0x00, 0x92, 0x50,
+  0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50, 0x04, 0x92, 0x50, 0x93, 0x50, 0x73, 0x50,
+  0x64, 0x10, 0x61, 0x08, 0x83, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x06, 0x60, 0x08,
+  0x61, 0x08, 0x6d, 0x38, 0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x04,
+  0x75, 0x58, 0x6b, 0x30, 0x60, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x9d, 0x61, 0x08,
+  0x04, 0x60, 0x08, 0x6a, 0x28, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x74,
+  0x50, 0x65, 0x18, 0x60, 0x08, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa8, 0x61, 0x08, 0x01, 0x60,
+  0x08, 0x64, 0x18, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58,
+  0x6c, 0x30, 0x60, 0x08, 0x92, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x62, 0x10, 0x04, 0x82, 0x08,
+  0x00, 0x10, 0xc3, 0x10, 0xd4, 0x0c, 0xbc, 0x0e, 0x95, 0x39, 0x0e, 0x06, 0x19, 0x0e, 0x7b, 0x0e,
+  0x5a, 0x0e, 0xec, 0x12, 0x00, 0x10, 0x20, 0x10, 0x82, 0x08, 0x81, 0x62, 0x10, 0x0c, 0x61, 0x10,
+  0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x80, 0x08, 0x65, 0x18, 0x70, 0x40, 0x74, 0x58, 0x74, 0x50,
+  0x93, 0x50, 0x92, 0x48, 0x62, 0x08, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x82, 0x61,
+  0x10, 0x02, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x61, 0x08,
+  0x84, 0x62, 0x10, 0x05, 0x61, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x08, 0x62, 0x10, 0x61, 0x10,
+  0x83, 0x62, 0x10, 0x05, 0x82, 0x10, 0x41, 0x10, 0x82, 0x10, 0x56, 0x0d, 0x9b, 0x0e, 0x19, 0x0e,
+  0x82, 0x39, 0x0e, 0x04, 0x5a, 0x0e, 0xf8, 0x0d, 0xc3, 0x10, 0x41, 0x10, 0x82, 0x10, 0x8c, 0x62,
+  0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x08, 0x00, 0x61, 0x10, 0x83, 0x62, 0x10, 0x04, 0x60, 0x08,
+  0x68, 0x20, 0x74, 0x58, 0x92, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x9b, 0x72, 0x50, 0x00, 0x93,
+  0x50, 0x81, 0x72, 0x50, 0x02, 0x73, 0x50, 0x71, 0x48, 0x62, 0x08, 0x85, 0x61, 0x08, 0x07, 0x62,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x80, 0x08, 0x8a, 0x30, 0x75, 0x58, 0x93, 0x50, 0x84,
+  0x72, 0x50, 0x07, 0x93, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x9c, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6c, 0x30, 0x74, 0x58, 0x82, 0x73, 0x50,
+  0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x64, 0x10, 0x60, 0x08, 0xae, 0x61, 0x08, 0x00, 0x64,
+  0x10, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x74, 0x58, 0x6d, 0x38, 0x60,
+  0x08, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x81, 0x62, 0x10, 0x06, 0x82, 0x10,
+  0x61, 0x10, 0x00, 0x10, 0xe8, 0x11, 0xf9, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x95, 0x39, 0x0e, 0x04,
+  0xbc, 0x06, 0x77, 0x0d, 0x66, 0x11, 0x00, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x81, 0x61, 0x10,
+  0x08, 0x61, 0x08, 0x60, 0x08, 0x6b, 0x30, 0x74, 0x58, 0x94, 0x50, 0x92, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x71, 0x48, 0x81, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x00, 0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x10, 0x84, 0x62,
+  0x10, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x10, 0x81,
+  0x61, 0x10, 0x01, 0x62, 0x10, 0x61, 0x10, 0x81, 0x82, 0x10, 0x04, 0x20, 0x10, 0xc3, 0x10, 0xb8,
+  0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x81, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0x9b, 0x0e, 0xf4, 0x0c, 0x20,
+  0x10, 0x61, 0x10, 0x82, 0x10, 0x8a, 0x62, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10,
+  0x01, 0x62, 0x10, 0x62, 0x08, 0x81, 0x62, 0x10, 0x03, 0x61, 0x10, 0x80, 0x08, 0x6d, 0x38, 0x74,
+  0x58, 0xa2, 0x72, 0x50, 0x03, 0x74, 0x50, 0x6e, 0x38, 0x60, 0x08, 0x61, 0x10, 0x86, 0x61, 0x08,
+  0x82, 0x61, 0x10, 0x01, 0x80, 0x00, 0x68, 0x20, 0x81, 0x73, 0x50, 0x84, 0x72, 0x50, 0x03, 0x74,
+  0x50, 0x6f, 0x40, 0x80, 0x08, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x06, 0x61, 0x10, 0x60, 0x08, 0x6d,
+  0x38, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x63, 0x10, 0x81,
+  0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xaa, 0x61, 0x08, 0x01, 0x63, 0x10, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x94, 0x50, 0x6f, 0x40, 0x60,
+  0x08, 0x90, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x05, 0x82, 0x08, 0x41, 0x10, 0x00,
+  0x10, 0x2d, 0x0b, 0x9b, 0x0e, 0x5a, 0x0e, 0x95, 0x39, 0x0e, 0x08, 0x3a, 0x0e, 0xbc, 0x06, 0x52,
+  0x0c, 0x62, 0x10, 0x00, 0x10, 0x82, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x02, 0x6e, 0x38, 0x95, 0x58, 0x93, 0x50, 0x82, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x01, 0x83, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62,
+  0x10, 0x61, 0x10, 0x81, 0x62, 0x10, 0x04, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x61,
+  0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x07, 0x61, 0x08, 0x62, 0x10, 0x61,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x05, 0x82,
+  0x10, 0x00, 0x10, 0x25, 0x11, 0xf9, 0x0d, 0x7b, 0x0e, 0x19, 0x0e, 0x81, 0x39, 0x0e, 0x04, 0x19,
+  0x0e, 0xbc, 0x06, 0x11, 0x0c, 0x00, 0x10, 0x61, 0x08, 0x81, 0x82, 0x10, 0x84, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x03, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x82, 0x62, 0x10, 0x00, 0x61,
+  0x08, 0x81, 0x62, 0x10, 0x02, 0x61, 0x10, 0x61, 0x08, 0x70, 0x40, 0x81, 0x73, 0x50, 0x87, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x98, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x08, 0x82, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x03, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x02, 0x81, 0x08, 0x71, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x04, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x9d, 0x61, 0x08, 0x05, 0x60,
+  0x08, 0x6f, 0x40, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x72,
+  0x48, 0x62, 0x10, 0xb0, 0x61, 0x08, 0x01, 0x71, 0x48, 0x73, 0x50, 0x83, 0x72, 0x50, 0x01, 0x73,
+  0x50, 0x70, 0x48, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x09, 0x61, 0x10, 0x61,
+  0x08, 0x62, 0x08, 0x61, 0x08, 0x82, 0x10, 0x00, 0x10, 0x82, 0x10, 0x93, 0x0c, 0xbc, 0x0e, 0x3a,
+  0x0e, 0x95, 0x39, 0x0e, 0x04, 0x7a, 0x0e, 0x7b, 0x0e, 0xec, 0x0a, 0x00, 0x10, 0x41, 0x10, 0x82,
+  0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x06, 0x61, 0x10, 0x60, 0x08, 0x6d,
+  0x38, 0x75, 0x58, 0x92, 0x50, 0x93, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x94, 0x58, 0x69,
+  0x28, 0x60, 0x00, 0x84, 0x62, 0x10, 0x09, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x83, 0x62, 0x10, 0x83, 0x61,
+  0x10, 0x02, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x84, 0x62, 0x10, 0x05, 0x82, 0x10, 0x00, 0x10,
+  0x45, 0x11, 0x19, 0x06, 0x5a, 0x0e, 0x19, 0x0e, 0x81, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0xdc, 0x0e,
+  0x2d, 0x0b, 0x00, 0x10, 0x61, 0x10, 0x82, 0x10, 0x84, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x62,
+  0x10, 0x06, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x03, 0x63, 0x10, 0x72, 0x48, 0x93, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00,
+  0x92, 0x50, 0x87, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x8d, 0x72, 0x50, 0x00,
+  0x92, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x74, 0x50, 0x65, 0x18,
+  0x60, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x05,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x60, 0x00, 0x6c, 0x30, 0x74, 0x58, 0x86, 0x72, 0x50, 0x03,
+  0x74, 0x58, 0x6d, 0x38, 0x60, 0x08, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x00, 0x71, 0x48, 0x82, 0x73,
+  0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x70, 0x40, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xa5, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x03, 0x70, 0x40, 0x74, 0x50, 0x73, 0x50,
+  0x72, 0x50, 0x82, 0x73, 0x50, 0x01, 0x72, 0x48, 0x62, 0x10, 0x8d, 0x61, 0x08, 0x01, 0x61, 0x10,
+  0x61, 0x08, 0x82, 0x62, 0x10, 0x03, 0x00, 0x10, 0x65, 0x11, 0x97, 0x0d, 0xbc, 0x0e, 0x95, 0x39,
+  0x0e, 0x09, 0x19, 0x0e, 0x9b, 0x0e, 0xf9, 0x0d, 0xc7, 0x11, 0x00, 0x10, 0x61, 0x10, 0x62, 0x08,
+  0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x82, 0x61, 0x10, 0x07, 0x62, 0x10, 0x60, 0x08, 0x69, 0x28,
+  0x75, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x73, 0x50,
+  0x93, 0x50, 0x72, 0x50, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x62,
+  0x10, 0x81, 0x61, 0x10, 0x81, 0x62, 0x10, 0x04, 0x60, 0x08, 0x67, 0x20, 0x72, 0x50, 0x8a, 0x28,
+  0x63, 0x10, 0x81, 0x60, 0x08, 0x00, 0x61, 0x10, 0x82, 0x62, 0x10, 0x00, 0x81, 0x10, 0x84, 0x62,
+  0x10, 0x00, 0x61, 0x10, 0x83, 0x62, 0x10, 0x02, 0x82, 0x10, 0x00, 0x10, 0xa6, 0x11, 0x81, 0x5a,
+  0x0e, 0x00, 0x19, 0x0e, 0x82, 0x39, 0x0e, 0x05, 0x9b, 0x0e, 0x8a, 0x12, 0x00, 0x10, 0x62, 0x08,
+  0x62, 0x10, 0x82, 0x10, 0x85, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10,
+  0x84, 0x62, 0x10, 0x01, 0x61, 0x08, 0x64, 0x10, 0x82, 0x73, 0x50, 0x86, 0x72, 0x50, 0x01, 0x92,
+  0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00,
+  0x92, 0x50, 0x8b, 0x72, 0x50, 0x03, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x70, 0x48, 0x83, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x02, 0x60, 0x00, 0x68, 0x20, 0x74, 0x58, 0x87, 0x72, 0x50, 0x01, 0x73, 0x50, 0x71, 0x48,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9c, 0x61, 0x08, 0x01, 0x63, 0x10, 0x72, 0x50, 0x82, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x03, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0x61, 0x10, 0xae, 0x61, 0x08,
+  0x03, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x50, 0x93, 0x50, 0x84, 0x73, 0x50, 0x00, 0x64, 0x10, 0x8b,
+  0x61, 0x08, 0x83, 0x61, 0x10, 0x06, 0x62, 0x10, 0x41, 0x10, 0x00, 0x10, 0x8a, 0x12, 0x5a, 0x0e,
+  0x7b, 0x0e, 0x19, 0x0e, 0x94, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0xbc, 0x0e, 0x35, 0x0d, 0xe4, 0x10,
+  0x00, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x01, 0x61, 0x08, 0x63, 0x10, 0x82, 0x73, 0x50, 0x82, 0x72, 0x50, 0x06, 0x73, 0x50, 0x72,
+  0x50, 0x73, 0x50, 0x92, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0x81, 0x61, 0x08, 0x83, 0x61,
+  0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x0a, 0x61, 0x08, 0x64, 0x10, 0x74, 0x58, 0x75, 0x58,
+  0x73, 0x50, 0x6c, 0x38, 0x65, 0x18, 0x80, 0x08, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61,
+  0x10, 0x04, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x81,
+  0x82, 0x10, 0x01, 0x00, 0x10, 0xc7, 0x11, 0x81, 0x5a, 0x0e, 0x82, 0x39, 0x0e, 0x04, 0x3a, 0x0e,
+  0x7b, 0x0e, 0x49, 0x12, 0x00, 0x10, 0x82, 0x08, 0x85, 0x62, 0x10, 0x05, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x01, 0x61, 0x08, 0x64, 0x18,
+  0x82, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x8d, 0x72, 0x50, 0x00, 0x92, 0x50, 0x8a,
+  0x72, 0x50, 0x04, 0x95, 0x58, 0x6a, 0x28, 0x60, 0x08, 0x62, 0x10, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x00, 0x66, 0x18, 0x74, 0x50, 0x93,
+  0x50, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x63, 0x10,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x02, 0x61, 0x10, 0x60, 0x08, 0x64, 0x18, 0x84,
+  0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x58, 0x6c, 0x38, 0x60, 0x08, 0xae, 0x61, 0x08, 0x03, 0x61,
+  0x10, 0x60, 0x08, 0x6b, 0x30, 0x74, 0x58, 0x83, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x66,
+  0x20, 0x60, 0x08, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x81, 0x62, 0x10, 0x06,
+  0x82, 0x10, 0x20, 0x10, 0x41, 0x10, 0xf0, 0x0b, 0xbc, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x94, 0x39,
+  0x0e, 0x04, 0x3a, 0x0e, 0xbc, 0x0e, 0x11, 0x0c, 0x41, 0x10, 0x20, 0x10, 0x81, 0x62, 0x10, 0x03,
+  0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62, 0x10, 0x03, 0x80,
+  0x08, 0x6a, 0x28, 0x75, 0x58, 0x72, 0x50, 0x81, 0x92, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x08, 0x92, 0x50, 0x74, 0x58, 0x6c, 0x38, 0x80, 0x08, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x10, 0x0d, 0x61, 0x08, 0x61, 0x10, 0x60, 0x08,
+  0x89, 0x28, 0x95, 0x58, 0x93, 0x50, 0x74, 0x58, 0x74, 0x50, 0x6f, 0x40, 0x67, 0x20, 0x82, 0x08,
+  0x60, 0x00, 0x80, 0x08, 0x61, 0x10, 0x83, 0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x62, 0x10, 0x00,
+  0x61, 0x10, 0x82, 0x62, 0x10, 0x01, 0x00, 0x10, 0xc7, 0x11, 0x81, 0x5a, 0x0e, 0x82, 0x39, 0x0e,
+  0x03, 0x5a, 0x0e, 0x7b, 0x06, 0x08, 0x12, 0x00, 0x10, 0x82, 0x82, 0x10, 0x83, 0x62, 0x10, 0x81,
+  0x61, 0x10, 0x01, 0x62, 0x10, 0x62, 0x08, 0x84, 0x62, 0x10, 0x01, 0x61, 0x08, 0x64, 0x18, 0x82,
+  0x73, 0x50, 0x00, 0x93, 0x50, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50, 0x88, 0x72, 0x50, 0x00, 0x92,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x00, 0x93, 0x50, 0x81, 0x73, 0x50, 0x01, 0x63, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50,
+  0x73, 0x50, 0x83, 0x72, 0x50, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x74, 0x50, 0x65, 0x18,
+  0x60, 0x08, 0x9d, 0x61, 0x08, 0x02, 0x60, 0x08, 0x67, 0x20, 0x74, 0x58, 0x81, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x08, 0xaf, 0x61, 0x08, 0x02,
+  0x60, 0x08, 0x68, 0x28, 0x74, 0x58, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x75, 0x58, 0x69,
+  0x28, 0x60, 0x08, 0x8c, 0x61, 0x08, 0x04, 0x62, 0x10, 0x00, 0x10, 0x04, 0x11, 0x15, 0x0d, 0xbc,
+  0x0e, 0x95, 0x39, 0x0e, 0x05, 0x19, 0x0e, 0x5a, 0x0e, 0x9b, 0x0e, 0xec, 0x12, 0x00, 0x10, 0x41,
+  0x10, 0x82, 0x62, 0x10, 0x02, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x62,
+  0x10, 0x05, 0x61, 0x10, 0x61, 0x08, 0x70, 0x40, 0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x81, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x84, 0x72, 0x50, 0x05, 0x92, 0x50, 0x74, 0x58, 0x6d, 0x38, 0x61, 0x08,
+  0x60, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08, 0x82, 0x61, 0x10, 0x0d, 0x61, 0x08, 0x80, 0x08, 0x6c,
+  0x30, 0x95, 0x58, 0x72, 0x50, 0x93, 0x50, 0x74, 0x58, 0x95, 0x58, 0x71, 0x48, 0x6b, 0x30, 0x85,
+  0x18, 0x80, 0x08, 0x60, 0x08, 0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81,
+  0x62, 0x10, 0x00, 0x61, 0x10, 0x82, 0x62, 0x10, 0x04, 0x82, 0x10, 0x00, 0x10, 0xc7, 0x11, 0x3a,
+  0x0e, 0x5a, 0x0e, 0x81, 0x39, 0x0e, 0x00, 0x19, 0x0e, 0x81, 0x5a, 0x0e, 0x02, 0xc7, 0x11, 0x00,
+  0x10, 0x82, 0x10, 0x85, 0x62, 0x10, 0x02, 0x62, 0x08, 0x62, 0x10, 0x61, 0x08, 0x84, 0x62, 0x10,
+  0x02, 0x61, 0x08, 0x64, 0x10, 0x73, 0x50, 0x81, 0x93, 0x50, 0x00, 0x73, 0x50, 0x89, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x87, 0x72, 0x50, 0x00, 0x73, 0x50, 0x89, 0x72, 0x50, 0x04, 0x92, 0x50, 0x74,
+  0x58, 0x6b, 0x30, 0x60, 0x08, 0x62, 0x10, 0x82, 0x61, 0x10, 0x82, 0x61, 0x08, 0x05, 0x61, 0x10,
+  0x61, 0x08, 0x60, 0x00, 0x69, 0x28, 0x74, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x92, 0x50,
+  0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x03, 0x92, 0x50, 0x74, 0x50, 0x66,
+  0x18, 0x60, 0x08, 0x9c, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6a, 0x28, 0x75, 0x58, 0x84,
+  0x72, 0x50, 0x02, 0x74, 0x50, 0x68, 0x20, 0x60, 0x08, 0xac, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x02, 0x60, 0x08, 0x66, 0x18, 0x74, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02,
+  0x74, 0x58, 0x6c, 0x30, 0x60, 0x08, 0x8a, 0x61, 0x08, 0x06, 0x62, 0x10, 0x61, 0x10, 0x00, 0x10,
+  0x29, 0x0a, 0x19, 0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0x95, 0x39, 0x0e, 0x04, 0x9b, 0x0e, 0x39, 0x0e,
+  0xe8, 0x09, 0x00, 0x10, 0x61, 0x10, 0x83, 0x62, 0x10, 0x0a, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08,
+  0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x64, 0x10, 0x73, 0x50, 0x93, 0x50,
+  0x82, 0x72, 0x50, 0x82, 0x93, 0x50, 0x01, 0x72, 0x50, 0x92, 0x50, 0x81, 0x72, 0x50, 0x05, 0x93,
+  0x50, 0x72, 0x50, 0x75, 0x58, 0x70, 0x40, 0x63, 0x10, 0x60, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61,
+  0x08, 0x83, 0x61, 0x10, 0x04, 0x61, 0x08, 0x80, 0x08, 0x6c, 0x30, 0x75, 0x58, 0x73, 0x50, 0x81,
+  0x92, 0x50, 0x05, 0x93, 0x50, 0x75, 0x58, 0x74, 0x50, 0x6f, 0x40, 0x69, 0x28, 0x83, 0x10, 0x81,
+  0x80, 0x08, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x83, 0x62, 0x10,
+  0x07, 0x82, 0x10, 0x00, 0x10, 0xa7, 0x11, 0x3a, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x39,
+  0x0e, 0x81, 0x5a, 0x0e, 0x03, 0xe8, 0x11, 0x00, 0x10, 0x62, 0x10, 0x62, 0x08, 0x86, 0x62, 0x10,
+  0x00, 0x61, 0x08, 0x83, 0x62, 0x10, 0x04, 0x61, 0x08, 0x62, 0x10, 0x72, 0x50, 0x73, 0x50, 0x93,
+  0x50, 0x81, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x86, 0x72, 0x50, 0x00, 0x93, 0x50, 0x87, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x81, 0x93, 0x50, 0x02, 0x73, 0x50, 0x83, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x82, 0x61, 0x10, 0x04, 0x60, 0x08, 0x82, 0x08, 0x6d, 0x38, 0x74, 0x58, 0x73, 0x50, 0x84, 0x72,
+  0x50, 0x83, 0x73, 0x50, 0x82, 0x72, 0x50, 0x03, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x61, 0x10,
+  0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6d, 0x38,
+  0x74, 0x58, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x50, 0x66, 0x18,
+  0x60, 0x08, 0xb0, 0x61, 0x08, 0x00, 0x63, 0x10, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0x8a, 0x61, 0x08, 0x07, 0x41, 0x10,
+  0x20, 0x10, 0x6e, 0x0b, 0x9b, 0x0e, 0x5a, 0x0e, 0x19, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x93, 0x39,
+  0x0e, 0x03, 0xbc, 0x06, 0x56, 0x0d, 0x04, 0x11, 0x00, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10,
+  0x81, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x62, 0x10, 0x60, 0x08, 0x66, 0x18, 0x74, 0x50, 0x72, 0x50, 0x93, 0x50, 0x81, 0x72, 0x50, 0x02,
+  0x93, 0x50, 0x90, 0x48, 0x71, 0x48, 0x81, 0x93, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72,
+  0x50, 0x02, 0x74, 0x50, 0x73, 0x50, 0x68, 0x20, 0x81, 0x60, 0x08, 0x84, 0x61, 0x10, 0x0f, 0x62,
+  0x10, 0x61, 0x08, 0x60, 0x08, 0x69, 0x28, 0x74, 0x58, 0x94, 0x50, 0x72, 0x50, 0x93, 0x50, 0x92,
+  0x50, 0x72, 0x50, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6e, 0x38, 0x68, 0x20, 0x83, 0x10, 0x81,
+  0x80, 0x08, 0x04, 0x61, 0x08, 0x61, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x10, 0x81, 0x62, 0x10,
+  0x04, 0x82, 0x08, 0x00, 0x10, 0x86, 0x11, 0x19, 0x0e, 0x7b, 0x0e, 0x81, 0x39, 0x0e, 0x06, 0x19,
+  0x0e, 0x5a, 0x0e, 0x7b, 0x0e, 0x29, 0x12, 0x00, 0x10, 0x62, 0x08, 0x82, 0x10, 0x83, 0x62, 0x10,
+  0x00, 0x61, 0x10, 0x86, 0x62, 0x10, 0x04, 0x61, 0x08, 0x70, 0x40, 0x94, 0x50, 0x73, 0x50, 0x93,
+  0x50, 0x86, 0x72, 0x50, 0x02, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x87, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x85, 0x72, 0x50, 0x07, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x92, 0x50, 0x75, 0x58, 0x69,
+  0x28, 0x80, 0x08, 0x62, 0x10, 0x82, 0x61, 0x08, 0x06, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x60,
+  0x08, 0x66, 0x18, 0x71, 0x48, 0x74, 0x58, 0x83, 0x72, 0x50, 0x04, 0x93, 0x50, 0x92, 0x50, 0x73,
+  0x50, 0x72, 0x48, 0x70, 0x48, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x05, 0x74, 0x50, 0x65, 0x18,
+  0x60, 0x08, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6f, 0x40,
+  0x74, 0x50, 0x84, 0x72, 0x50, 0x01, 0x73, 0x50, 0x64, 0x10, 0xad, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x83, 0x61, 0x08, 0x03, 0x71, 0x48, 0x93, 0x50, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00,
+  0x71, 0x48, 0x89, 0x61, 0x08, 0x07, 0x62, 0x08, 0x41, 0x10, 0xc3, 0x10, 0xb4, 0x0c, 0xbc, 0x0e,
+  0x3a, 0x0e, 0x39, 0x0e, 0x3a, 0x0e, 0x93, 0x39, 0x0e, 0x05, 0x3a, 0x0e, 0xdc, 0x06, 0x52, 0x0c,
+  0x61, 0x10, 0x20, 0x10, 0x82, 0x10, 0x81, 0x62, 0x10, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x82,
+  0x61, 0x08, 0x00, 0x62, 0x08, 0x82, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x66, 0x20, 0x74,
+  0x50, 0x81, 0x92, 0x50, 0x0a, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x6f, 0x40, 0x65, 0x18, 0x73,
+  0x50, 0x93, 0x50, 0x92, 0x50, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x06, 0x73,
+  0x50, 0x75, 0x58, 0x6e, 0x38, 0x64, 0x10, 0x80, 0x00, 0x61, 0x08, 0x62, 0x10, 0x82, 0x61, 0x10,
+  0x08, 0x62, 0x10, 0x61, 0x10, 0x80, 0x08, 0x65, 0x18, 0x71, 0x48, 0x75, 0x58, 0x73, 0x50, 0x92,
+  0x50, 0x93, 0x50, 0x81, 0x92, 0x50, 0x0c, 0x73, 0x50, 0x74, 0x58, 0x94, 0x58, 0x73, 0x50, 0x6f,
+  0x40, 0x89, 0x28, 0x64, 0x18, 0x81, 0x08, 0x60, 0x08, 0x80, 0x08, 0x81, 0x08, 0x61, 0x10, 0x62,
+  0x10, 0x81, 0x82, 0x10, 0x03, 0x00, 0x10, 0x46, 0x11, 0xf9, 0x0d, 0x7b, 0x0e, 0x82, 0x39, 0x0e,
+  0x03, 0x3a, 0x0e, 0x9b, 0x0e, 0x6a, 0x12, 0x00, 0x10, 0x81, 0x82, 0x10, 0x87, 0x62, 0x10, 0x00,
+  0x61, 0x10, 0x81, 0x62, 0x10, 0x03, 0x60, 0x08, 0x6c, 0x30, 0x74, 0x58, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x02, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01, 0x73,
+  0x50, 0x93, 0x50, 0x82, 0x72, 0x50, 0x00, 0x93, 0x50, 0x82, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x06, 0x73, 0x50, 0x93,
+  0x50, 0x72, 0x50, 0x74, 0x58, 0x6e, 0x40, 0x60, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x08, 0x62,
+  0x10, 0x61, 0x08, 0x60, 0x08, 0x63, 0x10, 0x6d, 0x38, 0x74, 0x58, 0x73, 0x50, 0x92, 0x50, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x73, 0x50, 0x01, 0x66, 0x18, 0x70, 0x48, 0x81,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x63, 0x10, 0x61, 0x08, 0x61, 0x10, 0x9c,
+  0x61, 0x08, 0x02, 0x62, 0x10, 0x72, 0x48, 0x73, 0x50, 0x83, 0x72, 0x50, 0x04, 0x73, 0x50, 0x71,
+  0x48, 0x62, 0x08, 0x61, 0x08, 0x61, 0x10, 0xaf, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x40, 0x74,
+  0x50, 0x82, 0x73, 0x50, 0x03, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x64, 0x10, 0x89, 0x61, 0x08,
+  0x03, 0x61, 0x10, 0x36, 0x0d, 0xbc, 0x06, 0x19, 0x0e, 0x83, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x8f,
+  0x39, 0x0e, 0x06, 0x19, 0x0e, 0x5a, 0x0e, 0x9b, 0x0e, 0x6e, 0x0b, 0x00, 0x10, 0x41, 0x10, 0x82,
+  0x10, 0x82, 0x62, 0x10, 0x86, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x03, 0x61, 0x10,
+  0x60, 0x08, 0x65, 0x18, 0x73, 0x50, 0x82, 0x72, 0x50, 0x06, 0x73, 0x50, 0x93, 0x50, 0x73, 0x50,
+  0x81, 0x08, 0x65, 0x18, 0x73, 0x50, 0x94, 0x50, 0x85, 0x72, 0x50, 0x08, 0x93, 0x50, 0x74, 0x58,
+  0x73, 0x50, 0x6c, 0x30, 0x83, 0x10, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x07, 0x62, 0x10, 0x60, 0x08, 0x81, 0x08, 0x6b, 0x30, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50,
+  0x92, 0x50, 0x82, 0x72, 0x50, 0x09, 0x92, 0x50, 0x93, 0x50, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50,
+  0x70, 0x48, 0x6c, 0x38, 0x67, 0x20, 0x63, 0x10, 0x61, 0x08, 0x81, 0x80, 0x08, 0x06, 0x81, 0x08,
+  0x82, 0x10, 0x00, 0x10, 0x25, 0x11, 0xd8, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x81, 0x39, 0x0e, 0x05,
+  0x5a, 0x0e, 0xbb, 0x0e, 0xcc, 0x0a, 0x00, 0x10, 0x62, 0x10, 0x82, 0x10, 0x81, 0x62, 0x10, 0x81,
+  0x61, 0x10, 0x85, 0x62, 0x10, 0x04, 0x60, 0x08, 0x66, 0x18, 0x74, 0x58, 0x92, 0x50, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x92, 0x50, 0x87,
+  0x72, 0x50, 0x83, 0x73, 0x50, 0x05, 0x92, 0x50, 0x93, 0x50, 0x75, 0x58, 0x71, 0x48, 0x62, 0x08,
+  0x61, 0x08, 0x82, 0x61, 0x10, 0x05, 0x61, 0x08, 0x80, 0x00, 0x63, 0x10, 0x6b, 0x30, 0x73, 0x50,
+  0x94, 0x58, 0x81, 0x72, 0x50, 0x01, 0x92, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x92, 0x50,
+  0x74, 0x58, 0x73, 0x50, 0x64, 0x10, 0x64, 0x18, 0x74, 0x58, 0x83, 0x72, 0x50, 0x01, 0x73, 0x50,
+  0x71, 0x48, 0x9e, 0x61, 0x08, 0x01, 0x60, 0x08, 0x64, 0x18, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50,
+  0x02, 0x73, 0x50, 0x6f, 0x40, 0x60, 0x08, 0xae, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x0a, 0x60, 0x08, 0x6b, 0x30, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x93,
+  0x50, 0x94, 0x58, 0x67, 0x20, 0x60, 0x08, 0x88, 0x61, 0x08, 0x03, 0x41, 0x10, 0x56, 0x0d, 0x9b,
+  0x0e, 0x19, 0x0e, 0x85, 0x39, 0x0e, 0x00, 0x7b, 0x0e, 0x8c, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0x7b,
+  0x0e, 0x5a, 0x0e, 0x49, 0x12, 0x00, 0x10, 0x82, 0x62, 0x10, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x81, 0x62, 0x08, 0x82, 0x61, 0x08, 0x84, 0x61, 0x10, 0x01, 0x61, 0x08, 0x63, 0x10, 0x81, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x07, 0x73, 0x50, 0x92, 0x50, 0x74, 0x58, 0x68, 0x20, 0x60, 0x00, 0x64,
+  0x10, 0x72, 0x48, 0x74, 0x58, 0x84, 0x72, 0x50, 0x08, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x94,
+  0x58, 0x73, 0x50, 0x6c, 0x30, 0x63, 0x10, 0x80, 0x08, 0x60, 0x08, 0x82, 0x61, 0x10, 0x0c, 0x62,
+  0x10, 0x61, 0x08, 0x80, 0x08, 0x64, 0x10, 0x6d, 0x38, 0x74, 0x50, 0x74, 0x58, 0x93, 0x50, 0x92,
+  0x50, 0x72, 0x50, 0x93, 0x50, 0x92, 0x50, 0x93, 0x50, 0x81, 0x72, 0x50, 0x16, 0x73, 0x50, 0x74,
+  0x58, 0x94, 0x58, 0x73, 0x50, 0x90, 0x40, 0x6c, 0x30, 0x67, 0x20, 0x83, 0x10, 0x61, 0x08, 0x80,
+  0x08, 0x00, 0x08, 0x03, 0x11, 0xb6, 0x0d, 0x9b, 0x0e, 0x19, 0x0e, 0x3a, 0x0e, 0x39, 0x0e, 0x3a,
+  0x0e, 0xbc, 0x0e, 0x6e, 0x0b, 0x00, 0x10, 0x61, 0x10, 0x82, 0x10, 0x88, 0x62, 0x10, 0x81, 0x61,
+  0x08, 0x01, 0x70, 0x40, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x03,
+  0x73, 0x50, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x0f, 0x92, 0x50, 0x72, 0x50,
+  0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x72, 0x50, 0x92, 0x50, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58,
+  0x73, 0x50, 0x6d, 0x38, 0x62, 0x10, 0x60, 0x08, 0x62, 0x10, 0x61, 0x10, 0x81, 0x60, 0x08, 0x05,
+  0x63, 0x10, 0x6b, 0x30, 0x72, 0x50, 0x74, 0x58, 0x93, 0x50, 0x92, 0x50, 0x84, 0x72, 0x50, 0x08,
+  0x73, 0x50, 0x75, 0x58, 0x70, 0x48, 0x83, 0x10, 0x60, 0x00, 0x6d, 0x38, 0x74, 0x50, 0x72, 0x50,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6d, 0x38, 0x60, 0x00, 0x81, 0x61, 0x08, 0x02,
+  0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x98, 0x61, 0x08, 0x04, 0x60, 0x08, 0x67, 0x20, 0x94, 0x58,
+  0x93, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x74, 0x50, 0x6c, 0x30, 0x60, 0x08, 0xb1, 0x61,
+  0x08, 0x02, 0x80, 0x08, 0x68, 0x20, 0x74, 0x58, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x93, 0x50,
+  0x94, 0x58, 0x6b, 0x28, 0x60, 0x08, 0x87, 0x61, 0x08, 0x05, 0x61, 0x10, 0x20, 0x10, 0xa6, 0x11,
+  0x19, 0x0e, 0xbc, 0x06, 0x5a, 0x0e, 0x82, 0x39, 0x0e, 0x04, 0x7b, 0x0e, 0x9b, 0x06, 0x11, 0x0c,
+  0x35, 0x0d, 0x5a, 0x0e, 0x89, 0x39, 0x0e, 0x04, 0x19, 0x0e, 0x9b, 0x0e, 0x97, 0x0d, 0x45, 0x11,
+  0x00, 0x10, 0x84, 0x62, 0x10, 0x05, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x01, 0x70, 0x48, 0x73, 0x50, 0x82, 0x72, 0x50, 0x09, 0x92, 0x50, 0x94, 0x58,
+  0x6f, 0x40, 0x80, 0x08, 0x60, 0x08, 0x62, 0x10, 0x6f, 0x40, 0x75, 0x58, 0x73, 0x50, 0x92, 0x50,
+  0x85, 0x72, 0x50, 0x07, 0x73, 0x50, 0x75, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x85, 0x18, 0x80, 0x08,
+  0x60, 0x08, 0x61, 0x08, 0x81, 0x61, 0x10, 0x07, 0x62, 0x10, 0x61, 0x08, 0x80, 0x08, 0x65, 0x18,
+  0x6d, 0x38, 0x73, 0x50, 0x95, 0x58, 0x93, 0x50, 0x81, 0x92, 0x50, 0x82, 0x93, 0x50, 0x81, 0x72,
+  0x50, 0x02, 0x92, 0x50, 0x93, 0x50, 0x93, 0x58, 0x81, 0x74, 0x58, 0x07, 0x73, 0x50, 0x70, 0x48,
+  0x6d, 0x38, 0x89, 0x28, 0x04, 0x20, 0xa4, 0x18, 0x35, 0x0d, 0xda, 0x06, 0x81, 0x9a, 0x06, 0x81,
+  0x5a, 0x06, 0x03, 0xdc, 0x06, 0x11, 0x0c, 0x20, 0x08, 0x41, 0x10, 0x83, 0x62, 0x10, 0x00, 0x82,
+  0x10, 0x82, 0x62, 0x10, 0x08, 0x61, 0x10, 0x62, 0x10, 0x80, 0x08, 0x66, 0x20, 0x75, 0x58, 0x92,
+  0x50, 0x93, 0x50, 0x92, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x93, 0x50,
+  0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x93, 0x50, 0x82, 0x92, 0x50, 0x08, 0x72, 0x50, 0x93,
+  0x50, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6f, 0x40, 0x69, 0x28, 0x63, 0x10, 0x60, 0x08, 0x81,
+  0x61, 0x08, 0x81, 0x60, 0x08, 0x06, 0x65, 0x18, 0x6c, 0x30, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50,
+  0x72, 0x50, 0x92, 0x50, 0x81, 0x73, 0x50, 0x0a, 0x93, 0x50, 0x72, 0x50, 0x92, 0x50, 0x74, 0x50,
+  0x74, 0x58, 0x6c, 0x30, 0x61, 0x08, 0x80, 0x00, 0x84, 0x18, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72,
+  0x50, 0x03, 0x92, 0x50, 0x74, 0x58, 0x67, 0x20, 0x60, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x99, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x00, 0x6b, 0x30, 0x74, 0x58, 0x83, 0x72, 0x50, 0x03,
+  0x92, 0x50, 0x74, 0x50, 0x69, 0x28, 0x60, 0x08, 0xb1, 0x61, 0x08, 0x03, 0x60, 0x08, 0x65, 0x18,
+  0x74, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03, 0x72, 0x50, 0x94, 0x50, 0x6e, 0x40, 0x60, 0x08,
+  0x87, 0x61, 0x08, 0x0c, 0x61, 0x10, 0x62, 0x10, 0x00, 0x10, 0xe4, 0x10, 0xf1, 0x0b, 0xd8, 0x0d,
+  0x7b, 0x0e, 0x9b, 0x0e, 0x5a, 0x06, 0x15, 0x0d, 0xe8, 0x11, 0xa7, 0x11, 0x7b, 0x0e, 0x8a, 0x39,
+  0x0e, 0x03, 0xbc, 0x06, 0x93, 0x0c, 0x82, 0x10, 0x00, 0x10, 0x84, 0x62, 0x10, 0x07, 0x61, 0x10,
+  0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x82, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x03, 0x62, 0x10, 0x60, 0x08, 0x6b, 0x30, 0x75, 0x58, 0x82, 0x72, 0x50,
+  0x81, 0x92, 0x50, 0x08, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x61, 0x08, 0x60, 0x08, 0x8a, 0x28,
+  0x74, 0x50, 0x74, 0x58, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x73, 0x50, 0x92,
+  0x50, 0x93, 0x50, 0x94, 0x58, 0x74, 0x50, 0x6f, 0x40, 0x69, 0x28, 0x63, 0x10, 0x81, 0x60, 0x08,
+  0x07, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x60, 0x08, 0x80, 0x08, 0x63, 0x10, 0x6b, 0x30, 0x92,
+  0x48, 0x81, 0x94, 0x58, 0x01, 0x93, 0x50, 0x92, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x81, 0x92, 0x50, 0x11, 0x73, 0x50, 0x93, 0x50, 0x94, 0x58, 0x75, 0x58, 0x94, 0x50,
+  0x31, 0x50, 0x90, 0x48, 0xd5, 0x3a, 0xb6, 0x33, 0x57, 0x24, 0x58, 0x1d, 0xd9, 0x15, 0x39, 0x0e,
+  0x1d, 0x07, 0x34, 0x05, 0x03, 0x09, 0x40, 0x08, 0x80, 0x08, 0x81, 0x60, 0x08, 0x81, 0x81, 0x08,
+  0x81, 0x61, 0x10, 0x00, 0x81, 0x10, 0x81, 0x62, 0x10, 0x04, 0x80, 0x08, 0x6c, 0x30, 0x75, 0x58,
+  0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x93, 0x50, 0x8c, 0x72, 0x50, 0x06, 0x73, 0x50,
+  0x74, 0x58, 0x94, 0x58, 0x73, 0x50, 0x6f, 0x40, 0x69, 0x28, 0x64, 0x10, 0x81, 0x80, 0x08, 0x00,
+  0x61, 0x08, 0x81, 0x60, 0x08, 0x05, 0x62, 0x10, 0x68, 0x20, 0x6f, 0x40, 0x74, 0x50, 0x74, 0x58,
+  0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x0a, 0x72, 0x50, 0x92, 0x50, 0x93, 0x50, 0x75,
+  0x58, 0x71, 0x48, 0x66, 0x18, 0x80, 0x00, 0x61, 0x08, 0x60, 0x00, 0x6e, 0x38, 0x74, 0x58, 0x83,
+  0x72, 0x50, 0x01, 0x93, 0x50, 0x71, 0x48, 0x9d, 0x61, 0x08, 0x0c, 0x61, 0x10, 0x61, 0x08, 0x60,
+  0x08, 0x6f, 0x40, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74,
+  0x50, 0x65, 0x18, 0x60, 0x08, 0xb2, 0x61, 0x08, 0x01, 0x62, 0x08, 0x72, 0x48, 0x81, 0x73, 0x50,
+  0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x72, 0x48, 0x62, 0x08, 0x88, 0x61, 0x08,
+  0x0b, 0x62, 0x10, 0x82, 0x10, 0x41, 0x10, 0x00, 0x10, 0xc3, 0x10, 0xa7, 0x11, 0x08, 0x12, 0x66,
+  0x11, 0x21, 0x10, 0x00, 0x10, 0x93, 0x0c, 0xbb, 0x0e, 0x82, 0x39, 0x0e, 0x81, 0x3a, 0x0e, 0x83,
+  0x39, 0x0e, 0x06, 0x5a, 0x0e, 0x9b, 0x0e, 0x6e, 0x0b, 0x00, 0x10, 0x41, 0x10, 0x82, 0x10, 0x62,
+  0x10, 0x82, 0x61, 0x10, 0x00, 0x62, 0x10, 0x82, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x63,
+  0x10, 0x81, 0x73, 0x50, 0x81, 0x93, 0x50, 0x81, 0x92, 0x50, 0x0a, 0x94, 0x58, 0x6f, 0x40, 0x60,
+  0x00, 0x61, 0x10, 0x61, 0x08, 0x80, 0x08, 0x64, 0x18, 0x6f, 0x40, 0x75, 0x58, 0x73, 0x50, 0x92,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x92, 0x50, 0x00, 0x73, 0x50, 0x81, 0x92, 0x50,
+  0x05, 0x74, 0x58, 0x75, 0x58, 0x72, 0x50, 0x8d, 0x38, 0x67, 0x20, 0x62, 0x08, 0x81, 0x60, 0x08,
+  0x0b, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x82, 0x08, 0x88, 0x20, 0x6f, 0x38, 0x73,
+  0x50, 0x75, 0x58, 0x94, 0x58, 0x93, 0x50, 0x92, 0x50, 0x83, 0x72, 0x50, 0x02, 0x93, 0x50, 0x73,
+  0x50, 0x93, 0x50, 0x83, 0x92, 0x50, 0x00, 0x73, 0x50, 0x82, 0x12, 0x58, 0x10, 0x52, 0x58, 0xb3,
+  0x50, 0x53, 0x49, 0xd4, 0x41, 0x57, 0x3b, 0x13, 0x32, 0x4a, 0x30, 0x68, 0x28, 0x67, 0x20, 0x86,
+  0x18, 0x64, 0x18, 0x63, 0x10, 0x62, 0x10, 0x82, 0x08, 0x61, 0x08, 0x60, 0x08, 0x80, 0x08, 0x81,
+  0x80, 0x00, 0x01, 0x6d, 0x38, 0x74, 0x50, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58,
+  0x74, 0x50, 0x71, 0x48, 0x6d, 0x38, 0x68, 0x20, 0x63, 0x10, 0x81, 0x60, 0x08, 0x00, 0x61, 0x08,
+  0x81, 0x80, 0x08, 0x05, 0x61, 0x08, 0x66, 0x18, 0x6c, 0x38, 0x72, 0x48, 0x74, 0x58, 0x74, 0x50,
+  0x85, 0x72, 0x50, 0x00, 0x93, 0x50, 0x81, 0x92, 0x50, 0x08, 0x94, 0x58, 0x74, 0x50, 0x6b, 0x30,
+  0x81, 0x08, 0x80, 0x08, 0x62, 0x10, 0x80, 0x08, 0x67, 0x20, 0x74, 0x58, 0x83, 0x72, 0x50, 0x05,
+  0x92, 0x50, 0x75, 0x58, 0x69, 0x28, 0x60, 0x08, 0x62, 0x10, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x04,
+  0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x72, 0x48, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x73, 0x50,
+  0x72, 0x48, 0x62, 0x10, 0xb3, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x40, 0x74, 0x58, 0x81, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x86, 0x61, 0x08,
+  0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x62, 0x08, 0x41, 0x08, 0x82, 0x20, 0x10,
+  0x04, 0x61, 0x10, 0x41, 0x10, 0x36, 0x0d, 0x7b, 0x0e, 0x3a, 0x0e, 0x82, 0x39, 0x0e, 0x00, 0x3a,
+  0x0e, 0x81, 0x39, 0x0e, 0x07, 0x19, 0x0e, 0x9b, 0x0e, 0x19, 0x0e, 0x29, 0x12, 0x00, 0x10, 0x61,
+  0x10, 0x62, 0x10, 0x61, 0x08, 0x82, 0x62, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x85, 0x61, 0x10, 0x04, 0x62, 0x10, 0x60, 0x08, 0x6b,
+  0x30, 0x95, 0x58, 0x92, 0x50, 0x82, 0x72, 0x50, 0x0b, 0x92, 0x50, 0x94, 0x58, 0x67, 0x20, 0x60,
+  0x08, 0x62, 0x10, 0x61, 0x10, 0x60, 0x08, 0x80, 0x08, 0x68, 0x20, 0x72, 0x48, 0x75, 0x58, 0x93,
+  0x50, 0x85, 0x72, 0x50, 0x03, 0x73, 0x50, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x74, 0x58,
+  0x03, 0x72, 0x48, 0x6c, 0x30, 0x86, 0x20, 0x82, 0x08, 0x81, 0x80, 0x08, 0x09, 0x61, 0x08, 0x61,
+  0x10, 0x60, 0x08, 0x80, 0x08, 0x63, 0x10, 0x69, 0x28, 0x6f, 0x40, 0x73, 0x50, 0x75, 0x58, 0x94,
+  0x58, 0x81, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x81, 0x93, 0x50, 0x00, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x01, 0x72, 0x50, 0x92, 0x50, 0x83, 0x72, 0x50, 0x03, 0x52, 0x50, 0x32, 0x50, 0x12,
+  0x50, 0x33, 0x58, 0x82, 0x74, 0x58, 0x00, 0x74, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x48, 0x71,
+  0x48, 0x70, 0x40, 0x6f, 0x40, 0x6e, 0x40, 0x6e, 0x38, 0x81, 0x6d, 0x38, 0x01, 0x73, 0x50, 0x93,
+  0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x04, 0x73, 0x50, 0x70, 0x40, 0x6b, 0x30, 0x86, 0x18, 0x62,
+  0x08, 0x81, 0x60, 0x08, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08, 0x06, 0x81, 0x08, 0x85, 0x18, 0x6b,
+  0x30, 0x71, 0x48, 0x74, 0x58, 0x94, 0x58, 0x73, 0x50, 0x88, 0x72, 0x50, 0x0a, 0x94, 0x50, 0x74,
+  0x58, 0x6e, 0x38, 0x84, 0x10, 0x80, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x08, 0x72,
+  0x48, 0x73, 0x50, 0x83, 0x72, 0x50, 0x01, 0x73, 0x50, 0x71, 0x48, 0x83, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x9a, 0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18, 0x74, 0x50, 0x84, 0x72, 0x50, 0x02, 0x74,
+  0x50, 0x6f, 0x40, 0x60, 0x08, 0xb3, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6a, 0x30, 0x74, 0x58, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x08, 0x86, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x84, 0x61, 0x10, 0x02, 0x00,
+  0x10, 0x8f, 0x0b, 0xfd, 0x06, 0x83, 0x39, 0x0e, 0x00, 0x3a, 0x0e, 0x81, 0x39, 0x0e, 0x03, 0xdc,
+  0x0e, 0x15, 0x0d, 0x04, 0x11, 0x00, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10,
+  0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x08, 0x82, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x10, 0x83, 0x61, 0x10, 0x03, 0x61, 0x08, 0x82, 0x08, 0x72,
+  0x48, 0x74, 0x50, 0x83, 0x72, 0x50, 0x0c, 0x93, 0x50, 0x72, 0x50, 0x62, 0x10, 0x61, 0x08, 0x61,
+  0x10, 0x62, 0x10, 0x61, 0x10, 0x80, 0x08, 0x62, 0x08, 0x6a, 0x28, 0x72, 0x50, 0x75, 0x58, 0x73,
+  0x50, 0x87, 0x72, 0x50, 0x08, 0x92, 0x50, 0x72, 0x50, 0x93, 0x50, 0x94, 0x58, 0x74, 0x58, 0x72,
+  0x48, 0x6d, 0x38, 0x68, 0x20, 0x63, 0x10, 0x81, 0x80, 0x08, 0x81, 0x61, 0x08, 0x81, 0x60, 0x08,
+  0x09, 0x63, 0x10, 0x68, 0x20, 0x6d, 0x38, 0x71, 0x48, 0x74, 0x50, 0x75, 0x58, 0x74, 0x58, 0x93,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x83, 0x92, 0x50, 0x82, 0x72, 0x50, 0x81, 0x92, 0x50, 0x85, 0x72,
+  0x50, 0x01, 0x92, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x93, 0x50, 0x01, 0x94, 0x50, 0x74,
+  0x58, 0x81, 0x94, 0x58, 0x00, 0x74, 0x58, 0x81, 0x93, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50,
+  0x81, 0x92, 0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x08, 0x74, 0x50, 0x71, 0x48, 0x6d, 0x38,
+  0x68, 0x28, 0x64, 0x10, 0x61, 0x08, 0x60, 0x08, 0x80, 0x08, 0x61, 0x08, 0x81, 0x60, 0x08, 0x0c,
+  0x61, 0x08, 0x65, 0x18, 0x6a, 0x30, 0x70, 0x48, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50,
+  0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x04, 0x92, 0x50,
+  0x74, 0x50, 0x74, 0x58, 0x70, 0x40, 0x66, 0x18, 0x81, 0x60, 0x08, 0x81, 0x61, 0x10, 0x04, 0x61,
+  0x08, 0x60, 0x08, 0x6d, 0x38, 0x94, 0x58, 0x92, 0x50, 0x83, 0x72, 0x50, 0x02, 0x74, 0x58, 0x66,
+  0x20, 0x60, 0x08, 0x81, 0x61, 0x10, 0x9c, 0x61, 0x08, 0x05, 0x60, 0x08, 0x69, 0x28, 0x74, 0x58,
+  0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x00,
+  0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0xae, 0x61, 0x08, 0x02, 0x60, 0x08, 0x66, 0x18, 0x74, 0x50,
+  0x83, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x6e, 0x38, 0x60, 0x08, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x81, 0x62, 0x10, 0x0d, 0x61,
+  0x10, 0x41, 0x10, 0xaf, 0x0b, 0x7b, 0x0e, 0xbc, 0x0e, 0x7a, 0x0e, 0x5a, 0x0e, 0x7a, 0x0e, 0xdc,
+  0x0e, 0x5a, 0x0e, 0x6e, 0x13, 0x41, 0x10, 0x20, 0x10, 0x82, 0x10, 0x81, 0x62, 0x10, 0x01, 0x61,
+  0x10, 0x61, 0x08, 0x82, 0x61, 0x10, 0x82, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x60, 0x08, 0x01, 0x80, 0x08, 0x81, 0x08, 0x81, 0x61,
+  0x10, 0x03, 0x62, 0x10, 0x60, 0x08, 0x66, 0x18, 0x74, 0x58, 0x81, 0x93, 0x50, 0x82, 0x72, 0x50,
+  0x02, 0x74, 0x58, 0x6e, 0x38, 0x60, 0x00, 0x81, 0x61, 0x08, 0x09, 0x61, 0x10, 0x62, 0x10, 0x61,
+  0x08, 0x60, 0x08, 0x62, 0x10, 0x6b, 0x30, 0x72, 0x50, 0x75, 0x58, 0x73, 0x50, 0x92, 0x50, 0x82,
+  0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x0f, 0x73, 0x50, 0x6e, 0x40, 0x69, 0x28, 0x63, 0x10, 0x80,
+  0x08, 0x60, 0x08, 0x80, 0x08, 0x61, 0x08, 0x80, 0x08, 0x60, 0x08, 0x82, 0x08, 0x65, 0x18, 0x69,
+  0x28, 0x8e, 0x38, 0x91, 0x48, 0x73, 0x50, 0x81, 0x74, 0x58, 0x01, 0x94, 0x50, 0x93, 0x50, 0x81,
+  0x73, 0x50, 0x81, 0x92, 0x50, 0x05, 0x93, 0x50, 0x73, 0x50, 0x93, 0x50, 0x73, 0x50, 0x72, 0x50,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x01, 0x93, 0x50, 0x73, 0x50, 0x81, 0x74, 0x58, 0x05,
+  0x74, 0x50, 0x72, 0x48, 0x6e, 0x38, 0x6a, 0x28, 0x65, 0x18, 0x61, 0x08, 0x81, 0x60, 0x08, 0x01,
+  0x61, 0x08, 0x81, 0x08, 0x81, 0x60, 0x08, 0x06, 0x61, 0x08, 0x65, 0x18, 0x6b, 0x30, 0x70, 0x48,
+  0x73, 0x50, 0x74, 0x58, 0x74, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x81, 0x92, 0x50, 0x05, 0x93, 0x50, 0x75, 0x58, 0x70, 0x40, 0x67, 0x20, 0x61, 0x08,
+  0x60, 0x08, 0x83, 0x61, 0x10, 0x02, 0x60, 0x00, 0x69, 0x28, 0x75, 0x58, 0x81, 0x73, 0x50, 0x05,
+  0x92, 0x50, 0x72, 0x50, 0x92, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x60, 0x08, 0x82, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x9a, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x50, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x67, 0x20, 0x60, 0x08, 0xb4, 0x61, 0x08, 0x03, 0x63,
+  0x10, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x01, 0x72, 0x48, 0x62, 0x08, 0x83,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x0e, 0x62, 0x10, 0x82, 0x10, 0x61, 0x10, 0x00, 0x10,
+  0x66, 0x11, 0xd0, 0x0b, 0x35, 0x0d, 0x76, 0x0d, 0x56, 0x0d, 0xf0, 0x0b, 0x65, 0x11, 0x00, 0x10,
+  0x41, 0x10, 0x62, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x82,
+  0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x04, 0x66, 0x18, 0x6d, 0x38,
+  0x6a, 0x28, 0x64, 0x18, 0x81, 0x08, 0x81, 0x60, 0x08, 0x06, 0x61, 0x08, 0x80, 0x08, 0x8a, 0x28,
+  0x95, 0x58, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x81, 0x72, 0x50, 0x04, 0x75, 0x58, 0x6a, 0x28,
+  0x80, 0x00, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x05, 0x62, 0x10, 0x61, 0x08, 0x80, 0x08,
+  0x82, 0x08, 0x69, 0x28, 0x91, 0x48, 0x81, 0x74, 0x58, 0x02, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50,
+  0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x92, 0x50, 0x81, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x04, 0x73, 0x50, 0x6f, 0x40, 0x8a, 0x30, 0x85, 0x18,
+  0x62, 0x08, 0x81, 0x80, 0x08, 0x01, 0x81, 0x08, 0x60, 0x08, 0x81, 0x80, 0x08, 0x07, 0x82, 0x08,
+  0x84, 0x18, 0x67, 0x20, 0x6b, 0x30, 0x6e, 0x38, 0x71, 0x48, 0x73, 0x50, 0x74, 0x50, 0x82, 0x74,
+  0x58, 0x81, 0x93, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x89, 0x72, 0x50, 0x00, 0x92, 0x50, 0x82,
+  0x73, 0x50, 0x82, 0x74, 0x58, 0x09, 0x73, 0x50, 0x71, 0x48, 0x6e, 0x38, 0x6a, 0x28, 0x65, 0x18,
+  0x82, 0x08, 0x60, 0x08, 0x80, 0x08, 0x60, 0x08, 0x61, 0x08, 0x82, 0x60, 0x08, 0x05, 0x63, 0x10,
+  0x67, 0x20, 0x6c, 0x38, 0x71, 0x48, 0x74, 0x50, 0x74, 0x58, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50,
+  0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x06, 0x72, 0x50, 0x74, 0x50, 0x74, 0x58,
+  0x70, 0x48, 0x67, 0x20, 0x61, 0x08, 0x80, 0x08, 0x81, 0x61, 0x10, 0x0d, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x10, 0x60, 0x08, 0x66, 0x18, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x73, 0x50,
+  0x72, 0x50, 0x74, 0x50, 0x71, 0x48, 0x81, 0x08, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08,
+  0x60, 0x08, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0x98, 0x61, 0x08, 0x01, 0x71, 0x48, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x63, 0x10, 0x9b, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x97, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50,
+  0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x87,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08,
+  0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61, 0x10, 0x0c, 0x20, 0x10, 0x00, 0x10, 0x41, 0x10, 0x62,
+  0x10, 0x41, 0x10, 0x00, 0x10, 0x20, 0x10, 0x82, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x62,
+  0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x84, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x62, 0x10, 0x73, 0x50, 0x81, 0x75,
+  0x58, 0x09, 0x73, 0x50, 0x70, 0x40, 0x6b, 0x30, 0x86, 0x18, 0x62, 0x08, 0x60, 0x08, 0x60, 0x00,
+  0x6c, 0x30, 0x74, 0x58, 0x72, 0x50, 0x81, 0x92, 0x50, 0x04, 0x72, 0x50, 0x93, 0x50, 0x74, 0x50,
+  0x86, 0x18, 0x60, 0x08, 0x82, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x07, 0x61, 0x08,
+  0x80, 0x08, 0x81, 0x08, 0x67, 0x20, 0x6e, 0x38, 0x73, 0x50, 0x94, 0x58, 0x93, 0x50, 0x84, 0x72,
+  0x50, 0x00, 0x93, 0x50, 0x83, 0x72, 0x50, 0x0a, 0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x50,
+  0x94, 0x58, 0x74, 0x58, 0x71, 0x48, 0x6d, 0x38, 0x69, 0x28, 0x84, 0x18, 0x81, 0x08, 0x81, 0x80,
+  0x08, 0x84, 0x60, 0x08, 0x08, 0x82, 0x08, 0x64, 0x10, 0x66, 0x18, 0x69, 0x28, 0x6c, 0x30, 0x6e,
+  0x40, 0x70, 0x48, 0x72, 0x50, 0x73, 0x50, 0x87, 0x74, 0x58, 0x00, 0x94, 0x58, 0x81, 0x74, 0x58,
+  0x08, 0x74, 0x50, 0x73, 0x50, 0x72, 0x48, 0x70, 0x40, 0x6e, 0x38, 0x6a, 0x28, 0x87, 0x20, 0x64,
+  0x10, 0x62, 0x08, 0x81, 0x80, 0x08, 0x01, 0x60, 0x08, 0x61, 0x08, 0x82, 0x60, 0x08, 0x04, 0x82,
+  0x10, 0x65, 0x18, 0x6a, 0x28, 0x6f, 0x40, 0x72, 0x50, 0x81, 0x74, 0x58, 0x81, 0x73, 0x50, 0x84,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x92, 0x50, 0x00, 0x72, 0x50, 0x81, 0x74,
+  0x58, 0x05, 0x70, 0x40, 0x68, 0x20, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x82, 0x61,
+  0x08, 0x02, 0x62, 0x10, 0x60, 0x08, 0x63, 0x10, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x05, 0x92,
+  0x50, 0x73, 0x50, 0x74, 0x50, 0x64, 0x18, 0x60, 0x08, 0x61, 0x08, 0x81, 0x60, 0x08, 0x03, 0x64,
+  0x18, 0x6b, 0x30, 0x71, 0x48, 0x6e, 0x38, 0x98, 0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18, 0x74,
+  0x50, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x70, 0x40, 0xb5,
+  0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x08, 0x6a, 0x30, 0x74, 0x58, 0x81, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x03, 0x72, 0x50, 0x94, 0x58, 0x6a, 0x28, 0x80, 0x00, 0x8d, 0x61, 0x08, 0x03, 0x61, 0x10,
+  0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x62, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10,
+  0x8c, 0x61, 0x08, 0x00, 0x63, 0x10, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x09, 0x73, 0x50, 0x74,
+  0x58, 0x74, 0x50, 0x72, 0x48, 0x6d, 0x38, 0x68, 0x28, 0x64, 0x10, 0x6d, 0x38, 0x73, 0x50, 0x93,
+  0x50, 0x81, 0x72, 0x50, 0x05, 0x92, 0x50, 0x93, 0x50, 0x73, 0x50, 0x64, 0x18, 0x60, 0x08, 0x62,
+  0x10, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x08, 0x82, 0x10, 0x61, 0x10, 0x60,
+  0x08, 0x80, 0x08, 0x64, 0x10, 0x6a, 0x28, 0x70, 0x40, 0x74, 0x50, 0x94, 0x58, 0x81, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x81, 0x93, 0x50, 0x81, 0x73, 0x50, 0x01, 0x93, 0x50, 0x73, 0x50, 0x83, 0x72,
+  0x50, 0x0a, 0x93, 0x50, 0x94, 0x58, 0x74, 0x58, 0x73, 0x50, 0x71, 0x48, 0x6d, 0x38, 0x69, 0x28,
+  0x65, 0x18, 0x82, 0x10, 0x80, 0x08, 0x60, 0x08, 0x81, 0x80, 0x08, 0x00, 0x61, 0x08, 0x81, 0x80,
+  0x08, 0x09, 0x60, 0x08, 0x80, 0x08, 0x61, 0x08, 0x83, 0x10, 0x64, 0x18, 0x66, 0x20, 0x67, 0x20,
+  0x68, 0x20, 0x69, 0x28, 0x6a, 0x28, 0x81, 0x6b, 0x30, 0x08, 0x6a, 0x30, 0x69, 0x28, 0x68, 0x20,
+  0x67, 0x20, 0x85, 0x18, 0x63, 0x10, 0x62, 0x10, 0x81, 0x08, 0x80, 0x08, 0x81, 0x60, 0x08, 0x81,
+  0x61, 0x08, 0x82, 0x60, 0x08, 0x08, 0x62, 0x10, 0x65, 0x18, 0x6a, 0x28, 0x6e, 0x38, 0x72, 0x48,
+  0x74, 0x50, 0x74, 0x58, 0x74, 0x50, 0x93, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x93,
+  0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x58, 0x74,
+  0x50, 0x6e, 0x38, 0x66, 0x18, 0x81, 0x80, 0x08, 0x03, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x62,
+  0x10, 0x81, 0x61, 0x10, 0x04, 0x61, 0x08, 0x60, 0x08, 0x63, 0x10, 0x72, 0x48, 0x74, 0x50, 0x83,
+  0x72, 0x50, 0x0c, 0x93, 0x50, 0x74, 0x58, 0x67, 0x20, 0x80, 0x00, 0x80, 0x08, 0x63, 0x10, 0x68,
+  0x28, 0x6f, 0x40, 0x73, 0x50, 0x74, 0x58, 0x93, 0x50, 0x75, 0x58, 0x64, 0x10, 0x97, 0x61, 0x08,
+  0x03, 0x60, 0x08, 0x6a, 0x28, 0x74, 0x58, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74,
+  0x58, 0x6b, 0x30, 0x60, 0x00, 0xb5, 0x61, 0x08, 0x02, 0x60, 0x08, 0x66, 0x18, 0x74, 0x50, 0x82,
+  0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x94, 0x50, 0x6f, 0x40, 0x60, 0x08, 0x8c, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x83, 0x61, 0x08, 0x81, 0x61, 0x10, 0x02, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x81,
+  0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x81, 0x61, 0x10, 0x08, 0x62,
+  0x10, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x60, 0x08, 0x6b, 0x30, 0x75,
+  0x58, 0x81, 0x72, 0x50, 0x00, 0x93, 0x50, 0x81, 0x92, 0x50, 0x00, 0x93, 0x50, 0x81, 0x74, 0x58,
+  0x05, 0x73, 0x50, 0x90, 0x40, 0x72, 0x50, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x05, 0x74, 0x50, 0x73, 0x50, 0x83, 0x10, 0x80, 0x00, 0x60, 0x08, 0x80, 0x08, 0x83, 0x60, 0x08,
+  0x01, 0x80, 0x08, 0x60, 0x08, 0x81, 0x80, 0x08, 0x81, 0x60, 0x00, 0x04, 0x63, 0x10, 0x69, 0x28,
+  0x6e, 0x38, 0x71, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x92, 0x50, 0x83, 0x72, 0x50, 0x01,
+  0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03, 0x72, 0x50, 0x92, 0x50, 0x72, 0x50, 0x73, 0x50,
+  0x81, 0x74, 0x58, 0x08, 0x73, 0x50, 0x72, 0x48, 0x6f, 0x40, 0x6c, 0x30, 0x68, 0x28, 0x86, 0x18,
+  0x83, 0x10, 0x81, 0x08, 0x60, 0x08, 0x81, 0x80, 0x08, 0x83, 0x60, 0x08, 0x00, 0x80, 0x08, 0x81,
+  0x60, 0x08, 0x01, 0x80, 0x08, 0x60, 0x08, 0x83, 0x80, 0x08, 0x81, 0x60, 0x08, 0x00, 0x61, 0x08,
+  0x82, 0x60, 0x08, 0x0b, 0x80, 0x08, 0x60, 0x08, 0x82, 0x08, 0x64, 0x10, 0x87, 0x20, 0x6b, 0x30,
+  0x6f, 0x40, 0x72, 0x48, 0x74, 0x50, 0x74, 0x58, 0x74, 0x50, 0x73, 0x50, 0x88, 0x72, 0x50, 0x02,
+  0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x09, 0x93, 0x50, 0x74, 0x50, 0x74, 0x58,
+  0x72, 0x48, 0x6c, 0x30, 0x84, 0x18, 0x80, 0x08, 0x60, 0x08, 0x61, 0x10, 0x62, 0x10, 0x82, 0x61,
+  0x10, 0x07, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x60, 0x08, 0x64, 0x10, 0x72, 0x48, 0x74, 0x50,
+  0x92, 0x50, 0x83, 0x72, 0x50, 0x07, 0x73, 0x50, 0x6a, 0x28, 0x83, 0x10, 0x69, 0x28, 0x6f, 0x40,
+  0x73, 0x50, 0x74, 0x58, 0x74, 0x50, 0x81, 0x72, 0x50, 0x01, 0x74, 0x50, 0x71, 0x48, 0x98, 0x61,
+  0x08, 0x04, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03,
+  0x92, 0x50, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0xb2, 0x61,
+  0x08, 0x01, 0x62, 0x08, 0x72, 0x48, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00,
+  0x63, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x62, 0x10, 0x85, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x06, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x6c, 0x38, 0x75,
+  0x58, 0x73, 0x50, 0x92, 0x50, 0x83, 0x72, 0x50, 0x04, 0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72,
+  0x50, 0x92, 0x50, 0x84, 0x72, 0x50, 0x01, 0x74, 0x50, 0x91, 0x48, 0x81, 0x68, 0x20, 0x01, 0x67,
+  0x20, 0x87, 0x20, 0x86, 0x67, 0x20, 0x83, 0x68, 0x20, 0x03, 0x6b, 0x30, 0x6f, 0x40, 0x73, 0x50,
+  0x93, 0x50, 0x81, 0x92, 0x50, 0x85, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x01, 0x93,
+  0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x0c, 0x93, 0x50, 0x94, 0x50, 0x94, 0x58, 0x74, 0x58, 0x74,
+  0x50, 0x73, 0x50, 0x70, 0x48, 0x6e, 0x38, 0x6b, 0x30, 0x69, 0x28, 0x66, 0x20, 0x64, 0x18, 0x83,
+  0x10, 0x81, 0x61, 0x08, 0x82, 0x80, 0x08, 0x86, 0x60, 0x08, 0x07, 0x81, 0x08, 0x63, 0x10, 0x65,
+  0x18, 0x68, 0x20, 0x6b, 0x30, 0x6e, 0x40, 0x71, 0x48, 0x73, 0x50, 0x81, 0x74, 0x58, 0x01, 0x74,
+  0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x93, 0x50, 0x89, 0x72, 0x50, 0x0a, 0x93, 0x50, 0x72,
+  0x50, 0x93, 0x50, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x8f, 0x40, 0x68, 0x20, 0x82, 0x10, 0x60,
+  0x08, 0x61, 0x08, 0x82, 0x61, 0x10, 0x00, 0x62, 0x08, 0x82, 0x61, 0x10, 0x05, 0x62, 0x10, 0x61,
+  0x08, 0x60, 0x00, 0x65, 0x18, 0x73, 0x50, 0x74, 0x50, 0x86, 0x72, 0x50, 0x04, 0x70, 0x48, 0x73,
+  0x50, 0x74, 0x58, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x66,
+  0x18, 0x60, 0x08, 0x81, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x03,
+  0x83, 0x10, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x01, 0x72, 0x50, 0x62, 0x10,
+  0xab, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58,
+  0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x93, 0x50, 0x74, 0x58, 0x68, 0x28, 0x60, 0x08, 0x86, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x03, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x82, 0x61, 0x10, 0x04, 0x61, 0x08,
+  0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x07, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x80, 0x08,
+  0x69, 0x28, 0x73, 0x50, 0x74, 0x58, 0x93, 0x50, 0x84, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50,
+  0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x84, 0x74, 0x58, 0x82,
+  0x74, 0x50, 0x85, 0x74, 0x58, 0x02, 0x75, 0x58, 0x74, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02,
+  0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x8d, 0x72, 0x50, 0x01, 0x73, 0x50, 0x93, 0x50, 0x83, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x03, 0x94, 0x58, 0x74, 0x58, 0x75, 0x58, 0x74, 0x58, 0x81, 0x73, 0x50,
+  0x05, 0x71, 0x48, 0x70, 0x40, 0x6f, 0x40, 0x6d, 0x38, 0x6c, 0x30, 0x6b, 0x30, 0x81, 0x6a, 0x28,
+  0x06, 0x8a, 0x28, 0x6a, 0x28, 0x6b, 0x30, 0x6e, 0x40, 0x71, 0x48, 0x73, 0x50, 0x74, 0x50, 0x81,
+  0x74, 0x58, 0x00, 0x74, 0x50, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x05, 0x73, 0x50, 0x74, 0x58, 0x74, 0x50, 0x70, 0x48, 0x6a, 0x30, 0x64, 0x10, 0x81,
+  0x80, 0x08, 0x00, 0x61, 0x08, 0x82, 0x61, 0x10, 0x00, 0x61, 0x08, 0x83, 0x61, 0x10, 0x05, 0x62,
+  0x10, 0x61, 0x08, 0x80, 0x00, 0x68, 0x20, 0x74, 0x50, 0x73, 0x50, 0x85, 0x72, 0x50, 0x02, 0x92,
+  0x50, 0x93, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x92, 0x50, 0x82, 0x72, 0x50, 0x04, 0x73,
+  0x50, 0x74, 0x50, 0x68, 0x20, 0x80, 0x08, 0x62, 0x10, 0x96, 0x61, 0x08, 0x02, 0x60, 0x08, 0x67,
+  0x20, 0x74, 0x58, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x02, 0x74, 0x50, 0x6e, 0x40, 0x60, 0x08,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0xb3, 0x61, 0x08, 0x05, 0x60, 0x08, 0x68, 0x20, 0x74, 0x58,
+  0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x74, 0x50, 0x6e, 0x38, 0x60, 0x08,
+  0x81, 0x61, 0x10, 0x92, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88,
+  0x61, 0x08, 0x09, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x61, 0x10, 0x60, 0x08, 0x63, 0x10, 0x6d,
+  0x38, 0x74, 0x50, 0x94, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01, 0x92, 0x50, 0x93, 0x50, 0xa1,
+  0x72, 0x50, 0x00, 0x92, 0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x83, 0x72, 0x50, 0x00, 0x93,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x85, 0x72, 0x50,
+  0x00, 0x93, 0x50, 0x81, 0x73, 0x50, 0x01, 0x93, 0x50, 0x74, 0x50, 0x87, 0x74, 0x58, 0x00, 0x74,
+  0x50, 0x81, 0x73, 0x50, 0x92, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x06, 0x74, 0x50,
+  0x70, 0x48, 0x6b, 0x30, 0x65, 0x18, 0x61, 0x08, 0x80, 0x08, 0x61, 0x08, 0x85, 0x61, 0x10, 0x01,
+  0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x07, 0x61, 0x10, 0x60, 0x08, 0x61, 0x08, 0x6c, 0x30,
+  0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x8b, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x58,
+  0x72, 0x48, 0x65, 0x18, 0x60, 0x08, 0x98, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x50,
+  0x82, 0x72, 0x50, 0x05, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x69, 0x28, 0x60, 0x08, 0x61, 0x10,
+  0xb7, 0x61, 0x08, 0x00, 0x63, 0x10, 0x83, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00,
+  0x63, 0x10, 0x94, 0x61, 0x08, 0x00, 0x61, 0x10, 0x99, 0x61, 0x08, 0x07, 0x61, 0x10, 0x61, 0x08,
+  0x62, 0x10, 0x61, 0x08, 0x80, 0x08, 0x64, 0x18, 0x6c, 0x30, 0x72, 0x50, 0x81, 0x74, 0x58, 0x01,
+  0x93, 0x50, 0x92, 0x50, 0x84, 0x72, 0x50, 0x00, 0x93, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x87, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x92, 0x50, 0x8b, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x83, 0x72, 0x50, 0x01, 0x92, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x93, 0x50,
+  0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x8f, 0x72, 0x50, 0x82, 0x92, 0x50,
+  0x82, 0x72, 0x50, 0x02, 0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x90, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x04, 0x72, 0x48, 0x6f, 0x40, 0x69, 0x28, 0x85, 0x18, 0x81, 0x08, 0x81, 0x60, 0x08, 0x01, 0x61,
+  0x10, 0x62, 0x10, 0x89, 0x61, 0x10, 0x04, 0x61, 0x08, 0x60, 0x00, 0x65, 0x18, 0x71, 0x48, 0x74,
+  0x58, 0x81, 0x72, 0x50, 0x00, 0x92, 0x50, 0x8a, 0x72, 0x50, 0x06, 0x73, 0x50, 0x74, 0x58, 0x73,
+  0x50, 0x6c, 0x30, 0x62, 0x08, 0x60, 0x08, 0x61, 0x10, 0x98, 0x61, 0x08, 0x02, 0x82, 0x10, 0x72,
+  0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x64, 0x10, 0x60, 0x08, 0xb8, 0x61,
+  0x08, 0x0a, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50,
+  0x72, 0x50, 0x75, 0x58, 0x69, 0x28, 0x60, 0x08, 0x82, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08,
+  0x61, 0x10, 0xaa, 0x61, 0x08, 0x00, 0x62, 0x10, 0x81, 0x61, 0x10, 0x05, 0x61, 0x08, 0x80, 0x08,
+  0x62, 0x10, 0x68, 0x20, 0x6e, 0x38, 0x72, 0x50, 0x81, 0x74, 0x58, 0x81, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x00, 0x92, 0x50, 0x8a, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50, 0x00, 0x92, 0x50,
+  0x82, 0x72, 0x50, 0x86, 0x92, 0x50, 0x81, 0x93, 0x50, 0x81, 0x73, 0x50, 0x01, 0x74, 0x50, 0x74,
+  0x58, 0x81, 0x94, 0x58, 0x04, 0x74, 0x50, 0x73, 0x50, 0x72, 0x48, 0x73, 0x50, 0x74, 0x50, 0x82,
+  0x74, 0x58, 0x01, 0x74, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x92, 0x50, 0x06, 0x72, 0x50,
+  0x93, 0x50, 0x92, 0x50, 0x72, 0x50, 0x92, 0x50, 0x72, 0x50, 0x92, 0x50, 0x84, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x8e, 0x72,
+  0x50, 0x04, 0x73, 0x50, 0x71, 0x48, 0x6b, 0x30, 0x65, 0x18, 0x81, 0x08, 0x81, 0x80, 0x00, 0x82,
+  0x60, 0x08, 0x81, 0x61, 0x08, 0x85, 0x61, 0x10, 0x05, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x60,
+  0x08, 0x82, 0x10, 0x6b, 0x30, 0x81, 0x74, 0x50, 0x89, 0x72, 0x50, 0x81, 0x92, 0x50, 0x06, 0x73,
+  0x50, 0x74, 0x50, 0x74, 0x58, 0x72, 0x50, 0x6c, 0x30, 0x64, 0x10, 0x60, 0x08, 0x82, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x04, 0x60, 0x08, 0x87,
+  0x20, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x01, 0x73, 0x50, 0x70, 0x40, 0xba,
+  0x61, 0x08, 0x05, 0x60, 0x08, 0x69, 0x28, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x02, 0x94, 0x50, 0x6f, 0x40, 0x60, 0x08, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x8e,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x08, 0x61, 0x08, 0x80, 0x08, 0x60, 0x08, 0x83, 0x10, 0x67, 0x20,
+  0x6c, 0x30, 0x70, 0x40, 0x72, 0x48, 0x74, 0x50, 0x81, 0x74, 0x58, 0x01, 0x74, 0x50, 0x93, 0x50,
+  0x89, 0x72, 0x50, 0x83, 0x93, 0x50, 0x04, 0x73, 0x50, 0x93, 0x50, 0x73, 0x50, 0x74, 0x50, 0x94,
+  0x50, 0x81, 0x74, 0x58, 0x14, 0x94, 0x58, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x72, 0x48, 0x70,
+  0x40, 0x6e, 0x38, 0x8c, 0x30, 0x69, 0x28, 0x67, 0x20, 0x86, 0x18, 0x63, 0x10, 0x82, 0x10, 0x83,
+  0x10, 0x65, 0x18, 0x68, 0x20, 0x6a, 0x30, 0x6d, 0x38, 0x70, 0x40, 0x72, 0x48, 0x73, 0x50, 0x81,
+  0x74, 0x58, 0x01, 0x94, 0x50, 0x74, 0x50, 0x81, 0x73, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x94, 0x72, 0x50, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50, 0x00, 0x93, 0x50, 0x81,
+  0x72, 0x50, 0x08, 0x6f, 0x40, 0x6d, 0x38, 0x6a, 0x30, 0x68, 0x28, 0x66, 0x18, 0x64, 0x10, 0x82,
+  0x10, 0x61, 0x08, 0x80, 0x08, 0x83, 0x60, 0x08, 0x08, 0x61, 0x08, 0x60, 0x08, 0x81, 0x08, 0x68,
+  0x28, 0x72, 0x48, 0x74, 0x58, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x86, 0x72, 0x50, 0x01, 0x73,
+  0x50, 0x74, 0x50, 0x81, 0x74, 0x58, 0x05, 0x72, 0x48, 0x6d, 0x38, 0x68, 0x20, 0x82, 0x10, 0x80,
+  0x08, 0x60, 0x08, 0x9b, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x58, 0x84, 0x72, 0x50,
+  0x03, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x08, 0x61, 0x10, 0x86, 0x61, 0x08, 0x81, 0x61, 0x10, 0xb0,
+  0x61, 0x08, 0x00, 0x63, 0x10, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x93, 0x50, 0x74, 0x50,
+  0x64, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x83, 0x61, 0x10,
+  0x02, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08,
+  0x05, 0x61, 0x08, 0x62, 0x10, 0x65, 0x18, 0x69, 0x28, 0x6c, 0x38, 0x6f, 0x40, 0x81, 0x73, 0x50,
+  0x01, 0x72, 0x50, 0x93, 0x50, 0x84, 0x72, 0x50, 0x02, 0x73, 0x50, 0x71, 0x48, 0x70, 0x48, 0x81,
+  0x71, 0x48, 0x01, 0x70, 0x48, 0x70, 0x40, 0x81, 0x6f, 0x40, 0x0b, 0x6d, 0x38, 0x6c, 0x30, 0x6b,
+  0x30, 0x69, 0x28, 0x68, 0x20, 0x66, 0x18, 0x65, 0x18, 0x63, 0x10, 0x82, 0x08, 0x81, 0x08, 0x60,
+  0x08, 0x80, 0x08, 0x82, 0x60, 0x08, 0x02, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x60, 0x08,
+  0x81, 0x80, 0x08, 0x0c, 0x61, 0x08, 0x82, 0x10, 0x64, 0x18, 0x67, 0x20, 0x6a, 0x28, 0x6c, 0x38,
+  0x6f, 0x40, 0x72, 0x48, 0x73, 0x50, 0x74, 0x58, 0x94, 0x58, 0x74, 0x58, 0x74, 0x50, 0x81, 0x73,
+  0x50, 0x81, 0x92, 0x50, 0x01, 0x72, 0x50, 0x93, 0x50, 0x87, 0x72, 0x50, 0x81, 0x92, 0x50, 0x82,
+  0x74, 0x50, 0x00, 0x74, 0x58, 0x81, 0x93, 0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72,
+  0x50, 0x03, 0x92, 0x50, 0x72, 0x50, 0x93, 0x50, 0x92, 0x50, 0x81, 0x93, 0x50, 0x00, 0x73, 0x58,
+  0x83, 0x74, 0x58, 0x0c, 0x73, 0x50, 0x72, 0x50, 0x70, 0x48, 0x6e, 0x38, 0x6c, 0x30, 0x6a, 0x28,
+  0x67, 0x20, 0x65, 0x18, 0x84, 0x18, 0x67, 0x20, 0x70, 0x48, 0x75, 0x58, 0x73, 0x50, 0x82, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x74, 0x58, 0x05, 0x73, 0x50,
+  0x71, 0x48, 0x6e, 0x38, 0x6a, 0x28, 0x66, 0x18, 0x62, 0x10, 0x81, 0x60, 0x08, 0x01, 0x61, 0x08,
+  0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08, 0x01, 0x62, 0x10, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x64, 0x10, 0xbb, 0x61, 0x08, 0x02,
+  0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x82, 0x72, 0x50, 0x05, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58,
+  0x6a, 0x28, 0x80, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8f, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61,
+  0x08, 0x00, 0x62, 0x08, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x61, 0x10,
+  0x00, 0x61, 0x08, 0x82, 0x60, 0x08, 0x04, 0x80, 0x08, 0x66, 0x20, 0x73, 0x50, 0x74, 0x50, 0x92,
+  0x50, 0x84, 0x72, 0x50, 0x04, 0x93, 0x50, 0x71, 0x48, 0x66, 0x20, 0x60, 0x08, 0x81, 0x08, 0x81,
+  0x61, 0x08, 0x00, 0x81, 0x08, 0x86, 0x60, 0x08, 0x83, 0x61, 0x08, 0x8b, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x82, 0x60, 0x08, 0x07, 0x61, 0x08, 0x62, 0x10, 0x64, 0x10, 0x86, 0x20, 0x89, 0x28, 0x6c,
+  0x30, 0x6e, 0x40, 0x70, 0x48, 0x81, 0x72, 0x48, 0x03, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81, 0x92, 0x50, 0x07, 0x94, 0x58, 0x74,
+  0x58, 0x6e, 0x38, 0x68, 0x20, 0x69, 0x28, 0x6d, 0x38, 0x70, 0x48, 0x73, 0x50, 0x81, 0x74, 0x58,
+  0x02, 0x73, 0x50, 0x93, 0x50, 0x92, 0x50, 0x88, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x00, 0x74, 0x50, 0x82, 0x74, 0x58, 0x03, 0x74, 0x50, 0x73, 0x50, 0x74, 0x50,
+  0x73, 0x50, 0x86, 0x72, 0x50, 0x06, 0x74, 0x58, 0x73, 0x50, 0x6e, 0x38, 0x6b, 0x30, 0x68, 0x20,
+  0x64, 0x18, 0x62, 0x08, 0x82, 0x60, 0x08, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x9a, 0x61, 0x08, 0x04, 0x60, 0x08, 0x68, 0x20, 0x94, 0x58, 0x72, 0x50, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x02, 0x94, 0x50, 0x70, 0x40, 0x60, 0x08, 0x8c, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xad, 0x61, 0x08, 0x02, 0x60, 0x08, 0x69, 0x28, 0x74, 0x58, 0x81, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x02, 0x72, 0x50, 0x93, 0x50, 0x71, 0x48, 0x93, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08, 0x01, 0x61, 0x10,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x03, 0x80, 0x08, 0x65, 0x18, 0x72, 0x48, 0x74,
+  0x58, 0x85, 0x72, 0x50, 0x06, 0x93, 0x50, 0x74, 0x50, 0x6b, 0x30, 0x81, 0x08, 0x60, 0x08, 0x61,
+  0x10, 0x81, 0x10, 0x82, 0x61, 0x10, 0x02, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x03, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x85, 0x61, 0x10, 0x00, 0x62, 0x08, 0x85,
+  0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08,
+  0x01, 0x80, 0x08, 0x60, 0x08, 0x81, 0x80, 0x08, 0x06, 0x80, 0x00, 0x62, 0x08, 0x69, 0x28, 0x71,
+  0x48, 0x93, 0x50, 0x72, 0x50, 0x93, 0x50, 0x82, 0x72, 0x50, 0x05, 0x92, 0x50, 0x72, 0x50, 0x74,
+  0x58, 0x74, 0x50, 0x6e, 0x38, 0x65, 0x18, 0x82, 0x60, 0x08, 0x0c, 0x80, 0x08, 0x81, 0x08, 0x83,
+  0x10, 0x67, 0x20, 0x6b, 0x30, 0x70, 0x40, 0x72, 0x50, 0x74, 0x50, 0x74, 0x58, 0x74, 0x50, 0x73,
+  0x50, 0x72, 0x50, 0x92, 0x50, 0x83, 0x72, 0x50, 0x81, 0x92, 0x50, 0x82, 0x72, 0x50, 0x00, 0x93,
+  0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x92, 0x50, 0x82, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6f, 0x40, 0x64, 0x10, 0x82, 0x80, 0x08,
+  0xa5, 0x61, 0x08, 0x04, 0x60, 0x08, 0x6f, 0x40, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x82, 0x72,
+  0x50, 0x02, 0x74, 0x58, 0x6a, 0x28, 0x60, 0x00, 0x8c, 0x61, 0x08, 0x00, 0x62, 0x08, 0xae, 0x61,
+  0x08, 0x00, 0x63, 0x10, 0x84, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x74, 0x58, 0x66, 0x20, 0x60,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x97, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x84, 0x61, 0x08, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x82,
+  0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x05, 0x62, 0x10, 0x60, 0x08,
+  0x63, 0x10, 0x70, 0x40, 0x75, 0x58, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50, 0x09, 0x93,
+  0x50, 0x75, 0x58, 0x72, 0x48, 0x67, 0x20, 0x80, 0x08, 0x60, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61,
+  0x10, 0x61, 0x08, 0x82, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61, 0x10, 0x01, 0x62, 0x10, 0x61,
+  0x10, 0x84, 0x60, 0x08, 0x00, 0x80, 0x08, 0x84, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61,
+  0x10, 0x82, 0x61, 0x08, 0x83, 0x61, 0x10, 0x04, 0x80, 0x08, 0x60, 0x08, 0x62, 0x10, 0x69, 0x28,
+  0x70, 0x40, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x92,
+  0x50, 0x81, 0x94, 0x58, 0x01, 0x6e, 0x38, 0x65, 0x18, 0x81, 0x60, 0x08, 0x01, 0x61, 0x10, 0x62,
+  0x10, 0x82, 0x61, 0x10, 0x08, 0x61, 0x08, 0x60, 0x08, 0x80, 0x08, 0x61, 0x08, 0x63, 0x10, 0x66,
+  0x20, 0x6b, 0x30, 0x6f, 0x40, 0x72, 0x50, 0x81, 0x74, 0x58, 0x01, 0x94, 0x58, 0x73, 0x50, 0x82,
+  0x92, 0x50, 0x01, 0x93, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50, 0x87, 0x72, 0x50,
+  0x82, 0x73, 0x50, 0x00, 0x6a, 0x30, 0x81, 0x60, 0x00, 0x81, 0x80, 0x08, 0x84, 0x60, 0x08, 0x01,
+  0x61, 0x08, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x02, 0x60, 0x08, 0x64, 0x18, 0x74, 0x50, 0x81, 0x72,
+  0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x64, 0x10, 0xbc, 0x61, 0x08, 0x04,
+  0x61, 0x10, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03, 0x72, 0x50,
+  0x74, 0x50, 0x6e, 0x38, 0x60, 0x08, 0x8d, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x81, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x03, 0x61, 0x10, 0x62, 0x08, 0x61, 0x08, 0x62, 0x08,
+  0x85, 0x61, 0x08, 0x81, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x07, 0x62, 0x10, 0x61, 0x10,
+  0x62, 0x10, 0x60, 0x08, 0x61, 0x08, 0x6c, 0x30, 0x94, 0x58, 0x73, 0x50, 0x82, 0x72, 0x50, 0x09,
+  0x73, 0x50, 0x93, 0x50, 0x92, 0x50, 0x93, 0x50, 0x74, 0x58, 0x6f, 0x40, 0x64, 0x18, 0x60, 0x00,
+  0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10, 0x81, 0x61, 0x10,
+  0x0a, 0x60, 0x08, 0x68, 0x20, 0x72, 0x50, 0x6f, 0x40, 0x6e, 0x40, 0x6c, 0x38, 0x6a, 0x28, 0x67,
+  0x20, 0x64, 0x10, 0x62, 0x10, 0x61, 0x08, 0x82, 0x60, 0x08, 0x81, 0x61, 0x08, 0x04, 0x61, 0x10,
+  0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08, 0x81, 0x60, 0x08, 0x04, 0x65, 0x18, 0x6c, 0x38,
+  0x72, 0x50, 0x74, 0x58, 0x73, 0x50, 0x84, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50,
+  0x6e, 0x38, 0x85, 0x18, 0x81, 0x80, 0x08, 0x00, 0x81, 0x10, 0x81, 0x61, 0x10, 0x05, 0x61, 0x08,
+  0x61, 0x10, 0x62, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x81, 0x08,
+  0x82, 0x80, 0x08, 0x05, 0x83, 0x10, 0x86, 0x18, 0x6a, 0x28, 0x6e, 0x40, 0x71, 0x48, 0x73, 0x50,
+  0x81, 0x74, 0x58, 0x00, 0x73, 0x50, 0x88, 0x72, 0x50, 0x00, 0x92, 0x50, 0x86, 0x72, 0x50, 0x06,
+  0x73, 0x50, 0x71, 0x48, 0x70, 0x40, 0x6e, 0x40, 0x6d, 0x38, 0x8b, 0x30, 0x6a, 0x28, 0x81, 0x69,
+  0x28, 0x81, 0x6a, 0x28, 0x00, 0x63, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x96, 0x61, 0x08, 0x02, 0x60, 0x00, 0x6c, 0x30, 0x74,
+  0x58, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08,
+  0x9d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x04, 0x60, 0x08, 0x67, 0x20, 0x74, 0x50,
+  0x92, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x63, 0x10, 0x81, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xb6, 0x61, 0x08, 0x03, 0x62, 0x08, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x83,
+  0x61, 0x10, 0x06, 0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x68, 0x20, 0x73, 0x50, 0x94, 0x58, 0x92,
+  0x50, 0x85, 0x72, 0x50, 0x81, 0x74, 0x50, 0x05, 0x6c, 0x30, 0x83, 0x10, 0x60, 0x08, 0x61, 0x08,
+  0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x05, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x63, 0x10,
+  0x71, 0x48, 0x76, 0x60, 0x83, 0x74, 0x58, 0x08, 0x73, 0x50, 0x71, 0x48, 0x6f, 0x40, 0x6c, 0x30,
+  0x69, 0x28, 0x65, 0x18, 0x83, 0x10, 0x61, 0x08, 0x80, 0x08, 0x82, 0x60, 0x08, 0x07, 0x82, 0x10,
+  0x68, 0x28, 0x6f, 0x40, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x05, 0x92, 0x50, 0x93, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x65, 0x18, 0x81, 0x60,
+  0x08, 0x82, 0x61, 0x10, 0x81, 0x62, 0x10, 0x04, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x61, 0x08,
+  0x62, 0x08, 0x86, 0x61, 0x10, 0x01, 0x61, 0x08, 0x80, 0x08, 0x81, 0x60, 0x08, 0x05, 0x62, 0x10,
+  0x65, 0x18, 0x69, 0x28, 0x6d, 0x38, 0x70, 0x48, 0x72, 0x48, 0x86, 0x72, 0x50, 0x00, 0x92, 0x50,
+  0x88, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x74, 0x50, 0x00, 0x94, 0x58, 0x83, 0x74, 0x58, 0x01,
+  0x76, 0x58, 0x70, 0x48, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x92, 0x61, 0x08, 0x02, 0x62, 0x08, 0x72, 0x48, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x03, 0x72, 0x50, 0x74, 0x58, 0x68, 0x20, 0x60, 0x08, 0xbf, 0x61, 0x08, 0x01, 0x71, 0x48, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6b, 0x30, 0x60,
+  0x08, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x07, 0x62, 0x10, 0x61,
+  0x08, 0x63, 0x10, 0x67, 0x20, 0x62, 0x10, 0x80, 0x08, 0x60, 0x08, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x06, 0x62, 0x10, 0x61, 0x10, 0x80, 0x08, 0x64, 0x10, 0x70, 0x40, 0x95, 0x58, 0x93, 0x50, 0x82,
+  0x72, 0x50, 0x0e, 0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6b,
+  0x30, 0x62, 0x10, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x62,
+  0x10, 0x81, 0x61, 0x08, 0x00, 0x6c, 0x30, 0x81, 0x74, 0x58, 0x01, 0x92, 0x50, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x00, 0x94, 0x50, 0x81, 0x74, 0x58, 0x0d, 0x74, 0x50, 0x72, 0x50, 0x70, 0x40, 0x6d,
+  0x38, 0x6a, 0x30, 0x68, 0x20, 0x6c, 0x30, 0x72, 0x48, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x92,
+  0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6c,
+  0x30, 0x64, 0x10, 0x81, 0x80, 0x08, 0x00, 0x62, 0x10, 0x82, 0x61, 0x10, 0x05, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x62, 0x08, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x10, 0x82, 0x62, 0x10, 0x83,
+  0x61, 0x10, 0x02, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x81, 0x61, 0x08, 0x04, 0x60, 0x08, 0x80,
+  0x00, 0x60, 0x00, 0x65, 0x18, 0x6f, 0x40, 0x82, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x92, 0x50,
+  0x81, 0x73, 0x50, 0x84, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x84, 0x72,
+  0x50, 0x03, 0x74, 0x58, 0x70, 0x48, 0x61, 0x08, 0x61, 0x10, 0x9c, 0x61, 0x08, 0x02, 0x60, 0x08,
+  0x68, 0x20, 0x74, 0x58, 0x83, 0x72, 0x50, 0x03, 0x73, 0x50, 0x93, 0x50, 0x72, 0x48, 0x62, 0x10,
+  0xbf, 0x61, 0x08, 0x02, 0x60, 0x00, 0x6b, 0x30, 0x74, 0x58, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50,
+  0x72, 0x50, 0x73, 0x50, 0x72, 0x48, 0x62, 0x08, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x97, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x06, 0x62, 0x10, 0x71, 0x48, 0x75, 0x58, 0x72, 0x50,
+  0x6d, 0x38, 0x87, 0x20, 0x82, 0x08, 0x81, 0x80, 0x08, 0x08, 0x61, 0x08, 0x61, 0x10, 0x62, 0x10,
+  0x80, 0x08, 0x81, 0x08, 0x6a, 0x30, 0x74, 0x50, 0x74, 0x58, 0x92, 0x50, 0x81, 0x72, 0x50, 0x01,
+  0x93, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x93, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6b, 0x30,
+  0x82, 0x10, 0x60, 0x08, 0x81, 0x08, 0x61, 0x10, 0x82, 0x62, 0x10, 0x09, 0x61, 0x08, 0x80, 0x00,
+  0x65, 0x18, 0x6e, 0x38, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x92, 0x50, 0x72, 0x50, 0x92, 0x50,
+  0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x83, 0x74, 0x58, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50, 0x07,
+  0x73, 0x50, 0x70, 0x48, 0x6a, 0x28, 0x63, 0x10, 0x80, 0x08, 0x60, 0x08, 0x61, 0x10, 0x62, 0x10,
+  0x84, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81, 0x62, 0x10, 0x01, 0x61, 0x10, 0x62,
+  0x10, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x83, 0x61, 0x10, 0x06, 0x61, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x80, 0x08, 0x61, 0x08, 0x68, 0x20, 0x6f, 0x40, 0x81, 0x73, 0x50, 0x86, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x81, 0x74, 0x58, 0x01, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50,
+  0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04, 0x74, 0x58, 0x71,
+  0x48, 0x64, 0x10, 0x61, 0x08, 0x61, 0x10, 0x84, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x10, 0x96,
+  0x61, 0x08, 0x01, 0x70, 0x40, 0x73, 0x50, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x94,
+  0x58, 0x6c, 0x30, 0x60, 0x08, 0xc0, 0x61, 0x08, 0x00, 0x64, 0x10, 0x82, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x58, 0x69, 0x28, 0x60, 0x08, 0xb6, 0x61, 0x08,
+  0x04, 0x60, 0x08, 0x66, 0x18, 0x74, 0x58, 0x72, 0x48, 0x73, 0x50, 0x81, 0x74, 0x58, 0x03, 0x72,
+  0x48, 0x8d, 0x38, 0x87, 0x20, 0x82, 0x10, 0x81, 0x80, 0x08, 0x81, 0x61, 0x08, 0x04, 0x60, 0x08,
+  0x64, 0x10, 0x6f, 0x40, 0x75, 0x58, 0x93, 0x50, 0x82, 0x72, 0x50, 0x01, 0x93, 0x50, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x58, 0x72, 0x50, 0x6b, 0x30, 0x63, 0x10, 0x81, 0x60,
+  0x08, 0x81, 0x61, 0x10, 0x08, 0x62, 0x10, 0x61, 0x10, 0x60, 0x08, 0x80, 0x08, 0x64, 0x18, 0x6c,
+  0x30, 0x72, 0x50, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x8a, 0x72, 0x50,
+  0x02, 0x73, 0x50, 0x6d, 0x38, 0x63, 0x10, 0x81, 0x60, 0x08, 0x00, 0x80, 0x08, 0x81, 0x60, 0x08,
+  0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x08, 0x83, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x82, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08,
+  0x81, 0x60, 0x08, 0x04, 0x64, 0x10, 0x6b, 0x30, 0x71, 0x48, 0x74, 0x58, 0x74, 0x50, 0x85, 0x72,
+  0x50, 0x08, 0x92, 0x50, 0x73, 0x50, 0x74, 0x58, 0x72, 0x48, 0x6a, 0x28, 0x6a, 0x30, 0x6f, 0x40,
+  0x71, 0x48, 0x73, 0x50, 0x82, 0x74, 0x58, 0x01, 0x94, 0x58, 0x74, 0x58, 0x83, 0x74, 0x50, 0x06,
+  0x74, 0x58, 0x73, 0x50, 0x70, 0x40, 0x69, 0x28, 0x81, 0x08, 0x60, 0x08, 0x62, 0x10, 0x9c, 0x61,
+  0x08, 0x02, 0x60, 0x08, 0x66, 0x20, 0x74, 0x50, 0x85, 0x72, 0x50, 0x02, 0x74, 0x50, 0x64, 0x10,
+  0x60, 0x08, 0xc0, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6d, 0x38, 0x74, 0x58, 0x72, 0x50, 0x82, 0x73,
+  0x50, 0x02, 0x72, 0x50, 0x73, 0x50, 0x71, 0x48, 0xae, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61,
+  0x08, 0x03, 0x62, 0x08, 0x71, 0x48, 0x74, 0x50, 0x72, 0x50, 0x81, 0x92, 0x50, 0x00, 0x73, 0x50,
+  0x81, 0x74, 0x58, 0x05, 0x72, 0x48, 0x6e, 0x40, 0x69, 0x28, 0x65, 0x18, 0x61, 0x08, 0x60, 0x08,
+  0x81, 0x80, 0x00, 0x03, 0x68, 0x28, 0x72, 0x50, 0x74, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81,
+  0x92, 0x50, 0x81, 0x72, 0x50, 0x05, 0x92, 0x50, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6c, 0x30,
+  0x63, 0x10, 0x81, 0x80, 0x08, 0x82, 0x61, 0x10, 0x05, 0x81, 0x08, 0x80, 0x08, 0x80, 0x00, 0x62,
+  0x08, 0x6b, 0x30, 0x73, 0x50, 0x81, 0x93, 0x50, 0x8d, 0x72, 0x50, 0x0c, 0x92, 0x50, 0x72, 0x50,
+  0x73, 0x50, 0x71, 0x48, 0x6f, 0x40, 0x6c, 0x38, 0x6a, 0x28, 0x66, 0x20, 0x64, 0x18, 0x62, 0x10,
+  0x81, 0x08, 0x60, 0x08, 0x80, 0x08, 0x81, 0x60, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82,
+  0x62, 0x10, 0x81, 0x61, 0x08, 0x82, 0x61, 0x10, 0x07, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x67,
+  0x20, 0x6e, 0x38, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x0e, 0x92, 0x50, 0x73, 0x50, 0x75, 0x58, 0x72, 0x50, 0x6a, 0x28, 0x82, 0x08, 0x60,
+  0x00, 0x60, 0x08, 0x80, 0x08, 0x82, 0x08, 0x64, 0x10, 0x67, 0x20, 0x69, 0x28, 0x6b, 0x30, 0x6c,
+  0x38, 0x82, 0x6d, 0x38, 0x05, 0x6c, 0x38, 0x6a, 0x30, 0x67, 0x20, 0x64, 0x10, 0x80, 0x08, 0x60,
+  0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x92, 0x61, 0x08,
+  0x03, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x02, 0x74, 0x50, 0x6e,
+  0x40, 0x80, 0x00, 0xc1, 0x61, 0x08, 0x02, 0x60, 0x08, 0x66, 0x18, 0x74, 0x50, 0x83, 0x72, 0x50,
+  0x06, 0x73, 0x50, 0x72, 0x50, 0x74, 0x50, 0x67, 0x20, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0xb3,
+  0x61, 0x08, 0x05, 0x62, 0x08, 0x60, 0x08, 0x64, 0x10, 0x72, 0x48, 0x94, 0x58, 0x92, 0x50, 0x83,
+  0x72, 0x50, 0x07, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x71, 0x48, 0x6d, 0x38, 0x69,
+  0x28, 0x65, 0x18, 0x81, 0x61, 0x08, 0x02, 0x6a, 0x28, 0x71, 0x48, 0x73, 0x50, 0x87, 0x72, 0x50,
+  0x04, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x85, 0x18, 0x81, 0x80, 0x08, 0x08, 0x61,
+  0x08, 0x63, 0x10, 0x67, 0x20, 0x6c, 0x30, 0x70, 0x40, 0x72, 0x48, 0x72, 0x50, 0x93, 0x50, 0x92,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x93, 0x50, 0x85, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x74, 0x50, 0x81, 0x74, 0x58, 0x09,
+  0x74, 0x50, 0x73, 0x50, 0x71, 0x48, 0x6f, 0x40, 0x6c, 0x38, 0x6a, 0x28, 0x67, 0x20, 0x65, 0x18,
+  0x82, 0x10, 0x61, 0x08, 0x83, 0x60, 0x08, 0x82, 0x61, 0x08, 0x81, 0x60, 0x08, 0x02, 0x64, 0x18,
+  0x6b, 0x30, 0x71, 0x48, 0x81, 0x74, 0x58, 0x00, 0x73, 0x50, 0x84, 0x72, 0x50, 0x0b, 0x92, 0x50,
+  0x72, 0x50, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6b, 0x30, 0x62, 0x10, 0x60, 0x08, 0x61, 0x08,
+  0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x60, 0x08, 0x80, 0x08, 0x87, 0x60,
+  0x08, 0x01, 0x61, 0x08, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x02, 0x60, 0x08, 0x65, 0x18, 0x74, 0x50,
+  0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x74, 0x58, 0x66, 0x20, 0x60, 0x08,
+  0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa1, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50,
+  0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x70, 0x40, 0x86, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x62, 0x10, 0x85, 0x61, 0x08, 0x00, 0x62, 0x08,
+  0xa2, 0x61, 0x08, 0x06, 0x62, 0x10, 0x60, 0x08, 0x62, 0x10, 0x6f, 0x40, 0x75, 0x58, 0x73, 0x50,
+  0x92, 0x50, 0x85, 0x72, 0x50, 0x01, 0x93, 0x50, 0x74, 0x50, 0x81, 0x74, 0x58, 0x05, 0x72, 0x50,
+  0x6f, 0x40, 0x8b, 0x30, 0x6b, 0x30, 0x6f, 0x40, 0x73, 0x50, 0x88, 0x72, 0x50, 0x06, 0x73, 0x50,
+  0x74, 0x58, 0x74, 0x50, 0x6e, 0x40, 0x6d, 0x38, 0x70, 0x40, 0x73, 0x50, 0x81, 0x74, 0x58, 0x81,
+  0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x93, 0x50, 0x09, 0x73, 0x50, 0x92, 0x50,
+  0x72, 0x50, 0x93, 0x50, 0x74, 0x58, 0x94, 0x58, 0x74, 0x58, 0x73, 0x50, 0x93, 0x50, 0x92, 0x50,
+  0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x85, 0x72, 0x50, 0x82, 0x73, 0x50, 0x82, 0x74, 0x58, 0x0e,
+  0x73, 0x50, 0x72, 0x48, 0x70, 0x40, 0x6e, 0x38, 0x6c, 0x30, 0x69, 0x28, 0x67, 0x20, 0x65, 0x18,
+  0x63, 0x10, 0x64, 0x10, 0x69, 0x28, 0x6f, 0x40, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x82, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x09, 0x93, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x58,
+  0x73, 0x50, 0x6b, 0x30, 0x83, 0x10, 0x60, 0x00, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x87, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x02, 0x60, 0x00, 0x6e, 0x38, 0x74, 0x50, 0x82, 0x72, 0x50,
+  0x03, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x70, 0x40, 0xc4, 0x61, 0x08, 0x02, 0x60, 0x08, 0x67,
+  0x20, 0x74, 0x58, 0x83, 0x72, 0x50, 0x04, 0x73, 0x50, 0x92, 0x50, 0x74, 0x58, 0x67, 0x20, 0x60,
+  0x08, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0xb1, 0x61, 0x08, 0x06, 0x61, 0x10, 0x61, 0x08, 0x60,
+  0x08, 0x69, 0x28, 0x72, 0x50, 0x75, 0x58, 0x93, 0x50, 0x81, 0x72, 0x50, 0x81, 0x92, 0x50, 0x82,
+  0x72, 0x50, 0x05, 0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58, 0x94, 0x50, 0x81,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50, 0x04, 0x73,
+  0x50, 0x74, 0x58, 0x73, 0x50, 0x93, 0x50, 0x92, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x06, 0x74, 0x50, 0x71, 0x48, 0x6d, 0x38, 0x6a,
+  0x30, 0x6d, 0x38, 0x90, 0x48, 0x73, 0x50, 0x82, 0x74, 0x58, 0x01, 0x74, 0x50, 0x73, 0x50, 0x83,
+  0x72, 0x50, 0x00, 0x93, 0x50, 0x86, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x74, 0x50, 0x82, 0x74,
+  0x58, 0x04, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x84, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x82, 0x72, 0x50, 0x09, 0x73, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6b, 0x30, 0x63, 0x10,
+  0x60, 0x00, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x84, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x61, 0x10, 0x01, 0x61, 0x08, 0x62,
+  0x08, 0x9f, 0x61, 0x08, 0x03, 0x60, 0x08, 0x65, 0x18, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x04, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x68, 0x20, 0x60, 0x08, 0xc5, 0x61, 0x08, 0x01, 0x71,
+  0x48, 0x73, 0x50, 0x84, 0x72, 0x50, 0x01, 0x73, 0x50, 0x70, 0x40, 0x8a, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08,
+  0x08, 0x62, 0x08, 0x61, 0x08, 0x60, 0x08, 0x62, 0x08, 0x69, 0x28, 0x71, 0x48, 0x74, 0x58, 0x94,
+  0x50, 0x93, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x91, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x00, 0x92, 0x50, 0x83, 0x72, 0x50, 0x81, 0x73, 0x50, 0x0a, 0x92, 0x50, 0x93, 0x50,
+  0x74, 0x50, 0x74, 0x58, 0x74, 0x50, 0x71, 0x48, 0x6d, 0x38, 0x69, 0x28, 0x64, 0x18, 0x61, 0x08,
+  0x80, 0x08, 0x81, 0x60, 0x08, 0x07, 0x61, 0x08, 0x63, 0x10, 0x66, 0x18, 0x69, 0x28, 0x6c, 0x38,
+  0x6f, 0x40, 0x72, 0x48, 0x73, 0x50, 0x81, 0x74, 0x58, 0x00, 0x74, 0x50, 0x81, 0x73, 0x50, 0x8c,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50, 0x81, 0x73, 0x50, 0x0b, 0x72, 0x50, 0x73, 0x50,
+  0x74, 0x58, 0x72, 0x48, 0x6a, 0x28, 0x83, 0x10, 0x60, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10,
+  0x62, 0x10, 0x61, 0x10, 0x83, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x87, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x02, 0x60, 0x08,
+  0x6d, 0x38, 0x74, 0x50, 0x84, 0x72, 0x50, 0x02, 0x73, 0x50, 0x71, 0x48, 0x62, 0x08, 0x84, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xbf, 0x61, 0x08, 0x02, 0x60, 0x08, 0x68, 0x28, 0x75, 0x58, 0x81, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x75, 0x58, 0x67, 0x20, 0x60, 0x08, 0x82, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x62, 0x08, 0x97, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x0a, 0x62, 0x10, 0x61, 0x08, 0x80, 0x08,
+  0x61, 0x08, 0x67, 0x20, 0x6e, 0x38, 0x73, 0x50, 0x74, 0x58, 0x74, 0x50, 0x73, 0x50, 0x92, 0x50,
+  0x83, 0x72, 0x50, 0x02, 0x73, 0x50, 0x92, 0x50, 0x93, 0x50, 0x84, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x86, 0x72, 0x50, 0x00, 0x93, 0x50, 0x83, 0x72, 0x50, 0x08, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50,
+  0x72, 0x48, 0x6d, 0x38, 0x68, 0x20, 0x84, 0x10, 0x81, 0x10, 0x80, 0x08, 0x81, 0x60, 0x08, 0x00,
+  0x61, 0x08, 0x83, 0x61, 0x10, 0x00, 0x61, 0x08, 0x82, 0x60, 0x08, 0x08, 0x81, 0x08, 0x82, 0x10,
+  0x64, 0x18, 0x67, 0x20, 0x8a, 0x30, 0x6d, 0x38, 0x70, 0x48, 0x52, 0x50, 0x73, 0x50, 0x81, 0x74,
+  0x58, 0x00, 0x73, 0x50, 0x91, 0x72, 0x50, 0x06, 0x73, 0x50, 0x74, 0x58, 0x70, 0x48, 0x69, 0x28,
+  0x62, 0x08, 0x80, 0x00, 0x60, 0x08, 0x81, 0x61, 0x08, 0x81, 0x60, 0x08, 0x01, 0x80, 0x08, 0x60,
+  0x08, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x03, 0x60, 0x08, 0x65, 0x18, 0x74,
+  0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x69,
+  0x28, 0x60, 0x00, 0xc7, 0x61, 0x08, 0x05, 0x71, 0x48, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72,
+  0x50, 0x93, 0x50, 0x81, 0x73, 0x50, 0x00, 0x71, 0x48, 0xb5, 0x61, 0x08, 0x00, 0x62, 0x08, 0x84,
+  0x61, 0x08, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x60, 0x08, 0x05, 0x63, 0x10, 0x68, 0x28, 0x6e,
+  0x38, 0x72, 0x48, 0x74, 0x50, 0x74, 0x58, 0x81, 0x74, 0x50, 0x82, 0x73, 0x50, 0x00, 0x93, 0x50,
+  0x86, 0x72, 0x50, 0x01, 0x92, 0x50, 0x93, 0x50, 0x81, 0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x05, 0x73, 0x50, 0x72, 0x50, 0x8f, 0x40, 0x6a, 0x28, 0x85, 0x18, 0x62,
+  0x08, 0x81, 0x60, 0x08, 0x82, 0x61, 0x08, 0x02, 0x62, 0x10, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x02, 0x61, 0x08, 0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x60, 0x08, 0x06, 0x61,
+  0x08, 0x62, 0x08, 0x63, 0x10, 0x65, 0x18, 0x6a, 0x28, 0x6f, 0x40, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x8a, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x6f, 0x40, 0x68, 0x20, 0x61, 0x08,
+  0x80, 0x00, 0x61, 0x08, 0x62, 0x08, 0x81, 0x62, 0x10, 0x02, 0x64, 0x10, 0x65, 0x18, 0x67, 0x20,
+  0x81, 0x69, 0x28, 0x01, 0x62, 0x10, 0x61, 0x08, 0x82, 0x61, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08, 0x05, 0x60, 0x08, 0x6e, 0x40, 0x74,
+  0x50, 0x72, 0x50, 0x73, 0x50, 0x93, 0x50, 0x82, 0x73, 0x50, 0x01, 0x72, 0x48, 0x62, 0x08, 0xc7,
+  0x61, 0x08, 0x05, 0x60, 0x08, 0x68, 0x28, 0x75, 0x58, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x03, 0x92, 0x50, 0x74, 0x58, 0x69, 0x28, 0x60, 0x08, 0xb3, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x07, 0x80, 0x08, 0x60, 0x08, 0x62,
+  0x10, 0x65, 0x18, 0x68, 0x20, 0x6b, 0x30, 0x6e, 0x38, 0x70, 0x40, 0x81, 0x72, 0x48, 0x81, 0x73,
+  0x50, 0x85, 0x74, 0x50, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x72, 0x48, 0x73, 0x50, 0x74, 0x58,
+  0x73, 0x50, 0x87, 0x72, 0x50, 0x81, 0x93, 0x50, 0x81, 0x74, 0x58, 0x04, 0x71, 0x48, 0x6d, 0x38,
+  0x68, 0x28, 0x64, 0x10, 0x61, 0x08, 0x81, 0x60, 0x08, 0x83, 0x61, 0x08, 0x82, 0x61, 0x10, 0x02,
+  0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x60, 0x08, 0x06, 0x61, 0x08, 0x63, 0x10, 0x68, 0x20,
+  0x6c, 0x38, 0x70, 0x48, 0x72, 0x50, 0x73, 0x50, 0x8e, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50,
+  0x81, 0x6f, 0x40, 0x81, 0x70, 0x48, 0x81, 0x71, 0x48, 0x03, 0x72, 0x48, 0x72, 0x50, 0x73, 0x50,
+  0x74, 0x50, 0x81, 0x74, 0x58, 0x03, 0x76, 0x60, 0x6c, 0x30, 0x80, 0x08, 0x61, 0x10, 0x82, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xa6, 0x61, 0x08, 0x02, 0x60, 0x08, 0x66, 0x18,
+  0x74, 0x58, 0x85, 0x72, 0x50, 0x03, 0x74, 0x58, 0x69, 0x28, 0x60, 0x08, 0x61, 0x10, 0xc8, 0x61,
+  0x08, 0x03, 0x71, 0x48, 0x93, 0x50, 0x72, 0x50, 0x93, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x01, 0x72, 0x48, 0x82, 0x10, 0xbb, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x81, 0x61, 0x08, 0x82, 0x60, 0x08, 0x03, 0x61, 0x08, 0x62, 0x10, 0x63, 0x10, 0x64, 0x10,
+  0x81, 0x65, 0x18, 0x83, 0x66, 0x18, 0x81, 0x65, 0x18, 0x00, 0x64, 0x18, 0x81, 0x63, 0x10, 0x04,
+  0x64, 0x18, 0x6c, 0x30, 0x72, 0x50, 0x74, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01, 0x92, 0x50,
+  0x73, 0x50, 0x85, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x04, 0x73, 0x50, 0x70, 0x40,
+  0x6b, 0x30, 0x67, 0x20, 0x63, 0x10, 0x82, 0x60, 0x08, 0x82, 0x61, 0x08, 0x81, 0x60, 0x08, 0x04,
+  0x62, 0x08, 0x86, 0x18, 0x6b, 0x30, 0x70, 0x40, 0x73, 0x50, 0x81, 0x74, 0x58, 0x01, 0x73, 0x50,
+  0x93, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x8c, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x93,
+  0x50, 0x81, 0x73, 0x50, 0x00, 0x93, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x92, 0x50, 0x93,
+  0x50, 0x75, 0x58, 0x6a, 0x28, 0x60, 0x08, 0x81, 0x61, 0x10, 0xab, 0x61, 0x08, 0x02, 0x80, 0x08,
+  0x90, 0x40, 0x74, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x93, 0x50, 0x72, 0x48, 0x62,
+  0x08, 0xc8, 0x61, 0x08, 0x03, 0x62, 0x10, 0x60, 0x08, 0x68, 0x20, 0x75, 0x58, 0x85, 0x72, 0x50,
+  0x02, 0x75, 0x58, 0x6c, 0x30, 0x60, 0x00, 0xb8, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62, 0x08, 0x62,
+  0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x62, 0x10, 0x82, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x01, 0x81, 0x08, 0x80, 0x08, 0x84, 0x60, 0x08, 0x83, 0x61, 0x08, 0x04, 0x60, 0x08, 0x80, 0x08,
+  0x82, 0x10, 0x69, 0x28, 0x71, 0x48, 0x81, 0x74, 0x58, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50, 0x01,
+  0x92, 0x50, 0x72, 0x50, 0x81, 0x92, 0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x0d, 0x73, 0x50,
+  0x70, 0x40, 0x6b, 0x30, 0x67, 0x20, 0x63, 0x10, 0x62, 0x08, 0x64, 0x10, 0x68, 0x28, 0x6e, 0x38,
+  0x72, 0x48, 0x94, 0x58, 0x74, 0x58, 0x73, 0x50, 0x93, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x90, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x04, 0x74, 0x58, 0x73, 0x50, 0x6a, 0x28, 0x61, 0x08, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x87, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60,
+  0x08, 0x68, 0x28, 0x75, 0x58, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x75, 0x58,
+  0x69, 0x28, 0x60, 0x08, 0x62, 0x10, 0xca, 0x61, 0x08, 0x03, 0x70, 0x40, 0x74, 0x50, 0x72, 0x50,
+  0x92, 0x50, 0x83, 0x73, 0x50, 0x04, 0x74, 0x50, 0x64, 0x10, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x99, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x02,
+  0x61, 0x08, 0x61, 0x10, 0x62, 0x10, 0x82, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x07,
+  0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x87, 0x20, 0x6e, 0x38, 0x73, 0x50, 0x75, 0x58, 0x93, 0x50,
+  0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x84, 0x72, 0x50, 0x02, 0x92, 0x50, 0x72, 0x50, 0x92, 0x50,
+  0x81, 0x73, 0x50, 0x81, 0x74, 0x58, 0x06, 0x73, 0x50, 0x71, 0x48, 0x73, 0x50, 0x74, 0x58, 0x74,
+  0x50, 0x73, 0x50, 0x92, 0x50, 0x84, 0x72, 0x50, 0x00, 0x92, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x74, 0x50, 0x00, 0x74, 0x58, 0x85, 0x74, 0x50,
+  0x81, 0x73, 0x50, 0x83, 0x74, 0x50, 0x00, 0x94, 0x58, 0x81, 0x74, 0x58, 0x07, 0x74, 0x50, 0x72,
+  0x50, 0x6f, 0x40, 0x6a, 0x28, 0x63, 0x10, 0x80, 0x08, 0x61, 0x08, 0x61, 0x10, 0x87, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x02, 0x62, 0x08, 0x72,
+  0x48, 0x73, 0x50, 0x82, 0x72, 0x50, 0x03, 0x73, 0x50, 0x92, 0x50, 0x73, 0x50, 0x51, 0x48, 0xa8,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xa2, 0x61, 0x08, 0x04, 0x60, 0x08, 0x66, 0x18, 0x74, 0x58, 0x72,
+  0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x74, 0x50, 0x6f, 0x40, 0x60, 0x08, 0xbb, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x61, 0x10, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08, 0x05, 0x83, 0x10, 0x6a, 0x28, 0x70, 0x48,
+  0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x81, 0x92, 0x50, 0x88, 0x72, 0x50, 0x81, 0x92, 0x50, 0x81,
+  0x73, 0x50, 0x8c, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x58, 0x04, 0x73, 0x50, 0x6f, 0x40,
+  0x6c, 0x30, 0x6d, 0x38, 0x6e, 0x38, 0x83, 0x6f, 0x40, 0x01, 0x70, 0x40, 0x6f, 0x40, 0x82, 0x70,
+  0x40, 0x81, 0x6f, 0x40, 0x0a, 0x6e, 0x40, 0x6e, 0x38, 0x6c, 0x30, 0x6b, 0x30, 0x69, 0x28, 0x66,
+  0x18, 0x63, 0x10, 0x81, 0x08, 0x80, 0x08, 0x61, 0x08, 0x61, 0x10, 0xad, 0x61, 0x08, 0x04, 0x60,
+  0x00, 0x6b, 0x30, 0x74, 0x58, 0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x75, 0x58, 0x68,
+  0x20, 0x60, 0x08, 0xcc, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x75, 0x58, 0x68, 0x28, 0x60, 0x08, 0x96, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x92, 0x61, 0x08, 0x00, 0x62, 0x08, 0x90, 0x61, 0x08, 0x81, 0x61, 0x10, 0x85,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x61,
+  0x10, 0x01, 0x81, 0x10, 0x81, 0x08, 0x81, 0x60, 0x08, 0x02, 0x64, 0x18, 0x6b, 0x30, 0x70, 0x40,
+  0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x92, 0x50, 0x89, 0x72, 0x50, 0x00, 0x92, 0x50, 0x83,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x05, 0x92, 0x50, 0x72, 0x50, 0x70, 0x48, 0x6c,
+  0x38, 0x67, 0x20, 0x83, 0x10, 0x88, 0x80, 0x08, 0x03, 0x60, 0x08, 0x61, 0x08, 0x81, 0x08, 0x61,
+  0x08, 0x85, 0x80, 0x08, 0x81, 0x60, 0x08, 0x00, 0x61, 0x08, 0x81, 0x61, 0x10, 0xae, 0x61, 0x08,
+  0x03, 0x60, 0x08, 0x64, 0x18, 0x74, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x01, 0x74, 0x50, 0x70, 0x40, 0xce, 0x61, 0x08, 0x01, 0x60, 0x08, 0x64, 0x10, 0x81,
+  0x73, 0x50, 0x00, 0x93, 0x50, 0x82, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x63, 0x10, 0xbd, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x82, 0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x08, 0x83, 0x60, 0x08, 0x07, 0x61, 0x08, 0x62, 0x08,
+  0x83, 0x10, 0x84, 0x18, 0x65, 0x18, 0x69, 0x28, 0x71, 0x48, 0x73, 0x50, 0x89, 0x72, 0x50, 0x00,
+  0x73, 0x50, 0x89, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x8d, 0x38, 0x67, 0x20,
+  0x63, 0x10, 0x81, 0x08, 0x82, 0x60, 0x08, 0x00, 0x80, 0x08, 0x81, 0x61, 0x08, 0x01, 0x61, 0x10,
+  0x62, 0x10, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x84, 0x61, 0x10, 0x01, 0x62, 0x10, 0x61, 0x10,
+  0x84, 0x62, 0x10, 0x8d, 0x61, 0x08, 0x00, 0x61, 0x10, 0x91, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e,
+  0x61, 0x08, 0x02, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50, 0x84, 0x72, 0x50, 0x03, 0x92, 0x50, 0x74,
+  0x58, 0x66, 0x18, 0x60, 0x08, 0xce, 0x61, 0x08, 0x04, 0x60, 0x00, 0x6b, 0x30, 0x75, 0x58, 0x72,
+  0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6d, 0x38, 0x60, 0x00, 0x82, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x9d, 0x61, 0x08, 0x00, 0x61, 0x10, 0xac, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x08, 0x62, 0x10, 0x67, 0x20, 0x69, 0x28, 0x6c, 0x30, 0x6e, 0x38, 0x6f, 0x40, 0x71,
+  0x48, 0x72, 0x50, 0x74, 0x50, 0x81, 0x74, 0x58, 0x00, 0x93, 0x50, 0x92, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x84, 0x72, 0x50, 0x0f, 0x93, 0x50, 0x94, 0x58, 0x73, 0x50, 0x72, 0x48, 0x70, 0x40, 0x6d,
+  0x38, 0x6a, 0x28, 0x88, 0x20, 0x65, 0x18, 0x63, 0x10, 0x61, 0x08, 0x60, 0x08, 0x62, 0x10, 0x62,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x62, 0x10, 0x00, 0x61,
+  0x10, 0x82, 0x62, 0x10, 0x02, 0x61, 0x08, 0x62, 0x10, 0x62, 0x08, 0xae, 0x61, 0x08, 0x02, 0x60,
+  0x08, 0x69, 0x28, 0x75, 0x58, 0x85, 0x72, 0x50, 0x02, 0x75, 0x58, 0x6d, 0x38, 0x60, 0x00, 0xd0,
+  0x61, 0x08, 0x01, 0x62, 0x08, 0x72, 0x48, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50, 0x07, 0x73, 0x50,
+  0x72, 0x50, 0x74, 0x58, 0x67, 0x20, 0x60, 0x08, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xca, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x01, 0x72, 0x48, 0x75, 0x58, 0x82, 0x74, 0x58, 0x02,
+  0x73, 0x50, 0x93, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x92, 0x50, 0x72, 0x50, 0x92, 0x50,
+  0x82, 0x72, 0x50, 0x00, 0x92, 0x50, 0x82, 0x72, 0x50, 0x81, 0x93, 0x50, 0x00, 0x73, 0x50, 0x83,
+  0x74, 0x58, 0x07, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x92, 0x50, 0x72, 0x50, 0x92, 0x50, 0x72,
+  0x50, 0x93, 0x50, 0x84, 0x72, 0x50, 0x00, 0x93, 0x50, 0x81, 0x73, 0x50, 0x00, 0x74, 0x50, 0x81,
+  0x74, 0x58, 0x03, 0x73, 0x50, 0x72, 0x50, 0x70, 0x48, 0x69, 0x28, 0x85, 0x61, 0x08, 0x04, 0x61,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa6, 0x61, 0x08, 0x01, 0x60, 0x08, 0x63, 0x10,
+  0x81, 0x73, 0x50, 0x84, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x63, 0x10, 0xd1, 0x61, 0x08, 0x03,
+  0x60, 0x08, 0x67, 0x20, 0x75, 0x58, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x02, 0x73,
+  0x50, 0x72, 0x50, 0x62, 0x10, 0xd1, 0x61, 0x08, 0x01, 0x6a, 0x28, 0x73, 0x50, 0x81, 0x74, 0x58,
+  0x00, 0x74, 0x50, 0x82, 0x73, 0x50, 0x01, 0x93, 0x50, 0x72, 0x50, 0x84, 0x73, 0x50, 0x00, 0x74,
+  0x50, 0x82, 0x74, 0x58, 0x04, 0x74, 0x50, 0x73, 0x50, 0x72, 0x48, 0x70, 0x40, 0x6d, 0x38, 0x81,
+  0x69, 0x28, 0x04, 0x6c, 0x30, 0x6f, 0x40, 0x71, 0x48, 0x73, 0x50, 0x74, 0x50, 0x82, 0x74, 0x58,
+  0x82, 0x73, 0x50, 0x87, 0x72, 0x50, 0x04, 0x93, 0x50, 0x73, 0x50, 0x74, 0x50, 0x76, 0x58, 0x72,
+  0x50, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x9c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08, 0x02, 0x60, 0x08, 0x6f,
+  0x40, 0x74, 0x50, 0x85, 0x72, 0x50, 0x02, 0x75, 0x58, 0x69, 0x28, 0x60, 0x00, 0xcf, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58, 0x72, 0x50, 0x82,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x02, 0x74, 0x58, 0x6e, 0x38, 0x80, 0x08, 0xcf, 0x61, 0x08, 0x08,
+  0x61, 0x10, 0x60, 0x08, 0x63, 0x10, 0x67, 0x20, 0x6c, 0x30, 0x6f, 0x40, 0x71, 0x48, 0x72, 0x48,
+  0x72, 0x50, 0x82, 0x73, 0x50, 0x0b, 0x72, 0x50, 0x72, 0x48, 0x71, 0x48, 0x70, 0x48, 0x6f, 0x40,
+  0x6d, 0x38, 0x6b, 0x30, 0x69, 0x28, 0x67, 0x20, 0x64, 0x18, 0x62, 0x10, 0x61, 0x08, 0x81, 0x60,
+  0x08, 0x00, 0x80, 0x08, 0x81, 0x60, 0x08, 0x09, 0x82, 0x10, 0x64, 0x18, 0x67, 0x20, 0x69, 0x28,
+  0x6c, 0x30, 0x6e, 0x38, 0x70, 0x48, 0x71, 0x48, 0x72, 0x50, 0x73, 0x50, 0x81, 0x74, 0x50, 0x82,
+  0x74, 0x58, 0x00, 0x74, 0x50, 0x81, 0x73, 0x50, 0x03, 0x71, 0x48, 0x6f, 0x40, 0x6b, 0x30, 0x63,
+  0x10, 0x83, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10, 0x84, 0x61, 0x08, 0x02, 0x62,
+  0x08, 0x61, 0x08, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x62, 0x08, 0xa9, 0x61, 0x08, 0x02, 0x60,
+  0x00, 0x69, 0x28, 0x75, 0x58, 0x85, 0x72, 0x50, 0x01, 0x94, 0x50, 0x70, 0x40, 0xd3, 0x61, 0x08,
+  0x02, 0x61, 0x10, 0x60, 0x08, 0x63, 0x10, 0x81, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x68, 0x28, 0x60, 0x00, 0xb5, 0x61, 0x08,
+  0x81, 0x61, 0x10, 0x92, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0x81,
+  0x61, 0x10, 0x01, 0x61, 0x08, 0x60, 0x08, 0x81, 0x80, 0x08, 0x02, 0x81, 0x08, 0x82, 0x10, 0x83,
+  0x10, 0x81, 0x84, 0x10, 0x81, 0x83, 0x10, 0x05, 0x62, 0x10, 0x61, 0x08, 0x81, 0x08, 0x80, 0x08,
+  0x60, 0x08, 0x80, 0x08, 0x81, 0x60, 0x08, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x62, 0x10,
+  0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x60, 0x08, 0x06, 0x80, 0x08, 0x81, 0x08, 0x62, 0x10,
+  0x83, 0x10, 0x84, 0x18, 0x85, 0x18, 0x66, 0x18, 0x82, 0x66, 0x20, 0x03, 0x66, 0x18, 0x65, 0x18,
+  0x84, 0x10, 0x62, 0x10, 0x81, 0x60, 0x08, 0x01, 0x61, 0x08, 0x62, 0x10, 0x87, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x01, 0x60, 0x08, 0x64, 0x10, 0x81, 0x73, 0x50, 0x84,
+  0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0xd4, 0x61, 0x08, 0x04, 0x60,
+  0x00, 0x69, 0x28, 0x75, 0x58, 0x92, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x01, 0x64, 0x10, 0x60, 0x08, 0xa8, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x98, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x8a, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08,
+  0x82, 0x61, 0x10, 0x00, 0x61, 0x08, 0x83, 0x61, 0x10, 0x00, 0x61, 0x08, 0x83, 0x61, 0x10, 0x81,
+  0x81, 0x08, 0x82, 0x60, 0x08, 0x00, 0x80, 0x08, 0x81, 0x60, 0x08, 0x84, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xaf, 0x61, 0x08, 0x01, 0x70, 0x48, 0x74, 0x50, 0x85, 0x72, 0x50, 0x03, 0x75, 0x58,
+  0x6b, 0x30, 0x60, 0x00, 0x61, 0x10, 0xd5, 0x61, 0x08, 0x04, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x50,
+  0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x01, 0x74, 0x50, 0x70, 0x40, 0xd3, 0x61, 0x08, 0x01,
+  0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01, 0x61, 0x08, 0x62, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x81, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x61,
+  0x10, 0x62, 0x08, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62, 0x10, 0x62, 0x08, 0x81, 0x61, 0x08,
+  0x01, 0x61, 0x10, 0x62, 0x10, 0x82, 0x61, 0x10, 0x02, 0x62, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x9c, 0x61, 0x08,
+  0x02, 0x60, 0x00, 0x6c, 0x30, 0x75, 0x58, 0x85, 0x72, 0x50, 0x01, 0x94, 0x50, 0x71, 0x48, 0xd8,
+  0x61, 0x08, 0x01, 0x60, 0x08, 0x63, 0x10, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x03, 0x72, 0x50, 0x94, 0x58, 0x6c, 0x30, 0x60, 0x08, 0xd2, 0x61, 0x08, 0x03, 0x61, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x00, 0x61, 0x08, 0x84, 0x61, 0x10, 0x82, 0x62, 0x10, 0x01, 0x62, 0x08,
+  0x61, 0x10, 0xb8, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x02, 0x60, 0x08, 0x68, 0x20,
+  0x75, 0x58, 0x85, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0xd4, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x04, 0x60, 0x08, 0x68, 0x20, 0x75, 0x58, 0x72, 0x50,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x04, 0x72, 0x50, 0x75, 0x58, 0x68, 0x20, 0x60,
+  0x00, 0x61, 0x10, 0xb5, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa0, 0x61, 0x08, 0x00, 0x61, 0x10, 0x90,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x62,
+  0x08, 0xa5, 0x61, 0x08, 0x00, 0x61, 0x10, 0x94, 0x61, 0x08, 0x01, 0x60, 0x08, 0x64, 0x10, 0x81,
+  0x73, 0x50, 0x83, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6b, 0x30, 0x60, 0x00,
+  0xd9, 0x61, 0x08, 0x05, 0x61, 0x10, 0x80, 0x08, 0x6d, 0x38, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x03, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x62, 0x10, 0xd2,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0xbf, 0x61, 0x08,
+  0x01, 0x71, 0x48, 0x74, 0x50, 0x85, 0x72, 0x50, 0x01, 0x74, 0x50, 0x70, 0x40, 0xdb, 0x61, 0x08,
+  0x04, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x72, 0x48, 0x74, 0x50, 0x85, 0x72, 0x50, 0x02, 0x73,
+  0x50, 0x72, 0x48, 0x62, 0x08, 0xe5, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xba, 0x61, 0x08,
+  0x02, 0x60, 0x08, 0x6e, 0x38, 0x74, 0x58, 0x85, 0x72, 0x50, 0x81, 0x73, 0x50, 0x02, 0x64, 0x10,
+  0x60, 0x08, 0x61, 0x10, 0x96, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc2, 0x61, 0x08, 0x04, 0x61, 0x10,
+  0x60, 0x08, 0x65, 0x18, 0x74, 0x50, 0x93, 0x50, 0x84, 0x73, 0x50, 0x03, 0x72, 0x50, 0x74, 0x58,
+  0x6f, 0x40, 0x80, 0x08, 0xd8, 0x61, 0x08, 0x00, 0x61, 0x10, 0x98, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xb5, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x04, 0x60, 0x00, 0x6b, 0x30, 0x74, 0x50,
+  0x72, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x75, 0x58, 0x69, 0x28,
+  0x60, 0x00, 0xdd, 0x61, 0x08, 0x05, 0x61, 0x10, 0x60, 0x08, 0x6a, 0x28, 0x75, 0x58, 0x72, 0x50,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x75, 0x58, 0x6c, 0x38, 0x60,
+  0x00, 0xee, 0x61, 0x08, 0x00, 0x62, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0xbc, 0x61, 0x08,
+  0x02, 0x60, 0x00, 0x69, 0x28, 0x75, 0x58, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x02, 0x74, 0x58, 0x6d, 0x38, 0x60, 0x00, 0xdf, 0x61, 0x08, 0x06, 0x61, 0x10, 0x60, 0x00, 0x6e,
+  0x38, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72,
+  0x50, 0x75, 0x58, 0x6a, 0x28, 0x60, 0x00, 0xa2, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa4, 0x61, 0x08,
+  0x00, 0x62, 0x08, 0x9f, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08, 0x00, 0x62, 0x08, 0x93,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x99, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x66, 0x18, 0x74,
+  0x50, 0x73, 0x50, 0x85, 0x72, 0x50, 0x01, 0x74, 0x50, 0x71, 0x48, 0xe3, 0x61, 0x08, 0x02, 0x82,
+  0x08, 0x72, 0x48, 0x74, 0x50, 0x83, 0x72, 0x50, 0x06, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x75,
+  0x58, 0x68, 0x20, 0x60, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa8, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xee, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x01, 0x60, 0x08, 0x65,
+  0x18, 0x81, 0x73, 0x50, 0x85, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x64, 0x10, 0x60, 0x08, 0xe1,
+  0x61, 0x08, 0x06, 0x62, 0x10, 0x60, 0x08, 0x64, 0x18, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0x61, 0x10,
+  0x8b, 0x61, 0x08, 0x81, 0x61, 0x10, 0xb7, 0x61, 0x08, 0x00, 0x61, 0x10, 0x99, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xc8, 0x61, 0x08, 0x03, 0x60, 0x08, 0x63, 0x10, 0x72, 0x50, 0x73, 0x50, 0x86, 0x72,
+  0x50, 0x02, 0x74, 0x58, 0x67, 0x20, 0x60, 0x08, 0xe2, 0x61, 0x08, 0x81, 0x61, 0x10, 0x02, 0x60,
+  0x08, 0x67, 0x20, 0x75, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x01, 0x65, 0x18, 0x60, 0x08, 0xff, 0x61, 0x08, 0xa9, 0x61, 0x08, 0x05,
+  0x60, 0x08, 0x62, 0x08, 0x72, 0x48, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50, 0x03,
+  0x75, 0x58, 0x6a, 0x28, 0x60, 0x00, 0x61, 0x10, 0xe4, 0x61, 0x08, 0x03, 0x61, 0x10, 0x60, 0x00,
+  0x6a, 0x28, 0x75, 0x58, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x02, 0x64, 0x10, 0x60, 0x08, 0x62, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0xbc, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x9e, 0x61, 0x08, 0x00, 0x62, 0x10, 0xbe, 0x61, 0x08, 0x03, 0x60, 0x08, 0x62,
+  0x08, 0x71, 0x48, 0x74, 0x50, 0x84, 0x72, 0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6d,
+  0x38, 0x60, 0x08, 0xe8, 0x61, 0x08, 0x03, 0x80, 0x00, 0x6c, 0x38, 0x75, 0x58, 0x72, 0x50, 0x84,
+  0x73, 0x50, 0x05, 0x72, 0x50, 0x94, 0x50, 0x72, 0x48, 0x63, 0x10, 0x60, 0x08, 0x61, 0x10, 0x88,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xc1, 0x61, 0x08, 0x00, 0x62, 0x08, 0xcd, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x88, 0x61, 0x08, 0x03, 0x60, 0x08, 0x62, 0x08, 0x70, 0x40, 0x74, 0x58, 0x81, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x01, 0x74, 0x58, 0x70, 0x40, 0x83, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xe4, 0x61, 0x08, 0x07, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x6f, 0x40, 0x74, 0x58, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x05, 0x92, 0x50, 0x74, 0x50, 0x72, 0x48, 0x63,
+  0x10, 0x60, 0x08, 0x62, 0x08, 0xff, 0x61, 0x08, 0xa2, 0x61, 0x08, 0x03, 0x60, 0x08, 0x61, 0x08,
+  0x70, 0x40, 0x74, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x74, 0x50,
+  0x71, 0x48, 0x62, 0x08, 0x60, 0x08, 0xeb, 0x61, 0x08, 0x02, 0x62, 0x08, 0x71, 0x48, 0x74, 0x58,
+  0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x04, 0x72, 0x50, 0x74, 0x50, 0x72, 0x48, 0x63, 0x10, 0x60,
+  0x08, 0x9e, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x81, 0x61, 0x08, 0x03, 0x60, 0x08,
+  0x62, 0x08, 0x70, 0x40, 0x74, 0x58, 0x86, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x63, 0x10, 0x60,
+  0x08, 0xeb, 0x61, 0x08, 0x05, 0x61, 0x10, 0x60, 0x08, 0x63, 0x10, 0x72, 0x48, 0x94, 0x58, 0x72,
+  0x50, 0x84, 0x73, 0x50, 0x04, 0x72, 0x50, 0x74, 0x50, 0x72, 0x48, 0x63, 0x10, 0x60, 0x08, 0xb0,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xec, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x62, 0x08, 0x70,
+  0x40, 0x74, 0x50, 0x86, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74, 0x50, 0x65, 0x18, 0x60, 0x08, 0x61,
+  0x10, 0xec, 0x61, 0x08, 0x06, 0x61, 0x10, 0x60, 0x08, 0x63, 0x10, 0x73, 0x50, 0x74, 0x50, 0x93,
+  0x50, 0x72, 0x50, 0x83, 0x73, 0x50, 0x05, 0x72, 0x50, 0x74, 0x50, 0x73, 0x50, 0x64, 0x18, 0x60,
+  0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0x9c, 0x61, 0x08, 0x03, 0x60, 0x08, 0x62, 0x08, 0x71, 0x48,
+  0x74, 0x58, 0x86, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x66, 0x18, 0x60, 0x08, 0xf0, 0x61,
+  0x08, 0x01, 0x60, 0x08, 0x64, 0x18, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00,
+  0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x01, 0x65, 0x18, 0x60, 0x00,
+  0xff, 0x61, 0x08, 0x9b, 0x61, 0x08, 0x03, 0x60, 0x08, 0x63, 0x10, 0x72, 0x48, 0x74, 0x50, 0x82,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x67, 0x20, 0x60,
+  0x00, 0xf1, 0x61, 0x08, 0x02, 0x61, 0x10, 0x60, 0x08, 0x65, 0x18, 0x81, 0x73, 0x50, 0x01, 0x72,
+  0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74,
+  0x50, 0x67, 0x20, 0x60, 0x00, 0x9a, 0x61, 0x08, 0x00, 0x61, 0x10, 0xfc, 0x61, 0x08, 0x06, 0x61,
+  0x10, 0x60, 0x00, 0x65, 0x18, 0x73, 0x50, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50,
+  0x03, 0x73, 0x50, 0x74, 0x50, 0x68, 0x20, 0x60, 0x00, 0xf3, 0x61, 0x08, 0x02, 0x61, 0x10, 0x60,
+  0x08, 0x65, 0x18, 0x81, 0x73, 0x50, 0x86, 0x72, 0x50, 0x03, 0x93, 0x50, 0x74, 0x50, 0x69, 0x28,
+  0x60, 0x00, 0xff, 0x61, 0x08, 0x97, 0x61, 0x08, 0x03, 0x60, 0x00, 0x66, 0x18, 0x73, 0x50, 0x74,
+  0x50, 0x86, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x68, 0x20, 0x60, 0x00, 0xf5, 0x61, 0x08,
+  0x04, 0x61, 0x10, 0x60, 0x08, 0x65, 0x18, 0x73, 0x50, 0x74, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x04, 0x92, 0x50, 0x93, 0x50, 0x75, 0x58, 0x6b, 0x30, 0x80, 0x08, 0xff,
+  0x61, 0x08, 0x95, 0x61, 0x08, 0x03, 0x60, 0x00, 0x69, 0x28, 0x74, 0x58, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50, 0x68, 0x20, 0x60, 0x00,
+  0xf7, 0x61, 0x08, 0x02, 0x61, 0x10, 0x60, 0x08, 0x65, 0x18, 0x81, 0x73, 0x50, 0x00, 0x92, 0x50,
+  0x82, 0x73, 0x50, 0x82, 0x72, 0x50, 0x05, 0x73, 0x50, 0x75, 0x58, 0x6d, 0x38, 0x81, 0x08, 0x60,
+  0x08, 0x62, 0x10, 0xff, 0x61, 0x08, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x81,
+  0x60, 0x08, 0x02, 0x6c, 0x30, 0x75, 0x58, 0x73, 0x50, 0x86, 0x72, 0x50, 0x04, 0x73, 0x50, 0x74,
+  0x50, 0x67, 0x20, 0x60, 0x08, 0x61, 0x10, 0xf8, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x64,
+  0x18, 0x73, 0x50, 0x74, 0x50, 0x84, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x74, 0x58,
+  0x70, 0x40, 0x63, 0x10, 0x60, 0x08, 0x61, 0x10, 0xaa, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc6, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x99, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x61, 0x08, 0x6e, 0x40,
+  0x75, 0x58, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x73, 0x50, 0x74, 0x50,
+  0x67, 0x20, 0x60, 0x00, 0x81, 0x61, 0x10, 0xf9, 0x61, 0x08, 0x05, 0x61, 0x10, 0x60, 0x08, 0x64,
+  0x10, 0x72, 0x48, 0x74, 0x50, 0x92, 0x50, 0x86, 0x72, 0x50, 0x03, 0x74, 0x58, 0x72, 0x48, 0x65,
+  0x18, 0x60, 0x00, 0xf5, 0x61, 0x08, 0x00, 0x61, 0x10, 0x95, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60,
+  0x08, 0x64, 0x10, 0x71, 0x48, 0x74, 0x58, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50,
+  0x00, 0x92, 0x50, 0x81, 0x73, 0x50, 0x02, 0x66, 0x18, 0x60, 0x08, 0x61, 0x10, 0xfc, 0x61, 0x08,
+  0x04, 0x61, 0x10, 0x60, 0x08, 0x63, 0x10, 0x71, 0x48, 0x74, 0x58, 0x87, 0x72, 0x50, 0x03, 0x73,
+  0x50, 0x74, 0x50, 0x6a, 0x28, 0x60, 0x08, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0xfd, 0x61, 0x08,
+  0x04, 0x60, 0x00, 0x67, 0x20, 0x73, 0x50, 0x74, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x94, 0x50, 0x72, 0x48, 0x64, 0x18, 0x60, 0x08, 0x61,
+  0x10, 0xfe, 0x61, 0x08, 0x04, 0x61, 0x10, 0x60, 0x08, 0x62, 0x08, 0x6f, 0x40, 0x75, 0x58, 0x82,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x04, 0x73, 0x50, 0x75, 0x58, 0x6e, 0x38, 0x62,
+  0x08, 0x60, 0x08, 0x93, 0x61, 0x08, 0x00, 0x61, 0x10, 0xee, 0x61, 0x08, 0x81, 0x61, 0x10, 0x06,
+  0x61, 0x08, 0x61, 0x10, 0x60, 0x08, 0x61, 0x08, 0x6c, 0x30, 0x75, 0x58, 0x73, 0x50, 0x83, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x04, 0x74, 0x58, 0x71, 0x48, 0x63, 0x10, 0x60, 0x08,
+  0x61, 0x10, 0xff, 0x61, 0x08, 0x01, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x6d, 0x38,
+  0x75, 0x58, 0x73, 0x50, 0x85, 0x72, 0x50, 0x05, 0x73, 0x50, 0x72, 0x50, 0x94, 0x58, 0x92, 0x48,
+  0x66, 0x18, 0x60, 0x00, 0x8c, 0x61, 0x08, 0x02, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0xab, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x04, 0x60, 0x08,
+  0x64, 0x10, 0x70, 0x40, 0x75, 0x58, 0x73, 0x50, 0x81, 0x72, 0x50, 0x0a, 0x73, 0x50, 0x72, 0x50,
+  0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x74, 0x58, 0x6f, 0x40, 0x61, 0x08, 0x60, 0x08,
+  0x62, 0x10, 0xff, 0x61, 0x08, 0x81, 0x61, 0x08, 0x81, 0x61, 0x10, 0x04, 0x61, 0x08, 0x60, 0x08,
+  0x6a, 0x28, 0x75, 0x58, 0x73, 0x50, 0x84, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x06,
+  0x93, 0x50, 0x74, 0x58, 0x6b, 0x30, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0x88, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xe3, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8d, 0x61, 0x08, 0x08, 0x61, 0x10,
+  0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x69, 0x28, 0x73, 0x50, 0x74, 0x50, 0x73, 0x50,
+  0x82, 0x72, 0x50, 0x09, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58,
+  0x6c, 0x38, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0x84, 0x61, 0x08, 0x05, 0x61,
+  0x10, 0x61, 0x08, 0x60, 0x00, 0x68, 0x20, 0x74, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x06, 0x73, 0x50, 0x75, 0x58, 0x71, 0x40, 0x65, 0x18, 0x60, 0x00, 0x61,
+  0x08, 0x61, 0x10, 0xf2, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83,
+  0x61, 0x08, 0x81, 0x61, 0x10, 0x04, 0x60, 0x08, 0x63, 0x10, 0x6f, 0x40, 0x75, 0x58, 0x73, 0x50,
+  0x87, 0x72, 0x50, 0x05, 0x73, 0x50, 0x74, 0x50, 0x69, 0x28, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10,
+  0xce, 0x61, 0x08, 0x00, 0x61, 0x10, 0xaf, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x81, 0x61, 0x08, 0x05, 0x61, 0x10, 0x61, 0x08, 0x60, 0x00, 0x64, 0x10, 0x71, 0x48,
+  0x74, 0x58, 0x86, 0x72, 0x50, 0x01, 0x73, 0x50, 0x92, 0x50, 0x81, 0x74, 0x50, 0x03, 0x6b, 0x30,
+  0x61, 0x08, 0x60, 0x08, 0x61, 0x10, 0x96, 0x61, 0x08, 0x00, 0x61, 0x10, 0xe1, 0x61, 0x08, 0x05,
+  0x61, 0x10, 0x61, 0x08, 0x60, 0x00, 0x68, 0x20, 0x73, 0x50, 0x74, 0x50, 0x88, 0x72, 0x50, 0x03,
+  0x74, 0x50, 0x73, 0x50, 0x66, 0x18, 0x80, 0x00, 0xff, 0x61, 0x08, 0x8b, 0x61, 0x08, 0x05, 0x61,
+  0x10, 0x60, 0x08, 0x62, 0x08, 0x6e, 0x38, 0x75, 0x58, 0x73, 0x50, 0x87, 0x72, 0x50, 0x06, 0x73,
+  0x50, 0x75, 0x58, 0x71, 0x48, 0x66, 0x18, 0x60, 0x00, 0x61, 0x08, 0x61, 0x10, 0x97, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xde, 0x61, 0x08, 0x06, 0x60, 0x08, 0x63, 0x10, 0x6e, 0x38, 0x75, 0x58, 0x73,
+  0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x05, 0x75,
+  0x58, 0x70, 0x40, 0x63, 0x10, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0x85, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0x81, 0x61, 0x08, 0x03, 0x60, 0x08,
+  0x6a, 0x28, 0x74, 0x50, 0x73, 0x50, 0x87, 0x72, 0x50, 0x00, 0x72, 0x48, 0x81, 0x74, 0x50, 0x04,
+  0x6d, 0x38, 0x63, 0x10, 0x60, 0x00, 0x61, 0x08, 0x62, 0x10, 0xe6, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x06, 0x60, 0x08, 0x61, 0x08, 0x69, 0x28,
+  0x73, 0x50, 0x74, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x09, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x50, 0x6c, 0x30, 0x61, 0x08, 0x60, 0x08, 0x61,
+  0x10, 0x61, 0x08, 0x81, 0x61, 0x10, 0xb0, 0x61, 0x08, 0x00, 0x61, 0x10, 0xca, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x8f, 0x61, 0x08, 0x03, 0x60, 0x00, 0x65, 0x18, 0x71, 0x48, 0x74, 0x58, 0x89, 0x72,
+  0x50, 0x04, 0x74, 0x58, 0x73, 0x50, 0x69, 0x28, 0x61, 0x08, 0x60, 0x08, 0xab, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xc3, 0x61, 0x08, 0x07, 0x61, 0x10, 0x61, 0x08, 0x60, 0x08, 0x66, 0x18, 0x70, 0x40,
+  0x75, 0x58, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x03, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50,
+  0x73, 0x50, 0x81, 0x72, 0x50, 0x03, 0x74, 0x58, 0x73, 0x50, 0x67, 0x20, 0x60, 0x00, 0xff, 0x61,
+  0x08, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x07, 0x61, 0x10, 0x60, 0x08, 0x62,
+  0x08, 0x6d, 0x38, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50, 0x05, 0x73,
+  0x50, 0x72, 0x50, 0x73, 0x50, 0x74, 0x58, 0x71, 0x40, 0x67, 0x20, 0x81, 0x60, 0x08, 0x95, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x90, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc5, 0x61, 0x08, 0x04, 0x60, 0x00,
+  0x63, 0x10, 0x6e, 0x38, 0x74, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x82, 0x73, 0x50, 0x07, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x6f, 0x40, 0x63, 0x10, 0x60, 0x08, 0x85,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x05, 0x61,
+  0x10, 0x61, 0x08, 0x60, 0x00, 0x68, 0x20, 0x73, 0x50, 0x74, 0x58, 0x84, 0x72, 0x50, 0x00, 0x73,
+  0x50, 0x83, 0x72, 0x50, 0x03, 0x93, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x65, 0x18, 0x81, 0x60, 0x08,
+  0xea, 0x61, 0x08, 0x04, 0x60, 0x00, 0x62, 0x10, 0x6b, 0x30, 0x73, 0x50, 0x74, 0x58, 0x85, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x74, 0x50, 0x00, 0x69, 0x28, 0x81, 0x60, 0x08,
+  0xff, 0x61, 0x08, 0x99, 0x61, 0x08, 0x05, 0x60, 0x08, 0x83, 0x10, 0x6f, 0x40, 0x75, 0x58, 0x73,
+  0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81,
+  0x74, 0x50, 0x03, 0x6e, 0x38, 0x65, 0x18, 0x60, 0x00, 0x60, 0x08, 0xe6, 0x61, 0x08, 0x06, 0x60,
+  0x08, 0x62, 0x08, 0x6a, 0x28, 0x72, 0x48, 0x74, 0x58, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x07, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x70, 0x40, 0x64,
+  0x18, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0x8f, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0x87, 0x61, 0x08, 0x81, 0x61, 0x10, 0x04, 0x60, 0x08, 0x80, 0x00, 0x68, 0x20, 0x73, 0x50, 0x74,
+  0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x81, 0x74, 0x50, 0x01, 0x6e, 0x38, 0x65, 0x18, 0x81, 0x60, 0x08, 0x87, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xd3, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x09, 0x61, 0x10, 0x61, 0x08, 0x60,
+  0x08, 0x62, 0x08, 0x6a, 0x28, 0x72, 0x48, 0x75, 0x58, 0x73, 0x50, 0x92, 0x50, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x00, 0x73, 0x50, 0x83, 0x72, 0x50, 0x81, 0x74, 0x50, 0x02, 0x6a, 0x28, 0x61, 0x08,
+  0x60, 0x08, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x99, 0x61, 0x08, 0x81, 0x61,
+  0x10, 0x05, 0x61, 0x08, 0x60, 0x08, 0x63, 0x10, 0x6d, 0x38, 0x75, 0x58, 0x73, 0x50, 0x89, 0x72,
+  0x50, 0x00, 0x73, 0x50, 0x81, 0x74, 0x50, 0x01, 0x6e, 0x38, 0x65, 0x18, 0x81, 0x60, 0x08, 0xde,
+  0x61, 0x08, 0x06, 0x60, 0x00, 0x62, 0x08, 0x6a, 0x28, 0x72, 0x48, 0x75, 0x58, 0x73, 0x50, 0x72,
+  0x50, 0x85, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x81, 0x93, 0x50, 0x03, 0x75, 0x58, 0x6f,
+  0x40, 0x64, 0x10, 0x60, 0x08, 0xff, 0x61, 0x08, 0x9d, 0x61, 0x08, 0x81, 0x61, 0x10, 0x00, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x06, 0x61, 0x08, 0x60, 0x08, 0x67, 0x20, 0x71, 0x48, 0x75, 0x58, 0x73,
+  0x50, 0x72, 0x48, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x08,
+  0x73, 0x50, 0x72, 0x48, 0x72, 0x50, 0x94, 0x50, 0x74, 0x50, 0x6f, 0x40, 0x67, 0x20, 0x61, 0x08,
+  0x60, 0x00, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xcc, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61,
+  0x08, 0x81, 0x60, 0x08, 0x04, 0x64, 0x10, 0x6b, 0x30, 0x72, 0x48, 0x74, 0x58, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50, 0x03, 0x73, 0x50, 0x75,
+  0x58, 0x72, 0x48, 0x68, 0x20, 0x81, 0x60, 0x08, 0x81, 0x61, 0x10, 0xff, 0x61, 0x08, 0xa3, 0x61,
+  0x08, 0x04, 0x60, 0x08, 0x61, 0x08, 0x6b, 0x30, 0x73, 0x50, 0x74, 0x50, 0x82, 0x72, 0x50, 0x84,
+  0x73, 0x50, 0x83, 0x72, 0x50, 0x04, 0x74, 0x50, 0x74, 0x58, 0x71, 0x48, 0x69, 0x28, 0x63, 0x10,
+  0x81, 0x60, 0x08, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc9, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83,
+  0x61, 0x08, 0x07, 0x60, 0x08, 0x61, 0x08, 0x66, 0x18, 0x6d, 0x38, 0x73, 0x50, 0x74, 0x58, 0x73,
+  0x50, 0x92, 0x50, 0x82, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x93, 0x50, 0x81, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x81, 0x74, 0x50, 0x04, 0x6c, 0x30, 0x62, 0x10, 0x60, 0x08, 0x61, 0x08, 0x61,
+  0x10, 0xff, 0x61, 0x08, 0x92, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93, 0x61, 0x08, 0x02, 0x60, 0x08,
+  0x64, 0x10, 0x6e, 0x38, 0x81, 0x74, 0x50, 0x82, 0x72, 0x50, 0x84, 0x73, 0x50, 0x83, 0x72, 0x50,
+  0x06, 0x93, 0x50, 0x74, 0x58, 0x73, 0x50, 0x6d, 0x38, 0x66, 0x18, 0x61, 0x08, 0x60, 0x08, 0xc9,
+  0x61, 0x08, 0x01, 0x62, 0x10, 0x61, 0x08, 0x82, 0x61, 0x10, 0x00, 0x61, 0x08, 0x81, 0x60, 0x08,
+  0x0b, 0x62, 0x10, 0x69, 0x28, 0x70, 0x40, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x92, 0x50, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x07, 0x72, 0x50, 0x73,
+  0x50, 0x72, 0x50, 0x74, 0x50, 0x74, 0x58, 0x6f, 0x40, 0x65, 0x18, 0x80, 0x00, 0x8f, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x95, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10,
+  0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x60, 0x08, 0x04, 0x66, 0x18, 0x6f, 0x40, 0x75, 0x58,
+  0x74, 0x50, 0x72, 0x50, 0x82, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x85, 0x72, 0x50, 0x06,
+  0x73, 0x50, 0x74, 0x50, 0x74, 0x58, 0x71, 0x48, 0x6b, 0x30, 0x64, 0x18, 0x61, 0x08, 0x81, 0x60,
+  0x08, 0xc8, 0x61, 0x08, 0x81, 0x60, 0x08, 0x05, 0x61, 0x08, 0x66, 0x18, 0x6d, 0x38, 0x72, 0x50,
+  0x75, 0x58, 0x73, 0x50, 0x84, 0x72, 0x50, 0x81, 0x73, 0x50, 0x08, 0x72, 0x50, 0x73, 0x50, 0x72,
+  0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x70, 0x48, 0x67, 0x20, 0x81, 0x60, 0x08,
+  0xff, 0x61, 0x08, 0xaa, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x60, 0x08, 0x03, 0x67, 0x20, 0x70, 0x40, 0x75, 0x58, 0x74, 0x50, 0x84, 0x73, 0x50, 0x87, 0x72,
+  0x50, 0x06, 0x73, 0x50, 0x74, 0x58, 0x74, 0x50, 0x70, 0x40, 0x6a, 0x28, 0x84, 0x18, 0x81, 0x08,
+  0x81, 0x60, 0x08, 0xb5, 0x61, 0x08, 0x00, 0x61, 0x10, 0x89, 0x61, 0x08, 0x0a, 0x61, 0x10, 0x61,
+  0x08, 0x60, 0x08, 0x60, 0x00, 0x61, 0x08, 0x65, 0x18, 0x6b, 0x30, 0x71, 0x48, 0x74, 0x50, 0x74,
+  0x58, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x82, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82,
+  0x72, 0x50, 0x07, 0x73, 0x50, 0x95, 0x58, 0x72, 0x48, 0x69, 0x28, 0x61, 0x08, 0x60, 0x08, 0x61,
+  0x08, 0x61, 0x10, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x8c, 0x61, 0x08, 0x05,
+  0x60, 0x08, 0x61, 0x08, 0x68, 0x20, 0x71, 0x48, 0x75, 0x58, 0x74, 0x50, 0x81, 0x72, 0x50, 0x02,
+  0x73, 0x50, 0x93, 0x50, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x84, 0x72, 0x50, 0x06,
+  0x73, 0x50, 0x75, 0x58, 0x74, 0x50, 0x70, 0x40, 0x6b, 0x30, 0x65, 0x18, 0x62, 0x08, 0x81, 0x60,
+  0x08, 0xb9, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x60, 0x08, 0x03, 0x62, 0x10,
+  0x66, 0x20, 0x6c, 0x30, 0x71, 0x48, 0x81, 0x74, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01,
+  0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x06, 0x72, 0x50,
+  0x73, 0x50, 0x75, 0x58, 0x72, 0x48, 0x69, 0x28, 0x61, 0x08, 0x60, 0x08, 0xfa, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xb9, 0x61, 0x08, 0x05, 0x62, 0x10, 0x61, 0x08, 0x60, 0x08, 0x61, 0x08, 0x67, 0x20,
+  0x70, 0x40, 0x81, 0x74, 0x58, 0x01, 0x73, 0x50, 0x92, 0x50, 0x82, 0x72, 0x50, 0x82, 0x73, 0x50,
+  0x86, 0x72, 0x50, 0x07, 0x73, 0x50, 0x75, 0x58, 0x74, 0x50, 0x71, 0x48, 0x6d, 0x38, 0x68, 0x28,
+  0x64, 0x10, 0x61, 0x08, 0x82, 0x60, 0x08, 0xb2, 0x61, 0x08, 0x82, 0x60, 0x08, 0x04, 0x61, 0x08,
+  0x64, 0x18, 0x68, 0x28, 0x6d, 0x38, 0x72, 0x48, 0x81, 0x74, 0x58, 0x00, 0x73, 0x50, 0x84, 0x72,
+  0x50, 0x04, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x08,
+  0x92, 0x50, 0x72, 0x50, 0x93, 0x50, 0x74, 0x58, 0x71, 0x48, 0x69, 0x28, 0x61, 0x08, 0x60, 0x08,
+  0x61, 0x08, 0x82, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0xb2, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81, 0x60, 0x08, 0x04, 0x66, 0x18, 0x6e, 0x38, 0x74, 0x50,
+  0x74, 0x58, 0x93, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x83,
+  0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x08, 0x93, 0x50, 0x74, 0x58, 0x75, 0x58, 0x73,
+  0x50, 0x71, 0x48, 0x6d, 0x38, 0x69, 0x28, 0x65, 0x18, 0x62, 0x10, 0x83, 0x60, 0x08, 0xa5, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x82, 0x60, 0x08, 0x05, 0x62, 0x08, 0x64, 0x18, 0x68,
+  0x28, 0x6d, 0x38, 0x71, 0x48, 0x73, 0x50, 0x81, 0x74, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x72, 0x50, 0x82, 0x73, 0x50, 0x09,
+  0x72, 0x50, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58, 0x70, 0x48, 0x68, 0x20, 0x61, 0x08, 0x60, 0x08,
+  0x61, 0x08, 0x62, 0x10, 0x87, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x81, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x93,
+  0x61, 0x08, 0x06, 0x60, 0x08, 0x80, 0x08, 0x64, 0x18, 0x6c, 0x30, 0x72, 0x50, 0x75, 0x58, 0x74,
+  0x50, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x85, 0x72, 0x50, 0x01, 0x73, 0x50, 0x93, 0x50, 0x81,
+  0x72, 0x50, 0x0b, 0x93, 0x50, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58, 0x74, 0x50, 0x72, 0x48, 0x6f,
+  0x40, 0x6b, 0x30, 0x68, 0x20, 0x65, 0x18, 0x62, 0x10, 0x61, 0x08, 0x84, 0x60, 0x08, 0x89, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x8f, 0x61, 0x08, 0x83, 0x60, 0x08, 0x0a, 0x81, 0x08, 0x62, 0x10, 0x65,
+  0x18, 0x67, 0x20, 0x6a, 0x30, 0x6e, 0x40, 0x72, 0x48, 0x74, 0x50, 0x74, 0x58, 0x74, 0x50, 0x73,
+  0x50, 0x82, 0x72, 0x50, 0x83, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x83, 0x72, 0x50,
+  0x0a, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x75, 0x58, 0x74, 0x50, 0x6e, 0x38, 0x66, 0x20, 0x61,
+  0x08, 0x60, 0x08, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08,
+  0xbc, 0x61, 0x08, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x60, 0x08, 0x05, 0x62, 0x10, 0x69, 0x28,
+  0x70, 0x40, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x83, 0x72, 0x50, 0x81, 0x73, 0x50, 0x8a, 0x72,
+  0x50, 0x81, 0x73, 0x50, 0x83, 0x74, 0x50, 0x0d, 0x72, 0x48, 0x70, 0x40, 0x6d, 0x38, 0x6b, 0x30,
+  0x68, 0x28, 0x67, 0x20, 0x64, 0x18, 0x63, 0x10, 0x62, 0x08, 0x61, 0x08, 0x60, 0x08, 0x80, 0x08,
+  0x60, 0x08, 0x80, 0x08, 0x85, 0x60, 0x08, 0x00, 0x80, 0x08, 0x8a, 0x60, 0x08, 0x08, 0x61, 0x08,
+  0x63, 0x10, 0x64, 0x10, 0x66, 0x18, 0x68, 0x20, 0x6a, 0x28, 0x6d, 0x38, 0x70, 0x40, 0x72, 0x48,
+  0x81, 0x74, 0x50, 0x02, 0x74, 0x58, 0x74, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50,
+  0x85, 0x72, 0x50, 0x81, 0x73, 0x50, 0x85, 0x72, 0x50, 0x05, 0x73, 0x50, 0x74, 0x50, 0x74, 0x58,
+  0x72, 0x48, 0x6b, 0x30, 0x64, 0x10, 0x81, 0x60, 0x08, 0xff, 0x61, 0x08, 0xbb, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x86, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x81,
+  0x60, 0x08, 0x06, 0x65, 0x18, 0x6c, 0x30, 0x72, 0x48, 0x74, 0x50, 0x74, 0x58, 0x73, 0x50, 0x92,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x84, 0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x84, 0x72, 0x50, 0x81, 0x73, 0x50, 0x00, 0x94, 0x50,
+  0x81, 0x74, 0x58, 0x03, 0x74, 0x50, 0x73, 0x50, 0x72, 0x50, 0x71, 0x48, 0x81, 0x6f, 0x40, 0x02,
+  0x6e, 0x38, 0x6c, 0x30, 0x6a, 0x30, 0x81, 0x69, 0x28, 0x01, 0x68, 0x28, 0x68, 0x20, 0x83, 0x67,
+  0x20, 0x0c, 0x87, 0x20, 0x88, 0x20, 0x69, 0x28, 0x89, 0x28, 0x6a, 0x28, 0x6a, 0x30, 0x6b, 0x30,
+  0x6d, 0x38, 0x6e, 0x38, 0x70, 0x40, 0x71, 0x48, 0x72, 0x50, 0x73, 0x50, 0x81, 0x74, 0x50, 0x01,
+  0x74, 0x58, 0x74, 0x50, 0x83, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x86, 0x72, 0x50,
+  0x04, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x06, 0x73,
+  0x50, 0x74, 0x50, 0x75, 0x58, 0x73, 0x50, 0x6e, 0x38, 0x67, 0x20, 0x62, 0x08, 0x81, 0x60, 0x08,
+  0x81, 0x61, 0x10, 0x8c, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0x9d, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x9a, 0x61, 0x08, 0x82, 0x61, 0x10, 0x81, 0x60, 0x08, 0x06, 0x62, 0x08, 0x67, 0x20,
+  0x6d, 0x38, 0x72, 0x48, 0x94, 0x58, 0x74, 0x50, 0x73, 0x50, 0x85, 0x72, 0x50, 0x82, 0x73, 0x50,
+  0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x87, 0x72, 0x50, 0x83, 0x73, 0x50, 0x81, 0x74, 0x50, 0x84,
+  0x74, 0x58, 0x86, 0x74, 0x50, 0x84, 0x74, 0x58, 0x82, 0x74, 0x50, 0x82, 0x73, 0x50, 0x83, 0x72,
+  0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x81,
+  0x72, 0x50, 0x02, 0x73, 0x50, 0x72, 0x50, 0x73, 0x50, 0x83, 0x72, 0x50, 0x05, 0x74, 0x50, 0x74,
+  0x58, 0x73, 0x50, 0x6f, 0x40, 0x69, 0x28, 0x63, 0x10, 0x81, 0x60, 0x08, 0x00, 0x61, 0x08, 0x81,
+  0x61, 0x10, 0x00, 0x62, 0x10, 0x86, 0x61, 0x08, 0x81, 0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08,
+  0xa2, 0x61, 0x08, 0x07, 0x60, 0x08, 0x80, 0x08, 0x62, 0x10, 0x67, 0x20, 0x6d, 0x38, 0x72, 0x48,
+  0x74, 0x50, 0x74, 0x58, 0x81, 0x73, 0x50, 0x02, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x84, 0x72, 0x50, 0x81, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50,
+  0x92, 0x50, 0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x01, 0x93, 0x50, 0x73, 0x50, 0x8d, 0x72,
+  0x50, 0x8f, 0x73, 0x50, 0x02, 0x72, 0x50, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x05, 0x74,
+  0x50, 0x74, 0x58, 0x73, 0x50, 0x6f, 0x40, 0x6a, 0x28, 0x64, 0x10, 0x81, 0x60, 0x08, 0x01, 0x61,
+  0x08, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xc2, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61,
+  0x08, 0x01, 0x61, 0x10, 0x61, 0x08, 0x81, 0x60, 0x08, 0x0a, 0x62, 0x10, 0x66, 0x18, 0x6b, 0x30,
+  0x70, 0x40, 0x73, 0x50, 0x75, 0x58, 0x94, 0x50, 0x73, 0x50, 0x93, 0x50, 0x72, 0x50, 0x92, 0x50,
+  0x83, 0x72, 0x50, 0x83, 0x73, 0x50, 0x83, 0x72, 0x50, 0x82, 0x73, 0x50, 0x83, 0x72, 0x50, 0x85,
+  0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x84, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72, 0x50,
+  0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x85, 0x73, 0x50, 0x81, 0x72, 0x50, 0x83, 0x73, 0x50, 0x01,
+  0x72, 0x50, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x93, 0x50, 0x82, 0x74, 0x50, 0x03, 0x72, 0x48,
+  0x6e, 0x38, 0x68, 0x28, 0x64, 0x10, 0x81, 0x60, 0x08, 0x01, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61,
+  0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0x87, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xba, 0x61, 0x08,
+  0x02, 0x61, 0x10, 0x61, 0x08, 0x62, 0x08, 0x85, 0x61, 0x08, 0x09, 0x61, 0x10, 0x61, 0x08, 0x60,
+  0x08, 0x80, 0x08, 0x81, 0x08, 0x64, 0x10, 0x68, 0x20, 0x6d, 0x38, 0x71, 0x48, 0x73, 0x50, 0x81,
+  0x74, 0x58, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x00, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73,
+  0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x82, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x00, 0x72, 0x50, 0x81, 0x73, 0x50, 0x81, 0x72, 0x50, 0x82, 0x73, 0x50, 0x81, 0x72,
+  0x50, 0x83, 0x73, 0x50, 0x00, 0x72, 0x50, 0x84, 0x73, 0x50, 0x81, 0x72, 0x50, 0x81, 0x73, 0x50,
+  0x00, 0x72, 0x50, 0x83, 0x73, 0x50, 0x01, 0x72, 0x50, 0x92, 0x50, 0x81, 0x73, 0x50, 0x07, 0x74,
+  0x50, 0x75, 0x58, 0x74, 0x50, 0x72, 0x48, 0x6f, 0x40, 0x6b, 0x30, 0x66, 0x18, 0x62, 0x08, 0x81,
+  0x60, 0x08, 0x82, 0x61, 0x08, 0x81, 0x61, 0x10, 0xa6, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61,
+  0x08, 0xb3, 0x61, 0x08, 0x82, 0x61, 0x10, 0x81, 0x61, 0x08, 0x08, 0x80, 0x08, 0x60, 0x08, 0x61,
+  0x08, 0x64, 0x18, 0x68, 0x28, 0x6c, 0x30, 0x70, 0x40, 0x72, 0x50, 0x74, 0x50, 0x81, 0x74, 0x58,
+  0x00, 0x74, 0x50, 0x82, 0x73, 0x50, 0x82, 0x72, 0x50, 0x00, 0x73, 0x50, 0x84, 0x72, 0x50, 0x86,
+  0x73, 0x50, 0x82, 0x72, 0x50, 0x01, 0x73, 0x50, 0x72, 0x50, 0x81, 0x73, 0x50, 0x85, 0x72, 0x50,
+  0x01, 0x73, 0x50, 0x72, 0x50, 0x85, 0x73, 0x50, 0x02, 0x92, 0x50, 0x73, 0x50, 0x93, 0x50, 0x82,
+  0x74, 0x58, 0x05, 0x74, 0x50, 0x72, 0x48, 0x6e, 0x38, 0x6a, 0x28, 0x66, 0x18, 0x63, 0x10, 0x82,
+  0x60, 0x08, 0xff, 0x61, 0x08, 0xe3, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x82, 0x61,
+  0x10, 0x00, 0x62, 0x10, 0x81, 0x61, 0x08, 0x81, 0x60, 0x08, 0x08, 0x61, 0x08, 0x63, 0x10, 0x65,
+  0x18, 0x69, 0x28, 0x6d, 0x38, 0x6f, 0x40, 0x72, 0x48, 0x73, 0x50, 0x74, 0x50, 0x81, 0x74, 0x58,
+  0x00, 0x94, 0x50, 0x82, 0x73, 0x50, 0x85, 0x72, 0x50, 0x84, 0x73, 0x50, 0x00, 0x72, 0x50, 0x81,
+  0x73, 0x50, 0x01, 0x72, 0x50, 0x73, 0x50, 0x85, 0x72, 0x50, 0x84, 0x73, 0x50, 0x82, 0x74, 0x50,
+  0x08, 0x74, 0x58, 0x74, 0x50, 0x73, 0x50, 0x71, 0x48, 0x6e, 0x38, 0x6b, 0x30, 0x68, 0x20, 0x84,
+  0x18, 0x82, 0x08, 0x82, 0x60, 0x08, 0x81, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08, 0xe2, 0x61, 0x08, 0x84, 0x61, 0x10, 0x00, 0x61, 0x08,
+  0x83, 0x61, 0x10, 0x00, 0x61, 0x08, 0x83, 0x60, 0x08, 0x09, 0x82, 0x10, 0x64, 0x10, 0x87, 0x20,
+  0x69, 0x28, 0x6c, 0x30, 0x6d, 0x38, 0x70, 0x40, 0x71, 0x48, 0x72, 0x48, 0x73, 0x50, 0x81, 0x74,
+  0x50, 0x8f, 0x74, 0x58, 0x00, 0x75, 0x58, 0x81, 0x74, 0x58, 0x00, 0x74, 0x50, 0x81, 0x73, 0x50,
+  0x81, 0x71, 0x48, 0x06, 0x6f, 0x40, 0x6d, 0x38, 0x6a, 0x30, 0x68, 0x20, 0x66, 0x18, 0x63, 0x10,
+  0x61, 0x08, 0x82, 0x60, 0x08, 0x84, 0x61, 0x08, 0x04, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0x61,
+  0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xff, 0x61, 0x08,
+  0xe1, 0x61, 0x08, 0x83, 0x61, 0x10, 0x01, 0x61, 0x08, 0x61, 0x10, 0x81, 0x61, 0x08, 0x02, 0x61,
+  0x10, 0x61, 0x08, 0x61, 0x10, 0x83, 0x61, 0x08, 0x83, 0x60, 0x08, 0x81, 0x61, 0x08, 0x04, 0x62,
+  0x10, 0x64, 0x18, 0x65, 0x18, 0x66, 0x18, 0x68, 0x20, 0x81, 0x6a, 0x28, 0x81, 0x6b, 0x30, 0x82,
+  0x6c, 0x30, 0x84, 0x6c, 0x38, 0x81, 0x6b, 0x30, 0x08, 0x6a, 0x30, 0x6a, 0x28, 0x68, 0x28, 0x66,
+  0x20, 0x65, 0x18, 0x84, 0x18, 0x63, 0x10, 0x62, 0x10, 0x61, 0x08, 0x84, 0x60, 0x08, 0x81, 0x61,
+  0x08, 0x81, 0x61, 0x10, 0x83, 0x61, 0x08, 0x81, 0x61, 0x10, 0xff, 0x61, 0x08, 0xe0, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x86, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8a, 0x61, 0x08, 0x83, 0x60, 0x08, 0x01, 0x80, 0x08, 0x60, 0x08,
+  0x83, 0x80, 0x08, 0x00, 0x60, 0x08, 0x83, 0x80, 0x08, 0x86, 0x60, 0x08, 0x8a, 0x61, 0x08, 0x01,
+  0x62, 0x10, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xfa, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x85, 0x61, 0x08, 0x81, 0x61, 0x10, 0x01,
+  0x62, 0x10, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00, 0x61, 0x10, 0x84, 0x61, 0x08, 0x81, 0x61, 0x10,
+  0x85, 0x61, 0x08, 0x00, 0x61, 0x10, 0x83, 0x61, 0x08, 0x00, 0x61, 0x10, 0x82, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xb9, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xb8, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xaa, 0x61, 0x08, 0x81, 0x61, 0x10, 0x8b, 0x61, 0x08, 0x00, 0x61, 0x10, 0xf3, 0x61, 0x08,
+  0x00, 0x61, 0x10, 0xed, 0x61, 0x08, 0x00, 0x61, 0x10, 0x81, 0x61, 0x08, 0x00, 0x62, 0x08, 0xa0,
+  0x61, 0x08, 0x00, 0x61, 0x10, 0x8e, 0x61, 0x08, 0x00, 0x61, 0x10, 0x88, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08,
+  0xf7, 0x61, 0x08, 0x00, 0x61, 0x10, 0xc6, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff,
+  0x61, 0x08, 0xff, 0x61, 0x08, 0xc2, 0x61, 0x08, 0x00, 0x62, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61,
+  0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08,
+  0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xa3, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff,
+  0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xe4, 0x61,
+  0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08,
+  0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff,
+  0x61, 0x08, 0xff, 0x61, 0x08, 0x99, 0x61, 0x08, 0x00, 0x61, 0x10, 0xba, 0x61, 0x08, 0x00, 0x61,
+  0x10, 0x84, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xf3, 0x61, 0x08, 0x00, 0x61, 0x10,
+  0xed, 0x61, 0x08, 0x00, 0x61, 0x10, 0xfe, 0x61, 0x08, 0x00, 0x61, 0x10, 0xdc, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0xff, 0x61, 0x08, 0xe5, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61,
+  0x08, 0xff, 0x61, 0x08, 0x9b, 0x61, 0x08, 0x00, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08,
+  0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xca, 0x61, 0x08, 0x00,
+  0x61, 0x10, 0x89, 0x61, 0x08, 0x00, 0x61, 0x10, 0xee, 0x61, 0x08,
+};
+
+const PackedImage CuckooLogoNest = {
+    300,                             // width
+    300,                             // height
+    0x12,                            // color format (LV_COLOR_FORMAT_RGB565)
+    2,                               // bytes per pixel
+    180000,                          // raw size
+    CuckooLogoNest_rle,
+    sizeof(CuckooLogoNest_rle)
+};
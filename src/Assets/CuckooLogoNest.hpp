@@ -0,0 +1,5 @@
+#pragma once
+#include "PackedImage.hpp"
+
+// Boot splash logo, 300x300 RGB565
+extern const PackedImage CuckooLogoNest;
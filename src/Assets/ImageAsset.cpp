@@ -0,0 +1,54 @@
+#define CUCKOO_LOG_MODULE "assets"
+
+#include "ImageAsset.hpp"
+#include "ImageRle.hpp"
+#include <cstdlib>
+#include <cstring>
+#include "logger.h"
+
+const lv_image_dsc_t *ImageAsset::Descriptor()
+{
+    if (pixels_ != nullptr)
+        return &dsc_;
+
+    void *buffer = nullptr;
+    if (posix_memalign(&buffer, 64, packed_.raw_size) != 0)
+    {
+        LOG_ERROR_STREAM("ImageAsset: failed to allocate " << packed_.raw_size << " bytes");
+        return nullptr;
+    }
+    uint8_t *pixels = static_cast<uint8_t *>(buffer);
+
+    size_t decoded = ImageRle::Decode(packed_.data, packed_.data_size, pixels, packed_.raw_size, packed_.pixel_bytes);
+    if (decoded != packed_.raw_size)
+    {
+        LOG_ERROR_STREAM("ImageAsset: corrupt " << packed_.width << "x" << packed_.height << " image ("
+            << decoded << " of " << packed_.raw_size << " bytes decoded)");
+        free(pixels);
+        return nullptr;
+    }
+
+    memset(&dsc_, 0, sizeof(dsc_));
+    dsc_.header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc_.header.cf = packed_.color_format;
+    dsc_.header.w = packed_.width;
+    dsc_.header.h = packed_.height;
+    dsc_.header.stride = packed_.width * packed_.pixel_bytes;
+    dsc_.data_size = packed_.raw_size;
+    dsc_.data = pixels;
+    pixels_ = pixels;
+
+    LOG_DEBUG_STREAM("ImageAsset: decoded " << packed_.width << "x" << packed_.height << " image, "
+        << packed_.data_size << " -> " << packed_.raw_size << " bytes");
+    return &dsc_;
+}
+
+void ImageAsset::Release()
+{
+    if (pixels_ == nullptr)
+        return;
+    // Drop any cached decode LVGL keeps keyed on this descriptor before the pixels go
+    lv_image_cache_drop(&dsc_);
+    free(pixels_);
+    pixels_ = nullptr;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "lvgl/lvgl.h"
+#include "PackedImage.hpp"
+
+// Decodes a PackedImage into an LVGL image descriptor on first use and frees
+// the pixels again on Release(), so large images only occupy RAM while shown.
+// Objects using Descriptor() as their source must be deleted before Release().
+class ImageAsset
+{
+public:
+    explicit ImageAsset(const PackedImage &packed) : packed_(packed) {}
+    ~ImageAsset() { Release(); }
+
+    // Returns nullptr if decoding fails
+    const lv_image_dsc_t *Descriptor();
+    void Release();
+    inline bool IsLoaded() const { return pixels_ != nullptr; }
+
+private:
+    ImageAsset(const ImageAsset &) = delete;
+    ImageAsset &operator=(const ImageAsset &) = delete;
+
+    const PackedImage &packed_;
+    uint8_t *pixels_ = nullptr;
+    lv_image_dsc_t dsc_;
+};
@@ -0,0 +1,99 @@
+#include "ImageRle.hpp"
+#include <cstring>
+
+size_t ImageRle::Decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t pixel_bytes)
+{
+    if (pixel_bytes == 0)
+        return 0;
+
+    size_t in = 0;
+    size_t out = 0;
+    while (in < src_len)
+    {
+        uint8_t control = src[in++];
+        size_t count = (control & 0x7F) + 1;
+        size_t bytes = count * pixel_bytes;
+        if (out + bytes > dst_len)
+            return 0;
+
+        if (control & 0x80)
+        {
+            if (in + pixel_bytes > src_len)
+                return 0;
+            const uint8_t *pixel = src + in;
+            in += pixel_bytes;
+            if (pixel_bytes == 2)
+            {
+                for (size_t i = 0; i < count; i++, out += 2)
+                {
+                    dst[out] = pixel[0];
+                    dst[out + 1] = pixel[1];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < count; i++, out += pixel_bytes)
+                    memcpy(dst + out, pixel, pixel_bytes);
+            }
+        }
+        else
+        {
+            if (in + bytes > src_len)
+                return 0;
+            memcpy(dst + out, src + in, bytes);
+            in += bytes;
+            out += bytes;
+        }
+    }
+    return out;
+}
+
+std::vector<uint8_t> ImageRle::Encode(const uint8_t *src, size_t src_len, size_t pixel_bytes)
+{
+    std::vector<uint8_t> out;
+    if (pixel_bytes == 0)
+        return out;
+
+    size_t pixels = src_len / pixel_bytes;
+    size_t literal_start = 0;
+    size_t literal_count = 0;
+
+    auto flush_literals = [&]()
+    {
+        while (literal_count > 0)
+        {
+            size_t n = literal_count < MaxChunk ? literal_count : MaxChunk;
+            out.push_back(static_cast<uint8_t>(n - 1));
+            out.insert(out.end(), src + literal_start * pixel_bytes, src + (literal_start + n) * pixel_bytes);
+            literal_start += n;
+            literal_count -= n;
+        }
+    };
+
+    size_t i = 0;
+    while (i < pixels)
+    {
+        size_t j = i + 1;
+        while (j < pixels && j - i < MaxChunk
+               && memcmp(src + j * pixel_bytes, src + i * pixel_bytes, pixel_bytes) == 0)
+            j++;
+
+        if (j - i >= 2)
+        {
+            flush_literals();
+            out.push_back(static_cast<uint8_t>(0x80 | (j - i - 1)));
+            out.insert(out.end(), src + i * pixel_bytes, src + (i + 1) * pixel_bytes);
+            i = j;
+            literal_start = i;
+        }
+        else
+        {
+            if (literal_count == 0)
+                literal_start = i;
+            literal_count++;
+            i++;
+        }
+    }
+    flush_literals();
+    return out;
+}
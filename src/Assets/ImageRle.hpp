@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// Run-length codec for packed image assets, in units of one pixel.
+// Control byte 0x80 | (n - 1) is followed by one pixel repeated n times,
+// control byte (n - 1) by n literal pixels; n is 1..128.
+class ImageRle
+{
+public:
+    static const size_t MaxChunk = 128;
+
+    // Decodes into dst; returns the number of bytes written, or 0 if the
+    // stream is truncated, malformed or does not fit dst
+    static size_t Decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t pixel_bytes);
+
+    static std::vector<uint8_t> Encode(const uint8_t *src, size_t src_len, size_t pixel_bytes);
+};
@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// An image stored RLE-compressed in the binary (see tools/pack_image_rle.py).
+// Plain data so it lives in .rodata and needs no LVGL to describe.
+struct PackedImage
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t color_format;   // lv_color_format_t of the decoded pixels
+    uint8_t pixel_bytes;    // RLE unit size
+    uint32_t raw_size;      // decoded size in bytes
+    const uint8_t *data;
+    uint32_t data_size;
+};
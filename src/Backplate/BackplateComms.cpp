@@ -1,3 +1,5 @@
+#define CUCKOO_LOG_MODULE "backplate"
+
 #include <mutex>
 #include <unistd.h>
 #include <string>
@@ -9,20 +11,33 @@
 #include <ctype.h>
 
 #include "logger.h"
+#include "trace.h"
 #include "BackplateComms.hpp"
 #include "CommandMessage.hpp"
 #include "ResponseMessage.hpp"
 #include "MessageParser.hpp"
-#include "CTick.hpp"
+#include "../Reactor.hpp"
+#include "../Metrics.hpp"
 
 BackplateComms::BackplateComms(ISerialPort* serialPort, IDateTimeProvider* dateTimeProvider)
-    : SerialPort(serialPort), DateTimeProvider(dateTimeProvider)
+    : timers([this]() { return DateTimeProvider->monotonic_ns(); }),
+      SerialPort(serialPort), DateTimeProvider(dateTimeProvider),
+      pir_([this]() { return DateTimeProvider->monotonic_ns(); })
 {
     this->running.store(false);
-    this->LastKeepAliveTime.tv_sec = 0;
-    this->LastKeepAliveTime.tv_usec = 0;
-    this->LastHistoricalDataRequestTime.tv_sec = 0;
-    this->LastHistoricalDataRequestTime.tv_usec = 0;
+    this->handshakeComplete.store(false);
+    this->sensorDataReceived.store(false);
+    SetSensorFilters(SensorsConfig());
+}
+
+void BackplateComms::SetSensorFilters(const SensorsConfig &config)
+{
+    temperatureFilter_ = SensorFilter(config.temperature, 100);
+    humidityFilter_ = SensorFilter(config.humidity, 10);
+    temperatureGate_ = DeadbandGate(static_cast<int32_t>(config.temperature.deadband * 100 + 0.5),
+        TimerService::Sec(config.temperature.refresh_seconds));
+    humidityGate_ = DeadbandGate(static_cast<int32_t>(config.humidity.deadband * 10 + 0.5),
+        TimerService::Sec(config.humidity.refresh_seconds));
 }
 
 BackplateComms::~BackplateComms()
@@ -31,6 +46,12 @@ BackplateComms::~BackplateComms()
     running.store(false);
     if (workerThread.joinable())
         workerThread.join();
+    pir_.Stop();
+
+    if (reactor_ && handoverEvent_ >= 0)
+        reactor_->RemoveEvent(handoverEvent_);
+    if (reactor_ && reactorSerialFd_ >= 0)
+        reactor_->Remove(reactorSerialFd_);
 }
 
 bool BackplateComms::Initialize()
@@ -41,6 +62,7 @@ bool BackplateComms::Initialize()
     if (!running.load())
     {
         running.store(true);
+        pir_.Start();
         workerThread = std::thread([this](){ this->TaskBodyRunningState(); });
         success = true;
     }
@@ -48,61 +70,35 @@ bool BackplateComms::Initialize()
     return success;
 }
 
+bool BackplateComms::Initialize(Reactor &reactor)
+{
+    if (running.load())
+        return false;
+
+    reactor_ = &reactor;
+    handoverEvent_ = reactor.AddEvent([this]() { HandOverToReactor(); });
+    if (handoverEvent_ < 0)
+    {
+        reactor_ = nullptr;
+        LOG_WARN_STREAM("BackplateComms: no reactor event, staying on the worker thread");
+    }
+    return Initialize();
+}
+
 void BackplateComms::TaskBodyRunningState()
 {
-    CTickFuture tickRunState(10);
+    TRACE_THREAD_NAME("comms");
+    if(runstate_ < 99)
+        timers.ScheduleAfter(TimerService::Ms(RunStateStepMs), [this]() { StepRunState(); });
     while(running.load())
     {
         if(runstate_ < 99)
+            timers.RunExpired();
+        else if(handoverEvent_ >= 0)
         {
-            if(tickRunState.IsExpired())
-            {
-                tickRunState.Reset();
-                switch(runstate_)
-                {
-                    case 0:
-                        if(!InitializeSerial())
-                        {
-                            tickRunState.ScheduleSec(30);
-                            LOG_ERROR_STREAM("BackplateComms: Failed to initialize serial port.");
-                        }
-                        else
-                        {
-                            LOG_INFO_STREAM("BackplateComms: serial port initialized.");
-                            runstate_ ++;
-                        }
-                        break;
-                    case 1:
-                        if(!DoBurstStage())
-                        {
-                            tickRunState.ScheduleSec(30);
-                            LOG_ERROR_STREAM("BackplateComms: Burst stage failed.");
-                            runstate_ = 0;
-                        }
-                        else
-                        {
-                            LOG_INFO_STREAM("BackplateComms: Burst stage success.");
-                            runstate_ ++;
-                        }
-                        break;
-                    case 2:
-                        if(!DoInfoGathering())
-                        {
-                            tickRunState.ScheduleSec(30);
-                            LOG_ERROR_STREAM("BackplateComms: Info gathering failed.");
-                            runstate_ = 0;
-                        }
-                        else
-                        {
-                            LOG_INFO_STREAM("BackplateComms: Info gathering success.");
-                            runstate_ ++;
-                        }
-                        break;
-                    default:
-                        LOG_INFO_STREAM("BackplateComms: Transition to normal comms.");
-                        runstate_ = 99;
-                }
-            }
+            // The reactor joins this thread and carries on from here
+            Reactor::Signal(handoverEvent_);
+            return;
         }
         else
             TaskBodyComms();
@@ -111,6 +107,83 @@ void BackplateComms::TaskBodyRunningState()
     }
 }
 
+// Runs on the reactor's thread once the worker has finished the handshake
+void BackplateComms::HandOverToReactor()
+{
+    if (workerThread.joinable())
+        workerThread.join();
+    reactor_->RemoveEvent(handoverEvent_);
+    handoverEvent_ = -1;
+
+    int fd = SerialPort->GetFd();
+    if (fd < 0 || !reactor_->Add(fd, [this]() { ReadSerial(); }) || !reactor_->AddTimers(timers))
+    {
+        if (fd >= 0)
+            reactor_->Remove(fd);
+        LOG_WARN_STREAM("BackplateComms: serial port cannot join the reactor, polling it on the worker thread");
+        workerThread = std::thread([this](){ this->TaskBodyRunningState(); });
+        return;
+    }
+
+    reactorSerialFd_ = fd;
+    StartPeriodicRequests();
+    LOG_INFO_STREAM("BackplateComms: serial port handed over to the reactor");
+}
+
+// One handshake stage per call; a failed stage starts over after RunStateRetrySeconds
+void BackplateComms::StepRunState()
+{
+    uint64_t next = TimerService::Ms(RunStateStepMs);
+    switch(runstate_)
+    {
+        case 0:
+            if(!InitializeSerial())
+            {
+                next = TimerService::Sec(RunStateRetrySeconds);
+                LOG_ERROR_STREAM("BackplateComms: Failed to initialize serial port.");
+            }
+            else
+            {
+                LOG_INFO_STREAM("BackplateComms: serial port initialized.");
+                runstate_ ++;
+            }
+            break;
+        case 1:
+            if(!DoBurstStage())
+            {
+                next = TimerService::Sec(RunStateRetrySeconds);
+                LOG_ERROR_STREAM("BackplateComms: Burst stage failed.");
+                runstate_ = 0;
+            }
+            else
+            {
+                LOG_INFO_STREAM("BackplateComms: Burst stage success.");
+                runstate_ ++;
+            }
+            break;
+        case 2:
+            if(!DoInfoGathering())
+            {
+                next = TimerService::Sec(RunStateRetrySeconds);
+                LOG_ERROR_STREAM("BackplateComms: Info gathering failed.");
+                runstate_ = 0;
+            }
+            else
+            {
+                LOG_INFO_STREAM("BackplateComms: Info gathering success.");
+                runstate_ ++;
+            }
+            break;
+        default:
+            LOG_INFO_STREAM("BackplateComms: Transition to normal comms.");
+            runstate_ = 99;
+            handshakeComplete.store(true);
+    }
+
+    if(runstate_ < 99)
+        timers.ScheduleAfter(next, [this]() { StepRunState(); });
+}
+
 bool BackplateComms::InitializeSerial()
 {
     const BaudRate baudRate = BaudRate::Baud115200;
@@ -288,18 +361,18 @@ bool BackplateComms::GetInfo(MessageType command, MessageType expectedResponse)
 
 void BackplateComms::TaskBodyComms ()
 {
+    TRACE_SCOPE("BackplateComms::TaskBodyComms");
 
-    if (IsTimeForKeepalive())
-    {
-        CommandMessage keepAliveMsg(MessageType::PeriodicStatusRequest);
-        SerialPort->Write(keepAliveMsg.GetRawMessage());
-    }
+    if (keepAliveTimer == 0)
+        StartPeriodicRequests();
+    timers.RunExpired();
+    ReadSerial();
+}
 
-    if (IsTimeForHistoricalDataRequest())
-    {
-        CommandMessage historicalDataMsg(MessageType::GetHistoricalDataBuffers);
-        SerialPort->Write(historicalDataMsg.GetRawMessage());
-    }
+void BackplateComms::ReadSerial()
+{
+    static MetricCounter &sensorSuppressed = Metrics::Instance().Counter(
+        "backplate_sensor_frames_suppressed_total", "Sensor frames whose filtered values stayed inside the deadband");
 
     // Read available data and attempt to parse ResponseMessage packets
     uint8_t readBuffer[256];
@@ -310,6 +383,7 @@ void BackplateComms::TaskBodyComms ()
         // nothing to do
         return;
     }
+    lastReadNs_ = timers.Now();
 
     auto msgs = parser.Feed(readBuffer, bytesRead);
     for (auto &resp : msgs)
@@ -324,23 +398,41 @@ void BackplateComms::TaskBodyComms ()
                     int16_t temp_cc = (resp.GetPayload()[1] << 8) | resp.GetPayload()[0];
                     uint16_t hum_pm = (resp.GetPayload()[3] << 8) | resp.GetPayload()[2];
                     LOG_DEBUG_STREAM("temp_cc=" << temp_cc << " hum_pm=" << hum_pm);
+
+                    // Filtered in raw units; floats only for values that get published
+                    uint64_t now = timers.Now();
+                    bool tempChanged = temperatureGate_.Pass(temperatureFilter_.Add(temp_cc), now);
+                    bool humChanged = humidityGate_.Pass(humidityFilter_.Add(hum_pm), now);
+                    if (!tempChanged && !humChanged)
+                        sensorSuppressed.Add();
+
+                    timeval receivedTime = {0, 0};
+                    DateTimeProvider->gettimeofday(receivedTime);
                     {
                         std::lock_guard<std::mutex> lk(this->dataMutex);
-                        CurrentTemperatureC = static_cast<double>(temp_cc) / 100.0;
-                        CurrentHumidityPercent = static_cast<double>(hum_pm) / 10.0;
-                        LOG_INFO("BackplateComms: TempHumidityData: Temperature = %.2f C, Humidity = %.2f %%", CurrentTemperatureC, CurrentHumidityPercent);
+                        if (tempChanged)
+                            CurrentTemperatureC = static_cast<float>(temperatureGate_.Last()) / 100.0f;
+                        if (humChanged)
+                            CurrentHumidityPercent = static_cast<float>(humidityGate_.Last()) / 10.0f;
+                        Snapshot.temperatureC = CurrentTemperatureC;
+                        Snapshot.humidityPercent = CurrentHumidityPercent;
+                        Snapshot.time = receivedTime.tv_sec;
                     }
+                    sensorDataReceived.store(true);
+                    if (tempChanged || humChanged)
+                        LOG_INFO("BackplateComms: TempHumidityData: Temperature = %.2f C, Humidity = %.2f %%", CurrentTemperatureC, CurrentHumidityPercent);
 
                     for (auto &cb : this->tempCallbacks)
                     {
-                        if (cb)
+                        if (cb && tempChanged)
                             cb(CurrentTemperatureC);
                     }
                 }
                 break;
 
             case MessageType::PirDataRaw:
-                LOG_INFO_STREAM("BackplateComms: Received PIR data (raw) size=" << resp.GetPayload().size());
+                LOG_TRACE_STREAM("BackplateComms: Received PIR data (raw) size=" << resp.GetPayload().size());
+                pir_.Push(resp.GetPayload().data(), resp.GetPayload().size(), lastReadNs_);
                 break;
 
             case MessageType::AmbientLightSensor:
@@ -395,12 +487,17 @@ void BackplateComms::TaskBodyComms ()
                 }
                 break;
 
+            case MessageType::FetControl:
+                OnFetEcho(resp.GetPayload());
+                break;
+
             case MessageType::RawAdcData:
                 if (resp.GetPayload().size() >= 14) {
                     uint16_t pir_raw = (resp.GetPayload()[1] << 8) | resp.GetPayload()[0];
                     uint16_t alir_raw = (resp.GetPayload()[11] << 8) | resp.GetPayload()[10];
                     uint16_t alvis_raw = (resp.GetPayload()[13] << 8) | resp.GetPayload()[12];
-                    LOG_INFO("Sensor ADC -> PIR: %u, AL_IR: %u, AL_VIS: %u", pir_raw, alir_raw, alvis_raw);
+                    LOG_TRACE("Sensor ADC -> PIR: %u, AL_IR: %u, AL_VIS: %u", pir_raw, alir_raw, alvis_raw);
+                    pir_.Push(pir_raw, lastReadNs_);
                 }
                 break;
 
@@ -421,33 +518,88 @@ void BackplateComms::TaskBodyComms ()
 
 }
 
-bool BackplateComms::IsTimeForKeepalive()
+// Both requests go out on the first pass, then every interval
+void BackplateComms::StartPeriodicRequests()
 {
-    struct timeval currentTime;
-    DateTimeProvider->gettimeofday(currentTime);
+    keepAliveTimer = timers.ScheduleEvery(TimerService::Sec(KeepAliveIntervalSeconds), [this]() {
+        CommandMessage keepAliveMsg(MessageType::PeriodicStatusRequest);
+        SerialPort->Write(keepAliveMsg.GetRawMessage());
+    }, 0);
+
+    historicalDataTimer = timers.ScheduleEvery(TimerService::Sec(HistoricalDataIntervalSeconds), [this]() {
+        CommandMessage historicalDataMsg(MessageType::GetHistoricalDataBuffers);
+        SerialPort->Write(historicalDataMsg.GetRawMessage());
+    }, 0);
+}
+
+TimerService::TimerId BackplateComms::AddCommsTask(uint64_t interval_ns, TimerService::Callback callback)
+{
+    return timers.ScheduleEvery(interval_ns, std::move(callback));
+}
 
-    long elapsedSecs = (currentTime.tv_sec - LastKeepAliveTime.tv_sec);
+void BackplateComms::SendFetControl(uint8_t fetMask)
+{
+    fetPendingMask_ = fetMask;
+    fetAttempts_ = 0;
+    WriteFetControl();
+}
+
+void BackplateComms::WriteFetControl()
+{
+    static MetricCounter &commands = Metrics::Instance().Counter(
+        "backplate_fet_commands_total", "FetControl frames written, resends included");
+
+    CommandMessage fetMsg(MessageType::FetControl);
+    fetMsg.SetPayload(std::vector<uint8_t>{ fetPendingMask_ });
+    SerialPort->Write(fetMsg.GetRawMessage());
+    commands.Add();
+
+    fetAckPending_ = true;
+    fetAttempts_++;
+    fetSentNs_ = timers.Now();
+    if (fetAckTimer_ != 0)
+        timers.Cancel(fetAckTimer_);
+    fetAckTimer_ = timers.ScheduleAfter(TimerService::Ms(FetAckTimeoutMs), [this]() { OnFetAckTimeout(); });
+}
 
-    if (elapsedSecs >= KeepAliveIntervalSeconds
-    || LastKeepAliveTime.tv_sec == 0)
+void BackplateComms::OnFetAckTimeout()
+{
+    static MetricCounter &timeouts = Metrics::Instance().Counter(
+        "backplate_fet_ack_timeouts_total", "FetControl frames the backplate did not echo in time");
+
+    fetAckTimer_ = 0;
+    if (!fetAckPending_)
+        return;
+    timeouts.Add();
+    if (fetAttempts_ < FetMaxAttempts)
     {
-        LastKeepAliveTime = currentTime;
-        return true;
+        LOG_WARN_STREAM("BackplateComms: no FetControl echo, resending 0x" << std::hex << static_cast<int>(fetPendingMask_));
+        WriteFetControl();
+        return;
     }
-    return false;
+    fetAckPending_ = false;
+    LOG_ERROR_STREAM("BackplateComms: FetControl 0x" << std::hex << static_cast<int>(fetPendingMask_)
+        << " not acknowledged after " << std::dec << fetAttempts_ << " attempts");
 }
 
-bool BackplateComms::IsTimeForHistoricalDataRequest()
+// The backplate answers FetControl with the same command and the mask it applied
+void BackplateComms::OnFetEcho(const std::vector<uint8_t> &payload)
 {
-    struct timeval currentTime;
-    DateTimeProvider->gettimeofday(currentTime);
+    static MetricHistogram &ackUs = Metrics::Instance().Histogram(
+        "backplate_fet_ack_us", "From writing FetControl to the backplate echoing it");
 
-    long elapsedSecs = (currentTime.tv_sec - LastHistoricalDataRequestTime.tv_sec);
-    if (elapsedSecs >= HistoricalDataIntervalSeconds
-    || LastHistoricalDataRequestTime.tv_sec == 0)
+    if (payload.empty())
+        return;
+    if (!fetAckPending_ || payload[0] != fetPendingMask_)
     {
-        LastHistoricalDataRequestTime = currentTime;
-        return true;
+        LOG_DEBUG_STREAM("BackplateComms: stale FetControl echo 0x" << std::hex << static_cast<int>(payload[0]));
+        return;
     }
-    return false;
-}
\ No newline at end of file
+    fetAckPending_ = false;
+    if (fetAckTimer_ != 0)
+        timers.Cancel(fetAckTimer_);
+    fetAckTimer_ = 0;
+    ackUs.Record((timers.Now() - fetSentNs_) / 1000);
+    ackedFetMask_.store(payload[0]);
+    LOG_DEBUG_STREAM("BackplateComms: FET outputs 0x" << std::hex << static_cast<int>(payload[0]) << " acknowledged");
+}
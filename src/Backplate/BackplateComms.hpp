@@ -12,7 +12,12 @@
 #include "MessageType.hxx"
 #include "../IDateTimeProvider.hpp"
 #include "MessageParser.hpp"
+#include "SensorFilter.hpp"
+#include "PirProcessor.hpp"
 #include "ISerialPort.hpp"
+#include "../TimerService.hpp"
+
+class Reactor;
 
 class BackplateComms {
 public:
@@ -23,16 +28,23 @@ public:
     virtual ~BackplateComms();
 
     bool Initialize();
+    // Reactor mode: the worker thread only runs the handshake, then the reactor's
+    // thread takes over the serial fd and the periodic requests
+    bool Initialize(Reactor &reactor);
 
     // Multi-subscriber event subscriptions using std::function
     using TemperatureCallback = std::function<void(float temperatureC)>;
     using PIRCallback = std::function<void(int value)>;
     using GenericEventCallback = std::function<void(uint16_t messageType, const uint8_t* payload, size_t length)>;
+    using OccupancyCallback = PirProcessor::OccupancyCallback;
 
-    // Add a subscriber; returns an index token (size_t) that can be used with Clear*Callbacks
+    // Add a subscriber; returns an index token (size_t) that can be used with Clear*Callbacks.
+    // Temperature subscribers hear of the filtered value when it moves past the deadband.
     size_t AddTemperatureCallback(TemperatureCallback cb) { tempCallbacks.push_back(std::move(cb)); return tempCallbacks.size()-1; }
     size_t AddPIRCallback(PIRCallback cb) { pirCallbacks.push_back(std::move(cb)); return pirCallbacks.size()-1; }
     size_t AddGenericEventCallback(GenericEventCallback cb) { genericCallbacks.push_back(std::move(cb)); return genericCallbacks.size()-1; }
+    // Occupancy from the raw PIR signal; called on the PIR thread when it changes. Add before Initialize().
+    size_t AddOccupancyCallback(OccupancyCallback cb) { return pir_.AddOccupancyCallback(std::move(cb)); }
 
     // Clear all subscribers for a type
     void ClearTemperatureCallbacks() { tempCallbacks.clear(); }
@@ -42,43 +54,119 @@ public:
     float GetCurrentTemperatureC() const { std::lock_guard<std::mutex> lk(dataMutex); return CurrentTemperatureC; }
     float GetCurrentHumidityPercent() const { std::lock_guard<std::mutex> lk(dataMutex); return CurrentHumidityPercent; }
 
+    // Filtered sensor values as last published, and when the latest frame arrived;
+    // time is 0 until the first frame
+    struct SensorSnapshot
+    {
+        float temperatureC = 0.0f;
+        float humidityPercent = 0.0f;
+        time_t time = 0;
+    };
+    SensorSnapshot GetSensorSnapshot() const { std::lock_guard<std::mutex> lk(dataMutex); return Snapshot; }
+    Occupancy GetOccupancy() const { return pir_.GetOccupancy(); }
+
+    // Smoothing and deadbands for temperature and humidity. Call before Initialize().
+    void SetSensorFilters(const SensorsConfig &config);
+
+    // Sets the FET outputs, a mask of Fet bits, and resends it until the backplate
+    // echoes it back; a newer mask replaces a pending one. Comms thread only: call
+    // it from a comms task or a callback of this object.
+    void SendFetControl(uint8_t fetMask);
+    // Mask the backplate last acknowledged, -1 before the first
+    int GetAckedFetMask() const { return ackedFetMask_.load(); }
+    // Whether a FetControl is still being resent; false once echoed or given up on. Comms thread only.
+    bool IsFetAckPending() const { return fetAckPending_; }
+
+    // Runs callback every interval_ns on the comms thread, between serial reads.
+    // Call before Initialize(), while no comms thread is running.
+    TimerService::TimerId AddCommsTask(uint64_t interval_ns, TimerService::Callback callback);
+    // Clock of the comms thread's timers
+    uint64_t CommsNowNs() const { return timers.Now(); }
+    // When the bytes being dispatched were read, for timing a callback against its frame
+    uint64_t LastReadNs() const { return lastReadNs_; }
+
+    // 0..2 while connecting, 99 once in normal comms
+    int GetRunState() const { return runstate_.load(); }
+
+    // Readiness for the boot splash: handshake finished and first sensor frame received
+    bool IsHandshakeComplete() const { return handshakeComplete.load(); }
+    bool IsSensorDataReceived() const { return sensorDataReceived.load(); }
+    bool IsReady() const { return IsHandshakeComplete() && IsSensorDataReceived(); }
+
 protected:
     bool InitializeSerial();
     bool DoBurstStage();
     bool DoInfoGathering();
     bool GetInfo(MessageType command, MessageType expectedResponse);
     void TaskBodyRunningState();
+    void StepRunState();
     void TaskBodyComms();
-
-    bool IsTimeForKeepalive();
-    bool IsTimeForHistoricalDataRequest();
+    void ReadSerial();
+    void HandOverToReactor();
+    void StartPeriodicRequests();
+    void WriteFetControl();
+    void OnFetAckTimeout();
+    void OnFetEcho(const std::vector<uint8_t> &payload);
 
     bool IsTimeout(timeval &startTime, int timeoutUs);
 
     // Background worker thread that runs TaskBodyComms periodically
     std::thread workerThread;
     std::atomic<bool> running;
+    std::atomic<bool> handshakeComplete;
+    std::atomic<bool> sensorDataReceived;
 
     float CurrentTemperatureC = 0.0f;
     float CurrentHumidityPercent = 0.0f;
+    SensorSnapshot Snapshot;
     mutable std::mutex dataMutex;
 
+    // Owned by the worker thread, or by the reactor's thread after the handover;
+    // runs the handshake stages and the periodic requests
+    TimerService timers;
+    TimerService::TimerId keepAliveTimer = 0;
+    TimerService::TimerId historicalDataTimer = 0;
+
 private:
     const int KeepAliveIntervalSeconds = 15;
     const int HistoricalDataIntervalSeconds = 60;
     const int BurstTimeoutUs = 5000000;
     const int GetInfoTimeoutUs = 200000;
+    const int RunStateStepMs = 10;
+    const int RunStateRetrySeconds = 30;
+    const int FetAckTimeoutMs = 250;
+    const int FetMaxAttempts = 4;
 
     ISerialPort* SerialPort;
     IDateTimeProvider* DateTimeProvider;
-    timeval LastKeepAliveTime;
-    timeval LastHistoricalDataRequestTime;
     // callback lists
     std::vector<TemperatureCallback> tempCallbacks;
     std::vector<PIRCallback> pirCallbacks;
     std::vector<GenericEventCallback> genericCallbacks;
     // Parser for incoming serial bytes
     MessageParser parser;
-
-    int runstate_ = 0;
+    // Sensor values in raw units, centi-degrees and per-mille; comms thread only
+    SensorFilter temperatureFilter_;
+    SensorFilter humidityFilter_;
+    DeadbandGate temperatureGate_;
+    DeadbandGate humidityGate_;
+    // Raw PIR samples go to its thread
+    PirProcessor pir_;
+
+    Reactor *reactor_ = nullptr;
+    // Signalled by the worker once the handshake is done; -1 outside reactor mode
+    int handoverEvent_ = -1;
+    int reactorSerialFd_ = -1;
+
+    // FetControl waiting for its echo; comms thread only
+    uint8_t fetPendingMask_ = 0;
+    bool fetAckPending_ = false;
+    int fetAttempts_ = 0;
+    uint64_t fetSentNs_ = 0;
+    TimerService::TimerId fetAckTimer_ = 0;
+    uint64_t lastReadNs_ = 0;
+
+    // Read from other threads for health reporting
+    std::atomic<int> runstate_{0};
+    std::atomic<int> ackedFetMask_{-1};
 };
@@ -17,6 +17,8 @@ public:
     virtual int Write(const std::vector<uint8_t> &data) = 0;
     virtual int SendBreak(int durationMs) = 0;
     virtual int Flush() = 0;
+    // Descriptor an event loop can wait on while the port is open; -1 when there is none
+    virtual int GetFd() const { return -1; }
 
 private:
     std::string portName;
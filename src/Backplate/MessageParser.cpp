@@ -1,8 +1,15 @@
 #include "MessageParser.hpp"
-#include <algorithm>
+#include "../Metrics.hpp"
+#include "trace.h"
 #include <cstring>
 
 const uint8_t MessageParser::PREAMBLE[4] = {0xd5, 0xd5, 0xaa, 0x96};
+// KMP failure function of PREAMBLE: after a mismatch at i, how many matched bytes still count
+const uint8_t MessageParser::PREAMBLE_FALLBACK[4] = {0, 1, 0, 0};
+
+const size_t MessageParser::MaxPayloadLength;
+const size_t MessageParser::HeaderLength;
+const size_t MessageParser::MaxFrameLength;
 
 MessageParser::MessageParser()
 {
@@ -10,75 +17,101 @@ MessageParser::MessageParser()
 
 std::vector<ResponseMessage> MessageParser::Feed(const uint8_t* data, size_t len)
 {
+    TRACE_SCOPE("MessageParser::Feed");
+    static MetricCounter &frames_parsed = Metrics::Instance().Counter(
+        "backplate_frames_parsed_total", "Backplate frames with a valid CRC");
+    static MetricCounter &frame_errors = Metrics::Instance().Counter(
+        "backplate_frame_errors_total", "Backplate frames dropped for a bad CRC or length");
+    static MetricCounter &bytes_discarded = Metrics::Instance().Counter(
+        "backplate_bytes_discarded_total", "Backplate bytes skipped while looking for a frame");
+
     std::vector<ResponseMessage> parsed;
 
     if (data != nullptr && len > 0) {
         buffer_.insert(buffer_.end(), data, data + len);
     }
 
-    // Search loop: try to find and extract as many complete messages as possible
     while (true) {
-        // Find start of preamble
-        auto it = std::search(buffer_.begin(), buffer_.end(), PREAMBLE, PREAMBLE + 4);
-        if (it == buffer_.end()) {
-            // No preamble found. Keep up to 3 last bytes in case partial preamble
-            if (buffer_.size() > 3) {
-                std::vector<uint8_t> tail(buffer_.end() - 3, buffer_.end());
-                buffer_.swap(tail);
-            }
-            break;
-        }
-
-        size_t idx = static_cast<size_t>(std::distance(buffer_.begin(), it));
-
-        // If there's leading junk before the preamble, drop it
-        if (idx > 0) {
-            buffer_.erase(buffer_.begin(), buffer_.begin() + idx);
-            // reset iterator to start
-            it = buffer_.begin();
-            idx = 0;
+        if (!inFrame_) {
+            size_t before = head_;
+            bool found = FindPreamble();
+            // Junk is dropped; only a partial preamble at the end is kept
+            head_ = found ? scan_ - 4 : scan_ - match_;
+            bytes_discarded.Add(head_ - before);
+            if (!found)
+                break;
+            inFrame_ = true;
+            match_ = 0;
         }
 
         // Need minimum bytes for header: preamble(4) + cmd(2) + len(2) + crc(2)
-        const size_t minHeader = 4 + 2 + 2 + 2;
-        if (buffer_.size() < minHeader) {
+        size_t available = buffer_.size() - head_;
+        if (available < HeaderLength + 2) {
             // wait for more data
             break;
         }
 
         // Extract payload length (little endian): at positions 6 and 7 (0-based)
-        uint16_t payloadLen = static_cast<uint16_t>(buffer_[4 + 2]) |
-                              (static_cast<uint16_t>(buffer_[4 + 3]) << 8);
-
-        size_t totalMsgLen = 4 + 2 + 2 + payloadLen + 2; // preamble + cmd + len + payload + crc
+        size_t payloadLen = static_cast<size_t>(buffer_[head_ + 6]) |
+                            (static_cast<size_t>(buffer_[head_ + 7]) << 8);
+        size_t totalMsgLen = HeaderLength + payloadLen + 2;
 
-        if (payloadLen > 65535) {
-            // invalid length -> drop the preamble byte and continue
-            buffer_.erase(buffer_.begin());
-            continue;
-        }
+        bool ok = false;
+        if (payloadLen <= MaxPayloadLength) {
+            if (available < totalMsgLen) {
+                // Wait for full message
+                break;
+            }
 
-        if (buffer_.size() < totalMsgLen) {
-            // Wait for full message
-            break;
+            ResponseMessage msg;
+            ok = msg.ParseMessage(buffer_.data() + head_, totalMsgLen);
+            if (ok) {
+                frames_parsed.Add();
+                parsed.push_back(msg);
+                head_ += totalMsgLen;
+                scan_ = head_;
+            }
         }
 
-        // We have a complete candidate message
-        ResponseMessage msg;
-        bool ok = msg.ParseMessage(buffer_.data(), totalMsgLen);
-        if (ok) {
-            parsed.push_back(msg);
-            // Erase the consumed bytes
-            buffer_.erase(buffer_.begin(), buffer_.begin() + totalMsgLen);
-            // Continue to parse next messages
-            continue;
-        } else {
-            // Parsing failed (likely CRC or malformed). Reset parser to initial
-            // behaviour by discarding the first byte and continue searching
-            buffer_.erase(buffer_.begin());
-            continue;
+        if (!ok) {
+            // Bad CRC or impossible length. The preamble has no proper prefix that is also
+            // a suffix, so no frame can start inside it: resume the search right after it.
+            frame_errors.Add();
+            bytes_discarded.Add(4);
+            head_ += 4;
+            scan_ = head_;
         }
+        inFrame_ = false;
     }
 
+    Compact();
     return parsed;
 }
+
+bool MessageParser::FindPreamble()
+{
+    const size_t size = buffer_.size();
+    while (scan_ < size) {
+        uint8_t byte = buffer_[scan_++];
+        while (match_ > 0 && byte != PREAMBLE[match_])
+            match_ = PREAMBLE_FALLBACK[match_ - 1];
+        if (byte == PREAMBLE[match_] && ++match_ == sizeof(PREAMBLE))
+            return true;
+    }
+    return false;
+}
+
+// Drops consumed bytes once they are at least half the buffer, so the copying
+// stays proportional to the bytes fed
+void MessageParser::Compact()
+{
+    if (head_ == buffer_.size()) {
+        buffer_.clear();
+    } else if (head_ == 0 || head_ < buffer_.size() / 2) {
+        return;
+    } else {
+        buffer_.erase(buffer_.begin(), buffer_.begin() + head_);
+    }
+    scan_ -= head_;
+    head_ = 0;
+}
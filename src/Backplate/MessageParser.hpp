@@ -2,8 +2,20 @@
 
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 #include "ResponseMessage.hpp"
 
+/**
+ * Splits the backplate byte stream into frames:
+ * preamble(4) + cmd(2) + len(2) + payload(len) + crc(2).
+ *
+ * The preamble is matched incrementally, so each byte is looked at once while
+ * hunting for a frame and a chunk split inside a preamble still matches. A
+ * frame that fails its CRC or announces more than MaxPayloadLength bytes is
+ * skipped past its preamble and the search carries on from there; nothing is
+ * rescanned from the start of the buffer. Between calls the parser keeps at
+ * most one partial frame.
+ */
 class MessageParser {
 public:
     MessageParser();
@@ -12,7 +24,24 @@ public:
     // from the input (can be zero, one or more).
     std::vector<ResponseMessage> Feed(const uint8_t* data, size_t len);
 
+    // Bytes held back for an incomplete frame or preamble
+    inline size_t Buffered() const { return buffer_.size() - head_; }
+
+    // Largest payload the backplate sends; a longer length field is noise
+    static const size_t MaxPayloadLength = 1024;
+    static const size_t HeaderLength = 4 + 2 + 2;
+    static const size_t MaxFrameLength = HeaderLength + MaxPayloadLength + 2;
+
 private:
+    // Finds the next preamble at or after scan_; false when the buffer runs out first
+    bool FindPreamble();
+    void Compact();
+
     std::vector<uint8_t> buffer_;
+    size_t head_ = 0;        // first byte still needed
+    size_t scan_ = 0;        // next byte for the preamble matcher
+    size_t match_ = 0;       // preamble bytes matched just before scan_
+    bool inFrame_ = false;   // head_ is at a preamble
     static const uint8_t PREAMBLE[4];
+    static const uint8_t PREAMBLE_FALLBACK[4];
 };
@@ -0,0 +1,155 @@
+#include "PirDetector.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PIR_DETECTOR_NEON 1
+#endif
+
+const int16_t PirDetector::Coefficients[Taps] = {
+    -114, -159, -139, 291, 1450, 3284, 5246, 6525, 6525, 5246, 3284, 1450, 291, -139, -159, -114
+};
+const size_t PirDetector::BlockSize;
+const uint64_t PirDetector::DefaultHoldNs;
+
+namespace {
+
+inline int16_t Saturate(int32_t value)
+{
+    return static_cast<int16_t>(std::min<int32_t>(32767, std::max<int32_t>(-32768, value)));
+}
+
+} // namespace
+
+PirDetector::PirDetector(uint64_t holdNs)
+    : holdNs_(holdNs)
+{
+    window_.fill(0);
+    filtered_.fill(0);
+}
+
+void PirDetector::LowPassScalar(const int16_t *x, int16_t *y, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        int32_t sum = 0;
+        for (int k = 0; k < Taps; ++k)
+            sum += static_cast<int32_t>(Coefficients[k]) * x[i + k];
+        // rounded and saturated as vqrshrn does
+        y[i] = Saturate((sum + (1 << 14)) >> 15);
+    }
+}
+
+void PirDetector::LowPass(const int16_t *x, int16_t *y, size_t n)
+{
+#ifdef PIR_DETECTOR_NEON
+    // 4 outputs per iteration: one widening multiply-accumulate per tap
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        int32x4_t sum = vdupq_n_s32(0);
+        for (int k = 0; k < Taps; ++k)
+            sum = vmlal_n_s16(sum, vld1_s16(x + i + k), Coefficients[k]);
+        vst1_s16(y + i, vqrshrn_n_s32(sum, 15));
+    }
+    LowPassScalar(x + i, y + i, n - i);
+#else
+    LowPassScalar(x, y, n);
+#endif
+}
+
+bool PirDetector::HasNeon()
+{
+#ifdef PIR_DETECTOR_NEON
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool PirDetector::Add(const PirSample *samples, size_t count)
+{
+    bool wasOccupied = state_.occupied;
+    int16_t *block = window_.data() + Taps - 1;
+    while (count > 0)
+    {
+        size_t n = std::min(count, BlockSize);
+        for (size_t i = 0; i < n; ++i)
+            block[i] = RemoveDc(samples[i].value);
+        LowPass(window_.data(), filtered_.data(), n);
+        for (size_t i = 0; i < n; ++i)
+            Detect(filtered_[i], samples[i].ns);
+
+        // The last Taps - 1 inputs are the next block's history
+        std::copy(block + n - (Taps - 1), block + n, window_.begin());
+        samples += n;
+        count -= n;
+    }
+    return state_.occupied != wasOccupied;
+}
+
+int16_t PirDetector::RemoveDc(uint16_t value)
+{
+    int32_t sample = static_cast<int32_t>(value) << FractionBits;
+    if (!dcReady_)
+    {
+        dc_ = sample;
+        dcReady_ = true;
+    }
+    else
+        dc_ += (sample - dc_) >> DcShift;
+    return Saturate((sample - dc_) >> FractionBits);
+}
+
+void PirDetector::Detect(int16_t filtered, uint64_t ns)
+{
+    int32_t magnitude = std::abs(static_cast<int32_t>(filtered)) << FractionBits;
+    envelope_ += (magnitude - envelope_) >> EnvelopeShift;
+    if (warmup_ < WarmupSamples)
+    {
+        warmup_++;
+        floor_ += (envelope_ - floor_) >> 3;
+        return;
+    }
+
+    int64_t threshold = std::max<int64_t>(static_cast<int64_t>(floor_) * ThresholdRatio,
+        static_cast<int64_t>(MinThreshold) << FractionBits);
+    if (envelope_ <= threshold)
+    {
+        // Motion would lift the threshold out of its own reach
+        floor_ += (envelope_ - floor_) >> FloorShift;
+        if (!Expire(ns) && !state_.occupied)
+            state_.confidence = static_cast<int>(std::max<int64_t>(0, 100 - 100 * envelope_ / threshold));
+        return;
+    }
+
+    // Half sure at the threshold, sure at twice it
+    motionConfidence_ = static_cast<int>(std::min<int64_t>(100, 50 + 50 * (envelope_ - threshold) / threshold));
+    state_.lastMotionNs = ns;
+    state_.confidence = motionConfidence_;
+    if (!state_.occupied)
+    {
+        state_.occupied = true;
+        state_.sinceNs = ns;
+    }
+}
+
+bool PirDetector::Expire(uint64_t nowNs)
+{
+    if (!state_.occupied)
+        return false;
+
+    uint64_t quietNs = nowNs > state_.lastMotionNs ? nowNs - state_.lastMotionNs : 0;
+    if (quietNs < holdNs_)
+    {
+        // Less sure the longer it has been still
+        state_.confidence = static_cast<int>(motionConfidence_ * (holdNs_ - quietNs) / holdNs_);
+        return false;
+    }
+    state_.occupied = false;
+    state_.sinceNs = nowNs;
+    state_.confidence = 50;
+    return true;
+}
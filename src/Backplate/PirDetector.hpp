@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+// One raw PIR ADC reading and when the frame carrying it was read
+struct PirSample
+{
+    uint64_t ns;
+    uint16_t value;
+};
+
+// Whether someone is in front of the thermostat. confidence is 0..100 in the
+// current state; sinceNs is when it last changed.
+struct Occupancy
+{
+    bool occupied = false;
+    int confidence = 0;
+    uint64_t sinceNs = 0;
+    uint64_t lastMotionNs = 0;
+};
+
+/**
+ * @brief Motion detection over the raw PIR signal, in integer arithmetic
+ *
+ * Each sample has its slow DC level removed, then goes through a 16-tap
+ * low-pass FIR; together the two make a band-pass that keeps the swings a
+ * person walking past causes and drops drift and ADC noise. The rectified
+ * output is smoothed into an envelope and compared against a threshold that
+ * follows the noise floor, so the detector adapts to the sensor and the room.
+ * The space counts as occupied from the first motion until HoldNs pass
+ * without any.
+ *
+ * The FIR runs a block at a time and uses NEON when the target is built with
+ * -mfpu=neon. Not thread safe; PirProcessor runs it on its own thread.
+ */
+class PirDetector
+{
+public:
+    explicit PirDetector(uint64_t holdNs = DefaultHoldNs);
+
+    // True if the samples changed the occupied state
+    bool Add(const PirSample *samples, size_t count);
+    // Ends the occupancy once HoldNs have passed without motion, for when no
+    // samples arrive; true if that changed the state
+    bool Expire(uint64_t nowNs);
+    inline const Occupancy &State() const { return state_; }
+
+    // y[i] = sum of Coefficients[k] * x[i + k], for n outputs from n + Taps - 1 inputs
+    static void LowPass(const int16_t *x, int16_t *y, size_t n);
+    // Scalar reference implementation, always available (used for the block tails)
+    static void LowPassScalar(const int16_t *x, int16_t *y, size_t n);
+    // True when the NEON FIR was compiled in
+    static bool HasNeon();
+
+    static const int Taps = 16;
+    // Q15, cut off at a tenth of the sample rate
+    static const int16_t Coefficients[Taps];
+    static const size_t BlockSize = 64;
+    static const uint64_t DefaultHoldNs = 30000000000ull;
+
+    // DC tracks the input over about 64 samples, the envelope over 8 and the noise floor over 1024
+    static const int DcShift = 6;
+    static const int EnvelopeShift = 3;
+    static const int FloorShift = 10;
+    // Motion is an envelope this many times the noise floor, and at least MinThreshold ADC counts
+    static const int ThresholdRatio = 4;
+    static const int MinThreshold = 8;
+    // Samples that only train the noise floor
+    static const int WarmupSamples = 64;
+
+private:
+    int16_t RemoveDc(uint16_t value);
+    void Detect(int16_t filtered, uint64_t ns);
+
+    uint64_t holdNs_;
+    Occupancy state_;
+
+    // Fraction bits of the DC level, envelope and noise floor
+    static const int FractionBits = 8;
+    bool dcReady_ = false;
+    int32_t dc_ = 0;
+    int32_t envelope_ = 0;
+    int32_t floor_ = 0;
+    int warmup_ = 0;
+    int motionConfidence_ = 0;
+
+    // Taps - 1 samples of history, then the block being filtered
+    std::array<int16_t, Taps - 1 + BlockSize> window_;
+    std::array<int16_t, BlockSize> filtered_;
+};
@@ -0,0 +1,142 @@
+#define CUCKOO_LOG_MODULE "backplate"
+
+#include "PirProcessor.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "logger.h"
+#include "trace.h"
+#include "../Metrics.hpp"
+
+const uint32_t PirProcessor::RingSize;
+const int PirProcessor::FlushMs;
+const int PirProcessor::ExpireCheckMs;
+
+PirProcessor::PirProcessor(Clock clock, uint64_t holdNs)
+    : clock_(clock)
+    , detector_(holdNs)
+{
+}
+
+PirProcessor::~PirProcessor()
+{
+    Stop();
+}
+
+bool PirProcessor::Start()
+{
+    if (thread_.joinable())
+        return true;
+    stopping_ = false;
+    thread_ = std::thread([this]() { WorkerLoop(); });
+    return true;
+}
+
+void PirProcessor::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    if (thread_.joinable())
+        thread_.join();
+}
+
+void PirProcessor::Push(uint16_t sample, uint64_t ns)
+{
+    static MetricCounter &dropped = Metrics::Instance().Counter(
+        "pir_samples_dropped_total", "Raw PIR samples dropped because the detector fell behind");
+
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    uint32_t pending = head - tail_.load(std::memory_order_acquire);
+    if (pending >= RingSize)
+    {
+        dropped.Add();
+        return;
+    }
+    ring_[head % RingSize] = PirSample{ ns, sample };
+    head_.store(head + 1, std::memory_order_release);
+
+    // Wake the worker for the first sample and for each full block; taking the
+    // lock means it cannot miss the wakeup between checking and waiting
+    if (pending == 0 || pending + 1 == PirDetector::BlockSize)
+    {
+        { std::lock_guard<std::mutex> lock(wakeMutex_); }
+        wake_.notify_one();
+    }
+}
+
+void PirProcessor::Push(const uint8_t *payload, size_t length, uint64_t ns)
+{
+    for (size_t i = 0; i + 1 < length; i += 2)
+        Push(static_cast<uint16_t>(payload[i] | (payload[i + 1] << 8)), ns);
+}
+
+void PirProcessor::Drain()
+{
+    static MetricHistogram &blockUs = Metrics::Instance().Histogram(
+        "pir_block_us", "Filtering one batch of raw PIR samples");
+
+    std::array<PirSample, PirDetector::BlockSize> batch;
+    bool changed = false;
+    bool any = false;
+    uint32_t pending;
+    while ((pending = Pending()) > 0)
+    {
+        MetricTimer timer(blockUs);
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        size_t n = std::min<size_t>(pending, batch.size());
+        for (size_t i = 0; i < n; ++i)
+            batch[i] = ring_[(tail + i) % RingSize];
+        tail_.store(tail + static_cast<uint32_t>(n), std::memory_order_release);
+
+        TRACE_SCOPE("pir_block");
+        changed = detector_.Add(batch.data(), n) || changed;
+        any = true;
+    }
+    if (!any)
+        changed = detector_.Expire(clock_());
+
+    Occupancy occupancy = detector_.State();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        occupancy_ = occupancy;
+    }
+    if (!changed)
+        return;
+
+    LOG_DEBUG_STREAM("PirProcessor: " << (occupancy.occupied ? "occupied" : "vacant")
+        << ", confidence " << occupancy.confidence);
+    for (auto &cb : callbacks_)
+    {
+        if (cb)
+            cb(occupancy);
+    }
+}
+
+void PirProcessor::WorkerLoop()
+{
+    TRACE_THREAD_NAME("pir");
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    while (!stopping_)
+    {
+        auto hasSamples = [this]() { return stopping_ || Pending() > 0; };
+        if (detector_.State().occupied)
+            wake_.wait_for(lock, std::chrono::milliseconds(ExpireCheckMs), hasSamples);
+        else
+            wake_.wait(lock, hasSamples);
+
+        // Give a block the chance to fill before filtering
+        wake_.wait_for(lock, std::chrono::milliseconds(FlushMs), [this]() {
+            return stopping_ || Pending() == 0 || Pending() >= PirDetector::BlockSize;
+        });
+        if (stopping_)
+            return;
+
+        lock.unlock();
+        Drain();
+        lock.lock();
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "PirDetector.hpp"
+
+/**
+ * @brief Runs PirDetector on its own thread, fed from the comms thread
+ *
+ * Push() only copies the sample into a single-producer ring buffer, so the
+ * comms thread pays a few stores per sample; samples that find the ring full
+ * are dropped and counted. The worker wakes when the ring stops being empty,
+ * waits up to FlushMs for a block to collect, and filters what is there.
+ * While occupied it also wakes once a second to let the hold expire.
+ *
+ * Occupancy callbacks run on the worker thread, on each change of the
+ * occupied state. Add them before Start().
+ */
+class PirProcessor
+{
+public:
+    using Clock = std::function<uint64_t()>;
+    using OccupancyCallback = std::function<void(const Occupancy &occupancy)>;
+
+    explicit PirProcessor(Clock clock, uint64_t holdNs = PirDetector::DefaultHoldNs);
+    ~PirProcessor();
+
+    bool Start();
+    void Stop();
+
+    // Producer side; one thread only
+    void Push(uint16_t sample, uint64_t ns);
+    // A payload of little-endian 16-bit samples
+    void Push(const uint8_t *payload, size_t length, uint64_t ns);
+
+    // Filters every pushed sample and publishes a change; the worker's body,
+    // also callable directly while it is not running
+    void Drain();
+
+    size_t AddOccupancyCallback(OccupancyCallback cb) { callbacks_.push_back(std::move(cb)); return callbacks_.size() - 1; }
+    // Latest state, from any thread
+    Occupancy GetOccupancy() const { std::lock_guard<std::mutex> lock(stateMutex_); return occupancy_; }
+
+    static const uint32_t RingSize = 512;
+    static const int FlushMs = 100;
+    static const int ExpireCheckMs = 1000;
+
+private:
+    void WorkerLoop();
+    inline uint32_t Pending() const { return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire); }
+
+    Clock clock_;
+    PirDetector detector_;
+    std::vector<OccupancyCallback> callbacks_;
+
+    std::array<PirSample, RingSize> ring_;
+    std::atomic<uint32_t> head_{0};  // written by the producer
+    std::atomic<uint32_t> tail_{0};  // written by the consumer
+
+    std::thread thread_;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+
+    mutable std::mutex stateMutex_;
+    Occupancy occupancy_;
+};
@@ -0,0 +1,122 @@
+#include "SensorFilter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+const int SensorFilter::MaxWindow;
+
+namespace {
+
+const int64_t One = int64_t(1) << SensorFilter::FractionBits;
+
+// Fixed point to integer, rounding half away from zero
+inline int32_t Round(int64_t value)
+{
+    return static_cast<int32_t>(value >= 0 ? (value + One / 2) / One : -((-value + One / 2) / One));
+}
+
+// A standard deviation in config units as a fixed-point variance in raw units
+int64_t Variance(double deviation, int32_t scale)
+{
+    double raw = deviation * scale;
+    return static_cast<int64_t>(std::llround(raw * raw * One));
+}
+
+} // namespace
+
+// The conversions below run once per configuration, not per sample
+SensorFilter::SensorFilter(const SensorFilterConfig &config, int32_t scale)
+    : kind_(ParseKind(config.filter))
+    , alpha_(std::min(One, std::max<int64_t>(1, std::llround(config.alpha * One))))
+    , window_(std::min(MaxWindow, std::max(1, config.window | 1)))
+    , processVariance_(Variance(config.process_noise, scale))
+    , measurementVariance_(std::max<int64_t>(1, Variance(config.measurement_noise, scale)))
+{
+}
+
+SensorFilter::Kind SensorFilter::ParseKind(const std::string &name)
+{
+    if (name == "ema")
+        return Kind::Ema;
+    if (name == "median")
+        return Kind::Median;
+    if (name == "kalman")
+        return Kind::Kalman;
+    return Kind::None;
+}
+
+int32_t SensorFilter::Add(int32_t sample)
+{
+    switch (kind_)
+    {
+        case Kind::Ema:
+            if (count_ == 0)
+                state_ = sample * One;
+            else
+                state_ += (sample * One - state_) * alpha_ / One;
+            count_ = 1;
+            return Round(state_);
+
+        case Kind::Median:
+            return AddMedian(sample);
+
+        case Kind::Kalman:
+            return AddKalman(sample);
+
+        case Kind::None:
+        default:
+            return sample;
+    }
+}
+
+int32_t SensorFilter::AddMedian(int32_t sample)
+{
+    samples_[next_] = sample;
+    next_ = (next_ + 1) % window_;
+    if (count_ < window_)
+        count_++;
+    int n = count_;
+
+    // Insertion sort of at most MaxWindow values
+    std::array<int32_t, MaxWindow> sorted;
+    for (int i = 0; i < n; ++i)
+    {
+        int j = i;
+        for (; j > 0 && sorted[j - 1] > samples_[i]; --j)
+            sorted[j] = sorted[j - 1];
+        sorted[j] = samples_[i];
+    }
+    return sorted[n / 2];
+}
+
+int32_t SensorFilter::AddKalman(int32_t sample)
+{
+    if (count_ == 0)
+    {
+        state_ = sample * One;
+        variance_ = measurementVariance_;
+        count_ = 1;
+        return sample;
+    }
+
+    // Predict, then blend in the sample by the gain, which has 16 fraction bits
+    const int64_t unit = int64_t(1) << 16;
+    variance_ += processVariance_;
+    int64_t gain = variance_ * unit / (variance_ + measurementVariance_);
+    state_ += (sample * One - state_) * gain / unit;
+    variance_ = variance_ * (unit - gain) / unit;
+    return Round(state_);
+}
+
+bool DeadbandGate::Pass(int32_t value, uint64_t nowNs)
+{
+    int32_t change = value > last_ ? value - last_ : last_ - value;
+    bool due = refreshNs_ != 0 && nowNs - lastNs_ >= refreshNs_;
+    if (passed_ && change < std::max(deadband_, 1) && !due)
+        return false;
+
+    passed_ = true;
+    last_ = value;
+    lastNs_ = nowNs;
+    return true;
+}
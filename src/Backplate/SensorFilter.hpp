@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <stdint.h>
+
+#include "../ConfigModel.hpp"
+
+/**
+ * @brief Streaming smoothing of one backplate sensor in integer arithmetic
+ *
+ * Samples and results are in the sensor's raw units (centi-degrees,
+ * per-mille humidity) and the state is fixed point, so a frame costs no
+ * float math on the soft-float target. "ema" weights each sample by alpha;
+ * "median" takes the median of the last window samples, which drops single
+ * spikes; "kalman" is a scalar Kalman filter with constant process and
+ * measurement noise. The first sample passes through unchanged.
+ */
+class SensorFilter
+{
+public:
+    enum class Kind { None, Ema, Median, Kalman };
+
+    // Passes samples through
+    SensorFilter() {}
+    // scale is raw units per config unit, 100 for centi-degrees
+    SensorFilter(const SensorFilterConfig &config, int32_t scale);
+
+    // Kind::None for an unknown name
+    static Kind ParseKind(const std::string &name);
+
+    int32_t Add(int32_t sample);
+    void Reset() { count_ = 0; next_ = 0; }
+    inline Kind GetKind() const { return kind_; }
+
+    static const int MaxWindow = 9;
+    // Fraction bits of the ema and kalman state, and of alpha
+    static const int FractionBits = 8;
+
+private:
+    int32_t AddMedian(int32_t sample);
+    int32_t AddKalman(int32_t sample);
+
+    Kind kind_ = Kind::None;
+    int64_t alpha_ = 0;
+    int window_ = 1;
+    // Variances in raw units squared, with FractionBits
+    int64_t processVariance_ = 0;
+    int64_t measurementVariance_ = 1;
+
+    int count_ = 0;
+    int next_ = 0;  // median: slot for the next sample
+    int64_t state_ = 0;
+    int64_t variance_ = 0;
+    std::array<int32_t, MaxWindow> samples_;
+};
+
+/**
+ * @brief Decides when a filtered value is worth telling subscribers about
+ *
+ * Passes the first value, any value at least deadband away from the last one
+ * passed and, so that a steady reading can be told from a silent sensor, one
+ * value per refresh interval.
+ */
+class DeadbandGate
+{
+public:
+    DeadbandGate() {}
+    DeadbandGate(int32_t deadband, uint64_t refreshNs) : deadband_(deadband), refreshNs_(refreshNs) {}
+
+    bool Pass(int32_t value, uint64_t nowNs);
+    inline int32_t Last() const { return last_; }
+
+private:
+    int32_t deadband_ = 0;
+    uint64_t refreshNs_ = 0;
+
+    bool passed_ = false;
+    int32_t last_ = 0;
+    uint64_t lastNs_ = 0;
+};
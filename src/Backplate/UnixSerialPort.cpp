@@ -1,3 +1,5 @@
+#define CUCKOO_LOG_MODULE "backplate"
+
 #include "UnixSerialPort.hpp"
 #include <fcntl.h>
 #include <unistd.h>
@@ -6,6 +8,7 @@
 #include <sys/ioctl.h>
 #include <cerrno>
 #include "logger.h"
+#include "../Metrics.hpp"
 
 static speed_t BaudRateToSpeed(BaudRate b)
 {
@@ -91,6 +94,9 @@ void UnixSerialPort::Close()
 
 int UnixSerialPort::Read(char* buffer, int bufferSize)
 {
+    static MetricCounter &bytes_read = Metrics::Instance().Counter(
+        "backplate_serial_bytes_read_total", "Bytes read from the backplate serial port");
+
     if (fd < 0) return 0;
     ssize_t r = ::read(fd, buffer, static_cast<size_t>(bufferSize));
     if (r < 0)
@@ -106,11 +112,15 @@ int UnixSerialPort::Read(char* buffer, int bufferSize)
     // {
     //     LOG_DEBUG_STREAM("UnixSerialPort: Read " << r << " bytes from port " << portName);
     // }
+    bytes_read.Add(static_cast<uint64_t>(r));
     return static_cast<int>(r);
 }
 
 int UnixSerialPort::Write(const std::vector<uint8_t> &data)
 {
+    static MetricCounter &bytes_written = Metrics::Instance().Counter(
+        "backplate_serial_bytes_written_total", "Bytes written to the backplate serial port");
+
     if (fd < 0) return -1;
     ssize_t w = ::write(fd, data.data(), data.size());
     if (w < 0)
@@ -119,6 +129,7 @@ int UnixSerialPort::Write(const std::vector<uint8_t> &data)
         return -1;
     }
 
+    bytes_written.Add(static_cast<uint64_t>(w));
     LOG_DEBUG_STREAM("UnixSerialPort: Wrote " << w << " bytes to port " << portName);
 
     // for (size_t i = 0; i < data.size(); ++i)
@@ -15,6 +15,7 @@ public:
     int Write(const std::vector<uint8_t> &data) override;
     int SendBreak(int durationMs) override;
     int Flush() override;
+    int GetFd() const override { return fd; }
 
 private:
     std::string portName;
@@ -0,0 +1,615 @@
+#define CUCKOO_LOG_MODULE "config"
+
+#include "ConfigCache.hpp"
+#include "logger.h"
+
+#include <map>
+#include <vector>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <climits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace {
+
+const char Magic[4] = { 'C', 'K', 'C', 'F' };
+
+// Attribute values nest no deeper than this in any sane config
+const int MaxValueDepth = 32;
+
+// Every record size is a multiple of 8, so each section stays aligned for
+// direct access through the mapping (the double in ValueRecord needs it on ARM)
+
+struct StringRef
+{
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct HALRecord
+{
+    StringRef beeper_device;
+    StringRef display_device;
+    StringRef button_device;
+    StringRef rotary_device;
+    StringRef backlight_device;
+    StringRef backplate_serial_device;
+    uint32_t emulate_display;
+    int32_t backlight_active_seconds;
+    int32_t backlight_max_brightness;
+    int32_t backlight_min_brightness;
+};
+
+struct ThermostatRecord
+{
+    StringRef mode;
+    double heat_setpoint_c;
+    double cool_setpoint_c;
+    double hysteresis_c;
+    int32_t min_on_seconds;
+    int32_t min_off_seconds;
+    int32_t compressor_lockout_seconds;
+    int32_t control_period_ms;
+    uint32_t experimental_fet_control;
+    uint32_t reserved;
+};
+
+struct SensorFilterRecord
+{
+    StringRef filter;
+    double alpha;
+    double process_noise;
+    double measurement_noise;
+    double deadband;
+    int32_t window;
+    int32_t refresh_seconds;
+};
+
+struct HomeAssistantRecord
+{
+    StringRef base_url;
+    StringRef token;
+    StringRef entity_id;
+};
+
+struct ImageHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t source_hash;
+    uint32_t image_size;
+    uint32_t strings_offset;
+    uint32_t strings_size;
+    uint32_t integrations_offset;
+    uint32_t integration_count;
+    uint32_t screens_offset;
+    uint32_t screen_count;
+    uint32_t values_offset;
+    uint32_t value_count;
+    StringRef first_screen_id;
+    uint32_t reserved;
+    HALRecord hal;
+    HomeAssistantRecord home_assistant;
+    ThermostatRecord thermostat;
+    SensorFilterRecord temperature_filter;
+    SensorFilterRecord humidity_filter;
+};
+
+struct IntegrationRecord
+{
+    StringRef id;
+    StringRef name;
+    StringRef type;
+    StringRef entity_id;
+};
+
+struct ScreenRecord
+{
+    StringRef id;
+    StringRef name;
+    StringRef type;
+    int32_t next_screen_index;
+    uint32_t value_index;       // the screen's attribute object
+};
+
+enum ValueType
+{
+    ValueNull = 0,
+    ValueNumber,
+    ValueBool,
+    ValueString,
+    ValueArray,
+    ValueObject,
+};
+
+// Containers keep their children contiguous at [first, first + count), always
+// after the container itself; strings use first/count as offset/length
+struct ValueRecord
+{
+    uint32_t type;
+    StringRef key;              // member name when the parent is an object
+    uint32_t first;
+    uint32_t count;
+    uint32_t reserved;
+    double number;
+};
+
+class ImageBuilder
+{
+public:
+    StringRef Intern(const std::string &str)
+    {
+        auto it = interned_.find(str);
+        if (it != interned_.end())
+            return it->second;
+        StringRef ref = { (uint32_t)strings_.size(), (uint32_t)str.size() };
+        strings_ += str;
+        interned_[str] = ref;
+        return ref;
+    }
+
+    uint32_t AddValue(const json11::Json &value)
+    {
+        uint32_t index = (uint32_t)values_.size();
+        values_.push_back(ValueRecord());
+        FillValue(value, index);
+        return index;
+    }
+
+    const std::string &Strings() const { return strings_; }
+    const std::vector<ValueRecord> &Values() const { return values_; }
+
+private:
+    void FillValue(const json11::Json &value, uint32_t index)
+    {
+        ValueRecord record;
+        memset(&record, 0, sizeof(record));
+
+        switch (value.type())
+        {
+        case json11::Json::NUMBER:
+            record.type = ValueNumber;
+            record.number = value.number_value();
+            break;
+        case json11::Json::BOOL:
+            record.type = ValueBool;
+            record.first = value.bool_value() ? 1 : 0;
+            break;
+        case json11::Json::STRING:
+        {
+            StringRef ref = Intern(value.string_value());
+            record.type = ValueString;
+            record.first = ref.offset;
+            record.count = ref.length;
+            break;
+        }
+        case json11::Json::ARRAY:
+        {
+            const json11::Json::array &items = value.array_items();
+            record.type = ValueArray;
+            record.first = (uint32_t)values_.size();
+            record.count = (uint32_t)items.size();
+            values_.resize(values_.size() + items.size());
+            for (uint32_t i = 0; i < record.count; i++)
+                FillValue(items[i], record.first + i);
+            break;
+        }
+        case json11::Json::OBJECT:
+        {
+            const json11::Json::object &items = value.object_items();
+            record.type = ValueObject;
+            record.first = (uint32_t)values_.size();
+            record.count = (uint32_t)items.size();
+            values_.resize(values_.size() + items.size());
+            uint32_t child = record.first;
+            for (const auto &item : items)
+            {
+                FillValue(item.second, child);
+                values_[child].key = Intern(item.first);
+                child++;
+            }
+            break;
+        }
+        default:
+            record.type = ValueNull;
+            break;
+        }
+
+        // assigned by index, the vector may have grown under the children
+        values_[index].type = record.type;
+        values_[index].first = record.first;
+        values_[index].count = record.count;
+        values_[index].number = record.number;
+    }
+
+    std::string strings_;
+    std::map<std::string, StringRef> interned_;
+    std::vector<ValueRecord> values_;
+};
+
+// Bounds checked access to a mapped image
+class ImageReader
+{
+public:
+    ImageReader(const uint8_t *image, size_t size) : image_(image), size_(size) {}
+
+    bool Open(const ImageHeader &header)
+    {
+        if (header.image_size != size_)
+            return false;
+        if (header.strings_offset > size_ || header.strings_size > size_ - header.strings_offset)
+            return false;
+        if (!Section(header.integrations_offset, header.integration_count, sizeof(IntegrationRecord))
+            || !Section(header.screens_offset, header.screen_count, sizeof(ScreenRecord))
+            || !Section(header.values_offset, header.value_count, sizeof(ValueRecord)))
+            return false;
+
+        strings_ = reinterpret_cast<const char *>(image_ + header.strings_offset);
+        strings_size_ = header.strings_size;
+        integrations_ = reinterpret_cast<const IntegrationRecord *>(image_ + header.integrations_offset);
+        screens_ = reinterpret_cast<const ScreenRecord *>(image_ + header.screens_offset);
+        values_ = reinterpret_cast<const ValueRecord *>(image_ + header.values_offset);
+        value_count_ = header.value_count;
+        return true;
+    }
+
+    bool String(const StringRef &ref, std::string &out) const
+    {
+        if (ref.offset > strings_size_ || ref.length > strings_size_ - ref.offset)
+            return false;
+        out.assign(strings_ + ref.offset, ref.length);
+        return true;
+    }
+
+    bool Value(uint32_t index, int depth, json11::Json &out) const
+    {
+        if (index >= value_count_ || depth > MaxValueDepth)
+            return false;
+
+        const ValueRecord &record = values_[index];
+        switch (record.type)
+        {
+        case ValueNull:
+            out = json11::Json();
+            return true;
+        case ValueNumber:
+            // the parser keeps integers as ints; so does the cache
+            if (record.number >= INT_MIN && record.number <= INT_MAX && record.number == std::floor(record.number))
+                out = json11::Json((int)record.number);
+            else
+                out = json11::Json(record.number);
+            return true;
+        case ValueBool:
+            out = json11::Json(record.first != 0);
+            return true;
+        case ValueString:
+        {
+            std::string str;
+            StringRef ref = { record.first, record.count };
+            if (!String(ref, str))
+                return false;
+            out = json11::Json(std::move(str));
+            return true;
+        }
+        case ValueArray:
+        case ValueObject:
+            break;
+        default:
+            return false;
+        }
+
+        if (record.count > 0 && (record.first <= index || record.first > value_count_
+            || record.count > value_count_ - record.first))
+            return false;
+
+        if (record.type == ValueArray)
+        {
+            json11::Json::array items(record.count);
+            for (uint32_t i = 0; i < record.count; i++)
+                if (!Value(record.first + i, depth + 1, items[i]))
+                    return false;
+            out = json11::Json(std::move(items));
+        }
+        else
+        {
+            json11::Json::object items;
+            for (uint32_t i = 0; i < record.count; i++)
+            {
+                std::string key;
+                if (!String(values_[record.first + i].key, key)
+                    || !Value(record.first + i, depth + 1, items[key]))
+                    return false;
+            }
+            out = json11::Json(std::move(items));
+        }
+        return true;
+    }
+
+    const IntegrationRecord *integrations_ = nullptr;
+    const ScreenRecord *screens_ = nullptr;
+
+private:
+    bool Section(uint32_t offset, uint32_t count, size_t record_size) const
+    {
+        return offset % 8 == 0 && offset <= size_ && (uint64_t)count * record_size <= size_ - offset;
+    }
+
+    const uint8_t *image_;
+    size_t size_;
+    const char *strings_ = nullptr;
+    uint32_t strings_size_ = 0;
+    const ValueRecord *values_ = nullptr;
+    uint32_t value_count_ = 0;
+};
+
+template <typename T>
+void Append(std::string &image, const T &record)
+{
+    image.append(reinterpret_cast<const char *>(&record), sizeof(record));
+}
+
+SensorFilterRecord BuildSensorFilter(ImageBuilder &builder, const SensorFilterConfig &config)
+{
+    SensorFilterRecord record;
+    memset(&record, 0, sizeof(record));
+    record.filter = builder.Intern(config.filter);
+    record.alpha = config.alpha;
+    record.process_noise = config.process_noise;
+    record.measurement_noise = config.measurement_noise;
+    record.deadband = config.deadband;
+    record.window = config.window;
+    record.refresh_seconds = config.refresh_seconds;
+    return record;
+}
+
+bool DecodeSensorFilter(const ImageReader &reader, const SensorFilterRecord &record, SensorFilterConfig &config)
+{
+    config.alpha = record.alpha;
+    config.process_noise = record.process_noise;
+    config.measurement_noise = record.measurement_noise;
+    config.deadband = record.deadband;
+    config.window = record.window;
+    config.refresh_seconds = record.refresh_seconds;
+    return reader.String(record.filter, config.filter);
+}
+
+} // namespace
+
+uint64_t ConfigCache::Hash(const std::string &content)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < content.size(); i++)
+    {
+        hash ^= (uint8_t)content[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string ConfigCache::PathFor(const std::string &config_path)
+{
+    return config_path + ".cache";
+}
+
+std::string ConfigCache::Build(const AppConfig &config, uint64_t source_hash)
+{
+    ImageBuilder builder;
+
+    ImageHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.source_hash = source_hash;
+
+    header.hal.beeper_device = builder.Intern(config.hal.beeper_device);
+    header.hal.display_device = builder.Intern(config.hal.display_device);
+    header.hal.button_device = builder.Intern(config.hal.button_device);
+    header.hal.rotary_device = builder.Intern(config.hal.rotary_device);
+    header.hal.backlight_device = builder.Intern(config.hal.backlight_device);
+    header.hal.backplate_serial_device = builder.Intern(config.hal.backplate_serial_device);
+    header.hal.emulate_display = config.hal.emulate_display ? 1 : 0;
+    header.hal.backlight_active_seconds = config.hal.backlight_active_seconds;
+    header.hal.backlight_max_brightness = config.hal.backlight_max_brightness;
+    header.hal.backlight_min_brightness = config.hal.backlight_min_brightness;
+
+    header.thermostat.mode = builder.Intern(config.thermostat.mode);
+    header.thermostat.heat_setpoint_c = config.thermostat.heat_setpoint_c;
+    header.thermostat.cool_setpoint_c = config.thermostat.cool_setpoint_c;
+    header.thermostat.hysteresis_c = config.thermostat.hysteresis_c;
+    header.thermostat.min_on_seconds = config.thermostat.min_on_seconds;
+    header.thermostat.min_off_seconds = config.thermostat.min_off_seconds;
+    header.thermostat.compressor_lockout_seconds = config.thermostat.compressor_lockout_seconds;
+    header.thermostat.control_period_ms = config.thermostat.control_period_ms;
+    header.thermostat.experimental_fet_control = config.thermostat.experimental_fet_control ? 1 : 0;
+    header.temperature_filter = BuildSensorFilter(builder, config.sensors.temperature);
+    header.humidity_filter = BuildSensorFilter(builder, config.sensors.humidity);
+
+    header.home_assistant.base_url = builder.Intern(config.home_assistant.base_url);
+    header.home_assistant.token = builder.Intern(config.home_assistant.token);
+    header.home_assistant.entity_id = builder.Intern(config.home_assistant.entity_id);
+    header.first_screen_id = builder.Intern(config.first_screen_id);
+
+    std::vector<IntegrationRecord> integrations;
+    for (const auto &integration : config.integrations)
+    {
+        IntegrationRecord record;
+        record.id = builder.Intern(integration.id);
+        record.name = builder.Intern(integration.name);
+        record.type = builder.Intern(integration.type);
+        record.entity_id = builder.Intern(integration.entity_id);
+        integrations.push_back(record);
+    }
+
+    std::vector<ScreenRecord> screens;
+    for (const auto &screen : config.screens)
+    {
+        ScreenRecord record;
+        memset(&record, 0, sizeof(record));
+        record.id = builder.Intern(screen.id);
+        record.name = builder.Intern(screen.name);
+        record.type = builder.Intern(screen.type);
+        record.next_screen_index = screen.next_screen_index;
+        record.value_index = builder.AddValue(screen.json);
+        screens.push_back(record);
+    }
+
+    header.integrations_offset = sizeof(ImageHeader);
+    header.integration_count = (uint32_t)integrations.size();
+    header.screens_offset = header.integrations_offset + header.integration_count * sizeof(IntegrationRecord);
+    header.screen_count = (uint32_t)screens.size();
+    header.values_offset = header.screens_offset + header.screen_count * sizeof(ScreenRecord);
+    header.value_count = (uint32_t)builder.Values().size();
+    header.strings_offset = header.values_offset + header.value_count * sizeof(ValueRecord);
+    header.strings_size = (uint32_t)builder.Strings().size();
+    header.image_size = header.strings_offset + header.strings_size;
+
+    std::string image;
+    image.reserve(header.image_size);
+    Append(image, header);
+    for (const auto &record : integrations)
+        Append(image, record);
+    for (const auto &record : screens)
+        Append(image, record);
+    for (const auto &record : builder.Values())
+        Append(image, record);
+    image += builder.Strings();
+    return image;
+}
+
+bool ConfigCache::Write(const std::string &path, const AppConfig &config, uint64_t source_hash)
+{
+    std::string image = Build(config, source_hash);
+    std::string tmp_path = path + ".tmp";
+
+    std::ofstream file(tmp_path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOG_WARN_STREAM("ConfigCache: Unable to create " << tmp_path);
+        return false;
+    }
+    file.write(image.data(), image.size());
+    file.close();
+
+    if (!file.good() || rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        LOG_WARN_STREAM("ConfigCache: Unable to write " << path);
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    LOG_INFO_STREAM("ConfigCache: Wrote " << path << " (" << image.size() << " bytes)");
+    return true;
+}
+
+bool ConfigCache::Load(const std::string &path, uint64_t source_hash, AppConfig &config)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(ImageHeader))
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *image = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (image == MAP_FAILED)
+    {
+        LOG_WARN_STREAM("ConfigCache: Unable to map " << path);
+        return false;
+    }
+
+    bool ok = Decode(static_cast<const uint8_t *>(image), size, source_hash, config);
+    munmap(image, size);
+    return ok;
+}
+
+bool ConfigCache::Decode(const uint8_t *image, size_t size, uint64_t source_hash, AppConfig &config)
+{
+    if (image == nullptr || size < sizeof(ImageHeader))
+        return false;
+
+    const ImageHeader &header = *reinterpret_cast<const ImageHeader *>(image);
+    if (memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version)
+    {
+        LOG_INFO_STREAM("ConfigCache: Image format changed, ignoring cache");
+        return false;
+    }
+    if (header.source_hash != source_hash)
+    {
+        LOG_INFO_STREAM("ConfigCache: Configuration changed since the cache was built");
+        return false;
+    }
+
+    ImageReader reader(image, size);
+    AppConfig decoded;
+    bool ok = reader.Open(header)
+        && reader.String(header.hal.beeper_device, decoded.hal.beeper_device)
+        && reader.String(header.hal.display_device, decoded.hal.display_device)
+        && reader.String(header.hal.button_device, decoded.hal.button_device)
+        && reader.String(header.hal.rotary_device, decoded.hal.rotary_device)
+        && reader.String(header.hal.backlight_device, decoded.hal.backlight_device)
+        && reader.String(header.hal.backplate_serial_device, decoded.hal.backplate_serial_device)
+        && reader.String(header.thermostat.mode, decoded.thermostat.mode)
+        && DecodeSensorFilter(reader, header.temperature_filter, decoded.sensors.temperature)
+        && DecodeSensorFilter(reader, header.humidity_filter, decoded.sensors.humidity)
+        && reader.String(header.home_assistant.base_url, decoded.home_assistant.base_url)
+        && reader.String(header.home_assistant.token, decoded.home_assistant.token)
+        && reader.String(header.home_assistant.entity_id, decoded.home_assistant.entity_id)
+        && reader.String(header.first_screen_id, decoded.first_screen_id);
+
+    decoded.hal.emulate_display = header.hal.emulate_display != 0;
+    decoded.hal.backlight_active_seconds = header.hal.backlight_active_seconds;
+    decoded.hal.backlight_max_brightness = header.hal.backlight_max_brightness;
+    decoded.hal.backlight_min_brightness = header.hal.backlight_min_brightness;
+    decoded.thermostat.heat_setpoint_c = header.thermostat.heat_setpoint_c;
+    decoded.thermostat.cool_setpoint_c = header.thermostat.cool_setpoint_c;
+    decoded.thermostat.hysteresis_c = header.thermostat.hysteresis_c;
+    decoded.thermostat.min_on_seconds = header.thermostat.min_on_seconds;
+    decoded.thermostat.min_off_seconds = header.thermostat.min_off_seconds;
+    decoded.thermostat.compressor_lockout_seconds = header.thermostat.compressor_lockout_seconds;
+    decoded.thermostat.control_period_ms = header.thermostat.control_period_ms;
+    decoded.thermostat.experimental_fet_control = header.thermostat.experimental_fet_control != 0;
+
+    decoded.integrations.resize(ok ? header.integration_count : 0);
+    for (uint32_t i = 0; ok && i < header.integration_count; i++)
+    {
+        const IntegrationRecord &record = reader.integrations_[i];
+        IntegrationConfig &integration = decoded.integrations[i];
+        ok = reader.String(record.id, integration.id)
+            && reader.String(record.name, integration.name)
+            && reader.String(record.type, integration.type)
+            && reader.String(record.entity_id, integration.entity_id);
+    }
+
+    decoded.screens.resize(ok ? header.screen_count : 0);
+    for (uint32_t i = 0; ok && i < header.screen_count; i++)
+    {
+        const ScreenRecord &record = reader.screens_[i];
+        ScreenConfig &screen = decoded.screens[i];
+        ok = reader.String(record.id, screen.id)
+            && reader.String(record.name, screen.name)
+            && reader.String(record.type, screen.type)
+            && reader.Value(record.value_index, 0, screen.json)
+            && record.next_screen_index >= -1 && record.next_screen_index < (int32_t)header.screen_count;
+        screen.next_screen_index = record.next_screen_index;
+    }
+
+    if (!ok)
+    {
+        LOG_WARN_STREAM("ConfigCache: Malformed image, ignoring cache");
+        return false;
+    }
+
+    config = decoded;
+    return true;
+}
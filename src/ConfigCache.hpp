@@ -0,0 +1,67 @@
+#ifndef CONFIG_CACHE_HPP
+#define CONFIG_CACHE_HPP
+
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "ConfigModel.hpp"
+
+/**
+ * @brief Compiled form of config.json for a faster cold start
+ *
+ * The image is a flat, versioned file: a header holding the HAL and Home
+ * Assistant settings, fixed size integration, screen and attribute value
+ * records, and one table of interned strings that every record points into.
+ * Each screen's "nextScreen" is stored already resolved to a record index.
+ *
+ * Load() maps the file and builds AppConfig straight from the records. It
+ * still reads and hashes config.json to check the image is current, and still
+ * builds each screen's json11 attributes, but skips the text parse and the
+ * validation of every entry. The image is only used when its hash matches the current
+ * config.json; otherwise the caller parses the JSON and writes a new image.
+ * The layout is native endian and written on the device that reads it.
+ * Bump Version whenever the layout or the meaning of AppConfig changes.
+ */
+class ConfigCache
+{
+public:
+    static const uint32_t Version = 5;
+
+    /**
+     * @brief 64-bit FNV-1a hash of the config.json contents
+     */
+    static uint64_t Hash(const std::string &content);
+
+    /**
+     * @brief Cache file used for config_path: "<config_path>.cache"
+     */
+    static std::string PathFor(const std::string &config_path);
+
+    /**
+     * @brief Serialize config into an image tagged with source_hash
+     */
+    static std::string Build(const AppConfig &config, uint64_t source_hash);
+
+    /**
+     * @brief Build the image and replace path with it atomically
+     *
+     * @return false if the file could not be written
+     */
+    static bool Write(const std::string &path, const AppConfig &config, uint64_t source_hash);
+
+    /**
+     * @brief Map path and decode it into config
+     *
+     * @return false if the file is missing, stale (hash or version) or malformed;
+     *         config is left untouched in that case
+     */
+    static bool Load(const std::string &path, uint64_t source_hash, AppConfig &config);
+
+    /**
+     * @brief Decode an image already in memory; see Load()
+     */
+    static bool Decode(const uint8_t *image, size_t size, uint64_t source_hash, AppConfig &config);
+};
+
+#endif // CONFIG_CACHE_HPP
@@ -0,0 +1,147 @@
+#ifndef CONFIG_MODEL_HPP
+#define CONFIG_MODEL_HPP
+
+#include <string>
+#include <vector>
+#include <json11.hpp>
+
+/**
+ * @brief Typed configuration produced by ConfigurationReader::load()
+ *
+ * config.json is parsed once; each subsystem takes its slice from AppConfig.
+ * Every field carries its default, so a missing or broken file still yields
+ * a usable configuration.
+ */
+
+/** @brief "hal" section: device paths and backlight tuning */
+struct HALConfig
+{
+    std::string beeper_device = "/dev/input/event0";
+    std::string display_device = "/dev/fb0";
+    std::string button_device = "/dev/input/event2";
+    std::string rotary_device = "/dev/input/event1";
+    std::string backlight_device = "/sys/class/backlight/3-0036/brightness";
+    std::string backplate_serial_device = "/dev/ttyO2";
+    bool emulate_display = false;
+    int backlight_active_seconds = 10;
+    int backlight_max_brightness = 115;
+    int backlight_min_brightness = 20;
+};
+
+/** @brief "thermostat" section: targets and equipment protection for the HVAC control loop */
+struct ThermostatConfig
+{
+    std::string mode = "off";       // "off", "heat" or "cool"; "off" never drives the FETs
+    double heat_setpoint_c = 20.0;
+    double cool_setpoint_c = 24.0;
+    double hysteresis_c = 0.5;      // a stage starts this far past its setpoint and stops as far on the other side
+    int min_on_seconds = 180;
+    int min_off_seconds = 180;
+    int compressor_lockout_seconds = 300;   // cooling stays off this long after it stops, and after start
+    int control_period_ms = 1000;
+    // The FET command format and its echo as acknowledgement are not confirmed against
+    // a backplate; without this opt-in a mode other than "off" drives nothing
+    bool experimental_fet_control = false;
+
+    // Whether the control loop may drive the FETs
+    bool ActuationEnabled() const { return mode != "off" && experimental_fet_control; }
+
+    bool operator==(const ThermostatConfig &other) const
+    {
+        return mode == other.mode && experimental_fet_control == other.experimental_fet_control
+            && heat_setpoint_c == other.heat_setpoint_c
+            && cool_setpoint_c == other.cool_setpoint_c && hysteresis_c == other.hysteresis_c
+            && min_on_seconds == other.min_on_seconds && min_off_seconds == other.min_off_seconds
+            && compressor_lockout_seconds == other.compressor_lockout_seconds
+            && control_period_ms == other.control_period_ms;
+    }
+    bool operator!=(const ThermostatConfig &other) const { return !(*this == other); }
+};
+
+/** @brief Smoothing and change reporting for one backplate sensor, in its units (C or %) */
+struct SensorFilterConfig
+{
+    std::string filter = "ema";     // "none", "ema", "median" or "kalman"
+    double alpha = 0.25;            // ema: weight of a new sample, 0..1
+    int window = 5;                 // median: samples, odd, at most 9
+    double process_noise = 0.02;    // kalman: how far the true value moves between samples
+    double measurement_noise = 0.1; // kalman: how far a sample strays from it
+    double deadband = 0.1;          // subscribers hear of a change once it is at least this big
+    int refresh_seconds = 60;       // and of the value at least this often; 0 never repeats it
+
+    bool operator==(const SensorFilterConfig &other) const
+    {
+        return filter == other.filter && alpha == other.alpha && window == other.window
+            && process_noise == other.process_noise && measurement_noise == other.measurement_noise
+            && deadband == other.deadband && refresh_seconds == other.refresh_seconds;
+    }
+    bool operator!=(const SensorFilterConfig &other) const { return !(*this == other); }
+};
+
+/** @brief "sensors" section */
+struct SensorsConfig
+{
+    SensorsConfig() { humidity.deadband = 0.5; }
+
+    SensorFilterConfig temperature;
+    SensorFilterConfig humidity;
+};
+
+/** @brief "homeAssistant" section */
+struct HomeAssistantConfig
+{
+    std::string base_url;
+    std::string token;
+    std::string entity_id;
+
+    bool IsComplete() const { return !base_url.empty() && !token.empty() && !entity_id.empty(); }
+
+    bool operator==(const HomeAssistantConfig &other) const
+    {
+        return base_url == other.base_url && token == other.token && entity_id == other.entity_id;
+    }
+    bool operator!=(const HomeAssistantConfig &other) const { return !(*this == other); }
+};
+
+/** @brief One validated "integrations" entry */
+struct IntegrationConfig
+{
+    std::string id;         // "id" as a string (numbers converted), falls back to name
+    std::string name;
+    std::string type;       // e.g. "HomeAssistant"
+    std::string entity_id;  // Home Assistant entity, e.g. "switch.garage"
+
+    bool operator==(const IntegrationConfig &other) const
+    {
+        return id == other.id && name == other.name && type == other.type && entity_id == other.entity_id;
+    }
+    bool operator!=(const IntegrationConfig &other) const { return !(*this == other); }
+};
+
+/** @brief One validated "screens" entry */
+struct ScreenConfig
+{
+    std::string id;         // "id" as a string (numbers converted), falls back to name
+    std::string name;
+    std::string type;       // lower case, e.g. "home", "menu", "analogclock"
+    json11::Json json;      // the entry itself, for screen specific attributes
+    // "nextScreen" resolved to an index into AppConfig::screens, -1 when unset or not configured
+    int next_screen_index = -1;
+
+    // The entry carries every attribute, so comparing it covers id, name and type
+    bool operator==(const ScreenConfig &other) const { return json == other.json; }
+    bool operator!=(const ScreenConfig &other) const { return !(*this == other); }
+};
+
+struct AppConfig
+{
+    HALConfig hal;
+    ThermostatConfig thermostat;
+    SensorsConfig sensors;
+    HomeAssistantConfig home_assistant;
+    std::vector<IntegrationConfig> integrations;
+    std::string first_screen_id;
+    std::vector<ScreenConfig> screens;
+};
+
+#endif // CONFIG_MODEL_HPP
@@ -0,0 +1,121 @@
+#define CUCKOO_LOG_MODULE "config"
+
+#include "ConfigWatcher.hpp"
+#include "logger.h"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+ConfigWatcher::ConfigWatcher(const std::string &config_path, int settle_ms)
+    : config_path_(config_path)
+    , settle_ms_(settle_ms)
+{
+    size_t slash = config_path_.find_last_of('/');
+    if (slash == std::string::npos)
+    {
+        directory_ = ".";
+        filename_ = config_path_;
+    }
+    else
+    {
+        directory_ = (slash == 0) ? "/" : config_path_.substr(0, slash);
+        filename_ = config_path_.substr(slash + 1);
+    }
+}
+
+ConfigWatcher::~ConfigWatcher()
+{
+    Stop();
+}
+
+bool ConfigWatcher::Start()
+{
+    if (IsWatching())
+        return true;
+
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ < 0)
+    {
+        LOG_ERROR_STREAM("ConfigWatcher: inotify_init1 failed: " << strerror(errno));
+        return false;
+    }
+
+    watch_descriptor_ = inotify_add_watch(
+        inotify_fd_, directory_.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (watch_descriptor_ < 0)
+    {
+        LOG_ERROR_STREAM("ConfigWatcher: Unable to watch " << directory_ << ": " << strerror(errno));
+        Stop();
+        return false;
+    }
+
+    LOG_INFO_STREAM("ConfigWatcher: Watching " << config_path_ << " for changes");
+    return true;
+}
+
+void ConfigWatcher::Stop()
+{
+    if (inotify_fd_ >= 0)
+    {
+        if (watch_descriptor_ >= 0)
+            inotify_rm_watch(inotify_fd_, watch_descriptor_);
+        close(inotify_fd_);
+    }
+    inotify_fd_ = -1;
+    watch_descriptor_ = -1;
+    change_pending_ = false;
+}
+
+bool ConfigWatcher::Poll()
+{
+    if (!IsWatching())
+        return false;
+
+    DrainEvents();
+
+    if (change_pending_ && NowMs() - last_event_ms_ >= (uint64_t)settle_ms_)
+    {
+        change_pending_ = false;
+        return true;
+    }
+    return false;
+}
+
+void ConfigWatcher::DrainEvents()
+{
+    // Aligned for struct inotify_event, large enough for a handful of events per read
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    while (true)
+    {
+        ssize_t len = read(inotify_fd_, buffer, sizeof(buffer));
+        if (len <= 0)
+        {
+            if (len < 0 && errno != EAGAIN && errno != EINTR)
+                LOG_ERROR_STREAM("ConfigWatcher: read failed: " << strerror(errno));
+            return;
+        }
+
+        for (char *ptr = buffer; ptr < buffer + len; )
+        {
+            const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(ptr);
+            if (event->len > 0 && filename_ == event->name)
+            {
+                change_pending_ = true;
+                last_event_ms_ = NowMs();
+            }
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+}
+
+uint64_t ConfigWatcher::NowMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <stdint.h>
+
+/**
+ * @brief Watches the configuration file for changes with inotify
+ *
+ * The containing directory is watched rather than the file itself: editors
+ * and deploy scripts usually write a temporary file and rename it over the
+ * original, which would silently drop a watch on the old inode.
+ *
+ * Poll() never blocks; call it from the main loop. A burst of events (write,
+ * close, rename) is collapsed into one change once the file has been quiet
+ * for settle_ms.
+ */
+class ConfigWatcher
+{
+public:
+    explicit ConfigWatcher(const std::string &config_path, int settle_ms = DefaultSettleMs);
+    ~ConfigWatcher();
+
+    bool Start();
+    void Stop();
+
+    // True once per settled change of the watched file
+    bool Poll();
+
+    inline bool IsWatching() const { return inotify_fd_ >= 0; }
+    inline const std::string &GetPath() const { return config_path_; }
+
+    static const int DefaultSettleMs = 250;
+
+private:
+    void DrainEvents();
+    static uint64_t NowMs();
+
+    std::string config_path_;
+    std::string directory_;
+    std::string filename_;
+    int settle_ms_;
+    int inotify_fd_ = -1;
+    int watch_descriptor_ = -1;
+    bool change_pending_ = false;
+    uint64_t last_event_ms_ = 0;
+};
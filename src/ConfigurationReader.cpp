@@ -1,15 +1,21 @@
+#define CUCKOO_LOG_MODULE "config"
+
 #include "ConfigurationReader.hpp"
+#include "ConfigCache.hpp"
 #include "logger.h"
 #include <fstream>
 #include <sstream>
 #include <unistd.h>
 #include <limits.h>
+#include <algorithm>
+#include <ctype.h>
 #include "json11.hpp"
 
 ConfigurationReader::ConfigurationReader(const std::string& config_filename)
     : config_filename_(config_filename)
     , json_root_(nullptr)
     , loaded_(false)
+    , loaded_from_cache_(false)
 {
     config_filepath_ = config_filename_;
 }
@@ -22,23 +28,81 @@ ConfigurationReader::~ConfigurationReader()
     }
 }
 
+// Logged for the typed configuration, whether it was parsed or read from the cache
+static void warn_thermostat_config(const ThermostatConfig& config)
+{
+    if (config.ActuationEnabled())
+        LOG_WARN_STREAM("ConfigurationReader: thermostat mode \"" << config.mode
+            << "\" drives the backplate FETs through an unverified protocol (\"experimental_fet_control\")");
+    else if (config.mode != "off")
+        LOG_WARN_STREAM("ConfigurationReader: thermostat mode \"" << config.mode
+            << "\" drives nothing until \"experimental_fet_control\" is set");
+}
+
 bool ConfigurationReader::load()
 {
     loaded_ = false;
+    loaded_from_cache_ = false;
+    app_config_ = AppConfig();
     
-    // Clean up any existing json object
+    // Read file content
+    std::string content = read_file_content(config_filepath_);
+    if (content.empty()) {
+        LOG_ERROR_STREAM("ConfigurationReader: Failed to read file: " << config_filepath_);
+        return false;
+    }
+
+    return parse_content(content);
+}
+
+bool ConfigurationReader::load_with_cache(const std::string& cache_path)
+{
+    loaded_ = false;
+    loaded_from_cache_ = false;
+    app_config_ = AppConfig();
+
     if (json_root_ != nullptr) {
         delete json_root_;
         json_root_ = nullptr;
     }
-    
-    // Read file content
+
     std::string content = read_file_content(config_filepath_);
     if (content.empty()) {
         LOG_ERROR_STREAM("ConfigurationReader: Failed to read file: " << config_filepath_);
         return false;
     }
 
+    uint64_t hash = ConfigCache::Hash(content);
+    if (ConfigCache::Load(cache_path, hash, app_config_)) {
+        loaded_ = true;
+        loaded_from_cache_ = true;
+        LOG_INFO_STREAM("ConfigurationReader: Loaded compiled config from " << cache_path
+            << " (" << app_config_.integrations.size() << " integrations, " << app_config_.screens.size() << " screens)");
+        warn_thermostat_config(app_config_.thermostat);
+        return true;
+    }
+
+    if (!parse_content(content))
+        return false;
+
+    // a failed write only costs the next start the JSON parse
+    ConfigCache::Write(cache_path, app_config_, hash);
+    return true;
+}
+
+bool ConfigurationReader::loaded_from_cache() const
+{
+    return loaded_from_cache_;
+}
+
+bool ConfigurationReader::parse_content(const std::string& content)
+{
+    // Clean up any existing json object
+    if (json_root_ != nullptr) {
+        delete json_root_;
+        json_root_ = nullptr;
+    }
+
     // Parse JSON using json11
     std::string parse_error;
     json11::Json parsed_json = json11::Json::parse(content, parse_error, json11::JsonParse::COMMENTS);
@@ -56,11 +120,215 @@ bool ConfigurationReader::load()
     // Store the parsed JSON
     json_root_ = new json11::Json(parsed_json);
     loaded_ = true;
+    build_app_config(parsed_json);
+    warn_thermostat_config(app_config_.thermostat);
     
-    LOG_INFO_STREAM("ConfigurationReader: Successfully loaded config from " << config_filepath_);
+    LOG_INFO_STREAM("ConfigurationReader: Successfully loaded config from " << config_filepath_
+        << " (" << app_config_.integrations.size() << " integrations, " << app_config_.screens.size() << " screens)");
     return true;
 }
 
+const AppConfig& ConfigurationReader::get_app_config() const
+{
+    return app_config_;
+}
+
+// "id" style values may be numbers or strings; anything else reads as empty
+static std::string id_string(const json11::Json& value)
+{
+    if (value.is_number())
+        return std::to_string(value.int_value());
+    if (value.is_string())
+        return value.string_value();
+    return "";
+}
+
+static void read_hal_config(const json11::Json& hal, HALConfig& config)
+{
+    if (!hal.is_object()) {
+        LOG_WARN_STREAM("ConfigurationReader: No 'hal' section found in config, using defaults");
+        return;
+    }
+
+    if (hal["beeper_device"].is_string()) {
+        config.beeper_device = hal["beeper_device"].string_value();
+        LOG_DEBUG_STREAM("  beeper_device: " << config.beeper_device);
+    }
+    if (hal["display_device"].is_string()) {
+        config.display_device = hal["display_device"].string_value();
+        LOG_DEBUG_STREAM("  display_device: " << config.display_device);
+    }
+    if (hal["button_device"].is_string()) {
+        config.button_device = hal["button_device"].string_value();
+        LOG_DEBUG_STREAM("  button_device: " << config.button_device);
+    }
+    if (hal["rotary_device"].is_string()) {
+        config.rotary_device = hal["rotary_device"].string_value();
+        LOG_DEBUG_STREAM("  rotary_device: " << config.rotary_device);
+    }
+    if (hal["backlight_device"].is_string()) {
+        config.backlight_device = hal["backlight_device"].string_value();
+        LOG_DEBUG_STREAM("  backlight_device: " << config.backlight_device);
+    }
+    if (hal["backplate_serial_device"].is_string()) {
+        config.backplate_serial_device = hal["backplate_serial_device"].string_value();
+        LOG_DEBUG_STREAM("  backplate_serial_device: " << config.backplate_serial_device);
+    }
+    if (hal["emulate_display"].is_bool()) {
+        config.emulate_display = hal["emulate_display"].bool_value();
+        LOG_INFO_STREAM("  emulate_display: " << (config.emulate_display ? "true" : "false"));
+    }
+    if (hal["backlight_active_seconds"].is_number()) {
+        config.backlight_active_seconds = hal["backlight_active_seconds"].int_value();
+        LOG_DEBUG_STREAM("  backlight_active_seconds: " << config.backlight_active_seconds);
+    }
+    if (hal["backlight_max_brightness"].is_number()) {
+        config.backlight_max_brightness = hal["backlight_max_brightness"].int_value();
+        LOG_DEBUG_STREAM("  backlight_max_brightness: " << config.backlight_max_brightness);
+    }
+    if (hal["backlight_min_brightness"].is_number()) {
+        config.backlight_min_brightness = hal["backlight_min_brightness"].int_value();
+        LOG_DEBUG_STREAM("  backlight_min_brightness: " << config.backlight_min_brightness);
+    }
+}
+
+static void read_thermostat_config(const json11::Json& thermostat, ThermostatConfig& config)
+{
+    if (!thermostat.is_object())
+        return;
+
+    if (thermostat["mode"].is_string()) {
+        std::string mode = thermostat["mode"].string_value();
+        transform(mode.begin(), mode.end(), mode.begin(), ::tolower);
+        if (mode == "off" || mode == "heat" || mode == "cool")
+            config.mode = mode;
+        else
+            LOG_WARN_STREAM("ConfigurationReader: unknown thermostat mode \"" << mode << "\", keeping \"" << config.mode << "\"");
+    }
+    if (thermostat["heat_setpoint"].is_number())
+        config.heat_setpoint_c = thermostat["heat_setpoint"].number_value();
+    if (thermostat["cool_setpoint"].is_number())
+        config.cool_setpoint_c = thermostat["cool_setpoint"].number_value();
+    if (thermostat["hysteresis"].is_number())
+        config.hysteresis_c = std::max(0.0, thermostat["hysteresis"].number_value());
+    if (thermostat["min_on_seconds"].is_number())
+        config.min_on_seconds = std::max(0, thermostat["min_on_seconds"].int_value());
+    if (thermostat["min_off_seconds"].is_number())
+        config.min_off_seconds = std::max(0, thermostat["min_off_seconds"].int_value());
+    if (thermostat["compressor_lockout_seconds"].is_number())
+        config.compressor_lockout_seconds = std::max(0, thermostat["compressor_lockout_seconds"].int_value());
+    if (thermostat["control_period_ms"].is_number())
+        config.control_period_ms = std::max(10, thermostat["control_period_ms"].int_value());
+    if (thermostat["experimental_fet_control"].is_bool())
+        config.experimental_fet_control = thermostat["experimental_fet_control"].bool_value();
+
+    LOG_DEBUG_STREAM("Thermostat configuration: mode " << config.mode << ", heat " << config.heat_setpoint_c
+        << " C, cool " << config.cool_setpoint_c << " C, hysteresis " << config.hysteresis_c << " C");
+}
+
+static void read_sensor_filter_config(const char* name, const json11::Json& sensor, SensorFilterConfig& config)
+{
+    if (!sensor.is_object())
+        return;
+
+    if (sensor["filter"].is_string()) {
+        std::string filter = sensor["filter"].string_value();
+        transform(filter.begin(), filter.end(), filter.begin(), ::tolower);
+        if (filter == "none" || filter == "ema" || filter == "median" || filter == "kalman")
+            config.filter = filter;
+        else
+            LOG_WARN_STREAM("ConfigurationReader: unknown " << name << " filter \"" << filter << "\", keeping \"" << config.filter << "\"");
+    }
+    if (sensor["alpha"].is_number())
+        config.alpha = std::min(1.0, std::max(0.0, sensor["alpha"].number_value()));
+    if (sensor["window"].is_number())
+        config.window = std::max(1, sensor["window"].int_value());
+    if (sensor["process_noise"].is_number())
+        config.process_noise = std::max(0.0, sensor["process_noise"].number_value());
+    if (sensor["measurement_noise"].is_number())
+        config.measurement_noise = std::max(0.0, sensor["measurement_noise"].number_value());
+    if (sensor["deadband"].is_number())
+        config.deadband = std::max(0.0, sensor["deadband"].number_value());
+    if (sensor["refresh_seconds"].is_number())
+        config.refresh_seconds = std::max(0, sensor["refresh_seconds"].int_value());
+
+    LOG_DEBUG_STREAM("Sensor configuration: " << name << " filter " << config.filter << ", deadband " << config.deadband);
+}
+
+void ConfigurationReader::build_app_config(const json11::Json& root)
+{
+    read_hal_config(root["hal"], app_config_.hal);
+    read_thermostat_config(root["thermostat"], app_config_.thermostat);
+    read_sensor_filter_config("temperature", root["sensors"]["temperature"], app_config_.sensors.temperature);
+    read_sensor_filter_config("humidity", root["sensors"]["humidity"], app_config_.sensors.humidity);
+
+    const json11::Json& ha = root["homeAssistant"];
+    app_config_.home_assistant.base_url = ha["baseURL"].string_value();
+    app_config_.home_assistant.token = ha["token"].string_value();
+    app_config_.home_assistant.entity_id = ha["entityId"].string_value();
+
+    int index = 0;
+    for (const auto& integration : root["integrations"].array_items()) {
+        index++;
+        if (!integration.is_object()) {
+            LOG_WARN_STREAM("ConfigurationReader: integrations[" << index - 1 << "] is not an object, skipped");
+            continue;
+        }
+
+        IntegrationConfig config;
+        config.name = integration["name"].string_value();
+        config.type = integration["type"].string_value();
+        config.entity_id = integration["entityId"].string_value();
+        config.id = id_string(integration["id"]);
+        if (config.id.empty())
+            config.id = config.name;
+
+        if (config.type == "HomeAssistant" && config.entity_id.find('.') == std::string::npos) {
+            LOG_WARN_STREAM("ConfigurationReader: integration \"" << config.id
+                << "\" has no valid entityId (\"" << config.entity_id << "\"), skipped");
+            continue;
+        }
+        app_config_.integrations.push_back(config);
+    }
+
+    app_config_.first_screen_id = id_string(root["firstScreen"]);
+
+    index = 0;
+    for (const auto& screen : root["screens"].array_items()) {
+        index++;
+        if (!screen.is_object()) {
+            LOG_WARN_STREAM("ConfigurationReader: screens[" << index - 1 << "] is not an object, skipped");
+            continue;
+        }
+
+        ScreenConfig config;
+        config.name = screen["name"].string_value();
+        config.id = id_string(screen["id"]);
+        if (config.id.empty())
+            config.id = config.name;
+        config.type = screen["type"].string_value();
+        transform(config.type.begin(), config.type.end(), config.type.begin(), ::tolower);
+        config.json = screen;
+        app_config_.screens.push_back(config);
+    }
+
+    resolve_references(app_config_);
+}
+
+void ConfigurationReader::resolve_references(AppConfig& config)
+{
+    // later entries win on duplicate IDs, as when the screens are built
+    std::map<std::string, int> screenIndex;
+    for (size_t i = 0; i < config.screens.size(); i++)
+        if (!config.screens[i].id.empty())
+            screenIndex[config.screens[i].id] = (int)i;
+
+    for (auto& screen : config.screens) {
+        auto next = screenIndex.find(id_string(screen.json["nextScreen"]));
+        screen.next_screen_index = (next != screenIndex.end()) ? next->second : -1;
+    }
+}
+
 bool ConfigurationReader::is_loaded() const
 {
     return loaded_;
@@ -5,10 +5,7 @@
 #include <map>
 #include <vector>
 
-// Forward declaration to avoid including json11.hpp in header
-namespace json11 {
-    class Json;
-}
+#include "ConfigModel.hpp"
 
 /**
  * @brief A configuration file reader that parses JSON files using libmjson
@@ -39,6 +36,25 @@ public:
      */
     bool load();
 
+    /**
+     * @brief Load the configuration, preferring the compiled image at cache_path
+     *
+     * The image is used when it was built from the current file contents (see
+     * ConfigCache). Otherwise the file is parsed as load() does and a new image
+     * is written for the next start. After a cache hit only get_app_config()
+     * is populated; the key lookups below need the parsed document and return
+     * their defaults.
+     *
+     * @param cache_path Location of the compiled image, usually ConfigCache::PathFor()
+     * @return true if the configuration was loaded from either source
+     */
+    bool load_with_cache(const std::string& cache_path);
+
+    /**
+     * @brief Check whether the last load came from the compiled image
+     */
+    bool loaded_from_cache() const;
+
     /**
      * @brief Check if the configuration was successfully loaded
      * 
@@ -130,11 +146,44 @@ public:
      */
     bool has_home_assistant_config() const;
 
+    /**
+     * @brief Get the typed configuration built by load()
+     *
+     * Holds the defaults when the file could not be loaded.
+     *
+     * @return const AppConfig& HAL, Home Assistant, integration and screen settings
+     */
+    const AppConfig& get_app_config() const;
+
 private:
     std::string config_filename_;
     std::string config_filepath_;
     json11::Json* json_root_;  // json11 object pointer
     bool loaded_;
+    bool loaded_from_cache_;
+    AppConfig app_config_;
+
+    /**
+     * @brief Parse content as JSON and build app_config_ from it
+     *
+     * @param content The file contents
+     * @return false on a parse error or a non-object root
+     */
+    bool parse_content(const std::string& content);
+
+    /**
+     * @brief Build app_config_ from the parsed document, logging invalid entries
+     *
+     * @param root The parsed root object
+     */
+    void build_app_config(const json11::Json& root);
+
+    /**
+     * @brief Resolve each screen's "nextScreen" to an index
+     *
+     * @param config The configuration to update in place
+     */
+    static void resolve_references(AppConfig& config);
 
     /**
      * @brief Get the directory where the executable is located
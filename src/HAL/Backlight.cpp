@@ -1,4 +1,7 @@
+#define CUCKOO_LOG_MODULE "hal"
+
 #include "Backlight.hpp"
+#include "../Metrics.hpp"
 #include "logger.h"
 #include <fcntl.h>
 #include <errno.h>
@@ -19,6 +22,9 @@ Backlight::~Backlight()
  */
 void Backlight::set_backlight_brightness(int brightness)
 {
+    static MetricCounter &sysfs_writes = Metrics::Instance().Counter(
+        "backlight_sysfs_writes_total", "Brightness writes to the backlight sysfs file");
+
     FILE* f = fopen(device_path_.c_str(), "w");
     if (f == NULL)
     {
@@ -27,6 +33,7 @@ void Backlight::set_backlight_brightness(int brightness)
     }
 
     fprintf(f, "%d\n", brightness);
+    sysfs_writes.Add();
 
     LOG_DEBUG_STREAM("Brightness set to: " << brightness);
 
@@ -34,36 +41,35 @@ void Backlight::set_backlight_brightness(int brightness)
 }
 
 
+void Backlight::set_timer_service(TimerService *timers)
+{
+    timers_ = timers;
+}
+
 void Backlight::Activate()
 {
     int brightness;
+    uint64_t active_ns;
     {
         std::lock_guard<std::mutex> lock(mutex_);
         brightness = max_brightness_;
-        remaining_seconds_ = active_seconds_;
+        active_ns = TimerService::Sec(active_seconds_);
     }
     set_backlight_brightness(brightness);
-}
 
-void Backlight::Tick()
-{
-    bool should_dim = false;
-    int brightness = 0;
+    if (timers_ == nullptr)
+        return;
+    // Push the pending dim out, or start one if the backlight was already dimmed
+    if (!timers_->Reschedule(dim_timer_, active_ns))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (remaining_seconds_ > 0)
-        {
-            --remaining_seconds_;
-            if (remaining_seconds_ == 0)
+        dim_timer_ = timers_->ScheduleAfter(active_ns, [this]() {
+            int dimmed;
             {
-                should_dim = true;
-                brightness = min_brightness_;
+                std::lock_guard<std::mutex> lock(mutex_);
+                dimmed = min_brightness_;
             }
-        }
-    }
-    if (should_dim)
-    {
-        set_backlight_brightness(brightness);
+            set_backlight_brightness(dimmed);
+        });
     }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <mutex>
+#include "../TimerService.hpp"
 
 class Backlight
 {
@@ -11,12 +12,13 @@ public:
     // Immediate set of brightness (writes to sysfs)
     void set_backlight_brightness(int brightness);
 
+    // Dimming after the active duration runs on timers, which belong to the
+    // thread that calls Activate(); without them the backlight stays bright
+    void set_timer_service(TimerService *timers);
+
     // Activate the backlight for the configured active duration
     void Activate();
 
-    // Should be called once-per-second from main loop to manage timeout
-    void Tick();
-
     // Setters for behavior
     void set_active_seconds(int secs);
     void set_max_brightness(int brightness);
@@ -26,8 +28,10 @@ private:
     std::string device_path_;
     std::mutex mutex_;
 
+    TimerService *timers_{nullptr};
+    TimerService::TimerId dim_timer_{0};
+
     int active_seconds_{10};
-    int remaining_seconds_{0};
     int max_brightness_{115};
     int min_brightness_{20};
 };
\ No newline at end of file
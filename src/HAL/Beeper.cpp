@@ -1,3 +1,5 @@
+#define CUCKOO_LOG_MODULE "hal"
+
 #include "Beeper.hpp"
 #include <fcntl.h>
 #include <unistd.h>
@@ -1,6 +1,10 @@
+#define CUCKOO_LOG_MODULE "hal"
+
 #include "Display.hpp"
 #include "BitmapFont.hpp"
-#include "../Screens/CuckooLogoNest.hpp"
+#include "PixelConvert.hpp"
+#include "../Metrics.hpp"
+#include "../Assets/CuckooLogoNest.hpp"
 #ifdef BUILD_TARGET_LINUX
 #include <linux/fb.h>
 #endif
@@ -10,10 +14,15 @@
 #include <iostream>
 #include <unistd.h>
 #include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <time.h>
+#include "logger.h"
 
 
 Display::Display(std::string device_path)
     : device_path_(device_path)
+    , splash_(CuckooLogoNest)
 {
 	res_w_ = 320;
 	res_h_ = 320;
@@ -21,20 +30,12 @@ Display::Display(std::string device_path)
 
 Display::~Display()
 {
-    if (fbp != nullptr)
-    {
-        munmap(fbp, screensize);
-    }
-    if (screen_buffer >= 0)
-    {
-        close(screen_buffer);
-    }
+    ReleaseFramebuffer();
 }
 
 bool Display::Initialize(bool emulate)
 {
     lv_init();
-	lv_display_t *disp = NULL;
     if (emulate)
     {
 #ifdef HOST_TOOLCHAIN
@@ -47,24 +48,40 @@ bool Display::Initialize(bool emulate)
     else
     {
 #ifdef BUILD_TARGET_LINUX
-        //Create a display
-        disp = lv_linux_fbdev_create();
-        if (disp == NULL) {
-            perror("lv_linux_fbdev_create failed");
+        if (!InitializeFramebuffer())
             return false;
-        }
+#endif
+    }
+    if (disp == NULL)
+        return false;
+    lv_display_set_resolution(disp, res_w_, res_h_);
 
-        uint bufsize = (res_w_ * res_h_ * 4); //res_w_ * res_h_ * BYTES_PER_PIXEL;
-        working_buffer1 = malloc(bufsize);
-        working_buffer2 = malloc(bufsize);
-        lv_display_set_buffers(disp, working_buffer1, working_buffer2, bufsize, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    InitializeStyles();
 
-        lv_linux_fbdev_set_file(disp, "/dev/fb0");
-#endif
+    // Show the splash; it stays up until the caller is ready for the first screen
+    const lv_image_dsc_t *logo = splash_.Descriptor();
+    if (logo != nullptr)
+    {
+        // Extract background color from first pixel of image (RGB565 format)
+        uint16_t first_pixel = (logo->data[1] << 8) | logo->data[0];
+        SetBackgroundColor(PixelConvert::Rgb565ToXrgb8888(first_pixel) & 0xFFFFFF);
+        lv_obj_t * img1 = lv_image_create(lv_screen_active());
+        lv_image_set_src(img1, logo);
+        lv_obj_align(img1, LV_ALIGN_CENTER, 0, 0);
     }
-	lv_display_set_resolution(disp, res_w_, res_h_);
+    // Force a render
+    lv_timer_handler();
+
+    return true;
+}
 
-    // Setup fonts
+void Display::ReleaseSplash()
+{
+    splash_.Release();
+}
+
+void Display::InitializeStyles()
+{
     fontH1 = new lv_style_t;
     lv_style_init(fontH1);
     lv_style_set_text_font(fontH1, &lv_font_montserrat_48);
@@ -72,28 +89,232 @@ bool Display::Initialize(bool emulate)
     fontH2 = new lv_style_t;
     lv_style_init(fontH2);
     lv_style_set_text_font(fontH2, &lv_font_montserrat_28);
+}
 
-    // Display logo image
-    // Extract background color from first pixel of image (RGB565 format)
-    uint16_t first_pixel = (CuckooLogoNest.data[1] << 8) | CuckooLogoNest.data[0];
-    uint32_t bg_color = ((first_pixel & 0xF800) << 8) |  // Red (5 bits -> 8 bits)
-                        ((first_pixel & 0x07E0) << 5) |  // Green (6 bits -> 8 bits)
-                        ((first_pixel & 0x001F) << 3);   // Blue (5 bits -> 8 bits)
-    
-    SetBackgroundColor(bg_color);
-    lv_obj_t * img1 = lv_image_create(lv_screen_active());
-    lv_image_set_src(img1, &CuckooLogoNest);
-    lv_obj_align(img1, LV_ALIGN_CENTER, 0, 0);
-    // Force a render
-    lv_timer_handler();
-    
-    #ifdef HOST_TOOLCHAIN
-        usleep ( 500 * 1000 );   // 500ms
-    #else
-        sleep (3);
-    #endif
+static inline uint64_t MonotonicNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+bool Display::InitializeFramebuffer()
+{
+#ifdef BUILD_TARGET_LINUX
+    screen_buffer = open(device_path_.c_str(), O_RDWR);
+    if (screen_buffer < 0)
+    {
+        LOG_ERROR_STREAM("Display: failed to open framebuffer " << device_path_ << ": " << strerror(errno));
+        return false;
+    }
 
+    if (ioctl(screen_buffer, FBIOGET_FSCREENINFO, &finfo) != 0
+        || ioctl(screen_buffer, FBIOGET_VSCREENINFO, &vinfo) != 0)
+    {
+        LOG_ERROR_STREAM("Display: failed to query framebuffer info: " << strerror(errno));
+        ReleaseFramebuffer();
+        return false;
+    }
+
+    lv_color_format_t panel_format;
+    switch (vinfo.bits_per_pixel)
+    {
+        case 16: panel_format = LV_COLOR_FORMAT_RGB565; break;
+        case 24: panel_format = LV_COLOR_FORMAT_RGB888; break;
+        case 32: panel_format = LV_COLOR_FORMAT_XRGB8888; break;
+        default:
+            LOG_ERROR_STREAM("Display: unsupported framebuffer depth " << vinfo.bits_per_pixel << " bpp");
+            ReleaseFramebuffer();
+            return false;
+    }
+
+    // A 16-bit build renders RGB565 even on a 32-bit panel: half the bytes are
+    // touched while drawing and the flush widens the pixels on the way out
+    lv_color_format_t color_format = panel_format;
+#if LV_COLOR_DEPTH == 16
+    if (panel_format == LV_COLOR_FORMAT_XRGB8888)
+        color_format = LV_COLOR_FORMAT_RGB565;
+#endif
+    convert_565_to_8888_ = (color_format != panel_format);
+
+    res_w_ = vinfo.xres;
+    res_h_ = vinfo.yres;
+    bytes_per_pixel_ = vinfo.bits_per_pixel / 8;
+    render_bytes_per_pixel_ = (color_format == LV_COLOR_FORMAT_RGB565 ? 2 : bytes_per_pixel_);
+    line_length_ = finfo.line_length;
+
+    // Map the whole virtual area so both pages are reachable when flipping
+    screensize = static_cast<long>(finfo.line_length) * vinfo.yres_virtual;
+    if (finfo.smem_len > 0 && screensize > static_cast<long>(finfo.smem_len))
+        screensize = finfo.smem_len;
+
+    void *map = mmap(NULL, screensize, PROT_READ | PROT_WRITE, MAP_SHARED, screen_buffer, 0);
+    if (map == MAP_FAILED)
+    {
+        LOG_ERROR_STREAM("Display: failed to mmap framebuffer: " << strerror(errno));
+        ReleaseFramebuffer();
+        return false;
+    }
+    fbp = static_cast<char *>(map);
+
+    disp = lv_display_create(res_w_, res_h_);
+    if (disp == NULL)
+    {
+        LOG_ERROR_STREAM("Display: lv_display_create failed");
+        ReleaseFramebuffer();
+        return false;
+    }
+    lv_display_set_color_format(disp, color_format);
+    lv_display_set_user_data(disp, this);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    uint32_t page_size = line_length_ * vinfo.yres;
+    page_flipping_ = (!convert_565_to_8888_
+                      && vinfo.yres_virtual >= 2 * vinfo.yres
+                      && static_cast<long>(2 * page_size) <= screensize);
+
+    static MetricGauge &flipping = Metrics::Instance().Gauge(
+        "display_page_flipping", "1 when LVGL renders into two panned framebuffer pages, 0 for partial buffers");
+    flipping.Set(page_flipping_ ? 1 : 0);
+
+    if (page_flipping_)
+    {
+        // Render straight into the two framebuffer pages and pan between them
+        vinfo.yoffset = 0;
+        ioctl(screen_buffer, FBIOPAN_DISPLAY, &vinfo);
+        lv_display_set_buffers_with_stride(
+            disp, fbp, fbp + page_size, page_size, line_length_, LV_DISPLAY_RENDER_MODE_DIRECT);
+    }
+    else
+    {
+        // Small cache-line aligned buffers sized for a dirty region, copied line by line
+        uint32_t bufsize = res_w_ * PartialBufferLines * render_bytes_per_pixel_;
+        if (posix_memalign(&working_buffer1, 64, bufsize) != 0
+            || posix_memalign(&working_buffer2, 64, bufsize) != 0)
+        {
+            LOG_ERROR_STREAM("Display: failed to allocate render buffers");
+            ReleaseFramebuffer();
+            return false;
+        }
+        lv_display_set_buffers(disp, working_buffer1, working_buffer2, bufsize, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    }
+
+    LOG_INFO_STREAM("Display: " << device_path_ << " " << vinfo.xres << "x" << vinfo.yres
+        << " (virtual " << vinfo.xres_virtual << "x" << vinfo.yres_virtual << ") "
+        << vinfo.bits_per_pixel << " bpp, stride " << line_length_
+        << (page_flipping_ ? ", page flipping" : ", partial buffers")
+        << (convert_565_to_8888_ ? (PixelConvert::HasNeon() ? ", RGB565 render (NEON convert)" : ", RGB565 render") : ""));
     return true;
+#else
+    return false;
+#endif
+}
+
+void Display::ReleaseFramebuffer()
+{
+    if (fbp != nullptr)
+    {
+        munmap(fbp, screensize);
+        fbp = nullptr;
+    }
+    if (screen_buffer >= 0)
+    {
+        close(screen_buffer);
+        screen_buffer = -1;
+    }
+    free(working_buffer1);
+    working_buffer1 = nullptr;
+    free(working_buffer2);
+    working_buffer2 = nullptr;
+}
+
+void Display::flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    Display *display = static_cast<Display *>(lv_display_get_user_data(disp));
+    display->FlushFramebuffer(area, px_map);
+    lv_display_flush_ready(disp);
+}
+
+void Display::FlushFramebuffer(const lv_area_t *area, uint8_t *px_map)
+{
+#ifdef BUILD_TARGET_LINUX
+    uint64_t start = MonotonicNs();
+    uint64_t bytes = 0;
+    bool last = lv_display_flush_is_last(disp);
+
+    if (page_flipping_)
+    {
+        // px_map is the page LVGL just finished; show it once the frame is complete
+        if (last)
+        {
+            vinfo.yoffset = (px_map == reinterpret_cast<uint8_t *>(fbp)) ? 0 : vinfo.yres;
+            if (ioctl(screen_buffer, FBIOPAN_DISPLAY, &vinfo) == 0)
+                flush_stats_.page_flips++;
+            else
+                LOG_ERROR_STREAM("Display: FBIOPAN_DISPLAY failed: " << strerror(errno));
+        }
+    }
+    else
+    {
+        int32_t w = lv_area_get_width(area);
+        int32_t h = lv_area_get_height(area);
+        uint32_t src_row_bytes = w * render_bytes_per_pixel_;
+        uint32_t dst_row_bytes = w * bytes_per_pixel_;
+        char *dst = fbp + (area->y1 + vinfo.yoffset) * line_length_ + (area->x1 + vinfo.xoffset) * bytes_per_pixel_;
+        for (int32_t y = 0; y < h; y++)
+        {
+            if (convert_565_to_8888_)
+                PixelConvert::Rgb565ToXrgb8888(
+                    reinterpret_cast<const uint16_t *>(px_map), reinterpret_cast<uint32_t *>(dst), w);
+            else
+                memcpy(dst, px_map, dst_row_bytes);
+            dst += line_length_;
+            px_map += src_row_bytes;
+        }
+        bytes = static_cast<uint64_t>(dst_row_bytes) * h;
+    }
+
+    AccountFlush(bytes, MonotonicNs() - start, last);
+#else
+    (void)area;
+    (void)px_map;
+#endif
+}
+
+void Display::AccountFlush(uint64_t bytes, uint64_t elapsed_ns, bool last)
+{
+    static MetricCounter &bytes_total = Metrics::Instance().Counter(
+        "display_flush_bytes_total", "Bytes copied or converted into the framebuffer");
+    static MetricHistogram &frame_us = Metrics::Instance().Histogram(
+        "display_frame_flush_us", "Time spent flushing one frame to the framebuffer");
+
+    bytes_total.Add(bytes);
+    flush_stats_.flushes++;
+    flush_stats_.bytes_copied += bytes;
+    flush_stats_.total_flush_ns += elapsed_ns;
+    frame_bytes_ += bytes;
+    frame_flush_ns_ += elapsed_ns;
+
+    if (!last)
+        return;
+
+    flush_stats_.frames++;
+    flush_stats_.last_frame_bytes = frame_bytes_;
+    flush_stats_.last_frame_flush_ns = frame_flush_ns_;
+    if (frame_flush_ns_ > flush_stats_.max_frame_flush_ns)
+        flush_stats_.max_frame_flush_ns = frame_flush_ns_;
+    frame_us.Record(frame_flush_ns_ / 1000);
+    frame_bytes_ = 0;
+    frame_flush_ns_ = 0;
+
+    if (flush_stats_.frames % FlushReportFrames == 0)
+    {
+        LOG_DEBUG_STREAM("Display: " << flush_stats_.frames << " frames, last frame "
+            << flush_stats_.last_frame_bytes << " bytes in " << flush_stats_.last_frame_flush_ns / 1000 << " us"
+            << ", avg flush " << (flush_stats_.total_flush_ns / flush_stats_.frames) / 1000 << " us"
+            << ", max " << flush_stats_.max_frame_flush_ns / 1000 << " us"
+            << ", " << flush_stats_.page_flips << " page flips");
+    }
 }
 
 void Display::SetBackgroundColor(uint32_t color)
@@ -129,7 +350,7 @@ void Display::DrawText(int x, int y, const std::string &text, uint32_t color, Fo
     lv_obj_set_y(label, y);
 }
 
-void Display::TimerHandler()
+uint32_t Display::TimerHandler()
 {
-    lv_timer_handler();
+    return lv_timer_handler();
 }
\ No newline at end of file
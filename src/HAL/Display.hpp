@@ -7,32 +7,77 @@
 
 #include "lvgl/lvgl.h"
 #include "IDisplay.hpp"
+#include "../Assets/ImageAsset.hpp"
 
 class Display : public IDisplay {
 public:
+    // Per-frame flush accounting for the framebuffer backend
+    struct FlushStats {
+        uint64_t frames = 0;
+        uint64_t flushes = 0;
+        uint64_t bytes_copied = 0;
+        uint64_t last_frame_bytes = 0;
+        uint64_t total_flush_ns = 0;
+        uint64_t last_frame_flush_ns = 0;
+        uint64_t max_frame_flush_ns = 0;
+        uint64_t page_flips = 0;
+    };
+
     Display(std::string device_path);
     ~Display() override;
     bool Initialize(bool emulate) override;
     void SetBackgroundColor(uint32_t color) override;
     void DrawText(int x, int y, const std::string &text, uint32_t color = 0xFFFFFF, Font font = Font::FONT_DEFAULT) override;
-    void TimerHandler() override;
+    uint32_t TimerHandler() override;
+
+    // Frees the decoded boot logo; call once the splash has been replaced
+    void ReleaseSplash();
+
+    inline bool IsConvertingRgb565() const { return convert_565_to_8888_; }
+
+protected:
+    // Font styles used by DrawText, shared by every LVGL backend
+    void InitializeStyles();
+
+    // lvgl display members
+    lv_display_t *disp = nullptr;
+    lv_style_t *fontH2 = nullptr;
+    lv_style_t *fontH1 = nullptr;
 
 private:
+    bool InitializeFramebuffer();
+    void ReleaseFramebuffer();
+    void FlushFramebuffer(const lv_area_t *area, uint8_t *px_map);
+    void AccountFlush(uint64_t bytes, uint64_t elapsed_ns, bool last);
+
+    static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+
+    // Partial render buffers cover this many lines when page flipping is unavailable
+    static const int PartialBufferLines = 40;
+    // Emit a flush summary every N frames
+    static const int FlushReportFrames = 300;
+
     std::string device_path_;
-    int screen_buffer;
-    char *fbp;
-	void *working_buffer1;
-	void *working_buffer2;
-    long screensize;
-    
+    int screen_buffer = -1;
+    char *fbp = nullptr;
+    void *working_buffer1 = nullptr;
+    void *working_buffer2 = nullptr;
+    long screensize = 0;
+
+    // Framebuffer geometry as reported by the driver
+    uint32_t line_length_ = 0;
+    uint32_t bytes_per_pixel_ = 0;
+    uint32_t render_bytes_per_pixel_ = 0;
+    bool convert_565_to_8888_ = false;
+    bool page_flipping_ = false;
+    uint64_t frame_bytes_ = 0;
+    uint64_t frame_flush_ns_ = 0;
+    FlushStats flush_stats_;
+    ImageAsset splash_;
+
     // Screen info
 #ifdef BUILD_TARGET_LINUX
     struct fb_var_screeninfo vinfo;
     struct fb_fix_screeninfo finfo;
 #endif
-
-    // lvgl display members
-    lv_display_t *disp;
-    lv_style_t *fontH2;
-    lv_style_t *fontH1;
-};
\ No newline at end of file
+};
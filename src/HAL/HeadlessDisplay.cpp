@@ -0,0 +1,133 @@
+#define CUCKOO_LOG_MODULE "hal"
+
+#include "HeadlessDisplay.hpp"
+#include "PixelConvert.hpp"
+#include <cstdlib>
+#include <cstring>
+#include "logger.h"
+
+uint32_t HeadlessDisplay::now_ms_ = 0;
+
+HeadlessDisplay::HeadlessDisplay(int width, int height)
+    : Display("")
+{
+    res_w_ = width;
+    res_h_ = height;
+}
+
+HeadlessDisplay::~HeadlessDisplay()
+{
+    if (disp != nullptr)
+    {
+        lv_display_delete(disp);
+        disp = nullptr;
+    }
+    free(frame_);
+    frame_ = nullptr;
+}
+
+bool HeadlessDisplay::Initialize(bool emulate)
+{
+    (void)emulate;
+    if (!lv_is_initialized())
+        lv_init();
+    lv_tick_set_cb(tick_cb);
+
+#if LV_COLOR_DEPTH == 16
+    color_format_ = LV_COLOR_FORMAT_RGB565;
+    bytes_per_pixel_ = 2;
+#else
+    color_format_ = LV_COLOR_FORMAT_XRGB8888;
+    bytes_per_pixel_ = 4;
+#endif
+    stride_ = res_w_ * bytes_per_pixel_;
+
+    uint32_t size = stride_ * res_h_;
+    void *buffer = nullptr;
+    if (posix_memalign(&buffer, 64, size) != 0)
+    {
+        LOG_ERROR_STREAM("HeadlessDisplay: failed to allocate " << size << " byte frame");
+        return false;
+    }
+    frame_ = static_cast<uint8_t *>(buffer);
+    memset(frame_, 0, size);
+
+    disp = lv_display_create(res_w_, res_h_);
+    if (disp == NULL)
+    {
+        LOG_ERROR_STREAM("HeadlessDisplay: lv_display_create failed");
+        return false;
+    }
+    lv_display_set_color_format(disp, color_format_);
+    lv_display_set_user_data(disp, this);
+    lv_display_set_flush_cb(disp, flush_cb);
+    // A single full-size buffer always holds the complete frame, so it can be
+    // inspected or dumped at any point without a copy
+    lv_display_set_buffers(disp, frame_, NULL, size, LV_DISPLAY_RENDER_MODE_DIRECT);
+
+    InitializeStyles();
+
+    LOG_INFO_STREAM("HeadlessDisplay: " << res_w_ << "x" << res_h_ << " " << bytes_per_pixel_ * 8 << " bpp");
+    return true;
+}
+
+void HeadlessDisplay::AdvanceTime(uint32_t ms)
+{
+    now_ms_ += ms;
+}
+
+uint32_t HeadlessDisplay::NowMs()
+{
+    return now_ms_;
+}
+
+uint32_t HeadlessDisplay::tick_cb()
+{
+    return now_ms_;
+}
+
+void HeadlessDisplay::flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    (void)px_map;
+    HeadlessDisplay *display = static_cast<HeadlessDisplay *>(lv_display_get_user_data(disp));
+    display->FlushFrame(area, lv_display_flush_is_last(disp));
+    lv_display_flush_ready(disp);
+}
+
+void HeadlessDisplay::FlushFrame(const lv_area_t *area, bool last)
+{
+    frame_stats_.flushes++;
+    frame_areas_++;
+    frame_pixels_ += static_cast<uint64_t>(lv_area_get_width(area)) * lv_area_get_height(area);
+
+    if (!last)
+        return;
+
+    frame_stats_.frames++;
+    frame_stats_.invalidated_pixels += frame_pixels_;
+    frame_stats_.last_frame_pixels = frame_pixels_;
+    frame_stats_.last_frame_areas = frame_areas_;
+    frame_pixels_ = 0;
+    frame_areas_ = 0;
+}
+
+void HeadlessDisplay::CopyRgb888(std::vector<uint8_t> &out) const
+{
+    out.resize(static_cast<size_t>(res_w_) * res_h_ * 3);
+    uint8_t *dst = out.data();
+    for (int y = 0; y < res_h_; y++)
+    {
+        const uint8_t *row = frame_ + y * stride_;
+        for (int x = 0; x < res_w_; x++)
+        {
+            uint32_t px;
+            if (bytes_per_pixel_ == 2)
+                px = PixelConvert::Rgb565ToXrgb8888(reinterpret_cast<const uint16_t *>(row)[x]);
+            else
+                px = reinterpret_cast<const uint32_t *>(row)[x];
+            *dst++ = (px >> 16) & 0xFF;
+            *dst++ = (px >> 8) & 0xFF;
+            *dst++ = px & 0xFF;
+        }
+    }
+}
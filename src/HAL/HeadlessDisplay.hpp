@@ -0,0 +1,53 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "lvgl/lvgl.h"
+#include "Display.hpp"
+
+// LVGL display rendering into an in-memory frame, for benchmarks and CI.
+// Time is virtual: LVGL only advances when AdvanceTime() is called, so a
+// scripted run produces the same frames on every machine.
+class HeadlessDisplay : public Display {
+public:
+    // Per-frame invalidation accounting
+    struct FrameStats {
+        uint64_t frames = 0;
+        uint64_t flushes = 0;
+        uint64_t invalidated_pixels = 0;
+        uint64_t last_frame_pixels = 0;
+        uint32_t last_frame_areas = 0;
+    };
+
+    HeadlessDisplay(int width = 320, int height = 320);
+    ~HeadlessDisplay() override;
+    bool Initialize(bool emulate) override;
+
+    void AdvanceTime(uint32_t ms);
+    static uint32_t NowMs();
+
+    inline const FrameStats &GetFrameStats() const { return frame_stats_; }
+    inline const uint8_t *Pixels() const { return frame_; }
+    inline uint32_t Stride() const { return stride_; }
+    inline lv_color_format_t ColorFormat() const { return color_format_; }
+
+    // Current frame as packed 8-bit RGB triplets, row major
+    void CopyRgb888(std::vector<uint8_t> &out) const;
+
+private:
+    void FlushFrame(const lv_area_t *area, bool last);
+
+    static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+    static uint32_t tick_cb();
+
+    static uint32_t now_ms_;
+
+    uint8_t *frame_ = nullptr;
+    uint32_t stride_ = 0;
+    uint32_t bytes_per_pixel_ = 0;
+    lv_color_format_t color_format_ = LV_COLOR_FORMAT_XRGB8888;
+    uint64_t frame_pixels_ = 0;
+    uint32_t frame_areas_ = 0;
+    FrameStats frame_stats_;
+};
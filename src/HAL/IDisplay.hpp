@@ -14,7 +14,8 @@ public:
     virtual bool Initialize(bool emulate) = 0;
     virtual void SetBackgroundColor(uint32_t color) = 0;
     virtual void DrawText(int x, int y, const std::string &text, uint32_t color = 0xFFFFFF, Font font = Font::FONT_DEFAULT) = 0;
-    virtual void TimerHandler() = 0;
+    // Runs LVGL's due timers; returns milliseconds until it needs to run again
+    virtual uint32_t TimerHandler() = 0;
 
     inline int width() const { return res_w_; };
     inline int height() const { return res_h_; };
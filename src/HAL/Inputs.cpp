@@ -1,4 +1,6 @@
 #include "Inputs.hpp"
+#include "trace.h"
+#include "../Reactor.hpp"
 #include <unistd.h>
 #include <fcntl.h>
 #include <cstring>
@@ -58,8 +60,20 @@ void Inputs::stop_polling()
     }
 }
 
+bool Inputs::attach(Reactor &reactor)
+{
+    if (!initialize()) {
+        return false;
+    }
+
+    // Drain until EAGAIN so one wakeup covers a whole burst of rotary steps
+    return reactor.Add(button_fd_, [this]() { while (poll_device(InputDeviceType::BUTTON, button_fd_)) {} }) &&
+           reactor.Add(rotary_fd_, [this]() { while (poll_device(InputDeviceType::ROTARY, rotary_fd_)) {} });
+}
+
 void Inputs::polling_loop()
 {
+    TRACE_THREAD_NAME("input");
     while (!should_stop_) 
     {
         bool button_event = poll_device(InputDeviceType::BUTTON, button_fd_);
@@ -6,6 +6,8 @@
 #include "InputEvent.hpp"
 #include "InputDevices.hxx"
 
+class Reactor;
+
 class Inputs {
 public:
     // Callback function type for input events
@@ -21,6 +23,9 @@ public:
     bool initialize();
     bool start_polling();
     void stop_polling();
+    // Instead of start_polling(): the reactor's thread reads both devices when they
+    // are readable and calls the callback there, with no polling thread
+    bool attach(Reactor &reactor);
     
     // Set callback for input events
     inline void set_callback(InputCallback callback) { callback_ = callback; };
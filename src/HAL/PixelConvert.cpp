@@ -0,0 +1,47 @@
+#include "PixelConvert.hpp"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PIXEL_CONVERT_NEON 1
+#endif
+
+void PixelConvert::Rgb565ToXrgb8888Scalar(const uint16_t *src, uint32_t *dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        dst[i] = Rgb565ToXrgb8888(src[i]);
+}
+
+void PixelConvert::Rgb565ToXrgb8888(const uint16_t *src, uint32_t *dst, size_t count)
+{
+#ifdef PIXEL_CONVERT_NEON
+    // 8 pixels per iteration: split into 8-bit channels, replicate the top bits
+    // into the low bits (same rounding as the scalar path) and interleave B,G,R,X
+    const uint8x8_t alpha = vdup_n_u8(0xFF);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        uint16x8_t p = vld1q_u16(src + i);
+        uint8x8_t r = vshrn_n_u16(p, 8);                  // RRRRRGGG
+        uint8x8_t g = vshrn_n_u16(p, 3);                  // GGGGGGBB
+        uint8x8_t b = vmovn_u16(vshlq_n_u16(p, 3));       // BBBBB000
+        uint8x8x4_t out;
+        out.val[0] = vsri_n_u8(b, b, 5);
+        out.val[1] = vsri_n_u8(g, g, 6);
+        out.val[2] = vsri_n_u8(r, r, 5);
+        out.val[3] = alpha;
+        vst4_u8(reinterpret_cast<uint8_t *>(dst + i), out);
+    }
+    Rgb565ToXrgb8888Scalar(src + i, dst + i, count - i);
+#else
+    Rgb565ToXrgb8888Scalar(src, dst, count);
+#endif
+}
+
+bool PixelConvert::HasNeon()
+{
+#ifdef PIXEL_CONVERT_NEON
+    return true;
+#else
+    return false;
+#endif
+}
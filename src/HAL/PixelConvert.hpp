@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Pixel format helpers used when the LVGL render format differs from the panel.
+// Rows are converted with NEON when the target is built with -mfpu=neon.
+class PixelConvert
+{
+public:
+    // RGB565 -> XRGB8888 (little endian B,G,R,X byte order), alpha byte set to 0xFF
+    static void Rgb565ToXrgb8888(const uint16_t *src, uint32_t *dst, size_t count);
+
+    // Scalar reference implementation, always available (used for the row tails)
+    static void Rgb565ToXrgb8888Scalar(const uint16_t *src, uint32_t *dst, size_t count);
+
+    static inline uint32_t Rgb565ToXrgb8888(uint16_t p)
+    {
+        uint32_t r = (p >> 11) & 0x1F;
+        uint32_t g = (p >> 5) & 0x3F;
+        uint32_t b = p & 0x1F;
+        r = (r << 3) | (r >> 2);
+        g = (g << 2) | (g >> 4);
+        b = (b << 3) | (b >> 2);
+        return 0xFF000000u | (r << 16) | (g << 8) | b;
+    }
+
+    static inline uint16_t Xrgb8888ToRgb565(uint32_t p)
+    {
+        return static_cast<uint16_t>(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+    }
+
+    // True when the NEON row converter was compiled in
+    static bool HasNeon();
+};
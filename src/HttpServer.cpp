@@ -0,0 +1,358 @@
+#define CUCKOO_LOG_MODULE "http"
+
+#include "HttpServer.hpp"
+#include "Metrics.hpp"
+#include "logger.h"
+#include "trace.h"
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <vector>
+
+static const char *StatusText(int status)
+{
+    switch (status)
+    {
+        case 200: return "OK";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default: return "Unknown";
+    }
+}
+
+static HttpServer::Response ErrorResponse(int status)
+{
+    HttpServer::Response response;
+    response.status = status;
+    response.body = std::string(StatusText(status)) + "\n";
+    return response;
+}
+
+HttpServer::HttpServer()
+{
+    running_.store(false);
+}
+
+HttpServer::~HttpServer()
+{
+    Stop();
+    for (auto &item : connections_)
+        close(item.first);
+    connections_.clear();
+    if (listen_fd_ >= 0)
+        close(listen_fd_);
+    if (wake_fd_ >= 0)
+        close(wake_fd_);
+    if (epoll_fd_ >= 0)
+        close(epoll_fd_);
+}
+
+void HttpServer::Route(const std::string &path, Handler handler)
+{
+    routes_[path] = std::move(handler);
+}
+
+bool HttpServer::Listen(const std::string &address, int port)
+{
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1)
+    {
+        LOG_ERROR_STREAM("HttpServer: invalid listen address " << address);
+        return false;
+    }
+
+    listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0)
+    {
+        LOG_ERROR_STREAM("HttpServer: socket failed: " << strerror(errno));
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (bind(listen_fd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0
+        || listen(listen_fd_, MaxConnections) != 0)
+    {
+        LOG_ERROR_STREAM("HttpServer: cannot listen on " << address << ":" << port << ": " << strerror(errno));
+        close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+
+    socklen_t length = sizeof(addr);
+    getsockname(listen_fd_, reinterpret_cast<struct sockaddr *>(&addr), &length);
+    port_ = ntohs(addr.sin_port);
+
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epoll_fd_ < 0 || wake_fd_ < 0)
+    {
+        LOG_ERROR_STREAM("HttpServer: epoll setup failed: " << strerror(errno));
+        return false;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = listen_fd_;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &event);
+    event.data.fd = wake_fd_;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event);
+
+    LOG_INFO_STREAM("HttpServer: listening on " << address << ":" << port_);
+    return true;
+}
+
+bool HttpServer::Start()
+{
+    if (epoll_fd_ < 0 || running_.load())
+        return false;
+    running_.store(true);
+    thread_ = std::thread([this]() { Run(); });
+    return true;
+}
+
+void HttpServer::Stop()
+{
+    if (!running_.exchange(false))
+        return;
+    uint64_t one = 1;
+    if (write(wake_fd_, &one, sizeof(one)) != sizeof(one))
+        LOG_WARN_STREAM("HttpServer: cannot wake the server thread: " << strerror(errno));
+    if (thread_.joinable())
+        thread_.join();
+}
+
+void HttpServer::Run()
+{
+    TRACE_THREAD_NAME("http");
+    while (running_.load())
+        Poll(-1);
+}
+
+void HttpServer::Poll(int timeout_ms)
+{
+    // Open connections need the idle sweep; with none there is nothing to time out
+    if (!connections_.empty() && (timeout_ms < 0 || timeout_ms > 1000))
+        timeout_ms = 1000;
+
+    struct epoll_event events[MaxConnections + 2];
+    int count = epoll_wait(epoll_fd_, events, MaxConnections + 2, timeout_ms);
+    if (count < 0 && errno != EINTR)
+        LOG_ERROR_STREAM("HttpServer: epoll_wait failed: " << strerror(errno));
+
+    for (int i = 0; i < count; ++i)
+    {
+        int fd = events[i].data.fd;
+        if (fd == listen_fd_)
+        {
+            Accept();
+            continue;
+        }
+        if (fd == wake_fd_)
+        {
+            uint64_t value;
+            if (read(wake_fd_, &value, sizeof(value)) < 0 && errno != EAGAIN)
+                LOG_WARN_STREAM("HttpServer: wake read failed: " << strerror(errno));
+            continue;
+        }
+
+        auto it = connections_.find(fd);
+        if (it == connections_.end())
+            continue;
+        if (!it->second.output.empty())
+            OnWritable(fd, it->second);
+        else
+            OnReadable(fd, it->second);
+    }
+
+    if (!connections_.empty())
+        CloseIdle();
+}
+
+void HttpServer::Accept()
+{
+    while (true)
+    {
+        int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                LOG_WARN_STREAM("HttpServer: accept failed: " << strerror(errno));
+            return;
+        }
+
+        if (static_cast<int>(connections_.size()) >= MaxConnections)
+        {
+            close(fd);
+            continue;
+        }
+
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0)
+        {
+            close(fd);
+            continue;
+        }
+        connections_[fd].last_active_ms = NowMs();
+    }
+}
+
+void HttpServer::OnReadable(int fd, Connection &connection)
+{
+    char buffer[1024];
+    bool peer_closed = false;
+    while (true)
+    {
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n > 0)
+        {
+            connection.input.append(buffer, static_cast<size_t>(n));
+            if (connection.input.size() > MaxRequestBytes)
+            {
+                Respond(fd, connection, ErrorResponse(431));
+                return;
+            }
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        if (n < 0 && errno == EINTR)
+            continue;
+        peer_closed = true;
+        break;
+    }
+
+    connection.last_active_ms = NowMs();
+    size_t head_end = connection.input.find("\r\n\r\n");
+    if (head_end == std::string::npos)
+        head_end = connection.input.find("\n\n");
+    if (head_end != std::string::npos)
+        Respond(fd, connection, Dispatch(connection.input.substr(0, head_end)));
+    else if (peer_closed)
+        CloseConnection(fd);
+}
+
+void HttpServer::OnWritable(int fd, Connection &connection)
+{
+    while (connection.sent < connection.output.size())
+    {
+        ssize_t n = send(fd, connection.output.data() + connection.sent,
+                         connection.output.size() - connection.sent, MSG_NOSIGNAL);
+        if (n > 0)
+        {
+            connection.sent += static_cast<size_t>(n);
+            connection.last_active_ms = NowMs();
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return;
+        break;
+    }
+    CloseConnection(fd);
+}
+
+void HttpServer::Respond(int fd, Connection &connection, const Response &response)
+{
+    static MetricCounter &requests = Metrics::Instance().Counter(
+        "http_server_requests_total", "Requests answered by the diagnostics HTTP server");
+    requests.Add();
+
+    bool head_only = connection.input.compare(0, 5, "HEAD ") == 0;
+    std::string output = "HTTP/1.0 " + std::to_string(response.status) + " " + StatusText(response.status) + "\r\n"
+        + "Content-Type: " + response.content_type + "\r\n"
+        + "Content-Length: " + std::to_string(response.body.size()) + "\r\n"
+        + "Connection: close\r\n\r\n";
+    if (!head_only)
+        output += response.body;
+
+    connection.input.clear();
+    connection.output.swap(output);
+    connection.sent = 0;
+
+    // Only wait for writability when the socket buffer cannot take it all at once
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLOUT;
+    event.data.fd = fd;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd, &event);
+    OnWritable(fd, connection);
+}
+
+HttpServer::Response HttpServer::Dispatch(const std::string &request_head)
+{
+    std::string line = request_head.substr(0, request_head.find('\n'));
+    if (!line.empty() && line[line.size() - 1] == '\r')
+        line.erase(line.size() - 1);
+
+    size_t method_end = line.find(' ');
+    size_t target_end = method_end == std::string::npos ? std::string::npos : line.find(' ', method_end + 1);
+    if (method_end == std::string::npos || target_end == std::string::npos
+        || line.compare(target_end + 1, 5, "HTTP/") != 0)
+        return ErrorResponse(400);
+
+    Request request;
+    request.method = line.substr(0, method_end);
+    std::string target = line.substr(method_end + 1, target_end - method_end - 1);
+    size_t query_start = target.find('?');
+    request.path = target.substr(0, query_start);
+    if (query_start != std::string::npos)
+        request.query = target.substr(query_start + 1);
+
+    if (request.method != "GET" && request.method != "HEAD")
+        return ErrorResponse(405);
+
+    auto route = routes_.find(request.path);
+    if (route == routes_.end())
+        return ErrorResponse(404);
+
+    LOG_DEBUG_STREAM("HttpServer: " << request.method << " " << target);
+    TRACE_SCOPE("HttpServer::Dispatch");
+    return route->second(request);
+}
+
+void HttpServer::CloseConnection(int fd)
+{
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections_.erase(fd);
+}
+
+void HttpServer::CloseIdle()
+{
+    uint64_t now = NowMs();
+    std::vector<int> idle;
+    for (const auto &item : connections_)
+    {
+        if (now - item.second.last_active_ms >= static_cast<uint64_t>(IdleTimeoutMs))
+            idle.push_back(item.first);
+    }
+    for (int fd : idle)
+        CloseConnection(fd);
+}
+
+uint64_t HttpServer::NowMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000ull + static_cast<uint64_t>(ts.tv_nsec / 1000000);
+}
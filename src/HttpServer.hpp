@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <stdint.h>
+
+/**
+ * @brief Minimal HTTP/1.0 server for local diagnostics
+ *
+ * One thread multiplexes the listening socket and every client connection
+ * with epoll; nothing runs while no request is pending. Each connection
+ * carries a single GET, is answered from a registered route and closed.
+ * Handlers run on the server thread and must only read state that is safe
+ * to read from there.
+ *
+ * Start() runs the loop on its own thread. A caller with its own event loop
+ * can instead watch Fd() for readability and call Poll(0).
+ */
+class HttpServer
+{
+public:
+    struct Request
+    {
+        std::string method;
+        std::string path;   // without the query string
+        std::string query;
+    };
+
+    struct Response
+    {
+        int status = 200;
+        std::string content_type = "text/plain; charset=utf-8";
+        std::string body;
+    };
+
+    using Handler = std::function<Response(const Request &request)>;
+
+    HttpServer();
+    ~HttpServer();
+
+    // Register before Listen(); paths match exactly
+    void Route(const std::string &path, Handler handler);
+
+    // Binds address:port; port 0 picks a free one (see Port())
+    bool Listen(const std::string &address, int port);
+    inline int Port() const { return port_; }
+
+    bool Start();
+    void Stop();
+
+    // epoll descriptor; readable whenever Poll() has work
+    inline int Fd() const { return epoll_fd_; }
+    // Handles ready events, waiting at most timeout_ms (-1 forever)
+    void Poll(int timeout_ms);
+
+    static const size_t MaxRequestBytes = 4096;
+    static const int MaxConnections = 16;
+    static const int IdleTimeoutMs = 5000;
+
+private:
+    struct Connection
+    {
+        std::string input;
+        std::string output;
+        size_t sent = 0;
+        uint64_t last_active_ms = 0;
+    };
+
+    void Accept();
+    void OnReadable(int fd, Connection &connection);
+    void OnWritable(int fd, Connection &connection);
+    void Respond(int fd, Connection &connection, const Response &response);
+    void CloseConnection(int fd);
+    void CloseIdle();
+    Response Dispatch(const std::string &request_head);
+    void Run();
+    static uint64_t NowMs();
+
+    std::map<std::string, Handler> routes_;
+    std::map<int, Connection> connections_;
+    int epoll_fd_ = -1;
+    int listen_fd_ = -1;
+    int wake_fd_ = -1;
+    int port_ = 0;
+    std::thread thread_;
+    std::atomic<bool> running_;
+};
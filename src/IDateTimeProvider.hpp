@@ -1,7 +1,16 @@
 #pragma once
 #include <sys/time.h>
+#include <stdint.h>
 
 class IDateTimeProvider {
     public:
     virtual int gettimeofday (struct timeval &timeval) = 0;    
-};
\ No newline at end of file
+
+    // Clock for timers, in nanoseconds. Defaults to gettimeofday() so that a
+    // provider with a simulated time of day drives timers as well.
+    virtual uint64_t monotonic_ns() {
+        struct timeval tv = {0, 0};
+        gettimeofday(tv);
+        return static_cast<uint64_t>(tv.tv_sec) * 1000000000ull + static_cast<uint64_t>(tv.tv_usec) * 1000ull;
+    }
+};
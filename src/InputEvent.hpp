@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdint.h>
 #include "HAL/InputEvent.hpp"
 #include "HAL/InputDevices.hxx"
 
@@ -9,4 +10,6 @@ public:
         : device_type(device_type), event(event) {}
     InputDeviceType device_type;
     struct input_event event;
+    // MetricTimer::NowUs() when the event was queued for the UI thread
+    uint64_t queued_us = 0;
 };
\ No newline at end of file
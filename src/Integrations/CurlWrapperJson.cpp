@@ -1,10 +1,14 @@
+#define CUCKOO_LOG_MODULE "integrations"
 
 #include <string>
 #include <algorithm> 
 #include <functional> 
+#include <time.h>
 
 #include "CurlWrapperJson.hpp"
+#include "../Metrics.hpp"
 #include "logger.h"
+#include "trace.h"
 
 #include <json11.hpp>
 
@@ -36,6 +40,30 @@ static std::vector<std::string> splitLlines(const std::string& input)
 }
 
 
+static MetricGauge &lastSuccessGauge()
+{
+    static MetricGauge &gauge = Metrics::Instance().Gauge(
+        "http_last_success_timestamp_seconds", "When Home Assistant last answered a request");
+    return gauge;
+}
+
+static MetricGauge &lastFailureGauge()
+{
+    static MetricGauge &gauge = Metrics::Instance().Gauge(
+        "http_last_failure_timestamp_seconds", "When a Home Assistant request last failed in curl");
+    return gauge;
+}
+
+int64_t CurlWrapperJson::LastSuccessTime()
+{
+    return lastSuccessGauge().Value();
+}
+
+int64_t CurlWrapperJson::LastFailureTime()
+{
+    return lastFailureGauge().Value();
+}
+
 bool CurlWrapperJson::Startup()
 {
     if(!curlInitialized_)
@@ -63,6 +91,12 @@ void CurlWrapperJson::Shutdown()
 
 json11::Json CurlWrapperJson::jsonGetOrPost(std::string url, std::string const &postData)
 {
+    TRACE_SCOPE("CurlWrapperJson::jsonGetOrPost");
+    static MetricHistogram &request_us = Metrics::Instance().Histogram(
+        "http_request_duration_us", "Home Assistant request time, including connection setup");
+    static MetricCounter &request_failures = Metrics::Instance().Counter(
+        "http_request_failures_total", "Home Assistant requests that failed in curl");
+
     json11::Json js;
 
     Startup();
@@ -90,10 +124,15 @@ json11::Json CurlWrapperJson::jsonGetOrPost(std::string url, std::string const &
             curlWrapper_.easy_setopt(curl_, CURLOPT_POSTFIELDS, postData.c_str());
         }
 
-        CURLcode res = curlWrapper_.easy_perform(curl_);
+        CURLcode res;
+        {
+            MetricTimer timer(request_us);
+            res = curlWrapper_.easy_perform(curl_);
+        }
 
         if(res == CURLE_OK)
         {
+            lastSuccessGauge().Set(time(nullptr));
             // LOG_INFO_STREAM("CurlWrapperJson request completed headers = "<< responseHeaders);
             std::vector<std::string> headers = splitLlines(responseHeaders);
             bool responseIsJsonContent = false;
@@ -117,7 +156,11 @@ json11::Json CurlWrapperJson::jsonGetOrPost(std::string url, std::string const &
 
         }
         else
+        {
+            request_failures.Add();
+            lastFailureGauge().Set(time(nullptr));
             LOG_ERROR_STREAM("CurlWrapperJson request failed: " << curlWrapper_.easy_strerror(res));
+        }
 
         if(headers)
             curlWrapper_.slist_free_all(headers);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <stdint.h>
 
 #include "CurlWrapper.hpp"
 #include <json11.hpp>
@@ -22,6 +23,11 @@ public:
 
     json11::Json jsonGetOrPost(std::string url, std::string const &postData = "");
 
+    // Wall clock time of the last request that got / failed to get an answer,
+    // across all instances; 0 until the first one
+    static int64_t LastSuccessTime();
+    static int64_t LastFailureTime();
+
 protected:
     CurlWrapper curlWrapper_;
     bool curlInitialized_ = false;
@@ -1,9 +1,12 @@
 #pragma once
+#include <mutex>
 #include <string>
 
 #include "IntegrationSwitchBase.hpp"
 #include "HomeAssistantCreds.hpp"
 #include "CurlWrapperJson.hpp"
+#include "../Metrics.hpp"
+#include "../TimerService.hpp"
 
 #include <json11.hpp>
 
@@ -13,20 +16,66 @@ public:
     HomeAssistantBase() = default;
     virtual ~HomeAssistantBase() = default;
 
+    // Always asks Home Assistant
     json11::Json queryStatus(std::string id, HomeAssistantCreds &creds)
     {
-        std::string url = creds.GetUrl() + "/api/states/" + id;
-        return cwj_.Bearer(creds.GetToken())->jsonGetOrPost(url);
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        return queryStatusLocked(id, creds);
+    }
+
+    // Asks Home Assistant ahead of the UI and keeps the answer for one cachedStatus
+    void prefetchStatus(std::string const &id, HomeAssistantCreds &creds)
+    {
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        prefetched_ = queryStatusLocked(id, creds);
+        prefetchedNs_ = prefetched_.is_object() ? TimerService::MonotonicNs() : 0;
+    }
+
+    // The prefetched status if it is younger than StatusCacheSeconds, which saves the UI
+    // thread one request; it is served once and every later read asks Home Assistant. A
+    // query that is running on another thread is waited for rather than sent twice.
+    json11::Json cachedStatus(std::string const &id, HomeAssistantCreds &creds)
+    {
+        static MetricCounter &hits = Metrics::Instance().Counter(
+            "ha_state_cache_hits_total", "Home Assistant states served from the prefetched copy");
+
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        bool fresh = prefetchedNs_ != 0
+            && TimerService::MonotonicNs() - prefetchedNs_ < TimerService::Sec(StatusCacheSeconds);
+        prefetchedNs_ = 0;
+        if (fresh)
+        {
+            hits.Add();
+            return prefetched_;
+        }
+        return queryStatusLocked(id, creds);
     }
 
     json11::Json queryExecute(std::string const &action, std::string jsonData, HomeAssistantCreds &creds)
     {
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        // the action changes the state
+        prefetchedNs_ = 0;
         std::string url = creds.GetUrl() + "/api/services/" + action;
         return cwj_.Bearer(creds.GetToken())->jsonGetOrPost(url, jsonData);
     }
 
+    static const int StatusCacheSeconds = 15;
+
 protected:
     CurlWrapperJson cwj_;
+
+private:
+    json11::Json queryStatusLocked(std::string const &id, HomeAssistantCreds &creds)
+    {
+        std::string url = creds.GetUrl() + "/api/states/" + id;
+        return cwj_.Bearer(creds.GetToken())->jsonGetOrPost(url);
+    }
+
+    // One request at a time: the UI thread and the prefetch share cwj_
+    std::mutex requestMutex_;
+    json11::Json prefetched_;
+    uint64_t prefetchedNs_ = 0;
 };
 
 class HomeAssistantDimmerBase : public HomeAssistantBase, IntegrationDimmerBase
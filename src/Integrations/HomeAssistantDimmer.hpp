@@ -22,10 +22,12 @@ public:
 
     const std::string &GetEntityId() const { return entityId_; }
 
+    void RefreshState() override { prefetchStatus(GetEntityId(), creds_); }
+
     SwitchState GetState() override
     {
         // Implementation to get state from Home Assistant
-        json11::Json status = queryStatus(GetEntityId(), creds_);
+        json11::Json status = cachedStatus(GetEntityId(), creds_);
         SwitchState ss =
             (
                 status.is_object()
@@ -52,7 +54,7 @@ public:
     }
     int GetBrightness() override
     {
-        json11::Json status = queryStatus(GetEntityId(), creds_);
+        json11::Json status = cachedStatus(GetEntityId(), creds_);
         int brightness = 128;
         if(status.is_object() && !status["attributes"].is_null())
         {
@@ -20,10 +20,12 @@ public:
 
     const std::string &GetEntityId() const { return entityId_; }
 
+    void RefreshState() override { prefetchStatus(GetEntityId(), creds_); }
+
     SwitchState GetState() override
     {
         // Implementation to get state from Home Assistant
-        json11::Json status = queryStatus(GetEntityId(), creds_);
+        json11::Json status = cachedStatus(GetEntityId(), creds_);
         SwitchState ss =
             (
                 status.is_object()
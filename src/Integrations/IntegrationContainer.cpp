@@ -1,7 +1,7 @@
+#define CUCKOO_LOG_MODULE "integrations"
+
 #include "IntegrationContainer.hpp"
-#include <fstream>
-#include <sstream>
-#include <json11.hpp>
+#include "../ConfigurationReader.hpp"
 #include "logger.h"
 #include <memory>
 #include <stdio.h>
@@ -11,87 +11,98 @@
 
 void IntegrationContainer::LoadIntegrationsFromConfig(const std::string& configPath)
 {
-    auto configContent = ReadFileContents(configPath);
-    if (configContent.empty())
-    {
-        // Handle error: could not read config file
-        LOG_ERROR_STREAM("ConfigurationReader: Could not read config file");
+    ConfigurationReader reader(configPath);
+    if (!reader.load())
         return;
-    }
 
-    std::string parse_error;
-    json11::Json parsed_json = json11::Json::parse(configContent, parse_error, json11::JsonParse::COMMENTS);
+    const AppConfig &config = reader.get_app_config();
+    LoadIntegrations(config.home_assistant, config.integrations);
+}
+
+void IntegrationContainer::LoadIntegrations(const HomeAssistantConfig &homeAssistant, const std::vector<IntegrationConfig> &integrations)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // global home assistant settings (token, baseurl)
+    homeAssistantConfig_ = homeAssistant;
+    homeAssistantCreds_ = HomeAssistantCreds(homeAssistant.base_url, homeAssistant.token);
+
+    for (const auto& integration : integrations)
+        AddIntegration(integration);
+}
+
+std::set<std::string> IntegrationContainer::ReloadIntegrations(const HomeAssistantConfig &homeAssistant, const std::vector<IntegrationConfig> &integrations)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::set<std::string> changed;
+
+    // later entries win on duplicate IDs, as in LoadIntegrations
+    std::map<std::string, IntegrationConfig> wanted;
+    for (const auto& integration : integrations)
+        wanted[integration.id] = integration;
+
+    // every integration holds its own copy of the credentials
+    bool credsChanged = (homeAssistant != homeAssistantConfig_);
 
-    if (!parse_error.empty())
+    std::vector<std::string> stale;
+    for (const auto& pair : configs_)
     {
-        LOG_ERROR_STREAM("ConfigurationReader: JSON parse error: " << parse_error);
-        return;
+        auto it = wanted.find(pair.first);
+        if (credsChanged || it == wanted.end() || it->second != pair.second)
+            stale.push_back(pair.first);
     }
-    
-    if (!parsed_json.is_object())
+    for (const auto& id : stale)
     {
-        LOG_ERROR_STREAM("ConfigurationReader: Root JSON element must be an object");
-        return;
+        RemoveIntegration(id);
+        changed.insert(id);
+    }
+
+    homeAssistantConfig_ = homeAssistant;
+    homeAssistantCreds_ = HomeAssistantCreds(homeAssistant.base_url, homeAssistant.token);
+
+    for (const auto& pair : wanted)
+    {
+        if (configs_.find(pair.first) != configs_.end())
+            continue;
+        AddIntegration(pair.second);
+        changed.insert(pair.first);
     }
 
-    // from config we want to:
-    // exract global home assistant settings (token, baseurl)
-    homeAssistantCreds_ = HomeAssistantCreds(
-        parsed_json["homeAssistant"]["baseURL"].string_value(),
-        parsed_json["homeAssistant"]["token"].string_value()
-    );
+    LOG_INFO_STREAM("IntegrationContainer: Reloaded integrations, " << changed.size()
+        << " changed, " << CountIntegrations() << " live");
+    return changed;
+}
 
-    for (const auto& integration : parsed_json["integrations"].array_items()) 
+void IntegrationContainer::AddIntegration(const IntegrationConfig &integration)
+{
+    if (integration.type == "HomeAssistant") 
     {
-        if (!integration.is_object())
-            continue; // skip invalid entries
-
-        std::string name = integration["name"].string_value();
-        std::string type = integration["type"].string_value();
-        std::string id = (
-            integration["id"].is_number()
-            ? std::to_string(integration["id"].int_value())
-            : integration["id"].string_value()
-        );
-        if(id == "")
-            id = name;
-
-        if (type == "HomeAssistant") 
+        const std::string &entityId = integration.entity_id;
+        std::string domain = entityId.substr(0, entityId.find('.'));
+        if (domain == "switch") 
         {
-            std::string entityId = integration["entityId"].string_value();
-            std::string domain = entityId.substr(0, entityId.find('.'));
-            if (domain == "switch") 
-            {
-                auto switchPtr = std::unique_ptr<HomeAssistantSwitch>(
-                    new HomeAssistantSwitch(homeAssistantCreds_, entityId)
-                );
-                switchPtr->SetId(id);
-                switchPtr->SetName(name);
-                switchMap_[id] = std::move(switchPtr);
-            } 
-            else if (domain == "light") 
-            {
-                auto dimmerPtr = std::unique_ptr<HomeAssistantDimmer>(
-                    new HomeAssistantDimmer(homeAssistantCreds_, entityId)
-                );
-                dimmerPtr->SetId(id);
-                dimmerPtr->SetName(name);
-                dimmerMap_[id] = std::move(dimmerPtr);
-            }
+            auto switchPtr = std::make_shared<HomeAssistantSwitch>(homeAssistantCreds_, entityId);
+            switchPtr->SetId(integration.id);
+            switchPtr->SetName(integration.name);
+            switchMap_[integration.id] = std::move(switchPtr);
+        } 
+        else if (domain == "light") 
+        {
+            auto dimmerPtr = std::make_shared<HomeAssistantDimmer>(homeAssistantCreds_, entityId);
+            dimmerPtr->SetId(integration.id);
+            dimmerPtr->SetName(integration.name);
+            dimmerMap_[integration.id] = std::move(dimmerPtr);
         }
     }
+
+    // remembered even when unsupported, so a reload only reports real changes
+    configs_[integration.id] = integration;
 }
 
-std::string IntegrationContainer::ReadFileContents(const std::string& filepath) const
+void IntegrationContainer::RemoveIntegration(const std::string &id)
 {
-    std::ifstream file(filepath);
-    if (!file.is_open())
-        return "";
-    
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-
-    return buffer.str();
+    switchMap_.erase(id);
+    dimmerMap_.erase(id);
+    configs_.erase(id);
 }
 
 IntegrationSwitchBase* IntegrationContainer::GetSwitchById(std::string const  &id)
@@ -110,4 +121,38 @@ IntegrationDimmerBase* IntegrationContainer::GetDimmerById(std::string const  &i
         return it->second.get();
 
     return nullptr;
-}
\ No newline at end of file
+}
+
+std::vector<std::string> IntegrationContainer::GetIntegrationIds() const
+{
+    std::vector<std::string> ids;
+    for (const auto& pair : switchMap_)
+        ids.push_back(pair.first);
+    for (const auto& pair : dimmerMap_)
+        ids.push_back(pair.first);
+    return ids;
+}
+
+void IntegrationContainer::RefreshStates(const std::vector<std::string> &ids)
+{
+    std::vector<std::shared_ptr<IntegrationSwitchBase>> integrations;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& id : ids)
+        {
+            auto sw = switchMap_.find(id);
+            if (sw != switchMap_.end())
+            {
+                integrations.push_back(sw->second);
+                continue;
+            }
+            auto dimmer = dimmerMap_.find(id);
+            if (dimmer != dimmerMap_.end())
+                integrations.push_back(dimmer->second);
+        }
+    }
+
+    // Blocking requests, one after the other; the UI thread may reload meanwhile
+    for (const auto& integration : integrations)
+        integration->RefreshState();
+}
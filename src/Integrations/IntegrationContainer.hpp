@@ -2,10 +2,14 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <set>
+#include <vector>
 
 #include "IntegrationSwitchBase.hpp"
 #include "IntegrationDimmerBase.hpp"
 #include "HomeAssistantCreds.hpp"
+#include "../ConfigModel.hpp"
 
 
 class IntegrationContainer 
@@ -13,19 +17,41 @@ class IntegrationContainer
     public:
         IntegrationContainer() {};
         virtual ~IntegrationContainer() = default;
+        void LoadIntegrations(const HomeAssistantConfig &homeAssistant, const std::vector<IntegrationConfig> &integrations);
+        // Reads and parses configPath itself; prefer LoadIntegrations with an already loaded config
         void LoadIntegrationsFromConfig(const std::string& configPath);
+        // Rebuilds only the integrations whose definition changed (all of them when the
+        // Home Assistant credentials changed) and drops the ones no longer configured.
+        // Returns the IDs that were added, rebuilt or removed.
+        std::set<std::string> ReloadIntegrations(const HomeAssistantConfig &homeAssistant, const std::vector<IntegrationConfig> &integrations);
+        inline size_t CountIntegrations() const { return switchMap_.size() + dimmerMap_.size(); }
 
-        
         IntegrationSwitchBase* GetSwitchById(std::string const  &id);
         IntegrationDimmerBase* GetDimmerById(std::string const  &id);
+        // IDs of the live integrations
+        std::vector<std::string> GetIntegrationIds() const;
+
+        // Fetches the state of each integration in ids, in order, for the pre-wake. Safe
+        // from another thread. The requests run without the lock, so loads and reloads
+        // do not wait for them; an integration dropped meanwhile is only freed once its
+        // request is done.
+        void RefreshStates(const std::vector<std::string> &ids);
         
     private:
-        std::string ReadFileContents(const std::string &filepath) const;
-        
-        std::map<std::string, std::unique_ptr<IntegrationSwitchBase>> switchMap_;
-        std::map<std::string, std::unique_ptr<IntegrationDimmerBase>> dimmerMap_;
+        void AddIntegration(const IntegrationConfig &integration);
+        void RemoveIntegration(const std::string &id);
+
+        // Shared with a RefreshStates in progress
+        std::map<std::string, std::shared_ptr<IntegrationSwitchBase>> switchMap_;
+        std::map<std::string, std::shared_ptr<IntegrationDimmerBase>> dimmerMap_;
 
     private:
         HomeAssistantCreds homeAssistantCreds_;
+        HomeAssistantConfig homeAssistantConfig_;
+        // Definitions of the live integrations, compared against on reload
+        std::map<std::string, IntegrationConfig> configs_;
+        // Held around every change to the maps and while RefreshStates looks up its
+        // integrations; the UI thread, which makes the changes, reads them without it
+        std::mutex mutex_;
 
 };
\ No newline at end of file
@@ -12,6 +12,8 @@ class IntegrationSwitchBase
         virtual SwitchState GetState() = 0;
         virtual void TurnOn() = 0;
         virtual void TurnOff() = 0;
+        // Fetches the state ahead of GetState(); called from a background thread
+        virtual void RefreshState() {}
 
         inline std::string const &GetId() const { return id; }
         inline void SetId(std::string const &newId) { id = newId; }
@@ -0,0 +1,248 @@
+#define CUCKOO_LOG_MODULE "metrics"
+
+#include "Metrics.hpp"
+#include "logger.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <signal.h>
+#include <sstream>
+#include <string.h>
+#include <time.h>
+
+static volatile sig_atomic_t dump_requested = 0;
+
+static void request_dump(int)
+{
+    dump_requested = 1;
+}
+
+MetricCounter::MetricCounter()
+{
+    for (int i = 0; i < Shards; ++i)
+        shards_[i].value.store(0, std::memory_order_relaxed);
+}
+
+uint64_t MetricCounter::Value() const
+{
+    uint64_t total = 0;
+    for (int i = 0; i < Shards; ++i)
+        total += shards_[i].value.load(std::memory_order_relaxed);
+    return total;
+}
+
+int MetricCounter::ShardIndex()
+{
+    static std::atomic<int> next_thread(0);
+    static thread_local int index = -1;
+    if (index < 0)
+        index = next_thread.fetch_add(1, std::memory_order_relaxed) % Shards;
+    return index;
+}
+
+MetricHistogram::MetricHistogram() : sum_(0), max_(0)
+{
+    for (int i = 0; i < Buckets; ++i)
+        buckets_[i].store(0, std::memory_order_relaxed);
+}
+
+int MetricHistogram::BucketIndex(uint64_t value)
+{
+    const uint64_t linear = 1u << SubBucketBits;
+    if (value < linear)
+        return static_cast<int>(value);
+    int exponent = 63 - __builtin_clzll(value);
+    if (exponent > MaxExponent)
+        return Buckets - 1;
+    int sub = static_cast<int>((value >> (exponent - SubBucketBits)) & (linear - 1));
+    return ((exponent - SubBucketBits + 1) << SubBucketBits) + sub;
+}
+
+uint64_t MetricHistogram::BucketUpperBound(int index)
+{
+    const int linear = 1 << SubBucketBits;
+    if (index < linear)
+        return static_cast<uint64_t>(index);
+    int exponent = (index >> SubBucketBits) - 1 + SubBucketBits;
+    uint64_t sub = static_cast<uint64_t>(index & (linear - 1));
+    uint64_t width = 1ull << (exponent - SubBucketBits);
+    return ((linear + sub) << (exponent - SubBucketBits)) + width - 1;
+}
+
+void MetricHistogram::Record(uint64_t value)
+{
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    uint64_t seen = max_.load(std::memory_order_relaxed);
+    while (value > seen && !max_.compare_exchange_weak(seen, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+MetricHistogram::Snapshot MetricHistogram::Read() const
+{
+    Snapshot snapshot;
+    snapshot.buckets.resize(Buckets);
+    // count is summed from the buckets so that it agrees with the percentiles
+    for (int i = 0; i < Buckets; ++i)
+    {
+        snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    snapshot.sum = sum_.load(std::memory_order_relaxed);
+    snapshot.max = max_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+uint64_t MetricHistogram::Snapshot::Percentile(double p) const
+{
+    if (count == 0)
+        return 0;
+    uint64_t rank = static_cast<uint64_t>(p * (count - 1)) + 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+            return std::min(BucketUpperBound(static_cast<int>(i)), max);
+    }
+    return max;
+}
+
+uint64_t MetricTimer::NowUs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000ull + static_cast<uint64_t>(ts.tv_nsec / 1000);
+}
+
+Metrics &Metrics::Instance()
+{
+    // never destroyed: other threads may still update metrics during exit
+    static Metrics *metrics = new Metrics();
+    return *metrics;
+}
+
+Metrics::Entry &Metrics::Lookup(const std::string &name, const std::string &help, Kind kind)
+{
+    auto it = entries_.find(name);
+    if (it != entries_.end())
+        return it->second;
+
+    Entry &entry = entries_[name];
+    entry.kind = kind;
+    entry.help = help;
+    return entry;
+}
+
+MetricCounter &Metrics::Counter(const std::string &name, const std::string &help)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry &entry = Lookup(name, help, Kind::Counter);
+    if (entry.kind != Kind::Counter)
+    {
+        LOG_ERROR_STREAM("Metrics: " << name << " is not a counter; updates are discarded");
+        static MetricCounter discarded;
+        return discarded;
+    }
+    if (!entry.counter)
+        entry.counter.reset(new MetricCounter());
+    return *entry.counter;
+}
+
+MetricGauge &Metrics::Gauge(const std::string &name, const std::string &help)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry &entry = Lookup(name, help, Kind::Gauge);
+    if (entry.kind != Kind::Gauge)
+    {
+        LOG_ERROR_STREAM("Metrics: " << name << " is not a gauge; updates are discarded");
+        static MetricGauge discarded;
+        return discarded;
+    }
+    if (!entry.gauge)
+        entry.gauge.reset(new MetricGauge());
+    return *entry.gauge;
+}
+
+MetricHistogram &Metrics::Histogram(const std::string &name, const std::string &help)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry &entry = Lookup(name, help, Kind::Histogram);
+    if (entry.kind != Kind::Histogram)
+    {
+        LOG_ERROR_STREAM("Metrics: " << name << " is not a histogram; updates are discarded");
+        static MetricHistogram discarded;
+        return discarded;
+    }
+    if (!entry.histogram)
+        entry.histogram.reset(new MetricHistogram());
+    return *entry.histogram;
+}
+
+std::string Metrics::RenderPrometheus() const
+{
+    std::ostringstream out;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &item : entries_)
+    {
+        const std::string &name = item.first;
+        const Entry &entry = item.second;
+        out << "# HELP " << name << " " << entry.help << "\n";
+        if (entry.counter)
+        {
+            out << "# TYPE " << name << " counter\n" << name << " " << entry.counter->Value() << "\n";
+        }
+        else if (entry.gauge)
+        {
+            out << "# TYPE " << name << " gauge\n" << name << " " << entry.gauge->Value() << "\n";
+        }
+        else if (entry.histogram)
+        {
+            MetricHistogram::Snapshot snapshot = entry.histogram->Read();
+            out << "# TYPE " << name << " summary\n";
+            const double quantiles[] = { 0.5, 0.9, 0.99 };
+            for (double q : quantiles)
+                out << name << "{quantile=\"" << q << "\"} " << snapshot.Percentile(q) << "\n";
+            out << name << "_sum " << snapshot.sum << "\n";
+            out << name << "_count " << snapshot.count << "\n";
+            out << "# TYPE " << name << "_max gauge\n" << name << "_max " << snapshot.max << "\n";
+        }
+    }
+    return out.str();
+}
+
+bool Metrics::InstallDumpSignal(int signo)
+{
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = request_dump;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(signo, &action, nullptr) != 0)
+    {
+        LOG_ERROR_STREAM("Metrics: cannot install dump signal handler: " << strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool Metrics::DumpRequested()
+{
+    if (!dump_requested)
+        return false;
+    dump_requested = 0;
+    return true;
+}
+
+void Metrics::DumpToLog() const
+{
+    std::istringstream lines(RenderPrometheus());
+    std::string line;
+    LOG_INFO_STREAM("Metrics dump:");
+    while (std::getline(lines, line))
+    {
+        if (line.compare(0, 1, "#") != 0)
+            LOG_INFO_STREAM("  " << line);
+    }
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/**
+ * @brief Process-wide counters, gauges and latency histograms
+ *
+ * Metrics are created on first lookup and live until exit, so call sites
+ * keep a reference in a function-local static and pay only for the update:
+ *
+ *     static MetricCounter &frames = Metrics::Instance().Counter("backplate_frames_total", "...");
+ *     frames.Add();
+ *
+ * Updates never take a lock. Counters are split into per-thread shards on
+ * separate cache lines; histograms use relaxed atomic buckets.
+ */
+class MetricCounter
+{
+public:
+    MetricCounter();
+
+    inline void Add(uint64_t n = 1)
+    {
+        shards_[ShardIndex()].value.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t Value() const;
+
+    static const int Shards = 8;
+
+private:
+    // Padded to a cache line so threads do not contend on each other's shard
+    struct Shard
+    {
+        std::atomic<uint64_t> value;
+        char padding[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    // Threads are numbered in order of their first update
+    static int ShardIndex();
+
+    Shard shards_[Shards];
+};
+
+class MetricGauge
+{
+public:
+    MetricGauge() : value_(0) {}
+
+    inline void Set(int64_t value) { value_.store(value, std::memory_order_relaxed); }
+    inline void Add(int64_t delta) { value_.fetch_add(delta, std::memory_order_relaxed); }
+    inline int64_t Value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value_;
+};
+
+/**
+ * @brief Latency histogram with HDR-style buckets
+ *
+ * Values below 8 have a bucket each; above that every power of two is split
+ * into 8 linear sub-buckets, so a percentile is within 12.5% of the true
+ * value across the whole range. Values are microseconds by convention.
+ */
+class MetricHistogram
+{
+public:
+    MetricHistogram();
+
+    void Record(uint64_t value);
+
+    struct Snapshot
+    {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+        std::vector<uint64_t> buckets;
+
+        // Upper bound of the bucket holding the p-th value, p in [0, 1]
+        uint64_t Percentile(double p) const;
+    };
+
+    Snapshot Read() const;
+
+    static const int SubBucketBits = 3;
+    static const int MaxExponent = 40;
+    static const int Buckets = (MaxExponent - SubBucketBits + 2) << SubBucketBits;
+
+    static int BucketIndex(uint64_t value);
+    static uint64_t BucketUpperBound(int index);
+
+private:
+    std::atomic<uint64_t> buckets_[Buckets];
+    std::atomic<uint64_t> sum_;
+    std::atomic<uint64_t> max_;
+};
+
+// Records the time from construction to destruction, in microseconds
+class MetricTimer
+{
+public:
+    explicit MetricTimer(MetricHistogram &histogram) : histogram_(histogram), start_us_(NowUs()) {}
+    ~MetricTimer() { histogram_.Record(NowUs() - start_us_); }
+
+    // Monotonic clock shared by all latency metrics
+    static uint64_t NowUs();
+
+private:
+    MetricHistogram &histogram_;
+    uint64_t start_us_;
+};
+
+class Metrics
+{
+public:
+    static Metrics &Instance();
+
+    // Same name, same metric; a name is bound to the kind it was created with
+    MetricCounter &Counter(const std::string &name, const std::string &help);
+    MetricGauge &Gauge(const std::string &name, const std::string &help);
+    MetricHistogram &Histogram(const std::string &name, const std::string &help);
+
+    // Prometheus text exposition format; histograms are rendered as summaries
+    std::string RenderPrometheus() const;
+
+    // SIGUSR1 (or signo) requests a dump; the handler only sets a flag
+    bool InstallDumpSignal(int signo);
+    // True once per signal received
+    bool DumpRequested();
+    // Writes RenderPrometheus() to the log
+    void DumpToLog() const;
+
+private:
+    Metrics() = default;
+
+    enum class Kind { Counter, Gauge, Histogram };
+
+    struct Entry
+    {
+        Kind kind;
+        std::string help;
+        std::unique_ptr<MetricCounter> counter;
+        std::unique_ptr<MetricGauge> gauge;
+        std::unique_ptr<MetricHistogram> histogram;
+    };
+
+    // mutex_ is held
+    Entry &Lookup(const std::string &name, const std::string &help, Kind kind);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Entry> entries_;
+};
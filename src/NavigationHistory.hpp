@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+/**
+ * @brief Back stack of screen node indexes, in a fixed ring
+ *
+ * Going forward to a screen that is already in the history unwinds back to
+ * it instead of pushing it again, so walking a cycle such as
+ * Home -> Menu -> Switch -> Home leaves just [Home]. Past Capacity the oldest
+ * entry is forgotten. Every operation is bounded by Capacity.
+ */
+class NavigationHistory
+{
+public:
+    static const size_t Capacity = 16;
+
+    // Makes node the top, unwinding to an earlier visit of it when there is one
+    void Push(int node)
+    {
+        for (size_t i = size_; i > 0; --i)
+        {
+            if (At(i - 1) == node)
+            {
+                size_ = i;
+                return;
+            }
+        }
+        if (size_ == Capacity)
+        {
+            start_ = (start_ + 1) % Capacity;
+            size_--;
+        }
+        entries_[(start_ + size_) % Capacity] = node;
+        size_++;
+    }
+
+    void Pop()
+    {
+        if (size_ > 0)
+            size_--;
+    }
+
+    // -1 when empty
+    int Top() const { return size_ > 0 ? At(size_ - 1) : -1; }
+    size_t Size() const { return size_; }
+    void Clear() { size_ = 0; }
+
+    bool Contains(int node) const
+    {
+        for (size_t i = 0; i < size_; ++i)
+            if (At(i) == node)
+                return true;
+        return false;
+    }
+
+    // Drops the entries matching remove; Push keeps entries unique, so no repeats are left behind
+    template <typename Predicate>
+    void RemoveIf(Predicate remove)
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < size_; ++i)
+        {
+            int node = At(i);
+            if (remove(node))
+                continue;
+            entries_[(start_ + kept) % Capacity] = node;
+            kept++;
+        }
+        size_ = kept;
+    }
+
+private:
+    // i counts from the oldest entry
+    int At(size_t i) const { return entries_[(start_ + i) % Capacity]; }
+
+    std::array<int, Capacity> entries_;
+    size_t start_ = 0;
+    size_t size_ = 0;
+};
@@ -0,0 +1,105 @@
+#define CUCKOO_LOG_MODULE "app"
+
+#include "Prewake.hpp"
+#include "Metrics.hpp"
+#include "logger.h"
+#include "trace.h"
+
+const uint64_t Prewake::CooldownUs;
+const uint64_t Prewake::InteractionWindowUs;
+
+Prewake::Prewake(WarmCallback warm, RefreshCallback refresh)
+    : warm_(warm)
+    , refresh_(refresh)
+{
+}
+
+Prewake::~Prewake()
+{
+    Stop();
+}
+
+bool Prewake::Start()
+{
+    if (thread_.joinable())
+        return true;
+    stopping_ = false;
+    thread_ = std::thread([this]() { RefreshLoop(); });
+    return true;
+}
+
+void Prewake::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    if (thread_.joinable())
+        thread_.join();
+}
+
+bool Prewake::OnApproach(uint64_t nowUs)
+{
+    static MetricCounter &prewakes = Metrics::Instance().Counter(
+        "ui_prewake_total", "Approaches that warmed screens and refreshed integration states");
+
+    approachUs_ = nowUs;
+    if (prewoken_ && nowUs - prewakeUs_ < CooldownUs)
+        return false;
+    prewoken_ = true;
+    prewakeUs_ = nowUs;
+    prewakes.Add();
+
+    std::vector<std::string> ids;
+    {
+        TRACE_SCOPE("prewake_warm");
+        ids = warm_();
+    }
+    LOG_DEBUG_STREAM("Prewake: approach, refreshing " << ids.size() << " integration(s)");
+    if (ids.empty())
+        return true;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // a refresh still queued from an earlier approach is superseded
+        pending_ = ids;
+        refreshPending_ = true;
+    }
+    wake_.notify_one();
+    return true;
+}
+
+void Prewake::OnInput(uint64_t nowUs)
+{
+    static MetricHistogram &approachToInputUs = Metrics::Instance().Histogram(
+        "ui_approach_to_input_us", "From proximity rising to the first input after it");
+
+    if (approachUs_ == 0)
+        return;
+    if (nowUs >= approachUs_ && nowUs - approachUs_ <= InteractionWindowUs)
+        approachToInputUs.Record(nowUs - approachUs_);
+    approachUs_ = 0;
+}
+
+void Prewake::RefreshLoop()
+{
+    TRACE_THREAD_NAME("prewake");
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        wake_.wait(lock, [this]() { return stopping_ || refreshPending_; });
+        if (stopping_)
+            return;
+
+        std::vector<std::string> ids;
+        ids.swap(pending_);
+        refreshPending_ = false;
+        lock.unlock();
+        {
+            TRACE_SCOPE("prewake_refresh");
+            refresh_(ids);
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+/**
+ * @brief Gets the UI ready while someone walks up to the thermostat
+ *
+ * OnApproach() runs on the UI thread when proximity rises: it warms the
+ * likely screens through the warm callback and hands the integration IDs it
+ * returns to a background thread, which passes them to the refresh callback
+ * so their Home Assistant state is fresh by the time the user turns the ring.
+ * An approach within CooldownUs of the last pre-wake does not start another,
+ * so standing in front of the display does not keep the network busy.
+ *
+ * OnInput() records the time from the latest approach, pre-woken or not, to
+ * the first input that follows it in ui_approach_to_input_us; input more
+ * than InteractionWindowUs after the approach is taken as unrelated to it.
+ */
+class Prewake
+{
+public:
+    typedef std::function<std::vector<std::string>()> WarmCallback;
+    typedef std::function<void(const std::vector<std::string> &)> RefreshCallback;
+
+    Prewake(WarmCallback warm, RefreshCallback refresh);
+    ~Prewake();
+
+    bool Start();
+    void Stop();
+
+    // True if the approach started a pre-wake
+    bool OnApproach(uint64_t nowUs);
+    void OnInput(uint64_t nowUs);
+
+    static const uint64_t CooldownUs = 30000000ull;
+    static const uint64_t InteractionWindowUs = 60000000ull;
+
+private:
+    void RefreshLoop();
+
+    WarmCallback warm_;
+    RefreshCallback refresh_;
+
+    // UI thread only
+    bool prewoken_ = false;
+    uint64_t prewakeUs_ = 0;
+    uint64_t approachUs_ = 0;  // 0 once input has followed the approach
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<std::string> pending_;
+    bool refreshPending_ = false;
+    bool stopping_ = false;
+};
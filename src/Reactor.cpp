@@ -0,0 +1,125 @@
+#define CUCKOO_LOG_MODULE "app"
+
+#include "Reactor.hpp"
+#include "TimerService.hpp"
+#include "Metrics.hpp"
+#include "logger.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+Reactor::Reactor()
+    : wakeups_(Metrics::Instance().Counter("reactor_wakeups_total", "Returns from epoll_wait in reactor mode"))
+{
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0)
+        LOG_ERROR_STREAM("Reactor: epoll_create1 failed: " << strerror(errno));
+}
+
+Reactor::~Reactor()
+{
+    if (epoll_fd_ >= 0)
+        close(epoll_fd_);
+}
+
+bool Reactor::Add(int fd, Handler on_readable)
+{
+    if (fd < 0)
+        return false;
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0)
+    {
+        LOG_ERROR_STREAM("Reactor: cannot watch fd " << fd << ": " << strerror(errno));
+        return false;
+    }
+    handlers_[fd] = std::move(on_readable);
+    return true;
+}
+
+void Reactor::Remove(int fd)
+{
+    if (handlers_.erase(fd) != 0)
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+bool Reactor::AddTimers(TimerService &timers)
+{
+    TimerService *service = &timers;
+    return Add(timers.Fd(), [service]() { service->RunExpired(); });
+}
+
+int Reactor::AddEvent(Handler handler)
+{
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0)
+    {
+        LOG_ERROR_STREAM("Reactor: eventfd failed: " << strerror(errno));
+        return -1;
+    }
+    bool added = Add(fd, [fd, handler]() {
+        uint64_t count;
+        if (read(fd, &count, sizeof(count)) == sizeof(count))
+            handler();
+    });
+    if (!added)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void Reactor::RemoveEvent(int event_fd)
+{
+    Remove(event_fd);
+    close(event_fd);
+}
+
+void Reactor::Signal(int event_fd)
+{
+    uint64_t one = 1;
+    if (write(event_fd, &one, sizeof(one)) != sizeof(one))
+        LOG_WARN_STREAM("Reactor: cannot signal eventfd " << event_fd << ": " << strerror(errno));
+}
+
+void Reactor::RunOnce(int timeout_ms)
+{
+    struct epoll_event events[MaxEvents];
+    int count = epoll_wait(epoll_fd_, events, MaxEvents, timeout_ms);
+    if (count < 0)
+    {
+        if (errno != EINTR)
+            LOG_ERROR_STREAM("Reactor: epoll_wait failed: " << strerror(errno));
+        return;
+    }
+    wakeups_.Add();
+
+    for (int i = 0; i < count; ++i)
+    {
+        auto it = handlers_.find(events[i].data.fd);
+        if (it == handlers_.end())
+            continue;
+        // A copy: the handler may remove itself
+        Handler handler = it->second;
+        handler();
+    }
+}
+
+uint64_t Reactor::Wakeups() const
+{
+    return wakeups_.Value();
+}
+
+void Reactor::Run()
+{
+    running_ = true;
+    while (running_)
+        RunOnce(-1);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <stdint.h>
+
+class TimerService;
+class MetricCounter;
+
+/**
+ * @brief Single-threaded epoll loop
+ *
+ * Every handler runs on the thread that calls Run(), one at a time, so the
+ * state they share needs no locks. Descriptors are level triggered: a
+ * handler reads until EAGAIN or it is called again on the next pass.
+ * Add/Remove are for the loop thread, or for setup before Run().
+ *
+ * Other threads reach the loop through an eventfd from AddEvent(): Signal()
+ * is a single write() and wakes the loop, which then runs the handler.
+ */
+class Reactor
+{
+public:
+    using Handler = std::function<void()>;
+
+    Reactor();
+    ~Reactor();
+
+    inline bool IsValid() const { return epoll_fd_ >= 0; }
+
+    // Calls on_readable whenever fd is readable; the caller keeps owning fd
+    bool Add(int fd, Handler on_readable);
+    void Remove(int fd);
+
+    // Runs the service's expired timers when its timerfd fires
+    bool AddTimers(TimerService &timers);
+
+    // Creates an eventfd owned by the reactor; returns it, or -1
+    int AddEvent(Handler handler);
+    void RemoveEvent(int event_fd);
+    // Safe from any thread
+    static void Signal(int event_fd);
+
+    // Waits for at most timeout_ms (-1 forever) and runs the ready handlers
+    void RunOnce(int timeout_ms);
+    // Until Stop() is called from a handler
+    void Run();
+    inline void Stop() { running_ = false; }
+
+    // Returns from epoll_wait so far, counted across every reactor (reactor_wakeups_total)
+    uint64_t Wakeups() const;
+
+    static const int MaxEvents = 16;
+
+private:
+    int epoll_fd_ = -1;
+    bool running_ = false;
+    std::map<int, Handler> handlers_;
+    MetricCounter &wakeups_;
+};
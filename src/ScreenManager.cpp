@@ -1,244 +1,479 @@
-#include <fstream>
-#include <sstream>
+#define CUCKOO_LOG_MODULE "screens"
+
 #include <json11.hpp>
 #include <algorithm>
 #include <stdio.h>
 
 #include "logger.h"
 #include "ScreenManager.hpp"
+#include "ConfigurationReader.hpp"
+#include "Metrics.hpp"
 #include "HAL/HAL.hpp"
 
-#include "Screens/HomeScreen.hpp"
-#include "Screens/MenuScreen.hpp"
-#include "Screens/SwitchScreen.hpp"
-#include "Screens/DimmerScreen.hpp"
-#include "Screens/AnalogClockScreen.hpp"
+#include "Screens/ScreenFactory.hpp"
+
+// Built when the configuration has no home screen at all
+static const char *FallbackScreenType = "home";
+static const char *FallbackScreenId = "Home";
+
+// An ID attribute as ScreenBase reads it: numbers are converted
+static std::string IdAttribute(const json11::Json &value)
+{
+    if (value.is_number())
+        return std::to_string(value.int_value());
+    return value.string_value();
+}
 
-void ScreenManager::GoToScreenPtr(ScreenBase *screen)
+// The integration a screen binds to, as SwitchScreen and DimmerScreen resolve it:
+// "integrationId", else the screen's name, else the name those screens default to
+static std::string BoundIntegrationId(const ScreenConfig &config)
 {
+    std::string id = IdAttribute(config.json["integrationId"]);
+    if (!id.empty())
+        return id;
+    if (!config.name.empty())
+        return config.name;
+    if (config.type == "switch")
+        return "Switch";
+    if (config.type == "dimmer")
+        return "Dimmer";
+    return "";
+}
+
+const int ScreenManager::NoScreen;
+
+void ScreenManager::GoToNode(int node)
+{
+    ScreenBase *screen = ScreenAt(node);
     if(screen != nullptr)
     {
-        if(current_screen_)
-            current_screen_->OnChangeFocus(false);
-        current_screen_ = screen;
-        screen_history_.push(current_screen_);
-        current_screen_->OnChangeFocus(true);
-        LOG_INFO_STREAM("ScreenManager: Navigated to screen ID \"" << current_screen_->GetId() << "\" / \"" << current_screen_->GetName() << "\"");
+        ScreenBase *previous = GetCurrentScreen();
+        if(previous)
+            previous->OnChangeFocus(false);
+        current_ = node;
+        history_.Push(node);
+        nodes_[node].lastUsedNs = TimerService::MonotonicNs();
+        screen->OnChangeFocus(true);
+        LOG_INFO_STREAM("ScreenManager: Navigated to screen ID \"" << screen->GetId() << "\" / \"" << screen->GetName() << "\"");
     }
     else
-        LOG_ERROR_STREAM("ScreenManager::GoToScreenPtr NULL screen ptr");
+        LOG_ERROR_STREAM("ScreenManager::GoToNode no screen for node " << node);
 }
 
 void ScreenManager::GoToFirstScreen(std::string id)
 {
     if(id == "")
         id = firstScreenId_;
-    ScreenBase* screen = (id != "" ? GetScreenById(id) : nullptr);
-    if(screen == nullptr)
+    int node = (id != "" ? FindNode(id) : NoScreen);
+    if(ScreenAt(node) == nullptr)
     {
         LOG_INFO_STREAM("ScreenManager::GoToFirstScreen Unable to find screen ID \"" << id << "\"");
+        node = NoScreen;
         if(id != "1")
         {
-            screen = GetScreenById("1");
-            if(screen == nullptr)
+            node = FindNode("1");
+            if(ScreenAt(node) == nullptr)
+            {
                 LOG_INFO_STREAM("ScreenManager::GoToFirstScreen Unable to find screen ID \"1\"");
+                node = NoScreen;
+            }
         }
     }
-    // no screen found, try to find a HomeScreen class instance
-    if(screen == nullptr)
+    // no screen found, use the first configured home screen
+    if(node == NoScreen)
     {
-        for(auto &pair: screens_)
-            if((screen = dynamic_cast<HomeScreen *>(pair.second.get())))
+        for(size_t i = 0; i < nodes_.size(); i++)
+        {
+            if(nodes_[i].configured && nodes_[i].config.type == FallbackScreenType && ScreenAt(i) != nullptr)
+            {
+                node = i;
                 break;
+            }
+        }
 
-        // no HomeScreen class instance found, build one
-        if(screen == nullptr)
+        // no home screen configured, build one
+        if(node == NoScreen)
         {
-            LOG_INFO_STREAM("ScreenManager::GoToFirstScreen - Creating HomeScreen");
-            std::map<std::string, std::string> attribs = { {"name","Home"}, {"id","Home"} };
-            screen = new HomeScreen(this, json11::Json(attribs));
-            AddScreen(std::unique_ptr<ScreenBase>(screen));
+            node = FindNode(FallbackScreenId);
+            if(ScreenAt(node) == nullptr)
+            {
+                LOG_INFO_STREAM("ScreenManager::GoToFirstScreen - Creating HomeScreen");
+                std::map<std::string, std::string> attribs = { {"name","Home"}, {"id",FallbackScreenId} };
+                std::unique_ptr<ScreenBase> built = ScreenFactory::Create(FallbackScreenType, this, json11::Json(attribs));
+                node = NoScreen;
+                if (built)
+                {
+                    AddScreen(std::move(built));
+                    node = FindNode(FallbackScreenId);
+                }
+            }
         }
     }
 
-    if (screen == nullptr)
+    if (node == NoScreen)
         LOG_ERROR_STREAM("ScreenManager::GoToFirstScreen Unable to find a home screen.");
     else
-        GoToScreenPtr(screen);
+        GoToNode(node);
 }
 
 void ScreenManager::GoToNextScreen(std::string const & id)
 {
-    ScreenBase* screen = (id != "" ? GetScreenById(id) : nullptr);
-    if (screen == nullptr)
+    int node = (id != "" ? FindNode(id) : NoScreen);
+    if (ScreenAt(node) == nullptr)
         LOG_ERROR_STREAM("ScreenManager: Unable to find screen \"" << id << "\"");
     else
-        GoToScreenPtr(screen);
+        GoToNode(node);
+}
+
+void ScreenManager::GoToNextScreen()
+{
+    if (current_ == NoScreen || nodes_[current_].next == NoScreen)
+        LOG_ERROR_STREAM("ScreenManager: Current screen has no next screen");
+    else
+        GoToScreen(nodes_[current_].next);
+}
+
+void ScreenManager::GoToScreen(int node)
+{
+    if (ScreenAt(node) == nullptr)
+        LOG_ERROR_STREAM("ScreenManager: Unable to find screen \""
+            << (node >= 0 && node < static_cast<int>(nodes_.size()) ? nodes_[node].id : "") << "\"");
+    else
+        GoToNode(node);
 }
 
 void ScreenManager::GoToPreviousScreen()
 {
-    if(screen_history_.size() > 1)
+    if(history_.Size() > 1)
     {
-        if(current_screen_)
-            current_screen_->OnChangeFocus(false);
-        screen_history_.pop();
-        current_screen_ = screen_history_.top();
-        if(current_screen_)
+        ScreenBase *previous = GetCurrentScreen();
+        if(previous)
+            previous->OnChangeFocus(false);
+        history_.Pop();
+        current_ = history_.Top();
+        // screens in the history are never evicted, so this does not build
+        ScreenBase *screen = ScreenAt(current_);
+        if(screen)
         {
-            current_screen_->OnChangeFocus(true);
-            LOG_INFO_STREAM("ScreenManager: Navigated to screen ID \"" << current_screen_->GetId() << "\" / \"" << current_screen_->GetName() << "\"");
+            nodes_[current_].lastUsedNs = TimerService::MonotonicNs();
+            screen->OnChangeFocus(true);
+            LOG_INFO_STREAM("ScreenManager: Navigated to screen ID \"" << screen->GetId() << "\" / \"" << screen->GetName() << "\"");
         }
     }
 }
 
-void ScreenManager::ProcessInputEvent(const InputDeviceType device_type, const struct input_event &event)
+int ScreenManager::ResolveScreen(const std::string &id)
 {
-    if (current_screen_ != nullptr)
-        current_screen_->handle_input_event(device_type, event);
+    if (id == "")
+        return NoScreen;
+    auto it = nodeIndex_.find(id);
+    if (it != nodeIndex_.end())
+        return it->second;
+
+    Node node;
+    node.id = id;
+    nodes_.push_back(std::move(node));
+    int index = static_cast<int>(nodes_.size()) - 1;
+    nodeIndex_[id] = index;
+    return index;
+}
+
+int ScreenManager::FindNode(const std::string &id) const
+{
+    auto it = nodeIndex_.find(id);
+    return it != nodeIndex_.end() ? it->second : NoScreen;
+}
+
+ScreenBase *ScreenManager::ScreenAt(int node)
+{
+    if (node < 0 || node >= static_cast<int>(nodes_.size()))
+        return nullptr;
+    if (nodes_[node].screen)
+        return nodes_[node].screen.get();
+    if (!nodes_[node].configured)
+        return nullptr;
+
+    // building may resolve links and so grow nodes_; no Node reference is held across it
+    ScreenConfig config = nodes_[node].config;
+    std::unique_ptr<ScreenBase> built = CreateScreen(config);
+    ScreenBase *screen = built.get();
+    if (built)
+    {
+        LOG_DEBUG_STREAM("ScreenManager: Built screen ID \"" << config.id << "\" on first use");
+        nodes_[node].screen = std::move(built);
+        nodes_[node].lastUsedNs = TimerService::MonotonicNs();
+        UpdateResidentGauge();
+    }
+    return screen;
+}
+
+void ScreenManager::AddScreen(std::unique_ptr<ScreenBase> screen)
+{
+    int node = ResolveScreen(screen->GetId());
+    int next = ResolveScreen(screen->GetNextScreenId());
+    nodes_[node].screen = std::move(screen);
+    nodes_[node].lastUsedNs = TimerService::MonotonicNs();
+    if (!nodes_[node].configured)
+        nodes_[node].next = next;
 }
 
 void ScreenManager::LoadScreensFromConfig(const std::string& config_path)
 {
-    auto configContent = ReadFileContents(config_path);
-    if (configContent.empty())
-        // Handle error: could not read config file
+    ConfigurationReader reader(config_path);
+    if (!reader.load())
         return;
 
-    std::string parse_error;
-    json11::Json parsed_json = json11::Json::parse(configContent, parse_error, json11::JsonParse::COMMENTS);
+    const AppConfig &config = reader.get_app_config();
+    LoadScreens(config.first_screen_id, config.screens);
+}
 
-    if (!parse_error.empty())
+void ScreenManager::LoadScreens(const std::string &firstScreenId, const std::vector<ScreenConfig> &screens)
+{
+    if(firstScreenId != "")
+        firstScreenId_ = firstScreenId;
+
+    for (const auto& screen : screens)
     {
-        LOG_ERROR_STREAM("ScreenManager: JSON parse error: " << parse_error);
-        return;
+        if (!ScreenFactory::IsRegistered(screen.type))
+        {
+            CreateScreen(screen); // logs the unknown type
+            continue;
+        }
+        int node = ResolveScreen(screen.id);
+        nodes_[node].config = screen;
+        nodes_[node].configured = true;
+        // an instance built from an earlier definition is out of date
+        if (node != current_ && !history_.Contains(node))
+            nodes_[node].screen.reset();
     }
-    
-    if (!parsed_json.is_object())
+    ResolveLinks(screens);
+    UpdateResidentGauge();
+}
+
+void ScreenManager::ResolveLinks(const std::vector<ScreenConfig> &screens)
+{
+    // "nextScreen" comes resolved to an index into screens by the configuration reader;
+    // only a link it left unresolved is looked up by ID. Nodes configured earlier keep
+    // their links, as node indexes never change.
+    std::vector<int> nodeOf(screens.size(), NoScreen);
+    for (size_t i = 0; i < screens.size(); i++)
+        nodeOf[i] = FindNode(screens[i].id);
+    for (size_t i = 0; i < screens.size(); i++)
     {
-        LOG_ERROR_STREAM("ScreenManager: Root JSON element must be an object");
-        return;
+        int node = nodeOf[i];
+        // later entries win on duplicate IDs, as for the definitions
+        if (node == NoScreen || !nodes_[node].configured || !ScreenFactory::IsRegistered(screens[i].type))
+            continue;
+        int target = screens[i].next_screen_index;
+        nodes_[node].next = (target >= 0 && nodeOf[target] != NoScreen)
+            ? nodeOf[target]
+            : ResolveScreen(IdAttribute(screens[i].json["nextScreen"]));
     }
 
-    if(!parsed_json["firstScreen"].is_null())
+    // ResolveScreen adds a node for each unknown target; those nodes are the dangling links
+    danglingLinks_.clear();
+    auto check = [this](const std::string &from, const std::string &target) {
+        int node = FindNode(target);
+        if (target != "" && (node == NoScreen || (!nodes_[node].configured && !nodes_[node].screen)))
+            danglingLinks_.push_back(from + " -> \"" + target + "\"");
+    };
+    check("firstScreen", firstScreenId_);
+    for (size_t i = 0; i < nodes_.size(); i++)
     {
-        firstScreenId_ = (
-            parsed_json["firstScreen"].is_number()
-            ? std::to_string(parsed_json["firstScreen"].int_value())
-            : 
-                (
-                    parsed_json["firstScreen"].is_string()
-                    ? parsed_json["firstScreen"].string_value()
-                    : ""
-                )
-            );
+        if (!nodes_[i].configured)
+            continue;
+        const json11::Json &json = nodes_[i].config.json;
+        std::string from = "screen \"" + nodes_[i].id + "\"";
+        check(from + " nextScreen", IdAttribute(json["nextScreen"]));
+        // as MenuItem: an item without "nextScreen" goes to the screen named like it
+        const auto &items = json["menuItems"].array_items();
+        for (size_t item = 0; item < items.size(); item++)
+        {
+            std::string target = IdAttribute(items[item]["nextScreen"]);
+            check(from + " menuItems[" + std::to_string(item) + "]",
+                target != "" ? target : items[item]["name"].string_value());
+        }
     }
 
-    for (const auto& screen : parsed_json["screens"].array_items())
+    for (const auto &link : danglingLinks_)
+        LOG_WARN_STREAM("ScreenManager: Link to a screen that is not configured: " << link);
+}
+
+size_t ScreenManager::CountScreens() const
+{
+    size_t count = 0;
+    for (const auto &node : nodes_)
+        if (node.configured || node.screen)
+            count++;
+    return count;
+}
+
+size_t ScreenManager::CountBuiltScreens() const
+{
+    size_t count = 0;
+    for (const auto &node : nodes_)
+        if (node.screen)
+            count++;
+    return count;
+}
+
+ScreenBase* ScreenManager::GetScreenById(std::string const &id)
+{
+    return ScreenAt(FindNode(id));
+}
+
+std::vector<std::string> ScreenManager::WarmLikelyScreens(uint64_t nowNs)
+{
+    std::vector<std::string> integrationIds;
+    if (current_ == NoScreen)
+        return integrationIds;
+
+    for (int node : { current_, nodes_[current_].next })
     {
-        std::string name = (!screen["name"].is_null() ? screen["name"].string_value() : "");
-        std::string id = (!screen["id"].is_null() ? screen["id"].string_value() : name);
-        std::string type = (!screen["type"].is_null() ? screen["type"].string_value() : "");
-        transform(type.begin(), type.end(), type.begin(), ::tolower);
-
-        if (type == "home") 
-            AddScreen(std::unique_ptr<ScreenBase>(new HomeScreen(this, screen)));
-        else if (type == "menu") 
-            BuildMenuScreenFromJSON(screen);
-        else if (type == "switch") 
-            AddScreen(std::unique_ptr<ScreenBase>(new SwitchScreen(this, screen)));
-        else if (type == "dimmer") 
-            AddScreen(std::unique_ptr<ScreenBase>(new DimmerScreen(this, screen)));
-        else if (type == "analogclock") 
-            AddScreen(std::unique_ptr<ScreenBase>(new AnalogClockScreen(this, screen)));
-        else 
-            LOG_ERROR_STREAM(
-                "ScreenManager: Unknown screen type '" << type
-                << "' for screen \"" << id << "\" / " << "\"" << name << "\""
-            );
+        ScreenBase *screen = ScreenAt(node);
+        if (screen == nullptr)
+            continue;
+        nodes_[node].lastUsedNs = nowNs;
+        const std::string &integrationId = screen->GetIntegrationId();
+        if (!integrationId.empty()
+            && std::find(integrationIds.begin(), integrationIds.end(), integrationId) == integrationIds.end())
+            integrationIds.push_back(integrationId);
     }
+    return integrationIds;
 }
 
-std::string ScreenManager::ReadFileContents(const std::string& filepath) const
+size_t ScreenManager::EvictIdleScreens(uint64_t idleNs, uint64_t nowNs)
 {
-    std::ifstream file(filepath);
-    if (!file.is_open())
-        return "";
-    
-    std::stringstream buffer;
-    buffer << file.rdbuf();
+    size_t evicted = 0;
+    for (size_t i = 0; i < nodes_.size(); i++)
+    {
+        Node &node = nodes_[i];
+        // screens added without a definition could not be rebuilt
+        if (!node.screen || !node.configured
+            || static_cast<int>(i) == current_ || history_.Contains(static_cast<int>(i))
+            || nowNs - node.lastUsedNs < idleNs)
+            continue;
+        node.screen.reset();
+        evicted++;
+    }
+
+    if (evicted > 0)
+    {
+        LOG_DEBUG_STREAM("ScreenManager: Evicted " << evicted << " idle screens");
+        UpdateResidentGauge();
+    }
+    return evicted;
+}
 
-    return buffer.str();
+void ScreenManager::UpdateResidentGauge()
+{
+    static MetricGauge &resident = Metrics::Instance().Gauge(
+        "ui_screens_resident", "Screens currently built; the others are built on first use");
+    resident.Set(static_cast<int64_t>(CountBuiltScreens()));
 }
 
-void ScreenManager::BuildMenuScreenFromJSON(const json11::Json &screenJson)
+ScreenReloadStats ScreenManager::ReloadScreens(
+    const std::string &firstScreenId
+    , const std::vector<ScreenConfig> &screens
+    , const std::set<std::string> &changedIntegrations)
 {
-    std::map<std::string, MenuIcon> menuIcons =
+    ScreenReloadStats stats;
+    if(firstScreenId != "")
+        firstScreenId_ = firstScreenId;
+
+    // later entries win on duplicate IDs, as in LoadScreens
+    std::map<std::string, const ScreenConfig*> wanted;
+    for (const auto& screen : screens)
+        wanted[screen.id] = &screen;
+
+    // old instances stay alive until the history no longer refers to them
+    std::vector<std::unique_ptr<ScreenBase>> retired;
+    ScreenBase *previous = GetCurrentScreen();
+
+    for (auto &node : nodes_)
     {
-        {"", MenuIcon::NONE},
-        {"none", MenuIcon::NONE},
-        {"ok", MenuIcon::OK},
-        {"close", MenuIcon::CLOSE},
-        {"home", MenuIcon::HOME},
-        {"power", MenuIcon::POWER},
-        {"settings", MenuIcon::SETTINGS},
-        {"gps", MenuIcon::GPS},
-        {"wifi", MenuIcon::WIFI},
-        {"usb", MenuIcon::USB},
-        {"bell", MenuIcon::BELL},
-        {"trash", MenuIcon::TRASH},
-        {"breifcase", MenuIcon::BREIFCASE},
-        {"light", MenuIcon::LIGHT},
-        {"fan", MenuIcon::FAN},
-        {"temperature", MenuIcon::TEMPERATURE},
-        // {"", MenuIcon::},
-        {"stop", MenuIcon::STOP},
-        {"left", MenuIcon::LEFT},
-        {"right", MenuIcon::RIGHT},
-        {"plus", MenuIcon::PLUS},
-        {"warning", MenuIcon::WARNING},
-        {"up", MenuIcon::UP},
-        {"down", MenuIcon::DOWN},
-    };
+        if (!node.configured || wanted.find(node.id) != wanted.end())
+            continue;
+        if (node.screen)
+            retired.push_back(std::move(node.screen));
+        node.config = ScreenConfig();
+        node.configured = false;
+        node.next = NoScreen;
+        stats.removed++;
+    }
 
-    auto screen = new MenuScreen(this, screenJson);
+    for (const auto& pair : wanted)
+    {
+        const ScreenConfig &config = *pair.second;
+        int index = ResolveScreen(pair.first);
+        if (nodes_[index].configured
+            && nodes_[index].config == config
+            && changedIntegrations.find(BoundIntegrationId(config)) == changedIntegrations.end())
+        {
+            stats.unchanged++;
+            continue;
+        }
 
-    // if there is a "nextScreen", add a "Previous"
-    std::string screenNext = screen->GetNextScreenId();
-    if(screenNext != "")
-        screen->AddMenuItem(MenuItem("Previous", "", menuIcons["left"], true));
+        bool known = ScreenFactory::IsRegistered(config.type);
+        if (nodes_[index].configured || nodes_[index].screen)
+            stats.rebuilt++;
+        else if (known)
+            stats.added++;
 
-    // add menu entries as configured
-    for (const auto& itemJson : screenJson["menuItems"].array_items()) 
+        nodes_[index].configured = known;
+        nodes_[index].config = known ? config : ScreenConfig();
+        if (!known)
+            CreateScreen(config); // logs the unknown type
+
+        // Screens never built stay that way; a built one is replaced now, since the
+        // navigation history may point at it
+        if (nodes_[index].screen)
+        {
+            retired.push_back(std::move(nodes_[index].screen));
+            std::unique_ptr<ScreenBase> built = known ? CreateScreen(config) : std::unique_ptr<ScreenBase>();
+            nodes_[index].screen = std::move(built);
+        }
+    }
+    ResolveLinks(screens);
+    UpdateResidentGauge();
+
+    bool currentChanged = false;
+    for (const auto &screen : retired)
+        currentChanged = currentChanged || (screen.get() == previous);
+    if (currentChanged && previous)
+        previous->OnChangeFocus(false);
+
+    // drop removed screens; rebuilt ones keep their node and so their place
+    history_.RemoveIf([this](int node) { return !nodes_[node].screen; });
+    current_ = history_.Top();
+    retired.clear();
+
+    if (currentChanged)
     {
-        std::string itemIconStr = itemJson["icon"].string_value();
-        transform(itemIconStr.begin(), itemIconStr.end(), itemIconStr.begin(), ::tolower);
-        auto menuIconsIt = menuIcons.find(itemIconStr);
-
-        std::string nextScreen = (
-            itemJson["nextScreen"].is_number()
-            ? std::to_string(itemJson["nextScreen"].int_value())
-            : 
-                (
-                    itemJson["nextScreen"].is_string()
-                    ? itemJson["nextScreen"].string_value()
-                    : ""
-                )
-            );
-
-        screen->AddMenuItem(MenuItem(
-            itemJson["name"].string_value()
-            , nextScreen
-            , menuIconsIt != menuIcons.end() ? menuIconsIt->second : menuIcons[""]
-        ));
+        ScreenBase *current = GetCurrentScreen();
+        if (current)
+        {
+            current->OnChangeFocus(true);
+            LOG_INFO_STREAM("ScreenManager: Reloaded current screen ID \"" << current->GetId() << "\" / \"" << current->GetName() << "\"");
+        }
+        else
+            GoToFirstScreen();
     }
 
-    // configure a "Next" or "Back" final menu item
-    MenuIcon menuLastIcon = (screenNext == "" ? menuIcons["close"] : menuIcons["right"]);
-    std::string menuLastName= (screenNext == "" ? "Back" : "Next");
-    bool isPrevious = (screenNext == "");
-    screen->AddMenuItem(MenuItem(menuLastName, screenNext, menuLastIcon, isPrevious));
+    LOG_INFO_STREAM("ScreenManager: Reloaded screens, " << stats.added << " added, " << stats.rebuilt << " rebuilt, "
+        << stats.removed << " removed, " << stats.unchanged << " unchanged");
+    return stats;
+}
+
+std::unique_ptr<ScreenBase> ScreenManager::CreateScreen(const ScreenConfig &screen)
+{
+    std::unique_ptr<ScreenBase> built = ScreenFactory::Create(screen.type, this, screen.json);
+    if (built)
+        return built;
 
-    // in conclusion
-    AddScreen(std::unique_ptr<ScreenBase>(screen));
+    LOG_ERROR_STREAM(
+        "ScreenManager: Unknown screen type '" << screen.type
+        << "' for screen \"" << screen.id << "\" / " << "\"" << screen.name << "\""
+    );
+    return built;
 }
@@ -2,15 +2,27 @@
 
 #include <memory>
 #include <vector>
-#include <stack>
 #include <map>
+#include <set>
 #include <cstddef>
 #include <json11.hpp>
 
+#include "ConfigModel.hpp"
 #include "HAL/HAL.hpp"
 #include "Screens/ScreenBase.hpp"
 #include "Integrations/IntegrationContainer.hpp"
 #include "Backplate/BackplateComms.hpp"
+#include "TimerService.hpp"
+#include "NavigationHistory.hpp"
+
+// Outcome of ScreenManager::ReloadScreens, for the reload log line
+struct ScreenReloadStats
+{
+    size_t added = 0;
+    size_t rebuilt = 0;
+    size_t removed = 0;
+    size_t unchanged = 0;
+};
 
 class ScreenManager 
 {
@@ -26,21 +38,54 @@ public:
     {}
 
     virtual ~ScreenManager() {};
-    
+
+    // Node index meaning "no screen" in resolved links
+    static const int NoScreen = -1;
+
     void GoToFirstScreen(std::string id = "");
     void GoToNextScreen(std::string const &id);
+    // Follows the current screen's "nextScreen" link, resolved at load
+    void GoToNextScreen();
+    // Goes to a node returned by ResolveScreen
+    void GoToScreen(int node);
     void GoToPreviousScreen();
+    // Node index of a screen ID, for links resolved once when a screen is built. Stays
+    // valid across reloads; an ID not configured yet gets a node that a reload may fill.
+    int ResolveScreen(const std::string &id);
     void ProcessInputEvent(const InputDeviceType device_type, const input_event &event);
 
+    // Only records the definitions and resolves the links between them; each screen is
+    // built by ScreenFactory the first time it is needed
+    void LoadScreens(const std::string &firstScreenId, const std::vector<ScreenConfig> &screens);
+    // Reads and parses config_path itself; prefer LoadScreens with an already loaded config
     void LoadScreensFromConfig(const std::string &config_path);
-    inline size_t CountScreens() const { return screens_.size(); } // for test harness
+    // Rebuilds only the screens whose definition changed or whose integration is in
+    // changedIntegrations, and drops the ones no longer configured. The current screen
+    // and navigation history are kept, pointing at the rebuilt instances.
+    ScreenReloadStats ReloadScreens(
+        const std::string &firstScreenId
+        , const std::vector<ScreenConfig> &screens
+        , const std::set<std::string> &changedIntegrations);
+    size_t CountScreens() const; // configured or added, built or not; for test harness
+    size_t CountBuiltScreens() const; // for test harness
+    inline size_t CountHistory() const { return history_.Size(); } // for test harness
+    inline ScreenBase *GetCurrentScreen() const { return current_ != NoScreen ? nodes_[current_].screen.get() : nullptr; }
+    // "firstScreen", "nextScreen" and menu item links whose target is not configured,
+    // as found by the last load or reload
+    inline const std::vector<std::string> &GetDanglingLinks() const { return danglingLinks_; }
 
-    ScreenBase* GetScreenById(std::string const &id) const
-    {
-        auto it = screens_.find(id);
-        return (it != screens_.end()) ? it->second.get() : nullptr;
-    }
-    inline void AddScreen(std::unique_ptr<ScreenBase> screen) { screens_[screen->GetId()] = std::move(screen); }
+    // Builds a configured screen on first use
+    ScreenBase* GetScreenById(std::string const &id);
+    void AddScreen(std::unique_ptr<ScreenBase> screen);
+
+    // Pre-wake: builds the screen the current one links to, so the first input does not
+    // wait for it, and keeps both from eviction a while longer. Returns the integration
+    // IDs of the current and next screens, current first, for prefetching their state.
+    std::vector<std::string> WarmLikelyScreens(uint64_t nowNs = TimerService::MonotonicNs());
+
+    // Destroys built screens that were not shown for idleNs and are not in the navigation
+    // history; they are rebuilt from their definition when next needed. Returns how many.
+    size_t EvictIdleScreens(uint64_t idleNs, uint64_t nowNs = TimerService::MonotonicNs());
 
     inline HAL *Hal() const { return hal_; }
     inline IDisplay *HalDisplay() const { return Hal() != nullptr ? Hal()->display : nullptr; }
@@ -52,14 +97,36 @@ public:
     inline BackplateComms *GetBackplaceComms() const { return backplateComms_; }
 
 private:
-    void GoToScreenPtr(ScreenBase *screen);
-    std::string ReadFileContents(const std::string &filepath) const;
+    // A screen of the navigation graph. Nodes are never removed, so their indexes stay
+    // valid in links and in the history; a screen dropped by a reload leaves its node
+    // unconfigured and unbuilt.
+    struct Node
+    {
+        std::string id;
+        // Definition of a screen built from configuration, compared against on reload
+        ScreenConfig config;
+        bool configured = false;
+        std::unique_ptr<ScreenBase> screen;
+        // Monotonic time the screen was last built or navigated to, for eviction
+        uint64_t lastUsedNs = 0;
+        // "nextScreen" resolved, NoScreen when unset
+        int next = NoScreen;
+    };
 
-    void BuildMenuScreenFromJSON(const json11::Json &screenJson);
+    void GoToNode(int node);
+    int FindNode(const std::string &id) const;
+    // The node's screen, built from its definition when needed; nullptr if there is none
+    ScreenBase *ScreenAt(int node);
+    // Sets the "nextScreen" link of each screen in screens and logs links to screens not configured
+    void ResolveLinks(const std::vector<ScreenConfig> &screens);
+    std::unique_ptr<ScreenBase> CreateScreen(const ScreenConfig &screen);
+    void UpdateResidentGauge();
 
-    std::stack<ScreenBase*> screen_history_;
-    ScreenBase* current_screen_ = nullptr;
-    std::map<std::string, std::unique_ptr<ScreenBase>> screens_;
+    std::vector<Node> nodes_;
+    std::map<std::string, int> nodeIndex_;
+    NavigationHistory history_;
+    int current_ = NoScreen;
+    std::vector<std::string> danglingLinks_;
     std::string firstScreenId_;
 
     HAL *hal_ = nullptr;
@@ -1,13 +1,27 @@
+#define CUCKOO_LOG_MODULE "screens"
+
 #include <iostream>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 #include "AnalogClockScreen.hpp"
+#include "ScreenFactory.hpp"
 #include "logger.h"
+#include "trace.h"
+
+REGISTER_SCREEN_TYPE("analogclock", AnalogClockScreen);
 
 #ifndef PI
 #define PI 3.14159265358979323846
 #endif
 
+// Face diameter in pixels
+static const int32_t FaceSize = 298;
+
+lv_draw_buf_t AnalogClockScreen::face_cache_;
+bool AnalogClockScreen::face_cache_valid_ = false;
+
 void AnalogClockScreen::OnChangeFocus(bool focused)
 {
     if(focused)
@@ -16,7 +30,7 @@ void AnalogClockScreen::OnChangeFocus(bool focused)
         CreateClockFace();
         if (!clock_timer)
         {
-            clock_timer = lv_timer_create(update_clock_cb, 250, this);
+            clock_timer = lv_timer_create(update_clock_cb, MsToNextSecond(), this);
             StartIntroAnimation();
         }
     }
@@ -27,6 +41,14 @@ void AnalogClockScreen::OnChangeFocus(bool focused)
             lv_timer_delete(clock_timer);
             clock_timer = nullptr;
         }
+        for (int i = 0; i < HAND_COUNT; i++)
+        {
+            if (hands_[i].line)
+                lv_anim_delete(hands_[i].line, NULL);
+            hands_[i].line = nullptr;
+            hands_[i].angle = -1;
+        }
+        animating_ = false;
     }
 }
 
@@ -38,7 +60,7 @@ void AnalogClockScreen::handle_input_event(const InputDeviceType device_type, co
             beeper_->click();
 
         if (GetNextScreenId() != "")
-            screenManager_->GoToNextScreen(GetNextScreenId());
+            screenManager_->GoToNextScreen();
         else
             screenManager_->GoToPreviousScreen();
     }
@@ -46,13 +68,28 @@ void AnalogClockScreen::handle_input_event(const InputDeviceType device_type, co
 
 void AnalogClockScreen::update_clock_cb(lv_timer_t * timer)
 {
+    TRACE_SCOPE("AnalogClockScreen::Render");
     AnalogClockScreen * screen = (AnalogClockScreen *)lv_timer_get_user_data(timer);
     screen->UpdateClock();
+    // Fire just after the next second boundary so the second hand ticks in step with the wall clock
+    lv_timer_set_period(timer, MsToNextSecond());
 }
 
-void AnalogClockScreen::set_hand_rotation(void * obj, int32_t v)
+uint32_t AnalogClockScreen::MsToNextSecond()
 {
-    lv_obj_set_style_transform_rotation((lv_obj_t*)obj, v, 0);
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return 1000 - ts.tv_nsec / 1000000 + 2;
+}
+
+void AnalogClockScreen::animate_hand_cb(lv_anim_t * a, int32_t v)
+{
+    AnalogClockScreen * screen = (AnalogClockScreen *)lv_anim_get_user_data(a);
+    for (int i = 0; i < HAND_COUNT; i++)
+    {
+        if (screen->hands_[i].line == a->var)
+            screen->SetHandAngle(screen->hands_[i], v);
+    }
 }
 
 void AnalogClockScreen::set_opacity(void * obj, int32_t v)
@@ -92,31 +129,35 @@ void AnalogClockScreen::StartIntroAnimation()
     int32_t m_target = (int32_t)(min_angle * 10) + 3600;     // 1 extra spin
     int32_t h_target = (int32_t)(hour_angle * 10) + 3600;    // 1 extra spin
 
-    // Hour Hand Anim
+    // Hand animations; the line object is the anim var so LVGL drops the
+    // animation if the screen is cleared while it is still running
     lv_anim_t a;
     lv_anim_init(&a);
-    lv_anim_set_var(&a, hour_hand);
+    lv_anim_set_user_data(&a, this);
+    lv_anim_set_custom_exec_cb(&a, animate_hand_cb);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+
+    // Hour Hand Anim
+    lv_anim_set_var(&a, hands_[HOUR_HAND].line);
     lv_anim_set_values(&a, 0, h_target);
     lv_anim_set_time(&a, 1000);
-    lv_anim_set_exec_cb(&a, set_hand_rotation);
-    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
     lv_anim_start(&a);
 
     // Minute Hand Anim
-    lv_anim_set_var(&a, minute_hand);
+    lv_anim_set_var(&a, hands_[MINUTE_HAND].line);
     lv_anim_set_values(&a, 0, m_target);
     lv_anim_set_time(&a, 1200);
     lv_anim_start(&a);
 
     // Second Hand Anim
-    lv_anim_set_var(&a, second_hand);
+    lv_anim_set_var(&a, hands_[SECOND_HAND].line);
     lv_anim_set_values(&a, 0, s_target);
     lv_anim_set_time(&a, 1500);
-    lv_anim_set_user_data(&a, this);
     lv_anim_set_completed_cb(&a, anim_ready_cb); // Only simplest/last callback needed
     lv_anim_start(&a);
 
     // Fade In Animation (Container)
+    lv_anim_init(&a);
     lv_anim_set_var(&a, clock_container);
     lv_anim_set_values(&a, 0, LV_OPA_COVER);
     lv_anim_set_time(&a, 800);
@@ -127,68 +168,82 @@ void AnalogClockScreen::StartIntroAnimation()
     lv_anim_start(&a);
 }
 
+bool AnalogClockScreen::BuildFaceCache()
+{
+    // Lay out a scale off-screen, rasterize it once and keep only the pixels
+    lv_obj_t * scale = lv_scale_create(lv_scr_act());
+    lv_obj_set_size(scale, FaceSize, FaceSize);
+    lv_scale_set_mode(scale, LV_SCALE_MODE_ROUND_INNER);
+    lv_obj_set_style_bg_opa(scale, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_line_width(scale, 3, 0);
+    lv_scale_set_label_show(scale, true);
+    lv_scale_set_total_tick_count(scale, 61);
+    lv_scale_set_major_tick_every(scale, 5);
+    lv_obj_set_style_bg_color(scale, lv_color_black(), 0);
+
+    static const char * custom_labels[] = {"12", "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", NULL};
+    lv_scale_set_text_src(scale, custom_labels);
+    lv_scale_set_range(scale, 0, 12);
+    lv_scale_set_angle_range(scale, 360);
+    lv_scale_set_rotation(scale, 270);
+    lv_obj_set_style_text_color(scale, lv_color_white(), 0);
+    lv_obj_update_layout(scale);
+
+    // The buffer lives outside LVGL's heap, which is far smaller than the face
+    int32_t ext = lv_obj_get_ext_draw_size(scale);
+    uint32_t w = lv_obj_get_width(scale) + ext * 2;
+    uint32_t h = lv_obj_get_height(scale) + ext * 2;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_NATIVE);
+    uint32_t size = stride * h;
+    void * data = nullptr;
+    bool ok = (posix_memalign(&data, 64, size) == 0);
+    if (ok)
+    {
+        memset(data, 0, size);
+        ok = (lv_draw_buf_init(&face_cache_, w, h, LV_COLOR_FORMAT_NATIVE, stride, data, size) == LV_RESULT_OK
+              && lv_snapshot_take_to_draw_buf(scale, LV_COLOR_FORMAT_NATIVE, &face_cache_) == LV_RESULT_OK);
+    }
+    lv_obj_delete(scale);
+
+    if (!ok)
+    {
+        LOG_ERROR_STREAM("AnalogClockScreen: failed to pre-render the clock face");
+        free(data);
+        return false;
+    }
+    face_cache_valid_ = true;
+    return true;
+}
+
 void AnalogClockScreen::CreateClockFace()
 {
+    if (!face_cache_valid_)
+        BuildFaceCache();
+
     // Create container for all clock elements
     clock_container = lv_obj_create(lv_scr_act());
     lv_obj_remove_style_all(clock_container);
     lv_obj_set_size(clock_container, LV_PCT(100), LV_PCT(100));
     lv_obj_center(clock_container);
     lv_obj_set_style_opa(clock_container, 0, 0); // Start transparent
+    lv_obj_clear_flag(clock_container, LV_OBJ_FLAG_SCROLLABLE);
 
     lv_obj_t * parent = clock_container;
 
-    // Create face (circle)
-    face = lv_scale_create(parent);
-    lv_obj_set_size(face, 298, 298);
-    lv_scale_set_mode(face, LV_SCALE_MODE_ROUND_INNER);
-    lv_obj_set_style_bg_opa(face, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_line_width(face, 3, 0);
-    lv_scale_set_label_show(face, true);
-    lv_scale_set_total_tick_count(face, 61);
-    lv_scale_set_major_tick_every(face, 5);
-    lv_obj_set_style_bg_color(face, lv_color_black(), 0);
+    // Face, drawn from the cached raster
+    if (face_cache_valid_)
+    {
+        face = lv_image_create(parent);
+        lv_image_set_src(face, &face_cache_);
+        lv_obj_center(face);
+    }
+
+    center_x_ = display_->width() / 2;
+    center_y_ = display_->height() / 2;
 
-    static const char * custom_labels[] = {"12", "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", NULL};
-    lv_scale_set_text_src(face, custom_labels);
-    lv_scale_set_range(face, 0, 12);
-    lv_scale_set_angle_range(face, 360);
-    lv_scale_set_rotation(face, 270);
-    lv_obj_set_style_text_color(face, lv_color_white(), 0);
-    lv_obj_center(face);
-
-    // Hands (using basic objects instead of lines)
-    // Use parent (screen) to avoid parenting issues with scale
-
-    // Hour hand
-    hour_hand = lv_obj_create(parent);
-    lv_obj_set_size(hour_hand, 6, 60);
-    lv_obj_set_style_bg_color(hour_hand, lv_color_white(), 0);
-    lv_obj_set_style_radius(hour_hand, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(hour_hand, 0, 0);
-    lv_obj_set_style_transform_pivot_x(hour_hand, lv_pct(50), 0);
-    lv_obj_set_style_transform_pivot_y(hour_hand, lv_pct(100), 0);
-    lv_obj_align(hour_hand, LV_ALIGN_CENTER, 0, -30);
-
-    // Minute hand
-    minute_hand = lv_obj_create(parent);
-    lv_obj_set_size(minute_hand, 4, 90);
-    lv_obj_set_style_bg_color(minute_hand, lv_color_white(), 0);
-    lv_obj_set_style_radius(minute_hand, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(minute_hand, 0, 0);
-    lv_obj_set_style_transform_pivot_x(minute_hand, lv_pct(50), 0);
-    lv_obj_set_style_transform_pivot_y(minute_hand, lv_pct(100), 0);
-    lv_obj_align(minute_hand, LV_ALIGN_CENTER, 0, -45);
-
-    // Second hand
-    second_hand = lv_obj_create(parent);
-    lv_obj_set_size(second_hand, 2, 100);
-    lv_obj_set_style_bg_color(second_hand, lv_palette_main(LV_PALETTE_RED), 0);
-    lv_obj_set_style_radius(second_hand, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(second_hand, 0, 0);
-    lv_obj_set_style_transform_pivot_x(second_hand, lv_pct(50), 0);
-    lv_obj_set_style_transform_pivot_y(second_hand, lv_pct(100), 0);
-    lv_obj_align(second_hand, LV_ALIGN_CENTER, 0, -50);
+    CreateHand(HOUR_HAND, 60, 6, lv_color_white());
+    CreateHand(MINUTE_HAND, 90, 4, lv_color_white());
+    CreateHand(SECOND_HAND, 100, 2, lv_palette_main(LV_PALETTE_RED));
 
     // Center point
     center_point = lv_obj_create(parent);
@@ -199,27 +254,59 @@ void AnalogClockScreen::CreateClockFace()
     lv_obj_center(center_point);
 }
 
+void AnalogClockScreen::CreateHand(HandIndex index, int32_t length, int32_t width, lv_color_t color)
+{
+    Hand &hand = hands_[index];
+    hand.length = length;
+    hand.width = width;
+    hand.angle = -1;
+    hand.line = lv_line_create(clock_container);
+    lv_obj_set_style_line_width(hand.line, width, 0);
+    lv_obj_set_style_line_color(hand.line, color, 0);
+    lv_obj_set_style_line_rounded(hand.line, true, 0);
+    SetHandAngle(hand, 0);
+}
+
+void AnalogClockScreen::SetHandAngle(Hand &hand, int32_t angle)
+{
+    // The trig below works in whole degrees, so finer steps would redraw the same line
+    int16_t deg = static_cast<int16_t>((angle % 3600) / 10);
+    if (deg == hand.angle)
+        return;
+    hand.angle = deg;
+
+    // Integer trig (see MenuScreen): 0 is 12 o'clock, clockwise
+    int32_t tip_x = (hand.length * lv_trigo_sin(deg)) >> LV_TRIGO_SHIFT;
+    int32_t tip_y = -((hand.length * lv_trigo_cos(deg)) >> LV_TRIGO_SHIFT);
+
+    // Place the object at the box spanning pivot and tip, padded for the round caps
+    int32_t pad = hand.width / 2 + 1;
+    int32_t min_x = LV_MIN(0, tip_x) - pad;
+    int32_t min_y = LV_MIN(0, tip_y) - pad;
+    hand.points[0].x = -min_x;
+    hand.points[0].y = -min_y;
+    hand.points[1].x = tip_x - min_x;
+    hand.points[1].y = tip_y - min_y;
+    lv_line_set_points(hand.line, hand.points, 2);
+    lv_obj_set_pos(hand.line, center_x_ + min_x, center_y_ + min_y);
+}
+
 void AnalogClockScreen::UpdateClock()
 {
-    if (!hour_hand || !minute_hand || !second_hand) return;
+    if (!hands_[HOUR_HAND].line || !hands_[MINUTE_HAND].line || !hands_[SECOND_HAND].line) return;
     if (animating_) return;
 
     struct timespec ts;
     clock_gettime(CLOCK_REALTIME, &ts);
     struct tm * t = localtime(&ts.tv_sec);
 
-    // Calculate angles (0-360 degrees)
-    // 12 o'clock = 0 degrees for calculations
-    int sec_angle = t->tm_sec * 6;
-    float min_angle = (t->tm_min + t->tm_sec / 60.0f) * 6.0f;
-    float hour_angle = (t->tm_hour % 12 + t->tm_min / 60.0f) * 30.0f;
-
-    int32_t s_rot = (int32_t)(sec_angle * 10);
-    int32_t m_rot = (int32_t)(min_angle * 10);
-    int32_t h_rot = (int32_t)(hour_angle * 10);
+    // Angles in 0.1 degree units, 12 o'clock = 0
+    int32_t s_rot = t->tm_sec * 60;
+    int32_t m_rot = t->tm_min * 60 + t->tm_sec;
+    int32_t h_rot = (t->tm_hour % 12) * 300 + t->tm_min * 5;
 
-    // Rotate objects (Pivots and alignment set in CreateClockFace)
-    lv_obj_set_style_transform_rotation(hour_hand, h_rot, 0);
-    lv_obj_set_style_transform_rotation(minute_hand, m_rot, 0);
-    lv_obj_set_style_transform_rotation(second_hand, s_rot, 0);
+    // Hands that did not move are left alone and invalidate nothing
+    SetHandAngle(hands_[HOUR_HAND], h_rot);
+    SetHandAngle(hands_[MINUTE_HAND], m_rot);
+    SetHandAngle(hands_[SECOND_HAND], s_rot);
 }
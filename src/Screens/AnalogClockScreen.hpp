@@ -33,25 +33,45 @@ private:
 
     bool initialized_ = false;
 
+    // A hand is a two-point lv_line sized to its own bounding box, so moving
+    // it only invalidates the old and new boxes instead of the whole face
+    struct Hand
+    {
+        lv_obj_t * line = nullptr;
+        lv_point_precise_t points[2];
+        int32_t length = 0;
+        int32_t width = 0;
+        int32_t angle = -1; // whole degrees as drawn, -1 until first placed
+    };
+    enum HandIndex { HOUR_HAND, MINUTE_HAND, SECOND_HAND, HAND_COUNT };
+
     // LVGL objects
     lv_obj_t * clock_container = nullptr;
     lv_obj_t * face = nullptr;
-    lv_obj_t * hour_hand = nullptr;
-    lv_obj_t * minute_hand = nullptr;
-    lv_obj_t * second_hand = nullptr;
     lv_obj_t * center_point = nullptr;
+    Hand hands_[HAND_COUNT];
+    int32_t center_x_ = 0;
+    int32_t center_y_ = 0;
 
-    // Timer for updating the clock
+    // Timer for updating the clock, re-armed for each wall-clock second
     lv_timer_t * clock_timer = nullptr;
 
     bool animating_ = false;
 
+    // The static face is rasterized once per process and shown as an image
+    static lv_draw_buf_t face_cache_;
+    static bool face_cache_valid_;
+
     static void update_clock_cb(lv_timer_t * timer);
-    static void set_hand_rotation(void * obj, int32_t v);
+    static void animate_hand_cb(lv_anim_t * a, int32_t v);
     static void set_opacity(void * obj, int32_t v);
     static void anim_ready_cb(lv_anim_t * a);
+    static uint32_t MsToNextSecond();
 
     void UpdateClock();
     void CreateClockFace();
+    void CreateHand(HandIndex index, int32_t length, int32_t width, lv_color_t color);
+    void SetHandAngle(Hand &hand, int32_t angle);
+    bool BuildFaceCache();
     void StartIntroAnimation();
 };
@@ -1,20 +0,0 @@
-#ifndef CUCKOO_LOGO_NEST_HPP
-#define CUCKOO_LOGO_NEST_HPP
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-extern const lv_image_dsc_t CuckooLogoNest;
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif // CUCKOO_LOGO_NEST_HPP
@@ -1,9 +1,16 @@
+#define CUCKOO_LOG_MODULE "screens"
+
 #include <string>
 #include "DimmerScreen.hpp"
+#include "ScreenFactory.hpp"
 #include "logger.h"
+#include "trace.h"
+
+REGISTER_SCREEN_TYPE("dimmer", DimmerScreen);
 
 void DimmerScreen::Render()
 {
+    TRACE_SCOPE("DimmerScreen::Render");
     if (display_ == nullptr)
         return;
 
@@ -68,7 +75,7 @@ void DimmerScreen::handle_input_event(const InputDeviceType device_type, const s
         }
 
         if (GetNextScreenId() != "")
-            screenManager_->GoToNextScreen(GetNextScreenId());
+            screenManager_->GoToNextScreen();
         else
             screenManager_->GoToPreviousScreen();
     }
@@ -1,8 +1,14 @@
+#define CUCKOO_LOG_MODULE "screens"
+
 #include "HomeScreen.hpp"
+#include "ScreenFactory.hpp"
 #include <string>
 #include "logger.h"
+#include "trace.h"
 #include "DimmerScreen.hpp"
 
+REGISTER_SCREEN_TYPE("home", HomeScreen);
+
 static enum screen_color colors[] = {
     SCREEN_COLOR_BLACK,
     SCREEN_COLOR_RED,
@@ -38,6 +44,7 @@ HomeScreen::HomeScreen(ScreenManager *screenManager, const json11::Json &jsonCon
 
 void HomeScreen::Render()
 {
+    TRACE_SCOPE("HomeScreen::Render");
     if (display_ == nullptr)
         return;
 
@@ -90,7 +97,7 @@ void HomeScreen::handle_input_event(const InputDeviceType device_type, const str
             beeper_->click();
 
         if (GetNextScreenId() != "")
-            screenManager_->GoToNextScreen(GetNextScreenId());
+            screenManager_->GoToNextScreen();
         else
             screenManager_->GoToPreviousScreen();
     }
@@ -25,10 +25,14 @@ class MenuItem
         inline const std::string &GetName() const { return name_; }
         inline const MenuIcon GetIcon() const { return icon_; }
         inline bool IsPrevious() const { return previous_; }
+        // ScreenManager node of the next screen, resolved when the menu is built; -1 when not
+        inline int GetNextScreenNode() const { return nextScreenNode_; }
+        inline void SetNextScreenNode(int node) { nextScreenNode_ = node; }
 
     private:
         std::string name_;
         std::string nextScreenId_;
         MenuIcon icon_;
         bool previous_;
+        int nextScreenNode_ = -1;
 };
\ No newline at end of file
@@ -1,5 +1,8 @@
+#define CUCKOO_LOG_MODULE "screens"
+
 #include "MenuScreen.hpp"
 #include "logger.h"
+#include "trace.h"
 #include <lvgl/lvgl.h>
 #include <cmath>
 #include "../fonts/CuckooFontAwesomeDefs.h"
@@ -10,6 +13,7 @@ extern "C" {
 
 void MenuScreen::Render()
 {
+    TRACE_SCOPE("MenuScreen::Render");
     if (display_ == nullptr)
         return;
 
@@ -216,6 +220,9 @@ void MenuScreen::handle_input_event(const InputDeviceType device_type, const str
         MenuItem &selectedItem = menuItems[menuSelectedIndex];
 
 		LOG_INFO_STREAM("MenuScreen: selecting " << selectedItem.GetNextScreenId() << " / \"" << selectedItem.GetName() << "\"");
-        screenManager_->GoToNextScreen(selectedItem.GetNextScreenId()); 
+        if (selectedItem.GetNextScreenNode() != ScreenManager::NoScreen)
+            screenManager_->GoToScreen(selectedItem.GetNextScreenNode());
+        else
+            screenManager_->GoToNextScreen(selectedItem.GetNextScreenId());
     }
 }
@@ -29,6 +29,9 @@ public:
 
     virtual ~MenuScreen() = default;
 
+    // Builds the menu and its items from a "menu" screen entry; registered with ScreenFactory
+    static std::unique_ptr<ScreenBase> FromConfig(ScreenManager *screenManager, const json11::Json &jsonConfig);
+
     void Render() override;
     void handle_input_event(const InputDeviceType device_type, const struct input_event &event) override;
     inline void AddMenuItem(const MenuItem& item) { menuItems.push_back(item); }
@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <map>
+
+#include "MenuScreen.hpp"
+#include "ScreenFactory.hpp"
+
+static const bool screen_type_registered_MenuScreen = ScreenFactory::Register("menu", MenuScreen::FromConfig);
+
+std::unique_ptr<ScreenBase> MenuScreen::FromConfig(ScreenManager *screenManager, const json11::Json &screenJson)
+{
+    std::map<std::string, MenuIcon> menuIcons =
+    {
+        {"", MenuIcon::NONE},
+        {"none", MenuIcon::NONE},
+        {"ok", MenuIcon::OK},
+        {"close", MenuIcon::CLOSE},
+        {"home", MenuIcon::HOME},
+        {"power", MenuIcon::POWER},
+        {"settings", MenuIcon::SETTINGS},
+        {"gps", MenuIcon::GPS},
+        {"wifi", MenuIcon::WIFI},
+        {"usb", MenuIcon::USB},
+        {"bell", MenuIcon::BELL},
+        {"trash", MenuIcon::TRASH},
+        {"breifcase", MenuIcon::BREIFCASE},
+        {"light", MenuIcon::LIGHT},
+        {"fan", MenuIcon::FAN},
+        {"temperature", MenuIcon::TEMPERATURE},
+        // {"", MenuIcon::},
+        {"stop", MenuIcon::STOP},
+        {"left", MenuIcon::LEFT},
+        {"right", MenuIcon::RIGHT},
+        {"plus", MenuIcon::PLUS},
+        {"warning", MenuIcon::WARNING},
+        {"up", MenuIcon::UP},
+        {"down", MenuIcon::DOWN},
+    };
+
+    auto screen = new MenuScreen(screenManager, screenJson);
+    // links are resolved to graph nodes once, here, rather than on every selection
+    auto addItem = [screen, screenManager](MenuItem item) {
+        if (!item.IsPrevious())
+            item.SetNextScreenNode(screenManager->ResolveScreen(item.GetNextScreenId()));
+        screen->AddMenuItem(item);
+    };
+
+    // if there is a "nextScreen", add a "Previous"
+    std::string screenNext = screen->GetNextScreenId();
+    if(screenNext != "")
+        addItem(MenuItem("Previous", "", menuIcons["left"], true));
+
+    // add menu entries as configured
+    for (const auto& itemJson : screenJson["menuItems"].array_items()) 
+    {
+        std::string itemIconStr = itemJson["icon"].string_value();
+        transform(itemIconStr.begin(), itemIconStr.end(), itemIconStr.begin(), ::tolower);
+        auto menuIconsIt = menuIcons.find(itemIconStr);
+
+        std::string nextScreen = (
+            itemJson["nextScreen"].is_number()
+            ? std::to_string(itemJson["nextScreen"].int_value())
+            : 
+                (
+                    itemJson["nextScreen"].is_string()
+                    ? itemJson["nextScreen"].string_value()
+                    : ""
+                )
+            );
+
+        addItem(MenuItem(
+            itemJson["name"].string_value()
+            , nextScreen
+            , menuIconsIt != menuIcons.end() ? menuIconsIt->second : menuIcons[""]
+        ));
+    }
+
+    // configure a "Next" or "Back" final menu item
+    MenuIcon menuLastIcon = (screenNext == "" ? menuIcons["close"] : menuIcons["right"]);
+    std::string menuLastName= (screenNext == "" ? "Back" : "Next");
+    bool isPrevious = (screenNext == "");
+    addItem(MenuItem(menuLastName, screenNext, menuLastIcon, isPrevious));
+
+    // in conclusion
+    return std::unique_ptr<ScreenBase>(screen);
+}
@@ -21,21 +21,11 @@ public:
     ScreenBase() {}; // for testing harness
     ScreenBase(ScreenManager* screenManager, const json11::Json &jsonConfig)
     : screenManager_(screenManager)
+    , name_(AttributeString(jsonConfig["name"]))
+    , id_(AttributeString(jsonConfig["id"]))
+    , nextScreenId_(AttributeString(jsonConfig["nextScreen"]))
+    , integrationId_(AttributeString(jsonConfig["integrationId"]))
     {
-        std::vector<std::string> attribNames =
-            { "name", "id", "nextScreen","integrationId" };
-        // copy attribute value from json, and ensure there is entry in the attribs_
-        for(const auto & attribName :attribNames)
-        {
-            std::string v;
-            // this might be a number, convert it to string
-            if(jsonConfig[attribName].is_number())
-                v = std::to_string(jsonConfig[attribName].int_value());
-            else if(jsonConfig[attribName].is_string())
-                v = jsonConfig[attribName].string_value();
-            attribs_[attribName] = v;
-        }
-
         // if no json "id" attribute is provided, use our "name" attribute
         if(GetId() == "")
             SetId(GetName());
@@ -46,21 +36,32 @@ public:
     virtual void handle_input_event(const InputDeviceType device_type, const struct input_event& event) = 0;
     virtual void OnChangeFocus(bool focused) { if(focused) Render(); };
 
-    // These getters are safe, because the ctor ensures that there is an entry in attribs_
-    inline const std::string &GetId() const { return attribs_["id"]; }
-    inline void SetId(std::string const &id) { attribs_["id"] = id; }
+    inline const std::string &GetId() const { return id_; }
+    inline void SetId(std::string const &id) { id_ = id; }
 
-	inline void SetName(std::string const &str) { attribs_["name"] = str; }
-	inline const std::string &GetName() const { return attribs_["name"]; }
+	inline void SetName(std::string const &str) { name_ = str; }
+	inline const std::string &GetName() const { return name_; }
 
-    inline const std::string &GetIntegrationId() const { return attribs_["integrationId"]; }
-    inline void SetIntegrationId(std::string const &id) { attribs_["integrationId"] = id; }
+    inline const std::string &GetIntegrationId() const { return integrationId_; }
+    inline void SetIntegrationId(std::string const &id) { integrationId_ = id; }
 
-    inline const std::string &GetNextScreenId() const { return attribs_["nextScreen"]; }
-    void SetNextScreenId(std::string const &id) { attribs_["nextScreen"] = id; }
+    inline const std::string &GetNextScreenId() const { return nextScreenId_; }
+    void SetNextScreenId(std::string const &id) { nextScreenId_ = id; }
 
 protected:
     ScreenManager* screenManager_ = nullptr;
 private:
-    mutable std::map<std::string, std::string> attribs_;
+    // a number is converted, as config IDs may be either
+    static std::string AttributeString(const json11::Json &value)
+    {
+        if(value.is_number())
+            return std::to_string(value.int_value());
+        return value.string_value();
+    }
+
+    // Plain fields rather than a map: the getters run on every input event and render
+    std::string name_;
+    std::string id_;
+    std::string nextScreenId_;
+    std::string integrationId_;
 };
\ No newline at end of file
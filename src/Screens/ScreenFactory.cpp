@@ -0,0 +1,34 @@
+#include "ScreenFactory.hpp"
+
+std::map<std::string, ScreenFactory::Creator> &ScreenFactory::Registry()
+{
+    static std::map<std::string, Creator> registry;
+    return registry;
+}
+
+bool ScreenFactory::Register(const std::string &type, Creator creator)
+{
+    Registry()[type] = std::move(creator);
+    return true;
+}
+
+bool ScreenFactory::IsRegistered(const std::string &type)
+{
+    return Registry().count(type) != 0;
+}
+
+std::unique_ptr<ScreenBase> ScreenFactory::Create(const std::string &type, ScreenManager *screenManager, const json11::Json &jsonConfig)
+{
+    auto it = Registry().find(type);
+    if (it == Registry().end())
+        return std::unique_ptr<ScreenBase>();
+    return it->second(screenManager, jsonConfig);
+}
+
+std::vector<std::string> ScreenFactory::Types()
+{
+    std::vector<std::string> types;
+    for (const auto &pair : Registry())
+        types.push_back(pair.first);
+    return types;
+}
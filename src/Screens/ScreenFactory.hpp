@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <json11.hpp>
+
+#include "ScreenBase.hpp"
+
+/**
+ * @brief Builds screens by their configured "type"
+ *
+ * Each screen type registers itself from its own source file with
+ * REGISTER_SCREEN_TYPE, so adding a type needs no change in ScreenManager.
+ * Types are lower case, as ConfigurationReader normalizes them.
+ */
+class ScreenFactory
+{
+public:
+    using Creator = std::function<std::unique_ptr<ScreenBase>(ScreenManager *screenManager, const json11::Json &jsonConfig)>;
+
+    // Returns true so it can initialize a namespace-scope constant; a later registration of a type replaces the earlier one
+    static bool Register(const std::string &type, Creator creator);
+    static bool IsRegistered(const std::string &type);
+    // nullptr for an unknown type
+    static std::unique_ptr<ScreenBase> Create(const std::string &type, ScreenManager *screenManager, const json11::Json &jsonConfig);
+    static std::vector<std::string> Types();
+
+private:
+    // Function-local, so registrations from other translation units' static initializers find it constructed
+    static std::map<std::string, Creator> &Registry();
+};
+
+// At namespace scope in the screen's .cpp: REGISTER_SCREEN_TYPE("dimmer", DimmerScreen)
+#define REGISTER_SCREEN_TYPE(type, ScreenClass) \
+    static const bool screen_type_registered_##ScreenClass = ScreenFactory::Register(type, \
+        [](ScreenManager *screenManager, const json11::Json &jsonConfig) { \
+            return std::unique_ptr<ScreenBase>(new ScreenClass(screenManager, jsonConfig)); \
+        })
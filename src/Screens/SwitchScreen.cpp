@@ -1,8 +1,15 @@
+#define CUCKOO_LOG_MODULE "screens"
+
 #include "SwitchScreen.hpp"
+#include "ScreenFactory.hpp"
 #include "logger.h"
+#include "trace.h"
+
+REGISTER_SCREEN_TYPE("switch", SwitchScreen);
 
 void SwitchScreen::Render()
 {
+    TRACE_SCOPE("SwitchScreen::Render");
     if (display_ == nullptr)
         return;
 
@@ -111,7 +118,7 @@ void SwitchScreen::handle_input_event(const InputDeviceType device_type, const s
             // Navigate back to the previous screen
 
             if (GetNextScreenId() != "")
-                screenManager_->GoToNextScreen(GetNextScreenId());
+                screenManager_->GoToNextScreen();
             else
                 screenManager_->GoToPreviousScreen();
             selectedOption = SelectedOption::TOGGLE; // Reset selection
@@ -0,0 +1,88 @@
+#include "StatusRoutes.hpp"
+#include "Metrics.hpp"
+#include "Backplate/BackplateComms.hpp"
+#include "Integrations/CurlWrapperJson.hpp"
+#include "trace.h"
+
+#include <iomanip>
+#include <sstream>
+#include <time.h>
+
+static HttpServer::Response JsonResponse(int status, const std::string &body)
+{
+    HttpServer::Response response;
+    response.status = status;
+    response.content_type = "application/json";
+    response.body = body;
+    return response;
+}
+
+// Seconds since a wall clock time, or null when it never happened
+static std::string AgeSeconds(int64_t then, time_t now)
+{
+    return then > 0 ? std::to_string(static_cast<int64_t>(now) - then) : "null";
+}
+
+static HttpServer::Response Health(const BackplateComms *backplate, bool home_assistant_configured, uint64_t started_us)
+{
+    time_t now = time(nullptr);
+    BackplateComms::SensorSnapshot sensors = backplate->GetSensorSnapshot();
+    int64_t last_success = CurlWrapperJson::LastSuccessTime();
+    int64_t last_failure = CurlWrapperJson::LastFailureTime();
+    bool ready = backplate->IsReady();
+    // Unknown until a request was made; failing while the latest attempt failed
+    bool ha_failing = home_assistant_configured && last_failure > last_success;
+
+    const char *status = !ready ? "down" : ha_failing ? "degraded" : "ok";
+    std::ostringstream body;
+    body << "{\"status\":\"" << status << "\""
+         << ",\"uptime_seconds\":" << (MetricTimer::NowUs() - started_us) / 1000000
+         << ",\"backplate\":{\"run_state\":" << backplate->GetRunState()
+         << ",\"ready\":" << (ready ? "true" : "false")
+         << ",\"last_sensor_time\":" << static_cast<int64_t>(sensors.time)
+         << ",\"sensor_age_seconds\":" << AgeSeconds(sensors.time, now) << "}"
+         << ",\"home_assistant\":{\"configured\":" << (home_assistant_configured ? "true" : "false")
+         << ",\"connected\":" << (last_success == 0 && last_failure == 0 ? "null" : ha_failing ? "false" : "true")
+         << ",\"last_success_time\":" << last_success
+         << ",\"last_failure_time\":" << last_failure << "}}\n";
+    return JsonResponse(ready ? 200 : 503, body.str());
+}
+
+static HttpServer::Response Sensors(const BackplateComms *backplate)
+{
+    BackplateComms::SensorSnapshot sensors = backplate->GetSensorSnapshot();
+    std::ostringstream body;
+    body << std::fixed << std::setprecision(2) << "{";
+    if (sensors.time > 0)
+        body << "\"temperature_c\":" << sensors.temperatureC << ",\"humidity_percent\":" << sensors.humidityPercent;
+    else
+        body << "\"temperature_c\":null,\"humidity_percent\":null";
+    body << ",\"time\":" << static_cast<int64_t>(sensors.time)
+         << ",\"age_seconds\":" << AgeSeconds(sensors.time, time(nullptr)) << "}\n";
+    return JsonResponse(200, body.str());
+}
+
+void RegisterStatusRoutes(HttpServer &server, const BackplateComms *backplate, bool home_assistant_configured)
+{
+    uint64_t started_us = MetricTimer::NowUs();
+
+    server.Route("/metrics", [](const HttpServer::Request &) {
+        HttpServer::Response response;
+        response.content_type = "text/plain; version=0.0.4";
+        response.body = Metrics::Instance().RenderPrometheus();
+        return response;
+    });
+    server.Route("/health", [backplate, home_assistant_configured, started_us](const HttpServer::Request &) {
+        return Health(backplate, home_assistant_configured, started_us);
+    });
+    server.Route("/sensors", [backplate](const HttpServer::Request &) {
+        return Sensors(backplate);
+    });
+#if CUCKOO_TRACE
+    server.Route("/trace", [](const HttpServer::Request &) {
+        std::ostringstream body;
+        cuckoo_trace::Tracer::write_chrome_json(body);
+        return JsonResponse(200, body.str());
+    });
+#endif
+}
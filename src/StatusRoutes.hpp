@@ -0,0 +1,19 @@
+#pragma once
+
+#include "HttpServer.hpp"
+
+class BackplateComms;
+
+/**
+ * @brief Registers the diagnostics routes on server
+ *
+ *   /metrics  Metrics::RenderPrometheus() in the Prometheus text format
+ *   /health   JSON with the backplate run state, the age of the last sensor
+ *             frame and Home Assistant reachability; 503 until the backplate
+ *             is ready
+ *   /sensors  JSON with the latest sensor snapshot
+ *   /trace    Chrome trace JSON of the recent spans, in CUCKOO_TRACE builds
+ *
+ * backplate must outlive the server.
+ */
+void RegisterStatusRoutes(HttpServer &server, const BackplateComms *backplate, bool home_assistant_configured);
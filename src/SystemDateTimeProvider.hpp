@@ -1,4 +1,5 @@
 #pragma once
+#include <time.h>
 #include "IDateTimeProvider.hpp"
 
 class SystemDateTimeProvider : public IDateTimeProvider {
@@ -6,4 +7,11 @@ public:
     int gettimeofday(struct timeval &tv) override {
         return ::gettimeofday(&tv, nullptr);
     }
-};
\ No newline at end of file
+
+    // Timers must not jump when the time of day is set
+    uint64_t monotonic_ns() override {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+    }
+};
@@ -0,0 +1,66 @@
+#define CUCKOO_LOG_MODULE "thermostat"
+
+#include "HvacControl.hpp"
+#include "../Metrics.hpp"
+#include "../TimerService.hpp"
+#include "logger.h"
+
+HvacControl::HvacControl(BackplateComms &comms, const ThermostatConfig &config)
+    : comms_(comms)
+    , controller_(config, comms.CommsNowNs())
+    , periodNs_(TimerService::Ms(config.control_period_ms))
+{
+}
+
+void HvacControl::Start()
+{
+    comms_.AddTemperatureCallback([this](float temperatureC) { OnTemperature(temperatureC); });
+    // Runs after the temperature callbacks of the same frame
+    comms_.AddGenericEventCallback([this](uint16_t type, const uint8_t *, size_t length) {
+        if (type == static_cast<uint16_t>(MessageType::TempHumidityData) && length >= 4)
+            controller_.OnReadingConfirmed(comms_.CommsNowNs());
+    });
+    comms_.AddCommsTask(periodNs_, [this]() { Tick(); });
+    LOG_INFO_STREAM("HvacControl: mode " << static_cast<int>(controller_.Mode()) << ", evaluating every "
+        << periodNs_ / 1000000 << " ms and on each temperature frame");
+}
+
+void HvacControl::OnTemperature(float temperatureC)
+{
+    frameNs_ = comms_.LastReadNs();
+    controller_.OnTemperature(temperatureC, comms_.CommsNowNs());
+    Tick();
+    frameNs_ = 0;
+}
+
+void HvacControl::Tick()
+{
+    static MetricHistogram &latencyUs = Metrics::Instance().Histogram(
+        "hvac_actuation_latency_us", "From a temperature frame to the FET write it caused");
+    static MetricCounter &late = Metrics::Instance().Counter(
+        "hvac_actuation_late_total", "FET writes later than one control period after their frame");
+
+    uint64_t now = comms_.CommsNowNs();
+    uint8_t outputs = controller_.Step(now);
+    if (!comms_.IsHandshakeComplete())
+        return;
+    // Written and either acknowledged or still being resent: nothing to do. A write
+    // BackplateComms gave up on goes out again, so a lost "all off" is not final.
+    if (static_cast<int>(outputs) == sentOutputs_
+        && (static_cast<int>(outputs) == comms_.GetAckedFetMask() || comms_.IsFetAckPending()))
+        return;
+
+    comms_.SendFetControl(outputs);
+    sentOutputs_ = outputs;
+    // Changes that come from a minimum time running out have no frame to time
+    if (frameNs_ != 0)
+    {
+        uint64_t latencyNs = comms_.CommsNowNs() - frameNs_;
+        latencyUs.Record(latencyNs / 1000);
+        if (latencyNs > periodNs_)
+        {
+            late.Add();
+            LOG_WARN_STREAM("HvacControl: FET write " << latencyNs / 1000 << " us after its frame");
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "ThermostatController.hpp"
+#include "../Backplate/BackplateComms.hpp"
+
+/**
+ * @brief Runs a ThermostatController on the backplate comms thread
+ *
+ * Every published temperature is evaluated as soon as it is parsed, and a
+ * tick every control_period_ms covers the minimum times and lockouts running
+ * out between frames. Frames the sensor filter holds back inside its deadband
+ * still keep the last temperature fresh, so a steady room is not mistaken for
+ * a lost sensor whatever the filter's refresh_seconds. Changed outputs go out
+ * as FetControl, which BackplateComms resends until acknowledged; when it
+ * gives up, the next tick writes them again until the backplate echoes them.
+ * Nothing is actuated before the handshake.
+ * hvac_actuation_latency_us measures a frame's arrival to the FET write it
+ * causes; writes later than one control period count in
+ * hvac_actuation_late_total.
+ */
+class HvacControl
+{
+public:
+    HvacControl(BackplateComms &comms, const ThermostatConfig &config);
+
+    // Call before comms.Initialize()
+    void Start();
+
+    // Comms thread only
+    inline const ThermostatController &Controller() const { return controller_; }
+
+private:
+    void OnTemperature(float temperatureC);
+    void Tick();
+
+    BackplateComms &comms_;
+    ThermostatController controller_;
+    uint64_t periodNs_;
+
+    // Outputs last written, -1 before the first write; not necessarily acknowledged
+    int sentOutputs_ = -1;
+    // Arrival of the frame being evaluated, 0 outside OnTemperature
+    uint64_t frameNs_ = 0;
+};
@@ -0,0 +1,86 @@
+#define CUCKOO_LOG_MODULE "thermostat"
+
+#include <algorithm>
+
+#include "ThermostatController.hpp"
+#include "../TimerService.hpp"
+#include "logger.h"
+
+const uint64_t ThermostatController::SensorTimeoutNs;
+
+ThermostatController::ThermostatController(const ThermostatConfig &config, uint64_t nowNs)
+    : mode_(ParseMode(config.mode))
+    , heatSetpointC_(static_cast<float>(config.heat_setpoint_c))
+    , coolSetpointC_(static_cast<float>(config.cool_setpoint_c))
+    , hysteresisC_(static_cast<float>(config.hysteresis_c))
+    , minOnNs_(TimerService::Sec(config.min_on_seconds))
+    , minOffNs_(TimerService::Sec(config.min_off_seconds))
+    , compressorLockoutNs_(TimerService::Sec(config.compressor_lockout_seconds))
+{
+    heat_.changedNs = nowNs;
+    cool_.changedNs = nowNs;
+}
+
+HvacMode ThermostatController::ParseMode(const std::string &mode)
+{
+    if (mode == "heat")
+        return HvacMode::Heat;
+    if (mode == "cool")
+        return HvacMode::Cool;
+    return HvacMode::Off;
+}
+
+void ThermostatController::OnTemperature(float temperatureC, uint64_t nowNs)
+{
+    haveTemperature_ = true;
+    temperatureC_ = temperatureC;
+    temperatureNs_ = nowNs;
+}
+
+void ThermostatController::OnReadingConfirmed(uint64_t nowNs)
+{
+    if (haveTemperature_)
+        temperatureNs_ = nowNs;
+}
+
+uint8_t ThermostatController::Step(uint64_t nowNs)
+{
+    bool fresh = haveTemperature_ && nowNs - temperatureNs_ < SensorTimeoutNs;
+    bool heatWanted = fresh && mode_ == HvacMode::Heat && Demand(heat_, true, heatSetpointC_);
+    bool coolWanted = fresh && mode_ == HvacMode::Cool && Demand(cool_, false, coolSetpointC_);
+
+    bool heating = Apply(heat_, heatWanted, 0, nowNs);
+    bool cooling = Apply(cool_, coolWanted, compressorLockoutNs_, nowNs);
+
+    uint8_t outputs = (heating ? Fet::Heat : 0) | (cooling ? Fet::Cool | Fet::Fan : 0);
+    if (outputs != outputs_)
+        LOG_INFO_STREAM("Thermostat: outputs 0x" << std::hex << static_cast<int>(outputs) << std::dec
+            << " at " << temperatureC_ << " C");
+    outputs_ = outputs;
+    return outputs_;
+}
+
+bool ThermostatController::Demand(const Stage &stage, bool heating, float setpointC) const
+{
+    // past the setpoint by the hysteresis to start, back across it by as much to stop
+    if (heating)
+        return stage.on ? temperatureC_ < setpointC + hysteresisC_ : temperatureC_ <= setpointC - hysteresisC_;
+    return stage.on ? temperatureC_ > setpointC - hysteresisC_ : temperatureC_ >= setpointC + hysteresisC_;
+}
+
+bool ThermostatController::Apply(Stage &stage, bool wanted, uint64_t lockoutNs, uint64_t nowNs)
+{
+    if (wanted == stage.on)
+        return stage.on;
+
+    uint64_t held = nowNs - stage.changedNs;
+    if (stage.on && held < minOnNs_)
+        return true;
+    if (!stage.on && held < (stage.switched ? std::max(minOffNs_, lockoutNs) : lockoutNs))
+        return false;
+
+    stage.on = wanted;
+    stage.switched = true;
+    stage.changedNs = nowNs;
+    return stage.on;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "../ConfigModel.hpp"
+
+// FET outputs as sent in a FetControl frame, one bit per thermostat wire
+namespace Fet
+{
+    const uint8_t Heat = 0x01;  // W1
+    const uint8_t Cool = 0x02;  // Y1, the compressor
+    const uint8_t Fan = 0x04;   // G
+}
+
+enum class HvacMode { Off, Heat, Cool };
+
+/**
+ * @brief Bang-bang HVAC control with equipment protection
+ *
+ * Pure logic: the caller feeds temperatures and asks for the outputs at a
+ * given time, so the same sequence of calls always gives the same outputs.
+ * A stage starts hysteresis past its setpoint and stops hysteresis on the
+ * other side of it. Once switched, a stage holds for its minimum on or off
+ * time; cooling also waits out the compressor lockout after it stops and
+ * after the controller starts, which covers a power cut. Without a reading
+ * for SensorTimeout the demand is dropped.
+ */
+class ThermostatController
+{
+public:
+    ThermostatController(const ThermostatConfig &config, uint64_t nowNs);
+
+    static HvacMode ParseMode(const std::string &mode);
+
+    void OnTemperature(float temperatureC, uint64_t nowNs);
+    // A sensor frame that did not change the published temperature: the last one still holds
+    void OnReadingConfirmed(uint64_t nowNs);
+    // Outputs for nowNs, as a mask of Fet bits
+    uint8_t Step(uint64_t nowNs);
+    inline uint8_t Outputs() const { return outputs_; }
+    inline HvacMode Mode() const { return mode_; }
+
+    // A reading older than this (5 minutes) no longer drives any stage
+    static const uint64_t SensorTimeoutNs = 300000000000ull;
+
+private:
+    struct Stage
+    {
+        bool on = false;
+        bool switched = false;  // false until the first change; changedNs is then the start
+        uint64_t changedNs = 0;
+    };
+
+    bool Demand(const Stage &stage, bool heating, float setpointC) const;
+    // Switches stage towards wanted if its minimum time and lockout allow; returns its state
+    bool Apply(Stage &stage, bool wanted, uint64_t lockoutNs, uint64_t nowNs);
+
+    HvacMode mode_;
+    float heatSetpointC_;
+    float coolSetpointC_;
+    float hysteresisC_;
+    uint64_t minOnNs_;
+    uint64_t minOffNs_;
+    uint64_t compressorLockoutNs_;
+
+    bool haveTemperature_ = false;
+    float temperatureC_ = 0.0f;
+    uint64_t temperatureNs_ = 0;
+
+    Stage heat_;
+    Stage cool_;
+    uint8_t outputs_ = 0;
+};
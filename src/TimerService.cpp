@@ -0,0 +1,181 @@
+#define CUCKOO_LOG_MODULE "app"
+
+#include "TimerService.hpp"
+#include "logger.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+const uint64_t TimerService::NoDeadline;
+
+TimerService::TimerService(Clock clock) : clock_(clock)
+{
+}
+
+TimerService::~TimerService()
+{
+    if (timer_fd_ >= 0)
+        close(timer_fd_);
+}
+
+uint64_t TimerService::MonotonicNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+TimerService::TimerId TimerService::ScheduleAfter(uint64_t delay_ns, Callback callback)
+{
+    TimerId id = next_id_++;
+    Timer &timer = timers_[id];
+    timer.deadline = Now() + delay_ns;
+    timer.interval = 0;
+    timer.callback = std::move(callback);
+    Push(id, timer.deadline);
+    return id;
+}
+
+TimerService::TimerId TimerService::ScheduleEvery(uint64_t interval_ns, Callback callback, uint64_t first_delay_ns)
+{
+    TimerId id = ScheduleAfter(first_delay_ns, std::move(callback));
+    timers_[id].interval = interval_ns > 0 ? interval_ns : 1;
+    return id;
+}
+
+bool TimerService::Reschedule(TimerId id, uint64_t delay_ns)
+{
+    auto it = timers_.find(id);
+    if (it == timers_.end())
+        return false;
+    it->second.deadline = Now() + delay_ns;
+    Push(id, it->second.deadline);
+    return true;
+}
+
+bool TimerService::Cancel(TimerId id)
+{
+    if (timers_.erase(id) == 0)
+        return false;
+    DropStale();
+    ArmFd();
+    return true;
+}
+
+int TimerService::RunExpired()
+{
+    // Clear the timerfd's readiness; ArmFd() below sets it up for the next deadline
+    if (timer_fd_ >= 0)
+    {
+        uint64_t expirations;
+        if (read(timer_fd_, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN)
+            LOG_WARN_STREAM("TimerService: timerfd read failed: " << strerror(errno));
+    }
+
+    int ran = 0;
+    uint64_t now = Now();
+    DropStale();
+    while (!heap_.empty() && heap_.front().deadline <= now)
+    {
+        TimerId id = heap_.front().id;
+        std::pop_heap(heap_.begin(), heap_.end());
+        heap_.pop_back();
+
+        Timer &timer = timers_[id];
+        Callback callback = timer.callback;
+        if (timer.interval != 0)
+        {
+            uint64_t late = now - timer.deadline;
+            timer.deadline += (late / timer.interval + 1) * timer.interval;
+            Push(id, timer.deadline);
+        }
+        else
+            timers_.erase(id);
+
+        // The callback may add or remove timers, so nothing above is held across it
+        callback();
+        ran++;
+        DropStale();
+    }
+    ArmFd();
+    return ran;
+}
+
+uint64_t TimerService::NextDeadline()
+{
+    DropStale();
+    return heap_.empty() ? NoDeadline : heap_.front().deadline;
+}
+
+int TimerService::TimeoutMs()
+{
+    uint64_t deadline = NextDeadline();
+    if (deadline == NoDeadline)
+        return -1;
+    uint64_t now = Now();
+    if (deadline <= now)
+        return 0;
+    uint64_t ms = (deadline - now + 999999) / 1000000;
+    return ms > 0x7fffffff ? 0x7fffffff : static_cast<int>(ms);
+}
+
+int TimerService::Fd()
+{
+    if (timer_fd_ < 0)
+    {
+        timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timer_fd_ < 0)
+            LOG_ERROR_STREAM("TimerService: timerfd_create failed: " << strerror(errno));
+        armed_deadline_ = NoDeadline;
+        ArmFd();
+    }
+    return timer_fd_;
+}
+
+void TimerService::Push(TimerId id, uint64_t deadline)
+{
+    HeapEntry entry = { deadline, id };
+    heap_.push_back(entry);
+    std::push_heap(heap_.begin(), heap_.end());
+    ArmFd();
+}
+
+void TimerService::DropStale()
+{
+    while (!heap_.empty())
+    {
+        auto it = timers_.find(heap_.front().id);
+        if (it != timers_.end() && it->second.deadline == heap_.front().deadline)
+            return;
+        std::pop_heap(heap_.begin(), heap_.end());
+        heap_.pop_back();
+    }
+}
+
+void TimerService::ArmFd()
+{
+    if (timer_fd_ < 0)
+        return;
+
+    DropStale();
+    uint64_t deadline = heap_.empty() ? NoDeadline : heap_.front().deadline;
+    if (deadline == armed_deadline_)
+        return;
+
+    // An absolute deadline; all zeros disarms. A deadline already passed fires at once.
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    if (deadline != NoDeadline)
+    {
+        uint64_t at = deadline > 0 ? deadline : 1;
+        spec.it_value.tv_sec = static_cast<time_t>(at / 1000000000ull);
+        spec.it_value.tv_nsec = static_cast<long>(at % 1000000000ull);
+    }
+    if (timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) != 0)
+        LOG_ERROR_STREAM("TimerService: timerfd_settime failed: " << strerror(errno));
+    armed_deadline_ = deadline;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <vector>
+#include <stdint.h>
+
+/**
+ * @brief One-shot and periodic timers on a min-heap of 64-bit deadlines
+ *
+ * Deadlines are nanoseconds on CLOCK_MONOTONIC, so they neither wrap nor
+ * jump with the wall clock. A service belongs to the thread that created
+ * it: scheduling, cancelling and RunExpired() take no lock and must all
+ * happen on that thread. Callbacks run from RunExpired() and may schedule
+ * or cancel timers themselves.
+ *
+ * A thread that waits in epoll can watch Fd(), a timerfd armed for the
+ * earliest deadline, instead of polling RunExpired().
+ */
+class TimerService
+{
+public:
+    using Callback = std::function<void()>;
+    using Clock = std::function<uint64_t()>;
+    // 0 is never a valid id
+    using TimerId = uint64_t;
+
+    explicit TimerService(Clock clock = MonotonicNs);
+    ~TimerService();
+
+    TimerId ScheduleAfter(uint64_t delay_ns, Callback callback);
+    // First run after first_delay_ns, then every interval_ns without drift;
+    // periods missed while the thread was busy are skipped, not replayed
+    TimerId ScheduleEvery(uint64_t interval_ns, Callback callback, uint64_t first_delay_ns);
+    TimerId ScheduleEvery(uint64_t interval_ns, Callback callback) { return ScheduleEvery(interval_ns, callback, interval_ns); }
+
+    // Moves a pending timer's next run to delay_ns from now
+    bool Reschedule(TimerId id, uint64_t delay_ns);
+    bool Cancel(TimerId id);
+    bool IsScheduled(TimerId id) const { return timers_.count(id) != 0; }
+
+    // Runs every callback that is due; returns how many ran
+    int RunExpired();
+
+    // Earliest deadline, or NoDeadline when nothing is scheduled
+    uint64_t NextDeadline();
+    // Milliseconds until NextDeadline(), rounded up, for poll/epoll_wait; -1 when idle
+    int TimeoutMs();
+
+    // timerfd that becomes readable at the earliest deadline; created on first use.
+    // Call RunExpired() when it is readable. Only meaningful with the default clock.
+    int Fd();
+
+    uint64_t Now() const { return clock_(); }
+
+    static uint64_t MonotonicNs();
+    static inline uint64_t Ms(uint64_t ms) { return ms * 1000000ull; }
+    static inline uint64_t Sec(uint64_t sec) { return sec * 1000000000ull; }
+
+    static const uint64_t NoDeadline = ~0ull;
+
+private:
+    struct Timer
+    {
+        uint64_t deadline;
+        uint64_t interval;  // 0 for one-shot timers
+        Callback callback;
+    };
+
+    // Heap entries are not removed on cancel or reschedule; an entry whose
+    // deadline no longer matches its timer is dropped when it reaches the top
+    struct HeapEntry
+    {
+        uint64_t deadline;
+        TimerId id;
+        bool operator<(const HeapEntry &other) const
+        {
+            // std::push_heap builds a max-heap; invert for the earliest deadline first
+            return deadline != other.deadline ? deadline > other.deadline : id > other.id;
+        }
+    };
+
+    void Push(TimerId id, uint64_t deadline);
+    void DropStale();
+    void ArmFd();
+
+    Clock clock_;
+    std::map<TimerId, Timer> timers_;
+    std::vector<HeapEntry> heap_;
+    TimerId next_id_ = 1;
+    int timer_fd_ = -1;
+    uint64_t armed_deadline_ = NoDeadline;
+};
@@ -1,13 +1,28 @@
+#include <algorithm>
+#include <atomic>
 #include <queue>
 #include <mutex>
 #include <memory>
-#include <fstream>
-#include <sstream>
+#include <set>
 #include <json11.hpp>
 
 #include <ctype.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
-
+#include <time.h>
+#include <sys/resource.h>
+
+#include "ConfigurationReader.hpp"
+#include "ConfigWatcher.hpp"
+#include "ConfigCache.hpp"
+#include "Metrics.hpp"
+#include "TimerService.hpp"
+#include "Reactor.hpp"
+#include "HttpServer.hpp"
+#include "StatusRoutes.hpp"
+#include "Prewake.hpp"
 #include "HAL/InputEvent.hpp"
 #include "HAL/HAL.hpp"
 #include "HAL/Display.hpp"
@@ -21,11 +36,13 @@
 #include "Integrations/ActionHomeAssistantService.hpp"
 
 #include "logger.h"
+#include "trace.h"
 
 #include "lvgl/lvgl.h"
 
 #include "Backplate/UnixSerialPort.hpp"
 #include "Backplate/BackplateComms.hpp"
+#include "Thermostat/HvacControl.hpp"
 #include "InputEvent.hpp"
 #include "IDateTimeProvider.hpp"
 #include "SystemDateTimeProvider.hpp"
@@ -37,29 +54,40 @@
 
 const int PROXIMITY_THRESHOLD = 3; // example threshold value
 
-// HAL Configuration structure
-struct HALConfig {
-    std::string beeper_device;
-    std::string display_device;
-    std::string button_device;
-    std::string rotary_device;
-    std::string backlight_device;
-    std::string backplate_serial_device;
-    bool emulate_display;
-    int backlight_active_seconds;
-    int backlight_max_brightness;
-    int backlight_min_brightness;
-};
+// Longest the boot splash waits for the backplate handshake and first sensor frame
+const int SplashTimeoutMs = 10000;
+const int SplashTimeoutEmulationMs = 500;
+
+// Diagnostics endpoint; CUCKOO_HTTP_PORT=0 turns it off, CUCKOO_HTTP_ADDR=0.0.0.0 exposes it
+const int DefaultHttpPort = 8080;
+const char *DefaultHttpAddress = "127.0.0.1";
+
+// Reactor mode bounds on LVGL's requested delay, so a busy UI still yields and an idle one still ticks
+const uint32_t ReactorMinFrameDelayMs = 1;
+const uint32_t ReactorMaxFrameDelayMs = 100;
 
 // Function declarations
 static void setup_logging();
-static HALConfig load_hal_config(const std::string& config_file);
+static void start_http_server(bool home_assistant_configured);
+static void wait_for_backplate(int timeout_ms);
+static void reload_config(const std::string &config_file);
+static bool reactor_mode_requested(bool emulate_display);
+static uint64_t dispatch_queued_input();
+static uint32_t render_frame(uint64_t oldest_input_us);
+static void schedule_reactor_frame(uint64_t delay_ns);
+static void sample_wakeup_rates(uint64_t total_wakeups);
+void dispatch_input_event(const InputDeviceType device_type, const struct input_event &event);
 void handle_input_event(const InputDeviceType device_type, const struct input_event &event);
 void ProximityCallback(int value);
 
+// Only set in reactor mode; declared first so it outlives everything registered with it
+static std::unique_ptr<Reactor> reactor;
+
 // Global pointers to HAL objects (will be initialized after config loading)
 static std::unique_ptr<UnixSerialPort> backplateSerial;
 static std::unique_ptr<SystemDateTimeProvider> systemDateTimeProvider;
+// Runs on the comms thread, so it must outlive backplateComms
+static std::unique_ptr<HvacControl> hvac_control;
 static std::unique_ptr<BackplateComms> backplateComms;
 static std::unique_ptr<HAL> hal;
 static std::unique_ptr<Beeper> beeper;
@@ -68,16 +96,28 @@ static std::unique_ptr<Inputs> inputs;
 static std::unique_ptr<Backlight> backlight;
 static std::unique_ptr<IntegrationContainer> integration_container;
 static std::unique_ptr<ScreenManager> screen_manager;
+// Refreshes integrations from its own thread, so it must go before the screens and integrations
+static std::unique_ptr<Prewake> prewake;
+static std::unique_ptr<HttpServer> http_server;
 
 // create a fifo for input events
 std::queue<InputEvent> input_event_queue;
 // Mutex for thread safety
 std::mutex input_event_queue_mutex;
+// Set by the backplate thread; the UI thread activates the backlight
+static std::atomic<bool> proximity_detected(false);
+// Set by the backplate or PIR thread when someone approaches; the UI thread pre-wakes
+static std::atomic<bool> proximity_approach(false);
+// Reactor mode: the pending LVGL pass and the oldest input it has not rendered yet
+static TimerService *reactor_timers = nullptr;
+static TimerService::TimerId reactor_frame_timer = 0;
+static uint64_t reactor_pending_input_us = 0;
 
 
 int main(int argc, char* argv[])
 {
     std::cout << "Cuckoo Nest Starting Up..." << std::endl;
+    TRACE_THREAD_NAME("ui");
 
     setup_logging();    
     
@@ -87,8 +127,13 @@ int main(int argc, char* argv[])
     if (argc > 1)
         config_file = argv[1];
 
-    // Load HAL configuration from config file
-    HALConfig hal_config = load_hal_config(config_file);
+    // Parse the configuration once; every subsystem takes its slice from it.
+    // The compiled image skips the JSON parse when config.json is unchanged.
+    ConfigurationReader config_reader(config_file);
+    if (!config_reader.load_with_cache(ConfigCache::PathFor(config_file)))
+        LOG_WARN_STREAM("Could not load " << config_file << ", using default configuration");
+    const AppConfig &app_config = config_reader.get_app_config();
+    const HALConfig &hal_config = app_config.hal;
 
     if (hal_config.emulate_display)
         LOG_INFO_STREAM("Running in display emulation mode");
@@ -112,12 +157,29 @@ int main(int argc, char* argv[])
     integration_container.reset(new IntegrationContainer());
     screen_manager.reset(new ScreenManager(hal.get(), integration_container.get(), backplateComms.get()));
     
+    // Timers of the UI thread: backlight dimming and the once-per-second tasks
+    TimerService ui_timers;
+
     // Configure backlight with loaded settings
+    backlight->set_timer_service(&ui_timers);
     backlight->set_active_seconds(hal_config.backlight_active_seconds);
     backlight->set_max_brightness(hal_config.backlight_max_brightness);
     backlight->set_min_brightness(hal_config.backlight_min_brightness);
     backlight->Activate();
 
+    // CUCKOO_REACTOR=1: the main thread's epoll loop owns serial, input, HTTP and timers
+    if (reactor_mode_requested(hal_config.emulate_display))
+    {
+        reactor.reset(new Reactor());
+        if (!reactor->IsValid() || !reactor->AddTimers(ui_timers))
+        {
+            LOG_WARN_STREAM("Reactor mode not available, using the threaded loops");
+            reactor.reset();
+        }
+        else
+            LOG_INFO_STREAM("Running in reactor mode");
+    }
+
     if (!screen->Initialize(hal_config.emulate_display))
     {
         LOG_ERROR_STREAM("Failed to initialize screen");
@@ -131,50 +193,129 @@ int main(int argc, char* argv[])
     hal->inputs = inputs.get();
     hal->backlight = backlight.get();
         
-    integration_container->LoadIntegrationsFromConfig(config_file);
-    screen_manager->LoadScreensFromConfig(config_file);
+    integration_container->LoadIntegrations(app_config.home_assistant, app_config.integrations);
+    screen_manager->LoadScreens(app_config.first_screen_id, app_config.screens);
+
+    // On approach: build the screens the user is about to see and fetch their integrations'
+    // state first, then the rest, while they are still walking up
+    prewake.reset(new Prewake(
+        []() {
+            std::vector<std::string> ids = screen_manager->WarmLikelyScreens();
+            for (const std::string &id : integration_container->GetIntegrationIds())
+                if (std::find(ids.begin(), ids.end(), id) == ids.end())
+                    ids.push_back(id);
+            return ids;
+        },
+        [](const std::vector<std::string> &ids) { integration_container->RefreshStates(ids); }));
+    prewake->Start();
+
+    backplateComms->SetSensorFilters(app_config.sensors);
+    backplateComms->AddPIRCallback(ProximityCallback);
+    // The raw PIR signal usually notices someone before the proximity sensor does
+    backplateComms->AddOccupancyCallback([](const Occupancy &occupancy) {
+        if (!occupancy.occupied)
+            return;
+        proximity_approach.store(true);
+        proximity_detected.store(true);
+    });
+    if (app_config.thermostat.ActuationEnabled())
+    {
+        hvac_control.reset(new HvacControl(*backplateComms, app_config.thermostat));
+        hvac_control->Start();
+    }
+    if (reactor)
+        backplateComms->Initialize(*reactor);
+    else
+        backplateComms->Initialize();
+    start_http_server(app_config.home_assistant.IsComplete());
+
+    // The splash stays up until the backplate has something to show
+    wait_for_backplate(hal_config.emulate_display ? SplashTimeoutEmulationMs : SplashTimeoutMs);
     screen_manager->GoToFirstScreen();
+    screen->ReleaseSplash();
+
+    // Screen and integration edits in the config file apply without a restart
+    ConfigWatcher config_watcher(config_file);
+    if (!config_watcher.Start())
+        LOG_WARN_STREAM("Config changes will need a restart to take effect");
 
     // Set up input event callback
-    inputs->set_callback(handle_input_event);
-    if (!hal_config.emulate_display)
+    if (reactor)
     {
-        if (!inputs->start_polling())
+        // Events are handled as they are read, on this thread; no queue, no lock
+        inputs->set_callback(dispatch_input_event);
+        if (!inputs->attach(*reactor))
         {
-            LOG_ERROR_STREAM("Failed to start input polling");
+            LOG_ERROR_STREAM("Failed to attach inputs to the reactor");
             return 1;
         }
+        LOG_INFO_STREAM("Inputs attached to the reactor...");
     }
+    else
+    {
+        inputs->set_callback(handle_input_event);
+        if (!hal_config.emulate_display)
+        {
+            if (!inputs->start_polling())
+            {
+                LOG_ERROR_STREAM("Failed to start input polling");
+                return 1;
+            }
+        }
 
-    LOG_INFO_STREAM("Input polling started in background thread...");
+        LOG_INFO_STREAM("Input polling started in background thread...");
+    }
 
-    backplateComms->AddPIRCallback(ProximityCallback);
-    backplateComms->Initialize();
+    // kill -USR1 <pid> writes all metrics to the log
+    Metrics::Instance().InstallDumpSignal(SIGUSR1);
+    MetricCounter &loop_wakeups = Metrics::Instance().Counter(
+        "ui_loop_wakeups_total", "Passes of the threaded main loop");
+
+    // CUCKOO_SCREEN_EVICT_SECONDS=<n> frees screens not shown for n seconds; they are rebuilt on next use
+    const char *evict_env = getenv("CUCKOO_SCREEN_EVICT_SECONDS");
+    int evict_seconds = evict_env ? atoi(evict_env) : 0;
+    if (evict_seconds > 0)
+        LOG_INFO_STREAM("Evicting screens idle for " << evict_seconds << " s");
+
+    ui_timers.ScheduleEvery(TimerService::Sec(1), [&config_watcher, &config_file, &loop_wakeups, evict_seconds]() {
+        if (config_watcher.Poll())
+            reload_config(config_file);
+        if (evict_seconds > 0)
+            screen_manager->EvictIdleScreens(TimerService::Sec(evict_seconds));
+
+        sample_wakeup_rates(reactor ? reactor->Wakeups() : loop_wakeups.Value());
+        // Without its own thread the HTTP server only sweeps idle connections when polled
+        if (reactor && http_server)
+            http_server->Poll(0);
+
+        if (Metrics::Instance().DumpRequested())
+            Metrics::Instance().DumpToLog();
+    });
+
+    if (reactor)
+    {
+        reactor_timers = &ui_timers;
+        schedule_reactor_frame(0);
+        reactor->Run();
+        return 0;
+    }
 
     // Main thread can now do other work or just wait
-    int tick = 0;
-    const int ticks_per_second = 1 * 1000 * 1000 / 5000; // 1 second / input polling interval (5ms)
     while (true)
     {
-        {
-            std::lock_guard<std::mutex> lock(input_event_queue_mutex);
-            while (!input_event_queue.empty()) {
-                LOG_DEBUG_STREAM("got event from queue");
-                auto event = input_event_queue.front();
-                input_event_queue.pop();
-                screen_manager->ProcessInputEvent(event.device_type, event.event);
-            }
-        }
+        loop_wakeups.Add();
+        uint64_t oldest_input_us = dispatch_queued_input();
+        if (proximity_approach.exchange(false))
+            prewake->OnApproach(MetricTimer::NowUs());
+        if (oldest_input_us != 0)
+            prewake->OnInput(oldest_input_us);
+        // Keep the screen bright on any input or proximity
+        if (oldest_input_us != 0 || proximity_detected.exchange(false))
+            backlight->Activate();
 
-        screen->TimerHandler();
-        tick++;
-        if (tick >= ticks_per_second)
-        {
-            tick = 0;
-            // Do once-per-second tasks here if needed
-            // Let Backlight manage its own timeout
-            backlight->Tick();
-        }
+        render_frame(oldest_input_us);
+
+        ui_timers.RunExpired();
 
 #if defined(LV_USE_SDL) && LV_USE_SDL == 1
         {
@@ -218,131 +359,234 @@ int main(int argc, char* argv[])
     return 0;
 }
 
-static void setup_logging()
+static bool reactor_mode_requested(bool emulate_display)
 {
-    // Simple console-only setup.
-    // Honor environment variable CUCKOO_LOG_LEVEL if present.
-    //cuckoo_log::Logger::set_level(cuckoo_log::Level::Debug);
-    cuckoo_log::Logger::set_level_from_env();
-    // If CUCKOO_LOG_FILE is set, enable file logging (append)
-    cuckoo_log::Logger::set_file_from_env();
-    LOG_INFO_STREAM("Logging initialized (console" << (cuckoo_log::Logger::file_enabled() ? " + file" : "") << ")");
+    const char *env = getenv("CUCKOO_REACTOR");
+    if (!env || strcmp(env, "1") != 0)
+        return false;
+#if defined(LV_USE_SDL) && LV_USE_SDL == 1
+    LOG_WARN_STREAM("CUCKOO_REACTOR ignored: the SDL build polls its own event queue");
+    return false;
+#else
+    if (emulate_display)
+    {
+        LOG_WARN_STREAM("CUCKOO_REACTOR ignored in display emulation mode");
+        return false;
+    }
+    return true;
+#endif
 }
 
-// Input event handler callback
-void handle_input_event(const InputDeviceType device_type, const struct input_event &event)
+// Threaded mode: runs the events the input thread queued; returns when the oldest was queued
+static uint64_t dispatch_queued_input()
 {
-    if (device_type == InputDeviceType::ROTARY && event.type == 0 && event.code == 0)
-        return; // Ignore 'end of event' markers from rotary encoder
+    TRACE_SCOPE("input_dispatch");
+    uint64_t oldest_input_us = 0;
+    std::lock_guard<std::mutex> lock(input_event_queue_mutex);
+    while (!input_event_queue.empty()) {
+        LOG_DEBUG_STREAM("got event from queue");
+        auto event = input_event_queue.front();
+        input_event_queue.pop();
+        if (oldest_input_us == 0)
+            oldest_input_us = event.queued_us;
+        screen_manager->ProcessInputEvent(event.device_type, event.event);
+    }
+    return oldest_input_us;
+}
 
-    LOG_DEBUG_STREAM("Main: Received input event - type: " << event.type << ", code: " << event.code << ", value: " << event.value);
+// One LVGL pass; returns LVGL's delay until the next one
+static uint32_t render_frame(uint64_t oldest_input_us)
+{
+    static MetricHistogram &timer_handler_us = Metrics::Instance().Histogram(
+        "ui_timer_handler_us", "Time spent in one lv_timer_handler pass");
+    static MetricHistogram &input_to_render_us = Metrics::Instance().Histogram(
+        "ui_input_to_render_us", "From an input event being queued to the end of the next render");
 
-    backlight->Activate(); // Keep the screen bright on any input
+    uint32_t next_ms;
+    {
+        TRACE_SCOPE("lv_timer_handler");
+        MetricTimer timer(timer_handler_us);
+        next_ms = screen->TimerHandler();
+    }
+    if (oldest_input_us != 0)
+        input_to_render_us.Record(MetricTimer::NowUs() - oldest_input_us);
+    return next_ms;
+}
 
-    std::lock_guard<std::mutex> lock(input_event_queue_mutex);
-    input_event_queue.push(InputEvent(device_type, event));
+// Reactor mode: a one-shot timer per LVGL pass, re-armed with the delay LVGL asks for
+static void schedule_reactor_frame(uint64_t delay_ns)
+{
+    if (reactor_timers->Reschedule(reactor_frame_timer, delay_ns))
+        return;
+
+    reactor_frame_timer = reactor_timers->ScheduleAfter(delay_ns, []() {
+        reactor_frame_timer = 0;
+        if (proximity_approach.exchange(false))
+            prewake->OnApproach(MetricTimer::NowUs());
+        // Keep the screen bright on any input or proximity
+        if (reactor_pending_input_us != 0 || proximity_detected.exchange(false))
+            backlight->Activate();
+
+        uint32_t next_ms = render_frame(reactor_pending_input_us);
+        reactor_pending_input_us = 0;
+        if (next_ms < ReactorMinFrameDelayMs)
+            next_ms = ReactorMinFrameDelayMs;
+        else if (next_ms > ReactorMaxFrameDelayMs)
+            next_ms = ReactorMaxFrameDelayMs;
+        schedule_reactor_frame(TimerService::Ms(next_ms));
+    });
 }
 
-void ProximityCallback(int value)
+// Once a second: context switches of the whole process and wakeups of the main loop, per second.
+// Compare a run with CUCKOO_REACTOR=1 against one without.
+static void sample_wakeup_rates(uint64_t total_wakeups)
 {
-    if (value >= PROXIMITY_THRESHOLD)
-        backlight->Activate(); // PIR proximity should keep the backlight active
+    static MetricGauge &voluntary = Metrics::Instance().Gauge(
+        "process_voluntary_switches_per_second", "Voluntary context switches of all threads in the last second");
+    static MetricGauge &involuntary = Metrics::Instance().Gauge(
+        "process_involuntary_switches_per_second", "Involuntary context switches of all threads in the last second");
+    static MetricGauge &wakeups = Metrics::Instance().Gauge(
+        "ui_wakeups_per_second", "Main loop wakeups in the last second, in either mode");
+    static long last_voluntary = -1;
+    static long last_involuntary = 0;
+    static uint64_t last_wakeups = 0;
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return;
+    if (last_voluntary >= 0)
+    {
+        voluntary.Set(usage.ru_nvcsw - last_voluntary);
+        involuntary.Set(usage.ru_nivcsw - last_involuntary);
+        wakeups.Set(static_cast<int64_t>(total_wakeups - last_wakeups));
+    }
+    last_voluntary = usage.ru_nvcsw;
+    last_involuntary = usage.ru_nivcsw;
+    last_wakeups = total_wakeups;
 }
 
-// Load HAL configuration from JSON file with sensible defaults
-static HALConfig load_hal_config(const std::string& config_file)
+static void wait_for_backplate(int timeout_ms)
 {
-    HALConfig config;
-
-    // Set default values for embedded target
-    config.beeper_device = "/dev/input/event0";
-    config.display_device = "/dev/fb0";
-    config.button_device = "/dev/input/event2";
-    config.rotary_device = "/dev/input/event1";
-    config.backlight_device = "/sys/class/backlight/3-0036/brightness";
-    config.backplate_serial_device = "/dev/ttyO2";
-    config.emulate_display = false;
-    config.backlight_active_seconds = 10;
-    config.backlight_max_brightness = 115;
-    config.backlight_min_brightness = 20;
-    
-    // Try to load configuration from file
-    std::ifstream file(config_file);
-    if (!file.is_open()) {
-        LOG_WARN_STREAM("Could not open " << config_file << ", using default HAL configuration");
-        return config;
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int elapsed_ms = 0;
+    while (!backplateComms->IsReady() && elapsed_ms < timeout_ms)
+    {
+        screen->TimerHandler();
+        usleep(5000);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        elapsed_ms = (now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000;
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string configContent = buffer.str();
+    if (backplateComms->IsReady())
+        LOG_INFO_STREAM("Backplate ready after " << elapsed_ms << " ms");
+    else
+        LOG_WARN_STREAM("Backplate not ready after " << elapsed_ms << " ms, continuing without sensor data");
+}
+
+static void reload_config(const std::string &config_file)
+{
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
 
-    if (configContent.empty()) {
-        LOG_ERROR_STREAM("Config file " << config_file << " is empty, using defaults");
-        return config;
+    ConfigurationReader reader(config_file);
+    if (!reader.load_with_cache(ConfigCache::PathFor(config_file)))
+    {
+        LOG_WARN_STREAM("Config reload: " << config_file << " could not be loaded, keeping the running configuration");
+        return;
     }
 
-    std::string parse_error;
-    json11::Json parsed_json = json11::Json::parse(configContent, parse_error, json11::JsonParse::COMMENTS);
+    // Integrations first, so rebuilt screens resolve the new instances
+    const AppConfig &config = reader.get_app_config();
+    std::set<std::string> changed = integration_container->ReloadIntegrations(config.home_assistant, config.integrations);
+    ScreenReloadStats stats = screen_manager->ReloadScreens(config.first_screen_id, config.screens, changed);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    long elapsed_us = (end.tv_sec - start.tv_sec) * 1000000L + (end.tv_nsec - start.tv_nsec) / 1000;
+    LOG_INFO_STREAM("Config reload: " << changed.size() << " integrations changed, "
+        << stats.added + stats.rebuilt + stats.removed << " screens changed, took " << elapsed_us << " us");
+}
 
-    if (!parse_error.empty()) {
-        LOG_ERROR_STREAM("JSON parse error: " << parse_error << ", using defaults");
-        return config;
+static void setup_logging()
+{
+    // Simple console-only setup.
+    // Honor environment variable CUCKOO_LOG_LEVEL if present.
+    //cuckoo_log::Logger::set_level(cuckoo_log::Level::Debug);
+    cuckoo_log::Logger::set_level_from_env();
+    // If CUCKOO_LOG_FILE is set, enable file logging (append)
+    cuckoo_log::Logger::set_file_from_env();
+    // If CUCKOO_LOG_DIR is set, keep a size-bounded binary log there (decode with cuckoo_logdump)
+    cuckoo_log::Logger::set_binary_sink_from_env();
+    // CUCKOO_LOG_CONSOLE=0 silences the console
+    cuckoo_log::Logger::set_console_from_env();
+    // Format and write log lines on a background thread, off the UI and comms threads
+    cuckoo_log::Logger::start_async();
+    LOG_INFO_STREAM("Logging initialized (console" << (cuckoo_log::Logger::file_enabled() ? " + file" : "")
+        << (cuckoo_log::Logger::binary_enabled() ? " + binary" : "") << ", async)");
+}
+
+static void start_http_server(bool home_assistant_configured)
+{
+    const char *port_env = getenv("CUCKOO_HTTP_PORT");
+    const char *address_env = getenv("CUCKOO_HTTP_ADDR");
+    int port = port_env ? atoi(port_env) : DefaultHttpPort;
+    if (port <= 0)
+    {
+        LOG_INFO_STREAM("Diagnostics HTTP server disabled");
+        return;
     }
 
-    if (!parsed_json.is_object()) {
-        LOG_ERROR_STREAM("Root JSON element must be an object, using defaults");
-        return config;
+    http_server.reset(new HttpServer());
+    RegisterStatusRoutes(*http_server, backplateComms.get(), home_assistant_configured);
+    bool listening = http_server->Listen(address_env ? address_env : DefaultHttpAddress, port);
+    // In reactor mode the server's epoll fd nests in the reactor instead of getting a thread
+    if (!listening || !(reactor ? reactor->Add(http_server->Fd(), []() { http_server->Poll(0); }) : http_server->Start()))
+    {
+        LOG_WARN_STREAM("Diagnostics HTTP server not available");
+        http_server.reset();
     }
+}
 
-    LOG_INFO_STREAM("Loading HAL configuration from " << config_file);
+// Input event handler callback
+void handle_input_event(const InputDeviceType device_type, const struct input_event &event)
+{
+    if (device_type == InputDeviceType::ROTARY && event.type == 0 && event.code == 0)
+        return; // Ignore 'end of event' markers from rotary encoder
 
-    // Override defaults with values from config file if present
-    auto hal = parsed_json["hal"];
-    if (hal.is_object()) {
-        if (hal["beeper_device"].is_string()) {
-            config.beeper_device = hal["beeper_device"].string_value();
-            LOG_DEBUG_STREAM("  beeper_device: " << config.beeper_device);
-        }
-        if (hal["display_device"].is_string()) {
-            config.display_device = hal["display_device"].string_value();
-            LOG_DEBUG_STREAM("  display_device: " << config.display_device);
-        }
-        if (hal["button_device"].is_string()) {
-            config.button_device = hal["button_device"].string_value();
-            LOG_DEBUG_STREAM("  button_device: " << config.button_device);
-        }
-        if (hal["rotary_device"].is_string()) {
-            config.rotary_device = hal["rotary_device"].string_value();
-            LOG_DEBUG_STREAM("  rotary_device: " << config.rotary_device);
-        }
-        if (hal["backlight_device"].is_string()) {
-            config.backlight_device = hal["backlight_device"].string_value();
-            LOG_DEBUG_STREAM("  backlight_device: " << config.backlight_device);
-        }
-        if (hal["backplate_serial_device"].is_string()) {
-            config.backplate_serial_device = hal["backplate_serial_device"].string_value();
-            LOG_DEBUG_STREAM("  backplate_serial_device: " << config.backplate_serial_device);
-        }
-        if (hal["emulate_display"].is_bool()) {
-            config.emulate_display = hal["emulate_display"].bool_value();
-            LOG_INFO_STREAM("  emulate_display: " << (config.emulate_display ? "true" : "false"));
-        }
-        if (hal["backlight_active_seconds"].is_number()) {
-            config.backlight_active_seconds = hal["backlight_active_seconds"].int_value();
-            LOG_DEBUG_STREAM("  backlight_active_seconds: " << config.backlight_active_seconds);
-        }
-        if (hal["backlight_max_brightness"].is_number()) {
-            config.backlight_max_brightness = hal["backlight_max_brightness"].int_value();
-            LOG_DEBUG_STREAM("  backlight_max_brightness: " << config.backlight_max_brightness);
-        }
-        if (hal["backlight_min_brightness"].is_number()) {
-            config.backlight_min_brightness = hal["backlight_min_brightness"].int_value();
-            LOG_DEBUG_STREAM("  backlight_min_brightness: " << config.backlight_min_brightness);
-        }
-    } else {
-        LOG_WARN_STREAM("No 'hal' section found in config, using defaults");
+    LOG_DEBUG_STREAM("Main: Received input event - type: " << event.type << ", code: " << event.code << ", value: " << event.value);
+
+    TRACE_SCOPE("input_enqueue");
+    InputEvent queued(device_type, event);
+    queued.queued_us = MetricTimer::NowUs();
+    std::lock_guard<std::mutex> lock(input_event_queue_mutex);
+    input_event_queue.push(queued);
+}
+
+// Reactor mode input handler: runs on the main thread straight from the evdev fd
+void dispatch_input_event(const InputDeviceType device_type, const struct input_event &event)
+{
+    if (device_type == InputDeviceType::ROTARY && event.type == 0 && event.code == 0)
+        return; // Ignore 'end of event' markers from rotary encoder
+
+    TRACE_SCOPE("input_dispatch");
+    if (reactor_pending_input_us == 0)
+    {
+        reactor_pending_input_us = MetricTimer::NowUs();
+        prewake->OnInput(reactor_pending_input_us);
     }
+    screen_manager->ProcessInputEvent(device_type, event);
+    // Render the result, and light the screen, now rather than at the next scheduled pass
+    schedule_reactor_frame(0);
+}
 
-    return config;
+void ProximityCallback(int value)
+{
+    // Only the comms thread calls this
+    static bool near = false;
+    bool was_near = near;
+    near = value >= PROXIMITY_THRESHOLD;
+    if (near && !was_near)
+        proximity_approach.store(true);
+    if (near)
+        proximity_detected.store(true); // PIR proximity should keep the backlight active
 }
@@ -1,4 +1,7 @@
 #include "AnalogClockScreen.hpp"
+#include "ScreenFactory.hpp"
+
+REGISTER_SCREEN_TYPE("analogclock", AnalogClockScreen);
 
 void AnalogClockScreen::OnChangeFocus(bool focused)
 {
@@ -1,4 +1,7 @@
 #include "DimmerScreen.hpp"
+#include "ScreenFactory.hpp"
+
+REGISTER_SCREEN_TYPE("dimmer", DimmerScreen);
 
 void DimmerScreen::Render()
 {
@@ -1,4 +1,7 @@
 #include "HomeScreen.hpp"
+#include "ScreenFactory.hpp"
+
+REGISTER_SCREEN_TYPE("home", HomeScreen);
 
 HomeScreen::HomeScreen(ScreenManager *screenManager, const json11::Json &jsonConfig)
     : ScreenBase(screenManager, jsonConfig)
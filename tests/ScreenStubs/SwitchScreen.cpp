@@ -1,4 +1,7 @@
 #include "SwitchScreen.hpp"
+#include "ScreenFactory.hpp"
+
+REGISTER_SCREEN_TYPE("switch", SwitchScreen);
 
 void SwitchScreen::Render()
 {
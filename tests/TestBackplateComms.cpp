@@ -3,6 +3,14 @@
 #include "Backplate/BackplateComms.hpp"
 #include "Backplate/CommandMessage.hpp"
 #include "Backplate/ResponseMessage.hpp"
+#include "Reactor.hpp"
+
+#include <deque>
+#include <memory>
+#include <thread>
+#include <fcntl.h>
+#include <sys/time.h>
+#include <unistd.h>
 
 using ::testing::Return;
 using ::testing::_;
@@ -27,6 +35,7 @@ public:
     MOCK_METHOD(int, Write, (const std::vector<uint8_t>& data), (override));
     MOCK_METHOD(int, SendBreak, (int durationMs), (override));
     MOCK_METHOD(int, Flush, (), (override));
+    MOCK_METHOD(int, GetFd, (), (const, override));
 };
 
 class TestBackplateComms : public ::testing::Test {
@@ -401,6 +410,92 @@ TEST_F(TestBackplateComms, TemperatureCallbackInvoked)
     EXPECT_NEAR(s_tempVal, 87.21f, 0.01f);
 }
 
+TEST_F(TestBackplateComms, TemperatureCallbackSkipsChangesInsideTheDeadband)
+{
+    BackplateCommsExposed comms(&mockSerialPort, &mockDateTimeProvider);
+    SensorsConfig sensors;
+    sensors.temperature.filter = "none";
+    sensors.temperature.deadband = 0.1;
+    sensors.temperature.refresh_seconds = 0;
+    comms.SetSensorFilters(sensors);
+
+    std::vector<float> notified;
+    comms.AddTemperatureCallback([&notified](float t) { notified.push_back(t); });
+
+    EXPECT_CALL(mockDateTimeProvider, gettimeofday(_))
+        .WillRepeatedly(mockGetTimevalSecs());
+    EXPECT_CALL(mockSerialPort, Write(_)).WillRepeatedly(Return(1));
+
+    // 21.00, 21.05, 20.95, 21.10 C
+    for (int16_t centi : { 2100, 2105, 2095, 2110 })
+    {
+        ResponseMessage sensorMsg(MessageType::TempHumidityData);
+        sensorMsg.SetPayload(std::vector<uint8_t>{ static_cast<uint8_t>(centi & 0xff),
+            static_cast<uint8_t>(centi >> 8), 0xf4, 0x01 });
+        EXPECT_CALL(mockSerialPort, Read(_,_))
+            .WillOnce(mockReadResponse(sensorMsg.GetRawMessage()))
+            .RetiresOnSaturation();
+        comms.TaskBodyComms();
+    }
+
+    ASSERT_EQ(2u, notified.size());
+    EXPECT_NEAR(21.0f, notified[0], 0.001f);
+    EXPECT_NEAR(21.1f, notified[1], 0.001f);
+    EXPECT_NEAR(21.1f, comms.GetCurrentTemperatureC(), 0.001f);
+}
+
+TEST_F(TestBackplateComms, FirstSensorFrameMarksDataReceived)
+{
+    BackplateCommsExposed comms(&mockSerialPort, &mockDateTimeProvider);
+
+    EXPECT_CALL(mockDateTimeProvider, gettimeofday(_))
+        .WillRepeatedly(mockGetTimevalSecs());
+
+    ResponseMessage sensorMsg(MessageType::TempHumidityData);
+    sensorMsg.SetPayload(std::vector<uint8_t>{0x11, 0x22, 0x33, 0x44});
+
+    EXPECT_CALL(mockSerialPort, Write(_)).WillRepeatedly(Return(1));
+    EXPECT_CALL(mockSerialPort, Read(_,_))
+        .WillOnce(Return(0))
+        .WillOnce(mockReadResponse(sensorMsg.GetRawMessage()));
+
+    EXPECT_FALSE(comms.IsSensorDataReceived());
+    comms.TaskBodyComms();
+    EXPECT_FALSE(comms.IsSensorDataReceived());
+    comms.TaskBodyComms();
+    EXPECT_TRUE(comms.IsSensorDataReceived());
+
+    // The handshake only completes through the worker's run states
+    EXPECT_FALSE(comms.IsHandshakeComplete());
+    EXPECT_FALSE(comms.IsReady());
+}
+
+TEST_F(TestBackplateComms, SensorSnapshotRecordsReceiveTime)
+{
+    BackplateCommsExposed comms(&mockSerialPort, &mockDateTimeProvider);
+    mockCurrentTimeSec = 1700000000;
+
+    EXPECT_CALL(mockDateTimeProvider, gettimeofday(_))
+        .WillRepeatedly(mockGetTimevalSecs());
+
+    ResponseMessage sensorMsg(MessageType::TempHumidityData);
+    sensorMsg.SetPayload(std::vector<uint8_t>{0x11, 0x22, 0x33, 0x02});
+
+    EXPECT_CALL(mockSerialPort, Write(_)).WillRepeatedly(Return(1));
+    EXPECT_CALL(mockSerialPort, Read(_,_))
+        .WillOnce(mockReadResponse(sensorMsg.GetRawMessage()));
+
+    EXPECT_EQ(0, comms.GetSensorSnapshot().time);
+    comms.TaskBodyComms();
+
+    BackplateComms::SensorSnapshot snapshot = comms.GetSensorSnapshot();
+    EXPECT_EQ(1700000000, snapshot.time);
+    EXPECT_NEAR(87.21f, snapshot.temperatureC, 0.01f);
+    // {0x33,0x02} -> hum_pm = 0x0233 = 563 -> 56.3 %
+    EXPECT_NEAR(56.3f, snapshot.humidityPercent, 0.01f);
+    EXPECT_EQ(0, comms.GetRunState());
+}
+
 TEST_F(TestBackplateComms, PIRCallbackInvoked)
 {
     BackplateCommsExposed comms(&mockSerialPort, &mockDateTimeProvider);
@@ -518,4 +613,67 @@ TEST_F(TestBackplateComms, EventOrderingPreservedForMultipleMessages)
     ASSERT_EQ(recvOrder.size(), 2);
     EXPECT_EQ(recvOrder[0], static_cast<uint16_t>(MessageType::TempHumidityData));
     EXPECT_EQ(recvOrder[1], static_cast<uint16_t>(MessageType::PirMotionEvent));
-}
\ No newline at end of file
+}
+
+TEST_F(TestBackplateComms, ReactorTakesOverSerialAfterHandshake)
+{
+    EXPECT_CALL(mockDateTimeProvider, gettimeofday(_))
+        .WillRepeatedly(testing::Invoke([](timeval &tv) { return ::gettimeofday(&tv, nullptr); }));
+
+    // The handshake replies, then whatever the test writes into the pipe
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    auto replies = std::make_shared<std::deque<std::vector<uint8_t>>>();
+    ResponseMessage fetPresence(MessageType::FetPresenceData);
+    fetPresence.SetPayload(std::vector<uint8_t>{0x0A, 0x0B});
+    ResponseMessage brkMsg(MessageType::ResponseAscii);
+    brkMsg.SetPayload(std::vector<uint8_t>{'B','R','K'});
+    replies->push_back(fetPresence.GetRawMessage());
+    replies->push_back(brkMsg.GetRawMessage());
+    for (MessageType type : { MessageType::TfeVersion, MessageType::TfeBuildInfo, MessageType::BackplateModelAndBslId })
+        replies->push_back(ResponseMessage(type).GetRawMessage());
+
+    int readFd = fds[0];
+    EXPECT_CALL(mockSerialPort, Open(_)).WillRepeatedly(Return(true));
+    EXPECT_CALL(mockSerialPort, Write(_)).WillRepeatedly(Return(1));
+    EXPECT_CALL(mockSerialPort, GetFd()).WillRepeatedly(Return(readFd));
+    EXPECT_CALL(mockSerialPort, Read(_,_)).WillRepeatedly(testing::Invoke([replies, readFd](char *buffer, int bufferSize) {
+        if (replies->empty())
+        {
+            int count = read(readFd, buffer, bufferSize);
+            return count > 0 ? count : 0;
+        }
+        std::vector<uint8_t> reply = replies->front();
+        replies->pop_front();
+        std::memcpy(buffer, reply.data(), reply.size());
+        return static_cast<int>(reply.size());
+    }));
+
+    std::thread::id callbackThread;
+    Reactor reactor;
+    {
+        BackplateCommsExposed comms(&mockSerialPort, &mockDateTimeProvider);
+        comms.AddTemperatureCallback([&callbackThread](float) { callbackThread = std::this_thread::get_id(); });
+        ASSERT_TRUE(comms.Initialize(reactor));
+
+        for (int i = 0; i < 100 && !comms.IsHandshakeComplete(); ++i)
+            reactor.RunOnce(50);
+        ASSERT_TRUE(comms.IsHandshakeComplete());
+
+        ResponseMessage sensorMsg(MessageType::TempHumidityData);
+        sensorMsg.SetPayload(std::vector<uint8_t>{0x11, 0x22, 0x33, 0x44});
+        std::vector<uint8_t> frame = sensorMsg.GetRawMessage();
+        ASSERT_EQ(static_cast<ssize_t>(frame.size()), write(fds[1], frame.data(), frame.size()));
+
+        for (int i = 0; i < 20 && !comms.IsSensorDataReceived(); ++i)
+            reactor.RunOnce(50);
+        EXPECT_TRUE(comms.IsReady());
+        // Parsed and delivered on the reactor's thread, not the worker's
+        EXPECT_EQ(std::this_thread::get_id(), callbackThread);
+        EXPECT_NEAR(87.21f, comms.GetCurrentTemperatureC(), 0.01f);
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
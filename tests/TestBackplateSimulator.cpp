@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "BackplateSimulator.hpp"
+#include "Backplate/BackplateComms.hpp"
+#include "Backplate/UnixSerialPort.hpp"
+#include "SystemDateTimeProvider.hpp"
+
+namespace {
+
+bool WaitUntil(std::function<bool()> condition, int timeoutMs = 5000)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(BackplateSimulatorTest, CommsHandshakeAndFetEchoOverThePty)
+{
+    BackplateSimulatorOptions options;
+    options.temperature_hz = 20.0;
+    options.adc_hz = 50.0;
+    BackplateSimulator simulator(options);
+    ASSERT_TRUE(simulator.Start());
+
+    std::atomic<int> adcFrames(0);
+    UnixSerialPort port(simulator.SlavePath());
+    SystemDateTimeProvider clock;
+    BackplateComms comms(&port, &clock);
+    comms.AddGenericEventCallback([&adcFrames](uint16_t type, const uint8_t *, size_t) {
+        if (type == static_cast<uint16_t>(MessageType::RawAdcData))
+            adcFrames++;
+    });
+    comms.AddCommsTask(TimerService::Ms(50), [&comms]() {
+        if (comms.IsHandshakeComplete() && comms.GetAckedFetMask() != 1)
+            comms.SendFetControl(1);
+    });
+    ASSERT_TRUE(comms.Initialize());
+
+    EXPECT_TRUE(WaitUntil([&]() { return comms.IsReady(); }));
+    EXPECT_TRUE(simulator.IsStreaming());
+    EXPECT_EQ(1u, simulator.GetStats().handshakes);
+    EXPECT_TRUE(WaitUntil([&]() { return comms.GetAckedFetMask() == 1; }));
+    EXPECT_TRUE(WaitUntil([&]() { return adcFrames.load() >= 10; }));
+    simulator.Stop();
+}
+
+TEST(BackplateSimulatorTest, CommsResyncsPastJunkOnTheLine)
+{
+    BackplateSimulatorOptions options;
+    options.adc_hz = 100.0;
+    options.junk_rate = 0.3;
+    BackplateSimulator simulator(options);
+    ASSERT_TRUE(simulator.Start());
+
+    // Declared before the comms, whose thread outlives the test body
+    uint32_t lastSequence = 0;
+    std::atomic<int> gaps(0);
+    std::atomic<int> adcFrames(0);
+    UnixSerialPort port(simulator.SlavePath());
+    SystemDateTimeProvider clock;
+    BackplateComms comms(&port, &clock);
+    comms.AddGenericEventCallback([&](uint16_t type, const uint8_t *payload, size_t length) {
+        if (type != static_cast<uint16_t>(MessageType::RawAdcData))
+            return;
+        uint32_t sequence = BackplateSimulator::AdcSequence(payload, length);
+        // Frames streamed during the info requests are not dispatched; count from the first that is
+        if (lastSequence != 0 && sequence != lastSequence + 1)
+            gaps++;
+        lastSequence = sequence;
+        adcFrames++;
+    });
+    ASSERT_TRUE(comms.Initialize());
+
+    ASSERT_TRUE(WaitUntil([&]() { return adcFrames.load() >= 50; }));
+    // Junk only ever comes between whole frames, so none of them is lost
+    EXPECT_EQ(0, gaps.load());
+    EXPECT_GT(simulator.GetStats().framesSent, static_cast<uint64_t>(adcFrames.load()));
+    simulator.Stop();
+}
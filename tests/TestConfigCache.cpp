@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <cstdio>
+
+#include "ConfigCache.hpp"
+#include "ConfigurationReader.hpp"
+
+class ConfigCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        config_path_ = "test_cache_config.json";
+        cache_path_ = ConfigCache::PathFor(config_path_);
+        std::remove(cache_path_.c_str());
+
+        std::ofstream file(config_path_);
+        file << R"({
+    // comments are allowed in config.json
+    "hal": { "display_device": "/dev/fb1", "emulate_display": true, "backlight_max_brightness": 90 },
+    "thermostat": { "mode": "cool", "experimental_fet_control": true, "cool_setpoint": 23.5, "hysteresis": 0.25, "compressor_lockout_seconds": 600 },
+    "sensors": { "temperature": { "filter": "kalman", "measurement_noise": 0.2 }, "humidity": { "filter": "median", "window": 7 } },
+    "homeAssistant": { "baseURL": "http://ha.local:8123", "token": "abc", "entityId": "switch.porch" },
+    "integrations": [
+        { "id": 10, "name": "Porch", "type": "HomeAssistant", "entityId": "switch.porch" }
+    ],
+    "firstScreen": 1,
+    "screens": [
+        { "id": 1, "name": "Home", "type": "Home", "nextScreen": 2 },
+        { "id": 2, "name": "Menu", "type": "Menu", "menuItems": [
+            { "name": "Porch", "icon": "light", "nextScreen": 3 },
+            { "name": "Scale", "value": 0.5, "enabled": false, "extra": null }
+        ] },
+        { "id": 3, "name": "Porch", "type": "Switch", "integrationId": 10, "nextScreen": 99 }
+    ]
+})";
+    }
+
+    void TearDown() override {
+        std::remove(config_path_.c_str());
+        std::remove(cache_path_.c_str());
+    }
+
+    static std::string ReadFile(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+
+    std::string config_path_;
+    std::string cache_path_;
+};
+
+TEST_F(ConfigCacheTest, JsonLoadResolvesReferences) {
+    ConfigurationReader reader(config_path_);
+    ASSERT_TRUE(reader.load());
+    const AppConfig &config = reader.get_app_config();
+
+    ASSERT_EQ(3u, config.screens.size());
+    EXPECT_EQ(1, config.screens[0].next_screen_index);
+    EXPECT_EQ(-1, config.screens[2].next_screen_index);
+}
+
+TEST_F(ConfigCacheTest, ImageRoundTripsAppConfig) {
+    ConfigurationReader reader(config_path_);
+    ASSERT_TRUE(reader.load());
+    const AppConfig &original = reader.get_app_config();
+
+    std::string image = ConfigCache::Build(original, 42);
+    AppConfig decoded;
+    ASSERT_TRUE(ConfigCache::Decode((const uint8_t *)image.data(), image.size(), 42, decoded));
+
+    EXPECT_EQ("/dev/fb1", decoded.hal.display_device);
+    EXPECT_EQ(original.hal.beeper_device, decoded.hal.beeper_device);
+    EXPECT_TRUE(decoded.hal.emulate_display);
+    EXPECT_EQ(90, decoded.hal.backlight_max_brightness);
+    EXPECT_EQ("cool", decoded.thermostat.mode);
+    EXPECT_TRUE(decoded.thermostat.experimental_fet_control);
+    EXPECT_TRUE(decoded.thermostat == original.thermostat);
+    EXPECT_EQ("kalman", decoded.sensors.temperature.filter);
+    EXPECT_TRUE(decoded.sensors.temperature == original.sensors.temperature);
+    EXPECT_TRUE(decoded.sensors.humidity == original.sensors.humidity);
+    EXPECT_TRUE(decoded.home_assistant == original.home_assistant);
+    EXPECT_EQ("1", decoded.first_screen_id);
+
+    ASSERT_EQ(original.integrations.size(), decoded.integrations.size());
+    EXPECT_TRUE(decoded.integrations[0] == original.integrations[0]);
+
+    ASSERT_EQ(original.screens.size(), decoded.screens.size());
+    for (size_t i = 0; i < original.screens.size(); i++) {
+        EXPECT_EQ(original.screens[i].id, decoded.screens[i].id);
+        EXPECT_EQ(original.screens[i].name, decoded.screens[i].name);
+        EXPECT_EQ(original.screens[i].type, decoded.screens[i].type);
+        EXPECT_EQ(original.screens[i].next_screen_index, decoded.screens[i].next_screen_index);
+        EXPECT_EQ(original.screens[i].json.dump(), decoded.screens[i].json.dump());
+    }
+    EXPECT_TRUE(decoded.screens[2].json["integrationId"].is_number());
+}
+
+TEST_F(ConfigCacheTest, StaleOrDamagedImageIsRejected) {
+    ConfigurationReader reader(config_path_);
+    ASSERT_TRUE(reader.load());
+    std::string image = ConfigCache::Build(reader.get_app_config(), 42);
+
+    AppConfig decoded;
+    decoded.first_screen_id = "untouched";
+    EXPECT_FALSE(ConfigCache::Decode((const uint8_t *)image.data(), image.size(), 43, decoded));
+    EXPECT_FALSE(ConfigCache::Decode((const uint8_t *)image.data(), image.size() - 1, 42, decoded));
+    EXPECT_FALSE(ConfigCache::Decode((const uint8_t *)image.data(), 16, 42, decoded));
+
+    std::string wrong_version = image;
+    wrong_version[4] ^= 0x7F;
+    EXPECT_FALSE(ConfigCache::Decode((const uint8_t *)wrong_version.data(), wrong_version.size(), 42, decoded));
+    EXPECT_EQ("untouched", decoded.first_screen_id);
+}
+
+TEST_F(ConfigCacheTest, LoadWithCacheWritesThenUsesImage) {
+    ConfigurationReader first(config_path_);
+    ASSERT_TRUE(first.load_with_cache(cache_path_));
+    EXPECT_FALSE(first.loaded_from_cache());
+    EXPECT_FALSE(ReadFile(cache_path_).empty());
+
+    ConfigurationReader second(config_path_);
+    ASSERT_TRUE(second.load_with_cache(cache_path_));
+    EXPECT_TRUE(second.loaded_from_cache());
+    EXPECT_EQ(3u, second.get_app_config().screens.size());
+    EXPECT_EQ("switch.porch", second.get_app_config().integrations[0].entity_id);
+}
+
+TEST_F(ConfigCacheTest, EditedConfigFallsBackToJson) {
+    ConfigurationReader first(config_path_);
+    ASSERT_TRUE(first.load_with_cache(cache_path_));
+
+    std::ofstream file(config_path_);
+    file << R"({ "screens": [ { "id": 7, "name": "Clock", "type": "AnalogClock" } ] })";
+    file.close();
+
+    ConfigurationReader second(config_path_);
+    ASSERT_TRUE(second.load_with_cache(cache_path_));
+    EXPECT_FALSE(second.loaded_from_cache());
+    ASSERT_EQ(1u, second.get_app_config().screens.size());
+    EXPECT_EQ("analogclock", second.get_app_config().screens[0].type);
+
+    ConfigurationReader third(config_path_);
+    ASSERT_TRUE(third.load_with_cache(cache_path_));
+    EXPECT_TRUE(third.loaded_from_cache());
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+
+#include "ScreenManager.hpp"
+#include "Integrations/IntegrationContainer.hpp"
+#include "Screens/HomeScreen.hpp"
+#include "Screens/SwitchScreen.hpp"
+
+class ConfigReloadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        screen_manager = new ScreenManager(&hal, &container, nullptr);
+
+        home_assistant.base_url = "http://ha.local:8123";
+        home_assistant.token = "token";
+        home_assistant.entity_id = "switch.porch";
+
+        integrations.push_back(Integration("10", "switch.porch"));
+        integrations.push_back(Integration("11", "light.kitchen"));
+
+        screens.push_back(Screen("1", "Home", json11::Json::object { {"nextScreen", "2"} }));
+        screens.push_back(Screen("2", "Menu"));
+        screens.push_back(Screen("3", "Switch", json11::Json::object { {"integrationId", "10"} }));
+
+        container.LoadIntegrations(home_assistant, integrations);
+        screen_manager->LoadScreens("1", screens);
+    }
+
+    void TearDown() override {
+        delete screen_manager;
+        screen_manager = nullptr;
+    }
+
+    static IntegrationConfig Integration(const std::string &id, const std::string &entity) {
+        IntegrationConfig config;
+        config.id = id;
+        config.name = "Integration " + id;
+        config.type = "HomeAssistant";
+        config.entity_id = entity;
+        return config;
+    }
+
+    static ScreenConfig Screen(const std::string &id, const std::string &type, json11::Json::object attribs = {}) {
+        attribs["id"] = id;
+        attribs["name"] = type + " " + id;
+        attribs["type"] = type;
+        ScreenConfig config;
+        config.id = id;
+        config.name = type + " " + id;
+        config.type = type;
+        std::transform(config.type.begin(), config.type.end(), config.type.begin(), ::tolower);
+        config.json = json11::Json(attribs);
+        return config;
+    }
+
+    HAL hal;
+    IntegrationContainer container;
+    ScreenManager* screen_manager;
+    HomeAssistantConfig home_assistant;
+    std::vector<IntegrationConfig> integrations;
+    std::vector<ScreenConfig> screens;
+};
+
+TEST_F(ConfigReloadTest, IdenticalConfigKeepsEverything) {
+    ScreenBase *home = screen_manager->GetScreenById("1");
+    IntegrationSwitchBase *porch = container.GetSwitchById("10");
+
+    std::set<std::string> changed = container.ReloadIntegrations(home_assistant, integrations);
+    ScreenReloadStats stats = screen_manager->ReloadScreens("1", screens, changed);
+
+    EXPECT_TRUE(changed.empty());
+    EXPECT_EQ(3u, stats.unchanged);
+    EXPECT_EQ(0u, stats.added + stats.rebuilt + stats.removed);
+    EXPECT_EQ(home, screen_manager->GetScreenById("1"));
+    EXPECT_EQ(porch, container.GetSwitchById("10"));
+}
+
+TEST_F(ConfigReloadTest, OnlyChangedScreensAreRebuilt) {
+    ScreenBase *home = screen_manager->GetScreenById("1");
+    ScreenBase *menu = screen_manager->GetScreenById("2");
+
+    screens[1] = Screen("2", "Menu", json11::Json::object { {"nextScreen", "1"} });
+    screens.erase(screens.begin() + 2);
+    screens.push_back(Screen("4", "Home"));
+
+    ScreenReloadStats stats = screen_manager->ReloadScreens("1", screens, std::set<std::string>());
+
+    EXPECT_EQ(1u, stats.added);
+    EXPECT_EQ(1u, stats.rebuilt);
+    EXPECT_EQ(1u, stats.removed);
+    EXPECT_EQ(1u, stats.unchanged);
+    EXPECT_EQ(home, screen_manager->GetScreenById("1"));
+    EXPECT_NE(menu, screen_manager->GetScreenById("2"));
+    EXPECT_EQ("1", screen_manager->GetScreenById("2")->GetNextScreenId());
+    EXPECT_EQ(nullptr, screen_manager->GetScreenById("3"));
+    EXPECT_NE(nullptr, screen_manager->GetScreenById("4"));
+}
+
+TEST_F(ConfigReloadTest, RebuiltCurrentScreenKeepsHistory) {
+    screen_manager->GoToFirstScreen();
+    screen_manager->GoToNextScreen("2");
+    ASSERT_EQ(2u, screen_manager->CountHistory());
+
+    screens[1] = Screen("2", "Menu", json11::Json::object { {"nextScreen", "3"} });
+    screen_manager->ReloadScreens("1", screens, std::set<std::string>());
+
+    ScreenBase *menu = screen_manager->GetScreenById("2");
+    EXPECT_EQ(menu, screen_manager->GetCurrentScreen());
+    EXPECT_EQ(2u, screen_manager->CountHistory());
+
+    screen_manager->GoToPreviousScreen();
+    EXPECT_EQ(screen_manager->GetScreenById("1"), screen_manager->GetCurrentScreen());
+}
+
+TEST_F(ConfigReloadTest, RemovedCurrentScreenFallsBackToHistory) {
+    screen_manager->GoToFirstScreen();
+    screen_manager->GoToNextScreen("3");
+
+    screens.erase(screens.begin() + 2);
+    screen_manager->ReloadScreens("1", screens, std::set<std::string>());
+
+    EXPECT_EQ(screen_manager->GetScreenById("1"), screen_manager->GetCurrentScreen());
+    EXPECT_EQ(1u, screen_manager->CountHistory());
+}
+
+TEST_F(ConfigReloadTest, ChangedIntegrationRebuildsItsScreens) {
+    ScreenBase *switchScreen = screen_manager->GetScreenById("3");
+    IntegrationDimmerBase *kitchen = container.GetDimmerById("11");
+
+    integrations[0] = Integration("10", "switch.garage");
+    std::set<std::string> changed = container.ReloadIntegrations(home_assistant, integrations);
+    ScreenReloadStats stats = screen_manager->ReloadScreens("1", screens, changed);
+
+    EXPECT_EQ(std::set<std::string>({"10"}), changed);
+    EXPECT_EQ(kitchen, container.GetDimmerById("11"));
+    EXPECT_EQ(1u, stats.rebuilt);
+    EXPECT_NE(switchScreen, screen_manager->GetScreenById("3"));
+}
+
+TEST_F(ConfigReloadTest, ChangedIntegrationRebuildsScreensBoundByName) {
+    // No "integrationId": the switch binds to the integration named like the screen
+    integrations.push_back(Integration("Switch 4", "switch.shed"));
+    screens.push_back(Screen("4", "Switch"));
+    container.ReloadIntegrations(home_assistant, integrations);
+    screen_manager->ReloadScreens("1", screens, std::set<std::string>());
+    ScreenBase *shed = screen_manager->GetScreenById("4");
+    ASSERT_NE(nullptr, shed);
+    EXPECT_EQ("Switch 4", shed->GetIntegrationId());
+
+    integrations.back() = Integration("Switch 4", "switch.barn");
+    std::set<std::string> changed = container.ReloadIntegrations(home_assistant, integrations);
+    ScreenReloadStats stats = screen_manager->ReloadScreens("1", screens, changed);
+
+    EXPECT_EQ(std::set<std::string>({"Switch 4"}), changed);
+    EXPECT_EQ(1u, stats.rebuilt);
+    EXPECT_NE(shed, screen_manager->GetScreenById("4"));
+}
+
+TEST_F(ConfigReloadTest, CredentialChangeRebuildsAllIntegrations) {
+    home_assistant.token = "rotated";
+    integrations.pop_back();
+
+    std::set<std::string> changed = container.ReloadIntegrations(home_assistant, integrations);
+
+    EXPECT_EQ(std::set<std::string>({"10", "11"}), changed);
+    EXPECT_NE(nullptr, container.GetSwitchById("10"));
+    EXPECT_EQ(nullptr, container.GetDimmerById("11"));
+    EXPECT_EQ(1u, container.CountIntegrations());
+}
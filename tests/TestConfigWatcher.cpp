@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <cstdio>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "ConfigWatcher.hpp"
+
+class ConfigWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char dir_template[] = "/tmp/cuckoo_watch_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dir_template));
+        dir_ = dir_template;
+        config_path_ = dir_ + "/config.json";
+        WriteFile(config_path_, "{}");
+    }
+
+    void TearDown() override {
+        std::remove(config_path_.c_str());
+        std::remove((dir_ + "/other.json").c_str());
+        std::remove((dir_ + "/config.json.tmp").c_str());
+        rmdir(dir_.c_str());
+    }
+
+    static void WriteFile(const std::string &path, const std::string &content) {
+        std::ofstream file(path);
+        file << content;
+    }
+
+    std::string dir_;
+    std::string config_path_;
+};
+
+TEST_F(ConfigWatcherTest, NoChangeReportsNothing) {
+    ConfigWatcher watcher(config_path_, 0);
+    ASSERT_TRUE(watcher.Start());
+    EXPECT_FALSE(watcher.Poll());
+}
+
+TEST_F(ConfigWatcherTest, WriteIsReportedOnce) {
+    ConfigWatcher watcher(config_path_, 0);
+    ASSERT_TRUE(watcher.Start());
+
+    WriteFile(config_path_, R"({"screens": []})");
+    EXPECT_TRUE(watcher.Poll());
+    EXPECT_FALSE(watcher.Poll());
+}
+
+TEST_F(ConfigWatcherTest, RenameOverConfigIsReported) {
+    ConfigWatcher watcher(config_path_, 0);
+    ASSERT_TRUE(watcher.Start());
+
+    std::string tmp_path = config_path_ + ".tmp";
+    WriteFile(tmp_path, R"({"screens": []})");
+    watcher.Poll(); // the temporary file itself is not the config
+    ASSERT_EQ(0, rename(tmp_path.c_str(), config_path_.c_str()));
+    EXPECT_TRUE(watcher.Poll());
+}
+
+TEST_F(ConfigWatcherTest, OtherFilesAreIgnored) {
+    ConfigWatcher watcher(config_path_, 0);
+    ASSERT_TRUE(watcher.Start());
+
+    WriteFile(dir_ + "/other.json", "{}");
+    EXPECT_FALSE(watcher.Poll());
+}
+
+TEST_F(ConfigWatcherTest, ChangeWaitsForSettleTime) {
+    ConfigWatcher watcher(config_path_, 10000);
+    ASSERT_TRUE(watcher.Start());
+
+    WriteFile(config_path_, R"({"screens": []})");
+    EXPECT_FALSE(watcher.Poll());
+}
@@ -265,4 +265,145 @@ TEST_F(ConfigurationReaderTest, HomeAssistantConfigRequiresAllFields) {
         check_file.close();
         std::remove(partial_config_filename.c_str());
     }
-}
\ No newline at end of file
+}
+TEST_F(ConfigurationReaderTest, AppConfigHoldsDefaultsWhenNotLoaded) {
+    ConfigurationReader config("nonexistent.json");
+    EXPECT_FALSE(config.load());
+
+    const AppConfig& app = config.get_app_config();
+    EXPECT_EQ(app.hal.display_device, "/dev/fb0");
+    EXPECT_EQ(app.hal.backplate_serial_device, "/dev/ttyO2");
+    EXPECT_FALSE(app.hal.emulate_display);
+    EXPECT_EQ(app.hal.backlight_active_seconds, 10);
+    EXPECT_TRUE(app.integrations.empty());
+    EXPECT_TRUE(app.screens.empty());
+}
+
+TEST_F(ConfigurationReaderTest, AppConfigParsesAllSections) {
+    std::string filename = "app_config.json";
+    std::ofstream file(filename);
+    file << R"({
+        // comments are allowed
+        "hal": {
+            "display_device": "/dev/fb1",
+            "emulate_display": true,
+            "backlight_max_brightness": 90
+        },
+        "homeAssistant": {
+            "baseURL": "http://ha.local:8123",
+            "token": "abc",
+            "entityId": "switch.x"
+        },
+        "integrations": [
+            { "id": 7, "name": "Lamp", "type": "HomeAssistant", "entityId": "light.lamp" },
+            { "name": "Fan", "type": "HomeAssistant", "entityId": "switch.fan" },
+            { "name": "Broken", "type": "HomeAssistant", "entityId": "nodomain" },
+            "not an object"
+        ],
+        "firstScreen": 2,
+        "screens": [
+            { "id": 2, "name": "Home", "type": "Home" },
+            { "name": "Clock", "type": "AnalogClock", "nextScreen": 2 },
+            42
+        ]
+    })";
+    file.close();
+
+    ConfigurationReader config(filename);
+    ASSERT_TRUE(config.load());
+    const AppConfig& app = config.get_app_config();
+
+    EXPECT_EQ(app.hal.display_device, "/dev/fb1");
+    EXPECT_TRUE(app.hal.emulate_display);
+    EXPECT_EQ(app.hal.backlight_max_brightness, 90);
+    EXPECT_EQ(app.hal.backlight_min_brightness, 20);  // default kept
+
+    EXPECT_TRUE(app.home_assistant.IsComplete());
+    EXPECT_EQ(app.home_assistant.base_url, "http://ha.local:8123");
+
+    ASSERT_EQ(app.integrations.size(), 2u);
+    EXPECT_EQ(app.integrations[0].id, "7");
+    EXPECT_EQ(app.integrations[0].entity_id, "light.lamp");
+    EXPECT_EQ(app.integrations[1].id, "Fan");
+
+    EXPECT_EQ(app.first_screen_id, "2");
+    ASSERT_EQ(app.screens.size(), 2u);
+    EXPECT_EQ(app.screens[0].id, "2");
+    EXPECT_EQ(app.screens[0].type, "home");
+    EXPECT_EQ(app.screens[1].id, "Clock");
+    EXPECT_EQ(app.screens[1].type, "analogclock");
+    EXPECT_EQ(app.screens[1].json["nextScreen"].int_value(), 2);
+
+    std::remove(filename.c_str());
+}
+
+TEST_F(ConfigurationReaderTest, ThermostatSectionIsParsedAndClamped) {
+    std::string filename = "thermostat_config.json";
+    std::ofstream file(filename);
+    file << R"({
+        "thermostat": {
+            "mode": "Heat",
+            "heat_setpoint": 19.5,
+            "hysteresis": -1,
+            "min_on_seconds": 240,
+            "control_period_ms": 1
+        }
+    })";
+    file.close();
+
+    ConfigurationReader config(filename);
+    ASSERT_TRUE(config.load());
+    const ThermostatConfig& thermostat = config.get_app_config().thermostat;
+
+    EXPECT_EQ(thermostat.mode, "heat");
+    EXPECT_DOUBLE_EQ(thermostat.heat_setpoint_c, 19.5);
+    EXPECT_DOUBLE_EQ(thermostat.cool_setpoint_c, 24.0);  // default kept
+    EXPECT_DOUBLE_EQ(thermostat.hysteresis_c, 0.0);
+    EXPECT_EQ(thermostat.min_on_seconds, 240);
+    EXPECT_EQ(thermostat.compressor_lockout_seconds, 300);
+    EXPECT_EQ(thermostat.control_period_ms, 10);
+    // A mode alone does not drive the FETs
+    EXPECT_FALSE(thermostat.experimental_fet_control);
+    EXPECT_FALSE(thermostat.ActuationEnabled());
+
+    std::remove(filename.c_str());
+}
+
+TEST_F(ConfigurationReaderTest, UnknownThermostatModeStaysOff) {
+    std::string filename = "thermostat_mode.json";
+    std::ofstream file(filename);
+    file << R"({ "thermostat": { "mode": "auto" } })";
+    file.close();
+
+    ConfigurationReader config(filename);
+    ASSERT_TRUE(config.load());
+    EXPECT_EQ(config.get_app_config().thermostat.mode, "off");
+
+    std::remove(filename.c_str());
+}
+
+TEST_F(ConfigurationReaderTest, SensorFiltersAreParsed) {
+    std::string filename = "sensors_config.json";
+    std::ofstream file(filename);
+    file << R"({
+        "sensors": {
+            "temperature": { "filter": "Median", "window": 3, "deadband": 0.2, "refresh_seconds": 30 },
+            "humidity": { "filter": "smooth", "alpha": 2 }
+        }
+    })";
+    file.close();
+
+    ConfigurationReader config(filename);
+    ASSERT_TRUE(config.load());
+    const SensorsConfig& sensors = config.get_app_config().sensors;
+
+    EXPECT_EQ(sensors.temperature.filter, "median");
+    EXPECT_EQ(sensors.temperature.window, 3);
+    EXPECT_DOUBLE_EQ(sensors.temperature.deadband, 0.2);
+    EXPECT_EQ(sensors.temperature.refresh_seconds, 30);
+    EXPECT_EQ(sensors.humidity.filter, "ema");  // unknown filter, default kept
+    EXPECT_DOUBLE_EQ(sensors.humidity.alpha, 1.0);
+    EXPECT_DOUBLE_EQ(sensors.humidity.deadband, 0.5);
+
+    std::remove(filename.c_str());
+}
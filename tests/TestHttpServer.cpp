@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include "HttpServer.hpp"
+#include "StatusRoutes.hpp"
+#include "Metrics.hpp"
+#include "Backplate/BackplateComms.hpp"
+
+static int Connect(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct timeval timeout = { 2, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Sends raw and returns everything the server wrote before closing
+static std::string Exchange(int port, const std::string &raw)
+{
+    int fd = Connect(port);
+    if (fd < 0)
+        return "";
+    send(fd, raw.data(), raw.size(), MSG_NOSIGNAL);
+
+    std::string reply;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+        reply.append(buffer, static_cast<size_t>(n));
+    close(fd);
+    return reply;
+}
+
+static std::string Get(int port, const std::string &path)
+{
+    return Exchange(port, "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n");
+}
+
+static std::string Body(const std::string &reply)
+{
+    size_t at = reply.find("\r\n\r\n");
+    return at == std::string::npos ? "" : reply.substr(at + 4);
+}
+
+class TestHttpServer : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        server.Route("/hello", [](const HttpServer::Request &request) {
+            HttpServer::Response response;
+            response.body = "hello " + request.query;
+            return response;
+        });
+        ASSERT_TRUE(server.Listen("127.0.0.1", 0));
+        ASSERT_GT(server.Port(), 0);
+        ASSERT_TRUE(server.Start());
+    }
+
+    HttpServer server;
+};
+
+TEST_F(TestHttpServer, ServesRegisteredRoute)
+{
+    std::string reply = Get(server.Port(), "/hello?name=cuckoo");
+    EXPECT_EQ(0u, reply.find("HTTP/1.0 200 OK\r\n"));
+    EXPECT_NE(std::string::npos, reply.find("Content-Length: 17\r\n"));
+    EXPECT_EQ("hello name=cuckoo", Body(reply));
+}
+
+TEST_F(TestHttpServer, AnswersErrorsWithStatusCodes)
+{
+    EXPECT_EQ(0u, Get(server.Port(), "/missing").find("HTTP/1.0 404 "));
+    EXPECT_EQ(0u, Exchange(server.Port(), "POST /hello HTTP/1.1\r\n\r\n").find("HTTP/1.0 405 "));
+    EXPECT_EQ(0u, Exchange(server.Port(), "nonsense\r\n\r\n").find("HTTP/1.0 400 "));
+    EXPECT_EQ(0u, Exchange(server.Port(), "GET /" + std::string(HttpServer::MaxRequestBytes, 'a')).find("HTTP/1.0 431 "));
+}
+
+TEST_F(TestHttpServer, HeadOmitsBody)
+{
+    std::string reply = Exchange(server.Port(), "HEAD /hello HTTP/1.1\r\n\r\n");
+    EXPECT_EQ(0u, reply.find("HTTP/1.0 200 OK\r\n"));
+    EXPECT_EQ("", Body(reply));
+}
+
+TEST_F(TestHttpServer, StalledClientDoesNotBlockOthers)
+{
+    // Half a request stays open while another client is served
+    int stalled = Connect(server.Port());
+    ASSERT_GE(stalled, 0);
+    send(stalled, "GET /hel", 8, MSG_NOSIGNAL);
+
+    EXPECT_EQ("hello ", Body(Get(server.Port(), "/hello")));
+
+    send(stalled, "lo HTTP/1.1\r\n\r\n", 15, MSG_NOSIGNAL);
+    char buffer[256];
+    ssize_t n = recv(stalled, buffer, sizeof(buffer), 0);
+    close(stalled);
+    ASSERT_GT(n, 0);
+    EXPECT_EQ(0, strncmp(buffer, "HTTP/1.0 200 OK", 15));
+}
+
+TEST_F(TestHttpServer, StatusRoutesReportMetricsAndHealth)
+{
+    HttpServer status;
+    BackplateComms backplate(nullptr, nullptr);
+    RegisterStatusRoutes(status, &backplate, false);
+    ASSERT_TRUE(status.Listen("127.0.0.1", 0));
+    ASSERT_TRUE(status.Start());
+
+    Metrics::Instance().Counter("test_http_scrapes_total", "Counter created by TestHttpServer").Add(3);
+    std::string metrics = Get(status.Port(), "/metrics");
+    EXPECT_EQ(0u, metrics.find("HTTP/1.0 200 OK\r\n"));
+    EXPECT_NE(std::string::npos, metrics.find("\ntest_http_scrapes_total 3\n"));
+
+    // No handshake yet: the backplate is down and there is no sensor data
+    std::string health = Get(status.Port(), "/health");
+    EXPECT_EQ(0u, health.find("HTTP/1.0 503 "));
+    EXPECT_NE(std::string::npos, health.find("Content-Type: application/json\r\n"));
+    EXPECT_NE(std::string::npos, health.find("\"status\":\"down\""));
+    EXPECT_NE(std::string::npos, health.find("\"run_state\":0"));
+    EXPECT_NE(std::string::npos, health.find("\"sensor_age_seconds\":null"));
+
+    std::string sensors = Get(status.Port(), "/sensors");
+    EXPECT_EQ(0u, sensors.find("HTTP/1.0 200 OK\r\n"));
+    EXPECT_NE(std::string::npos, sensors.find("\"temperature_c\":null"));
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "Assets/ImageRle.hpp"
+#include "Assets/CuckooLogoNest.hpp"
+
+static std::vector<uint8_t> Decode(const std::vector<uint8_t> &packed, size_t raw_size, size_t pixel_bytes)
+{
+    std::vector<uint8_t> out(raw_size);
+    size_t n = ImageRle::Decode(packed.data(), packed.size(), out.data(), out.size(), pixel_bytes);
+    out.resize(n);
+    return out;
+}
+
+TEST(TestImageRle, RoundTripsRunsAndLiterals)
+{
+    // Long run (split at 128), short literals, a run of exactly two, single pixels
+    std::vector<uint8_t> raw;
+    for (int i = 0; i < 300; ++i) { raw.push_back(0x61); raw.push_back(0x08); }
+    for (int i = 0; i < 5; ++i) { raw.push_back(i); raw.push_back(0xF0 + i); }
+    for (int i = 0; i < 2; ++i) { raw.push_back(0xAA); raw.push_back(0x55); }
+    raw.push_back(0x01); raw.push_back(0x02);
+
+    std::vector<uint8_t> packed = ImageRle::Encode(raw.data(), raw.size(), 2);
+    EXPECT_LT(packed.size(), raw.size());
+    EXPECT_EQ(Decode(packed, raw.size(), 2), raw);
+}
+
+TEST(TestImageRle, LongLiteralRunsAreChunked)
+{
+    std::vector<uint8_t> raw;
+    for (int i = 0; i < 1000; ++i) { raw.push_back(i & 0xFF); raw.push_back(i >> 8); }
+
+    std::vector<uint8_t> packed = ImageRle::Encode(raw.data(), raw.size(), 2);
+    // 1000 literal pixels need ceil(1000 / 128) = 8 control bytes
+    EXPECT_EQ(packed.size(), raw.size() + 8);
+    EXPECT_EQ(Decode(packed, raw.size(), 2), raw);
+}
+
+TEST(TestImageRle, RejectsTruncatedAndOversizedStreams)
+{
+    std::vector<uint8_t> raw(64, 0x7E);
+    std::vector<uint8_t> packed = ImageRle::Encode(raw.data(), raw.size(), 2);
+
+    std::vector<uint8_t> out(raw.size());
+    // Missing the run's pixel value
+    EXPECT_EQ(ImageRle::Decode(packed.data(), packed.size() - 1, out.data(), out.size(), 2), 0u);
+    // Destination too small
+    EXPECT_EQ(ImageRle::Decode(packed.data(), packed.size(), out.data(), out.size() - 2, 2), 0u);
+
+    // Literal header claiming more pixels than follow
+    const uint8_t literal[] = { 0x03, 0x01, 0x02 };
+    EXPECT_EQ(ImageRle::Decode(literal, sizeof(literal), out.data(), out.size(), 2), 0u);
+}
+
+TEST(TestImageRle, PackedLogoDecodesToFullImage)
+{
+    const PackedImage &logo = CuckooLogoNest;
+    ASSERT_EQ(logo.raw_size, static_cast<uint32_t>(logo.width) * logo.height * logo.pixel_bytes);
+    EXPECT_LT(logo.data_size, logo.raw_size / 2);
+
+    std::vector<uint8_t> pixels(logo.raw_size);
+    EXPECT_EQ(ImageRle::Decode(logo.data, logo.data_size, pixels.data(), pixels.size(), logo.pixel_bytes), logo.raw_size);
+    // Background colour of the original RGB565 array
+    EXPECT_EQ(pixels[0], 0x61);
+    EXPECT_EQ(pixels[1], 0x08);
+}
@@ -1,6 +1,16 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include "Integrations/IntegrationContainer.hpp"
 #include "Integrations/HomeAssistantSwitch.hpp"
 
@@ -64,4 +74,124 @@ TEST_F(IntegrationContainerTest, LoadIntegrationsFromConfigLoadsHomeAssistantSwi
     HomeAssistantSwitch *haSw = dynamic_cast<HomeAssistantSwitch*>(sw);
     EXPECT_NE(haSw, nullptr);
     EXPECT_EQ(haSw->GetEntityId(), "switch.test_switch_1");
-}
\ No newline at end of file
+}
+
+TEST_F(IntegrationContainerTest, IntegrationIdsListLoadedIntegrations)
+{
+    std::ofstream config("test_config.json");
+    config << R"({
+        "integrations": [
+            { "id": 1, "name": "Porch", "type": "HomeAssistant", "entityId": "switch.porch" },
+            { "id": 2, "name": "Hall", "type": "HomeAssistant", "entityId": "switch.hall" }
+        ]
+    })";
+    config.close();
+
+    EXPECT_TRUE(container->GetIntegrationIds().empty());
+    container->LoadIntegrationsFromConfig("test_config.json");
+    std::vector<std::string> expected = { "1", "2" };
+    EXPECT_EQ(expected, container->GetIntegrationIds());
+    // nothing to refresh for unknown IDs
+    container->RefreshStates({ "999" });
+}
+
+TEST_F(IntegrationContainerTest, ReloadDoesNotWaitForARefreshInFlight)
+{
+    // A Home Assistant that accepts the connection and never answers
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listener, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    ASSERT_EQ(0, bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+    ASSERT_EQ(0, listen(listener, 1));
+    ASSERT_EQ(0, getsockname(listener, reinterpret_cast<sockaddr *>(&address), &length));
+
+    HomeAssistantConfig homeAssistant;
+    homeAssistant.base_url = "http://127.0.0.1:" + std::to_string(ntohs(address.sin_port));
+    homeAssistant.token = "token";
+    IntegrationConfig porch;
+    porch.id = "1";
+    porch.name = "Porch";
+    porch.type = "HomeAssistant";
+    porch.entity_id = "switch.porch";
+    container->LoadIntegrations(homeAssistant, { porch });
+
+    // No ASSERT until the thread is joined: returning with it joinable would terminate
+    std::thread refresh([this]() { container->RefreshStates({ "1" }); });
+    int connection = accept(listener, nullptr, nullptr);
+    EXPECT_GE(connection, 0);
+
+    // The request is now blocked; dropping its integration must not wait for it
+    porch.entity_id = "switch.garage";
+    std::future<std::set<std::string>> reload = std::async(std::launch::async,
+        [&]() { return container->ReloadIntegrations(homeAssistant, { porch }); });
+    EXPECT_EQ(std::future_status::ready, reload.wait_for(std::chrono::seconds(2)));
+
+    if (connection >= 0)
+        close(connection);
+    close(listener);
+    refresh.join();
+    EXPECT_EQ(std::set<std::string>({ "1" }), reload.get());
+    EXPECT_NE(nullptr, container->GetSwitchById("1"));
+}
+
+TEST_F(IntegrationContainerTest, UiReadAfterThePrefetchedOneIsLive)
+{
+    // A Home Assistant whose switch is turned off from elsewhere after the prewake refresh
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listener, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    ASSERT_EQ(0, bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+    ASSERT_EQ(0, listen(listener, 4));
+    ASSERT_EQ(0, getsockname(listener, reinterpret_cast<sockaddr *>(&address), &length));
+
+    HomeAssistantConfig homeAssistant;
+    homeAssistant.base_url = "http://127.0.0.1:" + std::to_string(ntohs(address.sin_port));
+    homeAssistant.token = "token";
+    IntegrationConfig porch;
+    porch.id = "1";
+    porch.name = "Porch";
+    porch.type = "HomeAssistant";
+    porch.entity_id = "switch.porch";
+    container->LoadIntegrations(homeAssistant, { porch });
+    IntegrationSwitchBase *sw = container->GetSwitchById("1");
+    ASSERT_NE(nullptr, sw);
+
+    // No ASSERT until the server is joined
+    std::atomic<bool> on(true);
+    std::atomic<int> requests(0);
+    std::thread server([&]() {
+        int connection;
+        while ((connection = accept(listener, nullptr, nullptr)) >= 0)
+        {
+            std::string request;
+            char buffer[512];
+            ssize_t received;
+            while (request.find("\r\n\r\n") == std::string::npos
+                && (received = recv(connection, buffer, sizeof(buffer), 0)) > 0)
+                request.append(buffer, received);
+            requests++;
+            std::string body = std::string("{\"state\": \"") + (on ? "on" : "off") + "\"}";
+            std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: "
+                + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+            send(connection, response.data(), response.size(), 0);
+            close(connection);
+        }
+    });
+
+    container->RefreshStates({ "1" });
+    on = false;
+    // The first read is the prefetched one, the next asks again
+    EXPECT_EQ(IntegrationSwitchBase::SwitchState::ON, sw->GetState());
+    EXPECT_EQ(IntegrationSwitchBase::SwitchState::OFF, sw->GetState());
+    EXPECT_EQ(2, requests.load());
+
+    shutdown(listener, SHUT_RDWR);
+    server.join();
+    close(listener);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CUCKOO_LOG_MODULE "test-binary"
+#include "logger.h"
+
+using namespace cuckoo_log;
+
+static const int SegmentCount = 3;
+
+class LogBinaryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char dir_template[] = "/tmp/cuckoo_logbin_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dir_template));
+        dir_ = dir_template;
+    }
+
+    void TearDown() override {
+        for (int i = 0; i < SegmentCount; ++i)
+            std::remove(binary::segment_path(dir_, i).c_str());
+        rmdir(dir_.c_str());
+    }
+
+    // Lines of every segment, oldest segment first
+    std::vector<binary::Line> ReadAll(int *segments = nullptr) {
+        std::vector<std::pair<uint32_t, std::vector<binary::Line>>> found;
+        for (int i = 0; i < SegmentCount; ++i) {
+            uint32_t sequence;
+            std::vector<binary::Line> lines;
+            if (binary::read_segment(binary::segment_path(dir_, i), sequence, lines))
+                found.push_back(std::make_pair(sequence, lines));
+        }
+        std::sort(found.begin(), found.end(),
+                  [](const std::pair<uint32_t, std::vector<binary::Line>> &a,
+                     const std::pair<uint32_t, std::vector<binary::Line>> &b) { return a.first < b.first; });
+        if (segments) *segments = static_cast<int>(found.size());
+        std::vector<binary::Line> all;
+        for (const auto &segment : found)
+            all.insert(all.end(), segment.second.begin(), segment.second.end());
+        return all;
+    }
+
+    static binary::SegmentConfig SmallSegments() {
+        binary::SegmentConfig config;
+        config.segment_bytes = 4096;
+        config.segment_count = SegmentCount;
+        return config;
+    }
+
+    std::string dir_;
+};
+
+template<typename... Args>
+static std::string Render(const char *format, const Args &... args)
+{
+    binary::FormatSite site("test-binary", format);
+    std::string payload;
+    binary::put_varint(payload, site.id);
+    binary::put_args(payload, args...);
+    std::string text;
+    EXPECT_TRUE(binary::render_payload(payload.data(), payload.size(), text));
+    return text;
+}
+
+TEST_F(LogBinaryTest, PayloadRendersLikePrintf)
+{
+    EXPECT_EQ("no arguments", Render("no arguments"));
+    EXPECT_EQ("-42 42 2a 0X2A 100%", Render("%d %u %x %#X 100%%", -42, 42u, 42, 42));
+    EXPECT_EQ("[   7] [7   ] [007]", Render("[%4d] [%-4d] [%03d]", 7, 7, 7));
+    EXPECT_EQ("1.50 2.5e+00 x", Render("%.2f %.1e %c", 1.5, 2.5f, 'x'));
+    EXPECT_EQ("port /dev/ttyO2 (null)", Render("port %s %s", "/dev/ttyO2", static_cast<const char *>(nullptr)));
+    EXPECT_EQ("-9000000000 18446744073709551615", Render("%lld %llu", -9000000000LL, 18446744073709551615ULL));
+    EXPECT_EQ("[  ab]", Render("[%*s]", 4, "ab"));
+    EXPECT_EQ("missing <?>", Render("missing %d"));
+}
+
+TEST_F(LogBinaryTest, SegmentsRotateWithinBudget)
+{
+    binary::FormatSite site("test-binary", "line %d of %s");
+    binary::SegmentWriter writer(dir_, SmallSegments());
+    ASSERT_TRUE(writer.open(1000000));
+
+    const int lines = 2000;
+    std::string payload;
+    for (int i = 0; i < lines; ++i) {
+        payload.clear();
+        binary::put_varint(payload, site.id);
+        binary::put_args(payload, i, "backplate");
+        writer.append(static_cast<uint8_t>(Level::Info), 1000000 + i * 1000, payload.data(), payload.size());
+        if (i % 50 == 0) writer.flush(false);
+    }
+    writer.close();
+
+    for (int i = 0; i < SegmentCount; ++i) {
+        struct stat st;
+        ASSERT_EQ(0, stat(binary::segment_path(dir_, i).c_str(), &st));
+        EXPECT_EQ(4096, st.st_size);
+    }
+
+    // every segment carries its own definitions, so whatever survives decodes
+    int segments = 0;
+    std::vector<binary::Line> all = ReadAll(&segments);
+    EXPECT_EQ(SegmentCount, segments);
+    ASSERT_FALSE(all.empty());
+    EXPECT_LT(all.size(), static_cast<size_t>(lines));
+    int first = lines - static_cast<int>(all.size());
+    for (size_t i = 0; i < all.size(); ++i) {
+        int n = first + static_cast<int>(i);
+        EXPECT_EQ("line " + std::to_string(n) + " of backplate", all[i].text);
+        EXPECT_EQ("test-binary", all[i].module);
+        EXPECT_EQ(1000000 + n * 1000, all[i].time_us);
+    }
+}
+
+TEST_F(LogBinaryTest, ReopenStartsAfterNewestSegment)
+{
+    binary::FormatSite site("test-binary", "run %d");
+    uint32_t first_sequence;
+    for (int run = 0; run < 2; ++run) {
+        binary::SegmentWriter writer(dir_, SmallSegments());
+        ASSERT_TRUE(writer.open(run * 1000));
+        if (run == 0) first_sequence = writer.sequence();
+        else EXPECT_EQ(first_sequence + 1, writer.sequence());
+
+        std::string payload;
+        binary::put_varint(payload, site.id);
+        binary::put_args(payload, run);
+        writer.append(static_cast<uint8_t>(Level::Warn), run * 1000, payload.data(), payload.size());
+    }
+
+    std::vector<binary::Line> all = ReadAll();
+    ASSERT_EQ(2u, all.size());
+    EXPECT_EQ("run 0", all[0].text);
+    EXPECT_EQ("run 1", all[1].text);
+    EXPECT_EQ(static_cast<uint8_t>(Level::Warn), all[1].level);
+}
+
+TEST_F(LogBinaryTest, LoggerWritesMacrosToBinarySink)
+{
+    Logger::set_level(Level::Info);
+    Logger::set_console(false);
+    for (int async = 0; async < 2; ++async) {
+        ASSERT_TRUE(Logger::set_binary_sink(dir_, SmallSegments()));
+        if (async) Logger::start_async();
+
+        LOG_WARN("binary %d %s %.2f", 42 + async, "args", 1.5);
+        LOG_WARN_STREAM("stream " << 7 + async);
+        LOG_DEBUG("filtered %d", async);
+
+        Logger::flush();
+        Logger::stop_async();
+        ASSERT_TRUE(Logger::set_binary_sink(""));
+        EXPECT_FALSE(Logger::binary_enabled());
+    }
+    Logger::set_console(true);
+
+    std::vector<binary::Line> all = ReadAll();
+    ASSERT_EQ(4u, all.size());
+    EXPECT_EQ("binary 42 args 1.50", all[0].text);
+    EXPECT_EQ("stream 7", all[1].text);
+    EXPECT_EQ("binary 43 args 1.50", all[2].text);
+    EXPECT_EQ("stream 8", all[3].text);
+    EXPECT_EQ("test-binary", all[3].module);
+    EXPECT_EQ(static_cast<uint8_t>(Level::Warn), all[3].level);
+}
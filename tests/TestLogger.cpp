@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+#define CUCKOO_LOG_MODULE "test"
+#include "logger.h"
+
+using cuckoo_log::Level;
+using cuckoo_log::Logger;
+using cuckoo_log::detail::LogRing;
+
+static std::vector<std::string> DrainRing(LogRing &ring)
+{
+    std::vector<std::string> lines;
+    size_t pos = ring.read_begin();
+    size_t end = ring.read_end();
+    const LogRing::Record *record;
+    while ((record = ring.next(pos, end)) != nullptr)
+        lines.push_back(std::string(LogRing::text(record), record->length));
+    ring.release(pos);
+    return lines;
+}
+
+TEST(TestLogger, RingKeepsOrderAcrossWrapAround)
+{
+    LogRing ring;
+    int next_expected = 0;
+    int next_pushed = 0;
+    for (int round = 0; round < 50; ++round)
+    {
+        for (int i = 0; i < 17; ++i, ++next_pushed)
+        {
+            std::string msg = "line " + std::to_string(next_pushed) + std::string(next_pushed % 300, 'x');
+            ASSERT_TRUE(ring.push(Level::Info, next_pushed, msg.data(), msg.size()));
+        }
+        for (const auto &line : DrainRing(ring))
+        {
+            std::string expected = "line " + std::to_string(next_expected) + std::string(next_expected % 300, 'x') + "\n";
+            EXPECT_EQ(expected, line);
+            next_expected++;
+        }
+    }
+    EXPECT_EQ(next_pushed, next_expected);
+    EXPECT_EQ(0u, ring.used());
+    EXPECT_EQ(0u, ring.dropped.load());
+}
+
+TEST(TestLogger, FullRingDropsAndCounts)
+{
+    LogRing ring;
+    std::string msg(1000, 'a');
+    int accepted = 0;
+    while (ring.push(Level::Info, 0, msg.data(), msg.size()))
+        accepted++;
+
+    EXPECT_GT(accepted, 0);
+    EXPECT_EQ(1u, ring.dropped.load());
+    EXPECT_EQ((uint64_t)accepted, ring.enqueued.load());
+
+    EXPECT_EQ((size_t)accepted, DrainRing(ring).size());
+    EXPECT_TRUE(ring.push(Level::Info, 0, msg.data(), msg.size()));
+}
+
+TEST(TestLogger, OversizedMessageIsTruncated)
+{
+    LogRing ring;
+    std::string msg(LogRing::Capacity, 'b');
+    ASSERT_TRUE(ring.push(Level::Warn, 0, msg.data(), msg.size()));
+
+    std::vector<std::string> lines = DrainRing(ring);
+    ASSERT_EQ(1u, lines.size());
+    EXPECT_EQ((size_t)LogRing::MaxMessage, lines[0].size());
+    EXPECT_EQ('\n', lines[0].back());
+}
+
+TEST(TestLogger, AsyncWriterWritesEveryThreadInOrder)
+{
+    const std::string path = "test_async_log.txt";
+    std::remove(path.c_str());
+    Logger::set_level(Level::Info);
+    Logger::set_file(path);
+    Logger::start_async();
+    ASSERT_TRUE(Logger::async_enabled());
+
+    const int threads = 3;
+    const int lines = 100;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+        workers.push_back(std::thread([t, lines] {
+            for (int i = 0; i < lines; ++i)
+                LOG_INFO_STREAM("async-test " << t << " " << i);
+        }));
+    for (auto &worker : workers)
+        worker.join();
+
+    Logger::flush();
+    cuckoo_log::AsyncStats stats = Logger::async_stats();
+    Logger::stop_async();
+    Logger::set_file("");
+    EXPECT_FALSE(Logger::async_enabled());
+    EXPECT_EQ(0u, stats.dropped);
+    EXPECT_GE(stats.written, (uint64_t)(threads * lines));
+
+    std::ifstream file(path);
+    std::string line;
+    std::vector<int> next(threads, 0);
+    int count = 0;
+    while (std::getline(file, line))
+    {
+        size_t at = line.find("[INFO] async-test ");
+        if (at == std::string::npos)
+            continue;
+        std::istringstream fields(line.substr(at + 18));
+        int t = -1, i = -1;
+        fields >> t >> i;
+        ASSERT_GE(t, 0);
+        ASSERT_LT(t, threads);
+        EXPECT_EQ(next[t], i);
+        next[t] = i + 1;
+        count++;
+    }
+    EXPECT_EQ(threads * lines, count);
+    std::remove(path.c_str());
+}
+
+TEST(TestLogger, DisabledStatementDoesNotFormat)
+{
+    Logger::set_level(Level::Info);
+    int evaluated = 0;
+    auto count = [&evaluated] { return ++evaluated; };
+
+    LOG_DEBUG_STREAM("skipped " << count());
+    LOG_DEBUG("skipped %d", count());
+    EXPECT_EQ(0, evaluated);
+    EXPECT_FALSE(CUCKOO_LOG_ENABLED(Level::Debug));
+    EXPECT_TRUE(CUCKOO_LOG_ENABLED(Level::Info));
+}
+
+TEST(TestLogger, ModuleLevelOverridesGlobalLevel)
+{
+    Logger::set_level(Level::Warn);
+    const cuckoo_log::ModuleLevel &other = Logger::module("test-other");
+    EXPECT_FALSE(cuckoo_log_module().enabled(Level::Debug));
+    EXPECT_FALSE(other.enabled(Level::Info));
+
+    Logger::set_module_level("test", Level::Debug);
+    EXPECT_TRUE(cuckoo_log_module().enabled(Level::Debug));
+    EXPECT_FALSE(cuckoo_log_module().enabled(Level::Trace));
+    EXPECT_FALSE(other.enabled(Level::Info));
+
+    // an overridden module keeps its level when the global one changes
+    Logger::set_level(Level::Error);
+    EXPECT_TRUE(cuckoo_log_module().enabled(Level::Debug));
+    EXPECT_FALSE(other.enabled(Level::Warn));
+
+    Logger::clear_module_level("test");
+    EXPECT_FALSE(cuckoo_log_module().enabled(Level::Warn));
+    EXPECT_TRUE(cuckoo_log_module().enabled(Level::Error));
+    Logger::set_level(Level::Info);
+}
+
+TEST(TestLogger, LevelsFromEnvironment)
+{
+    setenv("CUCKOO_TEST_LOG_LEVEL", "warn,test-env=trace,test-bad=loud", 1);
+    Logger::set_level_from_env("CUCKOO_TEST_LOG_LEVEL");
+    unsetenv("CUCKOO_TEST_LOG_LEVEL");
+
+    EXPECT_EQ(Level::Warn, Logger::module("test-any").level());
+    EXPECT_EQ(Level::Trace, Logger::module("test-env").level());
+    EXPECT_TRUE(Logger::module("test-env").overridden());
+    EXPECT_FALSE(Logger::module("test-bad").overridden());
+
+    Logger::clear_module_level("test-env");
+    Logger::set_level(Level::Info);
+    EXPECT_EQ(Level::Info, Logger::module("test-env").level());
+}
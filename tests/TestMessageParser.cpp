@@ -106,3 +106,77 @@ TEST(TestMessageParser, ParsesRealWorldExampleStream)
     EXPECT_EQ(out[0].GetMessageCommand(), MessageType::ResponseAscii);
     EXPECT_EQ(out[1].GetMessageCommand(), MessageType::FetPresenceData);
 }
+
+TEST(TestMessageParser, PreambleSplitAcrossSingleByteFeeds)
+{
+    ResponseMessage msg(MessageType::TempHumidityData);
+    msg.SetPayload(vector<uint8_t>{0x11,0x22,0x33,0x44});
+    auto raw = msg.GetRawMessage();
+
+    // A false start that shares the first preamble byte, then the real frame
+    vector<uint8_t> stream = {0xd5, 0xd5, 0xd5, 0x00, 0xd5};
+    stream.insert(stream.end(), raw.begin(), raw.end());
+
+    MessageParser parser;
+    size_t frames = 0;
+    for (uint8_t byte : stream)
+        frames += parser.Feed(&byte, 1).size();
+
+    EXPECT_EQ(1u, frames);
+    EXPECT_EQ(0u, parser.Buffered());
+}
+
+TEST(TestMessageParser, OversizedLengthIsSkippedWithoutWaiting)
+{
+    ResponseMessage good(MessageType::ResponseAscii);
+    good.SetPayload(vector<uint8_t>{'B','R','K'});
+    auto goodRaw = good.GetRawMessage();
+
+    // Preamble with a length far above MaxPayloadLength, followed by a real frame
+    vector<uint8_t> stream = {0xd5, 0xd5, 0xaa, 0x96, 0x01, 0x00, 0xff, 0xff};
+    stream.insert(stream.end(), goodRaw.begin(), goodRaw.end());
+
+    MessageParser parser;
+    auto out = parser.Feed(stream.data(), stream.size());
+    ASSERT_EQ(1u, out.size());
+    EXPECT_EQ(MessageType::ResponseAscii, out[0].GetMessageCommand());
+}
+
+TEST(TestMessageParser, FrameInsideCorruptCandidateIsRecovered)
+{
+    ResponseMessage good(MessageType::PirMotionEvent);
+    good.SetPayload(vector<uint8_t>{0x01, 0x02, 0x03, 0x04});
+    auto goodRaw = good.GetRawMessage();
+
+    // A stray preamble whose length field swallows the real frame that follows
+    vector<uint8_t> stream = {0xd5, 0xd5, 0xaa, 0x96, 0x00, 0x00, 0x10, 0x00};
+    stream.insert(stream.end(), goodRaw.begin(), goodRaw.end());
+    stream.resize(stream.size() + 8, 0x00);
+
+    MessageParser parser;
+    auto out = parser.Feed(stream.data(), stream.size());
+    ASSERT_EQ(1u, out.size());
+    EXPECT_EQ(MessageType::PirMotionEvent, out[0].GetMessageCommand());
+}
+
+TEST(TestMessageParser, NoiseDoesNotGrowTheBuffer)
+{
+    vector<uint8_t> noise(4096);
+    uint32_t state = 12345;
+    for (auto &byte : noise)
+    {
+        state = state * 1103515245u + 12345u;
+        byte = static_cast<uint8_t>(state >> 16);
+    }
+    // Every chunk ends on a partial preamble
+    noise.push_back(0xd5);
+    noise.push_back(0xd5);
+    noise.push_back(0xaa);
+
+    MessageParser parser;
+    for (int i = 0; i < 64; ++i)
+    {
+        parser.Feed(noise.data(), noise.size());
+        EXPECT_LE(parser.Buffered(), MessageParser::MaxFrameLength);
+    }
+}
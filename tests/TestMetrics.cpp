@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <signal.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Metrics.hpp"
+#include "Backplate/MessageParser.hpp"
+#include "Backplate/ResponseMessage.hpp"
+
+TEST(TestMetrics, CounterSumsAcrossThreads)
+{
+    MetricCounter counter;
+    const int threads = 12;
+    const int adds = 10000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+        workers.push_back(std::thread([&counter, adds] {
+            for (int i = 0; i < adds; ++i)
+                counter.Add();
+        }));
+    for (auto &worker : workers)
+        worker.join();
+    EXPECT_EQ(static_cast<uint64_t>(threads * adds), counter.Value());
+}
+
+TEST(TestMetrics, HistogramBucketsCoverTheirBounds)
+{
+    for (uint64_t value : { 0ull, 1ull, 7ull, 8ull, 9ull, 15ull, 16ull, 1000ull, 123456789ull, 1ull << 40 })
+    {
+        int index = MetricHistogram::BucketIndex(value);
+        EXPECT_LE(value, MetricHistogram::BucketUpperBound(index)) << value;
+        if (index > 0)
+        {
+            EXPECT_GT(value, MetricHistogram::BucketUpperBound(index - 1)) << value;
+        }
+    }
+    EXPECT_EQ(MetricHistogram::Buckets - 1, MetricHistogram::BucketIndex(UINT64_MAX));
+}
+
+TEST(TestMetrics, HistogramPercentilesWithinBucketError)
+{
+    MetricHistogram histogram;
+    for (uint64_t value = 1; value <= 10000; ++value)
+        histogram.Record(value);
+
+    MetricHistogram::Snapshot snapshot = histogram.Read();
+    EXPECT_EQ(10000u, snapshot.count);
+    EXPECT_EQ(10000u * 10001u / 2, snapshot.sum);
+    EXPECT_EQ(10000u, snapshot.max);
+    EXPECT_NEAR(5000.0, static_cast<double>(snapshot.Percentile(0.5)), 5000 * 0.125);
+    EXPECT_NEAR(9900.0, static_cast<double>(snapshot.Percentile(0.99)), 9900 * 0.125);
+    EXPECT_EQ(10000u, snapshot.Percentile(1.0));
+}
+
+TEST(TestMetrics, RegistryRendersPrometheusText)
+{
+    Metrics &metrics = Metrics::Instance();
+    metrics.Counter("test_events_total", "Test events").Add(3);
+    metrics.Gauge("test_level", "Test level").Set(-7);
+    metrics.Histogram("test_latency_us", "Test latency").Record(100);
+    // same name, same metric
+    metrics.Counter("test_events_total", "Test events").Add(2);
+    // wrong kind is discarded
+    metrics.Gauge("test_events_total", "Test events").Set(99);
+
+    std::string text = metrics.RenderPrometheus();
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_events_total counter\ntest_events_total 5\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_level gauge\ntest_level -7\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE test_latency_us summary\n"));
+    EXPECT_NE(std::string::npos, text.find("test_latency_us_count 1\n"));
+    EXPECT_NE(std::string::npos, text.find("test_latency_us_max 100\n"));
+}
+
+TEST(TestMetrics, ParserCountsFramesAndErrors)
+{
+    MetricCounter &parsed = Metrics::Instance().Counter("backplate_frames_parsed_total", "");
+    MetricCounter &errors = Metrics::Instance().Counter("backplate_frame_errors_total", "");
+    uint64_t parsed_before = parsed.Value();
+    uint64_t errors_before = errors.Value();
+
+    ResponseMessage msg(MessageType::ResponseAscii);
+    msg.SetPayload(std::vector<uint8_t>{'B', 'R', 'K'});
+    std::vector<uint8_t> good = msg.GetRawMessage();
+    // corrupt the CRC
+    std::vector<uint8_t> bad(good.begin(), good.end());
+    bad[good.size() - 1] = static_cast<uint8_t>(~good[good.size() - 1]);
+
+    MessageParser parser;
+    parser.Feed(good.data(), good.size());
+    parser.Feed(bad.data(), bad.size());
+
+    EXPECT_EQ(parsed_before + 1, parsed.Value());
+    EXPECT_EQ(errors_before + 1, errors.Value());
+}
+
+TEST(TestMetrics, DumpSignalSetsFlagOnce)
+{
+    Metrics &metrics = Metrics::Instance();
+    ASSERT_TRUE(metrics.InstallDumpSignal(SIGUSR1));
+    EXPECT_FALSE(metrics.DumpRequested());
+    raise(SIGUSR1);
+    EXPECT_TRUE(metrics.DumpRequested());
+    EXPECT_FALSE(metrics.DumpRequested());
+    signal(SIGUSR1, SIG_DFL);
+}
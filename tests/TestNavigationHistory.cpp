@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include "NavigationHistory.hpp"
+
+TEST(TestNavigationHistory, PushAndPop)
+{
+    NavigationHistory history;
+    EXPECT_EQ(-1, history.Top());
+
+    history.Push(1);
+    history.Push(2);
+    history.Push(3);
+    EXPECT_EQ(3u, history.Size());
+    EXPECT_EQ(3, history.Top());
+
+    history.Pop();
+    EXPECT_EQ(2, history.Top());
+    EXPECT_TRUE(history.Contains(1));
+    EXPECT_FALSE(history.Contains(3));
+}
+
+TEST(TestNavigationHistory, RevisitingAScreenUnwindsToIt)
+{
+    NavigationHistory history;
+    // Home -> Menu -> Switch -> Home, many times over
+    for (int lap = 0; lap < 1000; ++lap)
+    {
+        history.Push(0);
+        history.Push(1);
+        history.Push(2);
+    }
+    history.Push(0);
+    EXPECT_EQ(1u, history.Size());
+    EXPECT_EQ(0, history.Top());
+
+    // going to the current screen again leaves the history as it is
+    history.Push(0);
+    EXPECT_EQ(1u, history.Size());
+}
+
+TEST(TestNavigationHistory, OldestEntriesAreDroppedPastCapacity)
+{
+    const int capacity = NavigationHistory::Capacity;
+    NavigationHistory history;
+    for (int node = 0; node < capacity + 5; ++node)
+        history.Push(node);
+
+    EXPECT_EQ(static_cast<size_t>(capacity), history.Size());
+    EXPECT_EQ(capacity + 4, history.Top());
+    EXPECT_FALSE(history.Contains(4));
+    EXPECT_TRUE(history.Contains(5));
+
+    for (int i = 1; i < capacity; ++i)
+        history.Pop();
+    EXPECT_EQ(5, history.Top());
+}
+
+TEST(TestNavigationHistory, RemoveIfKeepsTheOrder)
+{
+    NavigationHistory history;
+    for (int node = 1; node <= 5; ++node)
+        history.Push(node);
+
+    history.RemoveIf([](int node) { return node % 2 == 0; });
+    EXPECT_EQ(3u, history.Size());
+    EXPECT_EQ(5, history.Top());
+    history.Pop();
+    EXPECT_EQ(3, history.Top());
+    history.Pop();
+    EXPECT_EQ(1, history.Top());
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "Backplate/PirDetector.hpp"
+#include "Backplate/PirProcessor.hpp"
+#include "Metrics.hpp"
+
+namespace {
+
+// 10 samples a second
+const uint64_t SampleNs = 100000000ull;
+const uint64_t Sec = 1000000000ull;
+
+// A PIR signal sampled at 10 Hz: a DC level with noise, and a swing while someone moves
+class PirSignal
+{
+public:
+    explicit PirSignal(int noise) : noise_(noise) {}
+
+    std::vector<PirSample> Quiet(int count) { return Make(count, 0); }
+    std::vector<PirSample> Motion(int count, int amplitude) { return Make(count, amplitude); }
+
+    uint64_t nowNs = 0;
+
+private:
+    std::vector<PirSample> Make(int count, int amplitude)
+    {
+        std::vector<PirSample> samples;
+        for (int i = 0; i < count; ++i)
+        {
+            state_ = state_ * 1103515245u + 12345u;
+            int noise = static_cast<int>((state_ >> 16) % (2 * noise_ + 1)) - noise_;
+            // half a hertz, well inside the pass band
+            int swing = static_cast<int>(amplitude * std::sin(2 * M_PI * phase_++ / 20.0));
+            nowNs += SampleNs;
+            samples.push_back(PirSample{ nowNs, static_cast<uint16_t>(2048 + noise + swing) });
+        }
+        return samples;
+    }
+
+    int noise_;
+    uint32_t state_ = 1;
+    int phase_ = 0;
+};
+
+// Records what the PIR thread published
+class OccupancyLog
+{
+public:
+    void Add(const Occupancy &occupancy)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        published_.push_back(occupancy);
+        changed_.notify_all();
+    }
+
+    std::vector<Occupancy> WaitFor(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait_for(lock, std::chrono::seconds(2), [&]() { return published_.size() >= count; });
+        return published_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::vector<Occupancy> published_;
+};
+
+} // namespace
+
+TEST(PirDetectorTest, LowPassMatchesScalarIncludingTail)
+{
+    // 37 outputs: several vector blocks plus a ragged tail
+    std::vector<int16_t> x(37 + PirDetector::Taps - 1);
+    for (size_t i = 0; i < x.size(); ++i)
+        x[i] = static_cast<int16_t>((i * 7919u) % 4001u) - 2000;
+
+    std::vector<int16_t> fast(37), reference(37);
+    PirDetector::LowPass(x.data(), fast.data(), fast.size());
+    PirDetector::LowPassScalar(x.data(), reference.data(), reference.size());
+    EXPECT_EQ(reference, fast);
+
+    // Unity gain at DC
+    std::vector<int16_t> constant(8 + PirDetector::Taps - 1, 1000);
+    std::vector<int16_t> out(8);
+    PirDetector::LowPass(constant.data(), out.data(), out.size());
+    EXPECT_EQ(std::vector<int16_t>(8, 1000), out);
+}
+
+TEST(PirDetectorTest, MotionMarksOccupiedUntilTheHoldRunsOut)
+{
+    PirDetector detector(30 * Sec);
+    PirSignal signal(3);
+
+    std::vector<PirSample> quiet = signal.Quiet(300);
+    EXPECT_FALSE(detector.Add(quiet.data(), quiet.size()));
+    EXPECT_FALSE(detector.State().occupied);
+
+    // Someone walks past for a second and a half
+    uint64_t motionStart = signal.nowNs;
+    std::vector<PirSample> motion = signal.Motion(15, 150);
+    EXPECT_TRUE(detector.Add(motion.data(), motion.size()));
+    Occupancy occupied = detector.State();
+    EXPECT_TRUE(occupied.occupied);
+    EXPECT_GT(occupied.sinceNs, motionStart);
+    EXPECT_LE(occupied.sinceNs, motionStart + Sec);
+    EXPECT_GE(occupied.confidence, 50);
+
+    quiet = signal.Quiet(200);
+    EXPECT_FALSE(detector.Add(quiet.data(), quiet.size()));
+    EXPECT_TRUE(detector.State().occupied);
+    EXPECT_LT(detector.State().confidence, occupied.confidence);
+
+    // No samples at all: the hold still runs out
+    EXPECT_TRUE(detector.Expire(detector.State().lastMotionNs + 30 * Sec));
+    EXPECT_FALSE(detector.State().occupied);
+}
+
+TEST(PirDetectorTest, ThresholdFollowsTheNoiseFloor)
+{
+    PirDetector detector;
+    PirSignal signal(60);
+
+    std::vector<PirSample> noisy = signal.Quiet(2000);
+    detector.Add(noisy.data(), noisy.size());
+    EXPECT_FALSE(detector.State().occupied);
+
+    std::vector<PirSample> motion = signal.Motion(20, 600);
+    EXPECT_TRUE(detector.Add(motion.data(), motion.size()));
+}
+
+TEST(PirProcessorTest, PublishesOccupancyFromItsThread)
+{
+    OccupancyLog log;
+    PirSignal signal(3);
+    PirProcessor processor([]() { return Sec; });
+    processor.AddOccupancyCallback([&log](const Occupancy &occupancy) { log.Add(occupancy); });
+    ASSERT_TRUE(processor.Start());
+
+    // As RawAdcData delivers them, one sample per frame
+    for (const PirSample &sample : signal.Quiet(200))
+        processor.Push(sample.value, sample.ns);
+    for (const PirSample &sample : signal.Motion(15, 150))
+        processor.Push(sample.value, sample.ns);
+
+    std::vector<Occupancy> published = log.WaitFor(1);
+    ASSERT_EQ(1u, published.size());
+    EXPECT_TRUE(published[0].occupied);
+    EXPECT_TRUE(processor.GetOccupancy().occupied);
+    processor.Stop();
+}
+
+TEST(PirProcessorTest, PayloadSamplesAreLittleEndianAndOverflowIsDropped)
+{
+    MetricCounter &dropped = Metrics::Instance().Counter("pir_samples_dropped_total", "");
+    uint64_t droppedBefore = dropped.Value();
+
+    int published = 0;
+    PirProcessor processor([]() { return Sec; });
+    processor.AddOccupancyCallback([&published](const Occupancy &) { published++; });
+
+    // Steady at 0x0800, then a square wave between 0x0600 and 0x0a00 with a period of 20 samples
+    std::vector<uint8_t> payload;
+    for (uint32_t i = 0; i < PirProcessor::RingSize + 5; ++i)
+    {
+        uint16_t value = static_cast<uint16_t>(i < 200 ? 0x0800 : (i / 10) % 2 ? 0x0a00 : 0x0600);
+        payload.push_back(static_cast<uint8_t>(value & 0xff));
+        payload.push_back(static_cast<uint8_t>(value >> 8));
+    }
+    processor.Push(payload.data(), payload.size(), Sec);
+    EXPECT_EQ(5u, dropped.Value() - droppedBefore);
+
+    processor.Drain();
+    EXPECT_EQ(1, published);
+    EXPECT_TRUE(processor.GetOccupancy().occupied);
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "HAL/PixelConvert.hpp"
+
+TEST(TestPixelConvert, PrimaryColoursExpandToFullRange)
+{
+    EXPECT_EQ(0xFF000000u, PixelConvert::Rgb565ToXrgb8888(static_cast<uint16_t>(0x0000)));
+    EXPECT_EQ(0xFFFFFFFFu, PixelConvert::Rgb565ToXrgb8888(static_cast<uint16_t>(0xFFFF)));
+    EXPECT_EQ(0xFFFF0000u, PixelConvert::Rgb565ToXrgb8888(static_cast<uint16_t>(0xF800)));
+    EXPECT_EQ(0xFF00FF00u, PixelConvert::Rgb565ToXrgb8888(static_cast<uint16_t>(0x07E0)));
+    EXPECT_EQ(0xFF0000FFu, PixelConvert::Rgb565ToXrgb8888(static_cast<uint16_t>(0x001F)));
+}
+
+TEST(TestPixelConvert, RoundTripPreservesEveryRgb565Value)
+{
+    for (uint32_t v = 0; v <= 0xFFFF; ++v)
+    {
+        uint16_t p = static_cast<uint16_t>(v);
+        ASSERT_EQ(p, PixelConvert::Xrgb8888ToRgb565(PixelConvert::Rgb565ToXrgb8888(p)));
+    }
+}
+
+TEST(TestPixelConvert, RowConversionMatchesScalarIncludingTail)
+{
+    // 37 pixels: several full vector blocks plus a ragged tail
+    std::vector<uint16_t> src(37);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<uint16_t>(i * 1777u + 3u);
+
+    std::vector<uint32_t> fast(src.size(), 0);
+    std::vector<uint32_t> reference(src.size(), 0);
+    PixelConvert::Rgb565ToXrgb8888(src.data(), fast.data(), src.size());
+    PixelConvert::Rgb565ToXrgb8888Scalar(src.data(), reference.data(), src.size());
+
+    EXPECT_EQ(reference, fast);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Metrics.hpp"
+#include "Prewake.hpp"
+
+namespace {
+
+const uint64_t Sec = 1000000ull;
+
+// Records what the refresh thread was asked to fetch
+class RefreshLog
+{
+public:
+    void Add(const std::vector<std::string> &ids)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        refreshed_.push_back(ids);
+        changed_.notify_all();
+    }
+
+    // The refreshes seen once there are count of them, or after a second
+    std::vector<std::vector<std::string>> WaitFor(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait_for(lock, std::chrono::seconds(1), [&]() { return refreshed_.size() >= count; });
+        return refreshed_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::vector<std::vector<std::string>> refreshed_;
+};
+
+} // namespace
+
+TEST(PrewakeTest, ApproachRefreshesWarmedIntegrationsInTheBackground)
+{
+    RefreshLog log;
+    int warms = 0;
+    Prewake prewake(
+        [&warms]() { warms++; return std::vector<std::string>{ "42", "7" }; },
+        [&log](const std::vector<std::string> &ids) { log.Add(ids); });
+    ASSERT_TRUE(prewake.Start());
+
+    EXPECT_TRUE(prewake.OnApproach(100 * Sec));
+    std::vector<std::vector<std::string>> refreshed = log.WaitFor(1);
+    ASSERT_EQ(1u, refreshed.size());
+    EXPECT_EQ((std::vector<std::string>{ "42", "7" }), refreshed[0]);
+
+    // Within the cooldown nothing is warmed or fetched again
+    EXPECT_FALSE(prewake.OnApproach(100 * Sec + Prewake::CooldownUs - 1));
+    EXPECT_TRUE(prewake.OnApproach(100 * Sec + Prewake::CooldownUs));
+    EXPECT_EQ(2, warms);
+    EXPECT_EQ(2u, log.WaitFor(2).size());
+    prewake.Stop();
+}
+
+TEST(PrewakeTest, FirstInputAfterAnApproachIsMeasured)
+{
+    MetricHistogram &approachToInput = Metrics::Instance().Histogram("ui_approach_to_input_us", "");
+    uint64_t before = approachToInput.Read().count;
+
+    Prewake prewake([]() { return std::vector<std::string>(); }, [](const std::vector<std::string> &) {});
+
+    // Input with no approach, and the second input after one, are not counted
+    prewake.OnInput(5 * Sec);
+    prewake.OnApproach(10 * Sec);
+    prewake.OnInput(12 * Sec);
+    prewake.OnInput(13 * Sec);
+    EXPECT_EQ(before + 1, approachToInput.Read().count);
+
+    // Nor is input long after the approach
+    prewake.OnApproach(100 * Sec);
+    prewake.OnInput(100 * Sec + Prewake::InteractionWindowUs + 1);
+    EXPECT_EQ(before + 1, approachToInput.Read().count);
+}
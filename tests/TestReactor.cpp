@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <unistd.h>
+
+#include "Reactor.hpp"
+#include "TimerService.hpp"
+
+TEST(TestReactor, RunsTheHandlerOfAReadableFd)
+{
+    Reactor reactor;
+    ASSERT_TRUE(reactor.IsValid());
+
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    std::string received;
+    ASSERT_TRUE(reactor.Add(fds[0], [&]() {
+        char buffer[16];
+        ssize_t count = read(fds[0], buffer, sizeof(buffer));
+        if (count > 0)
+            received.append(buffer, count);
+    }));
+
+    reactor.RunOnce(0);
+    EXPECT_EQ("", received);
+
+    ASSERT_EQ(2, write(fds[1], "hi", 2));
+    reactor.RunOnce(1000);
+    EXPECT_EQ("hi", received);
+
+    // Once removed the fd is no longer watched
+    reactor.Remove(fds[0]);
+    ASSERT_EQ(1, write(fds[1], "x", 1));
+    reactor.RunOnce(0);
+    EXPECT_EQ("hi", received);
+    EXPECT_FALSE(reactor.Add(-1, []() {}));
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(TestReactor, EventFromAnotherThreadRunsOnTheLoopThread)
+{
+    Reactor reactor;
+    std::thread::id handler_thread;
+    int event_fd = reactor.AddEvent([&]() {
+        handler_thread = std::this_thread::get_id();
+        reactor.Stop();
+    });
+    ASSERT_GE(event_fd, 0);
+
+    std::thread signaller([event_fd]() { Reactor::Signal(event_fd); });
+    reactor.Run();
+    signaller.join();
+
+    EXPECT_EQ(std::this_thread::get_id(), handler_thread);
+    reactor.RemoveEvent(event_fd);
+}
+
+TEST(TestReactor, TimersFireThroughTheirTimerFd)
+{
+    TimerService timers;
+    Reactor reactor;
+    ASSERT_TRUE(reactor.AddTimers(timers));
+
+    int ticks = 0;
+    timers.ScheduleEvery(TimerService::Ms(5), [&]() {
+        if (++ticks == 3)
+            reactor.Stop();
+    });
+
+    uint64_t wakeups = reactor.Wakeups();
+    uint64_t start = TimerService::MonotonicNs();
+    reactor.Run();
+    EXPECT_EQ(3, ticks);
+    EXPECT_GE(TimerService::MonotonicNs() - start, TimerService::Ms(14));
+    // One wakeup per tick, not a polling loop
+    EXPECT_LE(reactor.Wakeups() - wakeups, 6u);
+}
@@ -117,4 +117,33 @@ TEST_F(ScreenManagerTest, ThreeLevelScreenHistory)
     screenManager->GoToPreviousScreen(); // should go to screen1
     
     EXPECT_EQ(mockScreen1->GetRenderCallCount(), 2);
-}
\ No newline at end of file
+}
+TEST_F(ScreenManagerTest, NextScreenLinkIsFollowed)
+{
+    MockScreen* linked = new MockScreen(screenManager, json11::Json::object { {"id", "4"}, {"nextScreen", 2} });
+    screenManager->AddScreen(std::unique_ptr<ScreenBase>(linked));
+
+    screenManager->GoToNextScreen(linked->GetId());
+    screenManager->GoToNextScreen();
+    EXPECT_EQ(mockScreen2, screenManager->GetCurrentScreen());
+    EXPECT_EQ(2u, screenManager->CountHistory());
+}
+
+TEST_F(ScreenManagerTest, NavigationCyclesDoNotGrowHistory)
+{
+    MockScreen* mock_screen3 = new MockScreen();
+    mock_screen3->SetId("3");
+    screenManager->AddScreen(std::unique_ptr<ScreenBase>(mock_screen3));
+
+    for (int lap = 0; lap < 100; ++lap)
+    {
+        screenManager->GoToNextScreen(mockScreen1->GetId());
+        screenManager->GoToNextScreen(mockScreen2->GetId());
+        screenManager->GoToNextScreen(mock_screen3->GetId());
+    }
+    EXPECT_EQ(3u, screenManager->CountHistory());
+
+    screenManager->GoToNextScreen(mockScreen1->GetId());
+    EXPECT_EQ(1u, screenManager->CountHistory());
+    EXPECT_EQ(mockScreen1, screenManager->GetCurrentScreen());
+}
@@ -2,11 +2,13 @@
 #include <fstream>
 #include <iostream>
 
+#include "ConfigurationReader.hpp"
 #include "ScreenManager.hpp"
 #include "Screens/HomeScreen.hpp"
 #include "Screens/MenuScreen.hpp"
 #include "Screens/SwitchScreen.hpp"
 #include "Screens/DimmerScreen.hpp"
+#include "Screens/ScreenFactory.hpp"
 
 class ScreenManagerConfigLoadTest : public ::testing::Test {
 protected:
@@ -234,3 +236,178 @@ TEST_F(ScreenManagerConfigLoadTest, DimmerScreenIntegrationLoaded) {
     ASSERT_NE(ds, nullptr);
     EXPECT_EQ("55", ds->GetIntegrationId());
 }
+
+TEST_F(ScreenManagerConfigLoadTest, ScreensAreBuiltOnFirstUse) {
+    std::ofstream config("test_config.json");
+    config << R"({
+        "screens": [
+            { "id": 1, "name": "HomeScreen", "type": "Home", "nextScreen": 2 },
+            { "id": 2, "name": "MainMenu", "type": "Menu" },
+            { "id": 3, "name": "Porch", "type": "Switch" },
+            { "id": 4, "name": "Mystery", "type": "Mystery" }
+        ]
+    })";
+    config.close();
+
+    screen_manager->LoadScreensFromConfig("test_config.json");
+    EXPECT_EQ(3, screen_manager->CountScreens());
+    EXPECT_EQ(0, screen_manager->CountBuiltScreens());
+
+    ScreenBase* menu_screen = screen_manager->GetScreenById("2");
+    ASSERT_NE(nullptr, menu_screen);
+    EXPECT_EQ(1, screen_manager->CountBuiltScreens());
+    EXPECT_EQ(menu_screen, screen_manager->GetScreenById("2"));
+    EXPECT_EQ(nullptr, screen_manager->GetScreenById("4"));
+}
+
+TEST_F(ScreenManagerConfigLoadTest, FactoryCreatesRegisteredTypes) {
+    EXPECT_TRUE(ScreenFactory::IsRegistered("home"));
+    EXPECT_TRUE(ScreenFactory::IsRegistered("menu"));
+    EXPECT_FALSE(ScreenFactory::IsRegistered("mystery"));
+
+    std::unique_ptr<ScreenBase> dimmer = ScreenFactory::Create("dimmer", screen_manager,
+        json11::Json(json11::Json::object { {"id", "7"}, {"integrationId", "55"} }));
+    ASSERT_NE(nullptr, dynamic_cast<DimmerScreen*>(dimmer.get()));
+    EXPECT_EQ("55", dimmer->GetIntegrationId());
+    EXPECT_EQ(nullptr, ScreenFactory::Create("mystery", screen_manager, json11::Json()));
+}
+
+TEST_F(ScreenManagerConfigLoadTest, IdleScreensOutsideHistoryAreEvicted) {
+    std::ofstream config("test_config.json");
+    config << R"({
+        "screens": [
+            { "id": 1, "name": "HomeScreen", "type": "Home", "nextScreen": 2 },
+            { "id": 2, "name": "MainMenu", "type": "Menu" },
+            { "id": 3, "name": "Porch", "type": "Switch" }
+        ]
+    })";
+    config.close();
+
+    screen_manager->LoadScreensFromConfig("test_config.json");
+    screen_manager->GoToFirstScreen("1");
+    screen_manager->GoToNextScreen("2");
+    screen_manager->GoToNextScreen("3");
+    screen_manager->GoToPreviousScreen();
+    EXPECT_EQ(3, screen_manager->CountBuiltScreens());
+
+    // Home and the menu are in the history; only the switch screen may go
+    uint64_t later = TimerService::MonotonicNs() + TimerService::Sec(60);
+    EXPECT_EQ(0u, screen_manager->EvictIdleScreens(TimerService::Sec(120), later));
+    EXPECT_EQ(1u, screen_manager->EvictIdleScreens(TimerService::Sec(30), later));
+    EXPECT_EQ(2, screen_manager->CountBuiltScreens());
+
+    // and comes back from its definition when navigated to again
+    screen_manager->GoToNextScreen("3");
+    ASSERT_NE(nullptr, dynamic_cast<SwitchScreen*>(screen_manager->GetCurrentScreen()));
+    EXPECT_EQ(3, screen_manager->CountBuiltScreens());
+}
+
+TEST_F(ScreenManagerConfigLoadTest, FirstScreenFallsBackToConfiguredHomeScreen) {
+    std::ofstream config("test_config.json");
+    config << R"({
+        "screens": [
+            { "id": 5, "name": "MainMenu", "type": "Menu" },
+            { "id": 8, "name": "Lounge", "type": "Home" }
+        ]
+    })";
+    config.close();
+
+    screen_manager->LoadScreensFromConfig("test_config.json");
+    screen_manager->GoToFirstScreen();
+
+    ASSERT_NE(nullptr, screen_manager->GetCurrentScreen());
+    EXPECT_EQ("8", screen_manager->GetCurrentScreen()->GetId());
+    EXPECT_EQ(1, screen_manager->CountBuiltScreens());
+}
+
+TEST_F(ScreenManagerConfigLoadTest, DanglingLinksAreReported) {
+    std::ofstream config("test_config.json");
+    config << R"({
+        "firstScreen": 9,
+        "screens": [
+            { "id": 1, "name": "HomeScreen", "type": "Home", "nextScreen": 2 },
+            { "id": 2, "name": "MainMenu", "type": "Menu", "nextScreen": 7,
+              "menuItems": [ { "name": "Porch", "nextScreen": 1 }, { "name": "Garage" } ] }
+        ]
+    })";
+    config.close();
+
+    screen_manager->LoadScreensFromConfig("test_config.json");
+
+    std::vector<std::string> expected = {
+        "firstScreen -> \"9\"",
+        "screen \"2\" nextScreen -> \"7\"",
+        "screen \"2\" menuItems[1] -> \"Garage\"",
+    };
+    EXPECT_EQ(expected, screen_manager->GetDanglingLinks());
+    // unknown targets are not counted as screens
+    EXPECT_EQ(2, screen_manager->CountScreens());
+}
+
+TEST_F(ScreenManagerConfigLoadTest, LinksAreFollowedThroughResolvedNodes) {
+    std::ofstream config("test_config.json");
+    config << R"({
+        "screens": [
+            { "id": 1, "name": "HomeScreen", "type": "Home", "nextScreen": 2 },
+            { "id": 2, "name": "MainMenu", "type": "Menu", "menuItems": [ { "name": "Porch", "nextScreen": 3 } ] },
+            { "id": 3, "name": "Porch", "type": "Switch" }
+        ]
+    })";
+    config.close();
+
+    screen_manager->LoadScreensFromConfig("test_config.json");
+    EXPECT_TRUE(screen_manager->GetDanglingLinks().empty());
+
+    screen_manager->GoToFirstScreen("1");
+    screen_manager->GoToNextScreen();
+    EXPECT_EQ(screen_manager->GetScreenById("2"), screen_manager->GetCurrentScreen());
+
+    int porch = screen_manager->ResolveScreen("3");
+    screen_manager->GoToScreen(porch);
+    EXPECT_EQ(screen_manager->GetScreenById("3"), screen_manager->GetCurrentScreen());
+    EXPECT_EQ(3u, screen_manager->CountHistory());
+}
+
+TEST_F(ScreenManagerConfigLoadTest, LinksUseTheIndexesResolvedAtLoad) {
+    std::ofstream config("test_config.json");
+    config << R"({
+        "screens": [
+            { "id": 1, "name": "HomeScreen", "type": "Home", "nextScreen": 2 },
+            { "id": 2, "name": "MainMenu", "type": "Menu" },
+            { "id": 3, "name": "Porch", "type": "Switch" }
+        ]
+    })";
+    config.close();
+
+    ConfigurationReader reader("test_config.json");
+    ASSERT_TRUE(reader.load());
+    std::vector<ScreenConfig> screens = reader.get_app_config().screens;
+    ASSERT_EQ(1, screens[0].next_screen_index);
+
+    // The link follows the resolved index, not the "nextScreen" text
+    screens[0].next_screen_index = 2;
+    screen_manager->LoadScreens("1", screens);
+    screen_manager->GoToFirstScreen();
+    screen_manager->GoToNextScreen();
+    EXPECT_EQ(screen_manager->GetScreenById("3"), screen_manager->GetCurrentScreen());
+}
+
+TEST_F(ScreenManagerConfigLoadTest, WarmingBuildsTheNextScreen) {
+    std::ofstream config("test_config.json");
+    config << R"({
+        "screens": [
+            { "id": 1, "name": "HomeScreen", "type": "Home", "nextScreen": 2 },
+            { "id": 2, "name": "Porch", "type": "Switch", "integrationId": 42 },
+            { "id": 3, "name": "Hall", "type": "Dimmer", "integrationId": 7 }
+        ]
+    })";
+    config.close();
+
+    screen_manager->LoadScreensFromConfig("test_config.json");
+    EXPECT_TRUE(screen_manager->WarmLikelyScreens().empty());
+
+    screen_manager->GoToFirstScreen("1");
+    EXPECT_EQ(1, screen_manager->CountBuiltScreens());
+    EXPECT_EQ(std::vector<std::string>{ "42" }, screen_manager->WarmLikelyScreens());
+    EXPECT_EQ(2, screen_manager->CountBuiltScreens());
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "Backplate/SensorFilter.hpp"
+
+namespace {
+
+SensorFilterConfig FilterConfig(const std::string &kind)
+{
+    SensorFilterConfig config;
+    config.filter = kind;
+    return config;
+}
+
+} // namespace
+
+TEST(SensorFilterTest, UnknownKindPassesSamplesThrough)
+{
+    SensorFilter filter(FilterConfig("lowpass"), 100);
+    EXPECT_EQ(SensorFilter::Kind::None, filter.GetKind());
+    EXPECT_EQ(2100, filter.Add(2100));
+    EXPECT_EQ(-350, filter.Add(-350));
+}
+
+TEST(SensorFilterTest, EmaStartsAtTheFirstSampleAndConverges)
+{
+    SensorFilterConfig config = FilterConfig("ema");
+    config.alpha = 0.5;
+    SensorFilter filter(config, 100);
+
+    EXPECT_EQ(2000, filter.Add(2000));
+    EXPECT_EQ(2050, filter.Add(2100));
+    EXPECT_EQ(2075, filter.Add(2100));
+    for (int i = 0; i < 20; ++i)
+        filter.Add(2100);
+    EXPECT_EQ(2100, filter.Add(2100));
+
+    filter.Reset();
+    EXPECT_EQ(-500, filter.Add(-500));
+    EXPECT_EQ(-750, filter.Add(-1000));
+}
+
+TEST(SensorFilterTest, MedianDropsASingleSpike)
+{
+    SensorFilterConfig config = FilterConfig("median");
+    config.window = 4;  // rounded up to 5
+    SensorFilter filter(config, 100);
+
+    for (int32_t sample : { 2100, 2101, 2099, 2100 })
+        filter.Add(sample);
+    EXPECT_EQ(2100, filter.Add(2600));
+    EXPECT_EQ(2100, filter.Add(2100));
+    // A real step wins once it fills most of the window
+    filter.Add(2300);
+    EXPECT_EQ(2300, filter.Add(2300));
+}
+
+TEST(SensorFilterTest, KalmanReducesNoise)
+{
+    SensorFilter filter(FilterConfig("kalman"), 100);
+
+    uint32_t state = 12345;
+    int64_t rawError = 0, filteredError = 0;
+    for (int i = 0; i < 2000; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        int32_t sample = 2100 + static_cast<int32_t>((state >> 16) % 21) - 10;
+        int32_t filtered = filter.Add(sample);
+        if (i >= 100)
+        {
+            rawError += std::abs(sample - 2100);
+            filteredError += std::abs(filtered - 2100);
+        }
+    }
+    EXPECT_LT(filteredError * 2, rawError);
+}
+
+TEST(DeadbandGateTest, PassesChangesPastTheDeadbandAndRefreshes)
+{
+    DeadbandGate gate(10, 60);
+
+    EXPECT_TRUE(gate.Pass(2100, 0));
+    EXPECT_FALSE(gate.Pass(2109, 1));
+    EXPECT_FALSE(gate.Pass(2091, 2));
+    EXPECT_TRUE(gate.Pass(2110, 3));
+    EXPECT_EQ(2110, gate.Last());
+    EXPECT_FALSE(gate.Pass(2110, 62));
+    EXPECT_TRUE(gate.Pass(2110, 63));
+
+    DeadbandGate everyChange(0, 0);
+    EXPECT_TRUE(everyChange.Pass(5, 0));
+    EXPECT_FALSE(everyChange.Pass(5, 1000));
+    EXPECT_TRUE(everyChange.Pass(6, 1001));
+}
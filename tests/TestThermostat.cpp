@@ -0,0 +1,365 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "Backplate/BackplateComms.hpp"
+#include "Backplate/CommandMessage.hpp"
+#include "Backplate/ResponseMessage.hpp"
+#include "Metrics.hpp"
+#include "Thermostat/HvacControl.hpp"
+#include "Thermostat/ThermostatController.hpp"
+#include "TimerService.hpp"
+
+namespace {
+
+const uint64_t Sec = 1000000000ull;
+
+ThermostatConfig MakeConfig(const std::string &mode)
+{
+    ThermostatConfig config;
+    config.mode = mode;
+    config.heat_setpoint_c = 20.0;
+    config.cool_setpoint_c = 24.0;
+    config.hysteresis_c = 0.5;
+    config.min_on_seconds = 0;
+    config.min_off_seconds = 0;
+    config.compressor_lockout_seconds = 0;
+    return config;
+}
+
+// Simulated time of day and timer clock
+class SimClock : public IDateTimeProvider
+{
+public:
+    int gettimeofday(struct timeval &tv) override
+    {
+        tv.tv_sec = nowNs / Sec;
+        tv.tv_usec = (nowNs % Sec) / 1000;
+        return 0;
+    }
+    uint64_t monotonic_ns() override { return nowNs; }
+
+    uint64_t nowNs = 1000 * Sec;
+};
+
+/**
+ * A backplate and the room it sits in: FetControl commands switch heating
+ * and cooling, which move the room temperature by a fixed rate while it
+ * drifts towards the outside. The backplate echoes each FetControl it
+ * applies and reports the temperature once a second.
+ */
+class SimulatedBackplate : public ISerialPort
+{
+public:
+    explicit SimulatedBackplate(SimClock &clock) : ISerialPort("simulated"), clock_(clock) {}
+
+    bool Open(BaudRate) override { return true; }
+    void Close() override {}
+    int SendBreak(int) override { return 0; }
+    int Flush() override { return 0; }
+
+    int Read(char *buffer, int bufferSize) override
+    {
+        int n = std::min(bufferSize, static_cast<int>(rx_.size()));
+        std::copy(rx_.begin(), rx_.begin() + n, buffer);
+        rx_.erase(rx_.begin(), rx_.begin() + n);
+        return n;
+    }
+
+    int Write(const std::vector<uint8_t> &data) override
+    {
+        clock_.nowNs += writeDelayNs;
+        CommandMessage command;
+        if (!command.ParseMessage(data.data(), data.size())
+            || command.GetMessageCommand() != MessageType::FetControl
+            || command.GetPayload().empty())
+            return static_cast<int>(data.size());
+
+        fetWrites++;
+        fets = command.GetPayload()[0];
+        if (dropAcks > 0)
+        {
+            dropAcks--;
+            return static_cast<int>(data.size());
+        }
+        ResponseMessage echo(MessageType::FetControl);
+        echo.SetPayload(std::vector<uint8_t>{ fets });
+        Send(echo);
+        return static_cast<int>(data.size());
+    }
+
+    // Advances the room by dtNs and reports the temperature when a second has passed
+    void Step(uint64_t dtNs)
+    {
+        double dt = static_cast<double>(dtNs) / Sec;
+        if (fets & Fet::Heat)
+            roomC += HeatRateCPerSec * dt;
+        if (fets & Fet::Cool)
+            roomC -= CoolRateCPerSec * dt;
+        roomC += (outsideC - roomC) * LeakPerSec * dt;
+
+        sinceReportNs_ += dtNs;
+        if (sinceReportNs_ >= Sec)
+        {
+            sinceReportNs_ = 0;
+            ResponseMessage frame(MessageType::TempHumidityData);
+            int16_t centi = static_cast<int16_t>(roomC * 100.0);
+            frame.SetPayload(std::vector<uint8_t>{ static_cast<uint8_t>(centi & 0xff),
+                static_cast<uint8_t>((centi >> 8) & 0xff), 0xf4, 0x01 });
+            Send(frame);
+        }
+    }
+
+    double roomC = 18.0;
+    double outsideC = 5.0;
+    uint8_t fets = 0;
+    int fetWrites = 0;
+    int dropAcks = 0;
+    uint64_t writeDelayNs = 0;
+
+    static constexpr double HeatRateCPerSec = 0.01;
+    static constexpr double CoolRateCPerSec = 0.01;
+    static constexpr double LeakPerSec = 0.0002;
+
+private:
+    void Send(ResponseMessage &message)
+    {
+        const std::vector<uint8_t> &raw = message.GetRawMessage();
+        rx_.insert(rx_.end(), raw.begin(), raw.end());
+    }
+
+    SimClock &clock_;
+    std::deque<uint8_t> rx_;
+    uint64_t sinceReportNs_ = 0;
+};
+
+class SimulatedComms : public BackplateComms
+{
+public:
+    SimulatedComms(ISerialPort *serialPort, IDateTimeProvider *clock) : BackplateComms(serialPort, clock) {}
+
+    void CompleteHandshake() { handshakeComplete.store(true); }
+    void TaskBodyComms() { BackplateComms::TaskBodyComms(); }
+};
+
+class HvacLoopTest : public ::testing::Test
+{
+protected:
+    HvacLoopTest() : backplate(clock), comms(&backplate, &clock) {}
+
+    // Runs the comms thread's loop every 50 ms of simulated time
+    void Run(uint64_t durationNs)
+    {
+        const uint64_t stepNs = 50000000ull;
+        for (uint64_t t = 0; t < durationNs; t += stepNs)
+        {
+            clock.nowNs += stepNs;
+            backplate.Step(stepNs);
+            comms.TaskBodyComms();
+        }
+    }
+
+    SimClock clock;
+    SimulatedBackplate backplate;
+    SimulatedComms comms;
+};
+
+} // namespace
+
+TEST(ThermostatControllerTest, HeatFollowsTheHysteresisBand)
+{
+    ThermostatController controller(MakeConfig("heat"), 0);
+
+    controller.OnTemperature(19.6f, Sec);
+    EXPECT_EQ(0, controller.Step(Sec));
+    controller.OnTemperature(19.5f, 2 * Sec);
+    EXPECT_EQ(Fet::Heat, controller.Step(2 * Sec));
+    controller.OnTemperature(20.4f, 3 * Sec);
+    EXPECT_EQ(Fet::Heat, controller.Step(3 * Sec));
+    controller.OnTemperature(20.5f, 4 * Sec);
+    EXPECT_EQ(0, controller.Step(4 * Sec));
+}
+
+TEST(ThermostatControllerTest, MinimumTimesHoldTheStage)
+{
+    ThermostatConfig config = MakeConfig("heat");
+    config.min_on_seconds = 60;
+    config.min_off_seconds = 120;
+    ThermostatController controller(config, 0);
+
+    controller.OnTemperature(18.0f, Sec);
+    EXPECT_EQ(Fet::Heat, controller.Step(Sec));
+
+    controller.OnTemperature(22.0f, 2 * Sec);
+    EXPECT_EQ(Fet::Heat, controller.Step(60 * Sec));
+    EXPECT_EQ(0, controller.Step(61 * Sec));
+
+    controller.OnTemperature(18.0f, 62 * Sec);
+    EXPECT_EQ(0, controller.Step(180 * Sec));
+    EXPECT_EQ(Fet::Heat, controller.Step(181 * Sec));
+}
+
+TEST(ThermostatControllerTest, CompressorLockoutCoversStartAndStop)
+{
+    ThermostatConfig config = MakeConfig("cool");
+    config.compressor_lockout_seconds = 300;
+    config.min_off_seconds = 60;
+    ThermostatController controller(config, 0);
+
+    controller.OnTemperature(26.0f, Sec);
+    EXPECT_EQ(0, controller.Step(Sec));
+    EXPECT_EQ(0, controller.Step(299 * Sec));
+    controller.OnTemperature(26.0f, 300 * Sec);
+    EXPECT_EQ(Fet::Cool | Fet::Fan, controller.Step(300 * Sec));
+
+    controller.OnTemperature(23.0f, 400 * Sec);
+    EXPECT_EQ(0, controller.Step(400 * Sec));
+    controller.OnTemperature(26.0f, 500 * Sec);
+    EXPECT_EQ(0, controller.Step(699 * Sec));
+    EXPECT_EQ(Fet::Cool | Fet::Fan, controller.Step(700 * Sec));
+}
+
+TEST(ThermostatControllerTest, StaleReadingOrOffModeDrivesNothing)
+{
+    ThermostatController heat(MakeConfig("heat"), 0);
+    EXPECT_EQ(0, heat.Step(Sec));
+    heat.OnTemperature(15.0f, Sec);
+    EXPECT_EQ(Fet::Heat, heat.Step(Sec));
+    EXPECT_EQ(0, heat.Step(Sec + ThermostatController::SensorTimeoutNs));
+
+    ThermostatController off(MakeConfig("off"), 0);
+    off.OnTemperature(15.0f, Sec);
+    EXPECT_EQ(HvacMode::Off, off.Mode());
+    EXPECT_EQ(0, off.Step(Sec));
+}
+
+TEST_F(HvacLoopTest, SimulatedRoomIsHeldInTheBand)
+{
+    ThermostatConfig config = MakeConfig("heat");
+    config.min_on_seconds = 60;
+    config.min_off_seconds = 60;
+    HvacControl hvac(comms, config);
+    hvac.Start();
+    comms.CompleteHandshake();
+
+    // Warm up from 18 C, then two hours of cycling
+    Run(600 * Sec);
+    int writesBefore = backplate.fetWrites;
+    double lowest = backplate.roomC, highest = backplate.roomC;
+    for (int minute = 0; minute < 120; ++minute)
+    {
+        Run(60 * Sec);
+        lowest = std::min(lowest, backplate.roomC);
+        highest = std::max(highest, backplate.roomC);
+    }
+
+    EXPECT_GT(lowest, 19.0);
+    EXPECT_LT(highest, 21.0);
+    // Each cycle is on and off for at least a minute each
+    EXPECT_LE(backplate.fetWrites - writesBefore, 120);
+    EXPECT_GT(backplate.fetWrites - writesBefore, 2);
+    EXPECT_EQ(backplate.fets, hvac.Controller().Outputs());
+    EXPECT_EQ(static_cast<int>(backplate.fets), comms.GetAckedFetMask());
+}
+
+TEST_F(HvacLoopTest, SteadyReadingInsideTheDeadbandStaysFresh)
+{
+    // Only the first frame is published; the rest fall inside the deadband and never repeat
+    SensorsConfig sensors;
+    sensors.temperature.filter = "none";
+    sensors.temperature.deadband = 10.0;
+    sensors.temperature.refresh_seconds = 0;
+    comms.SetSensorFilters(sensors);
+    HvacControl hvac(comms, MakeConfig("heat"));
+    hvac.Start();
+    comms.CompleteHandshake();
+    backplate.roomC = 15.0;
+
+    Run(ThermostatController::SensorTimeoutNs + 60 * Sec);
+    EXPECT_LT(backplate.roomC, 19.5);
+    EXPECT_EQ(Fet::Heat, backplate.fets);
+    EXPECT_EQ(Fet::Heat, hvac.Controller().Outputs());
+}
+
+TEST_F(HvacLoopTest, NothingIsActuatedBeforeTheHandshake)
+{
+    HvacControl hvac(comms, MakeConfig("heat"));
+    hvac.Start();
+
+    Run(5 * Sec);
+    EXPECT_EQ(0, backplate.fetWrites);
+
+    comms.CompleteHandshake();
+    Run(2 * Sec);
+    EXPECT_EQ(1, backplate.fetWrites);
+    EXPECT_EQ(Fet::Heat, backplate.fets);
+}
+
+TEST_F(HvacLoopTest, UnacknowledgedFetCommandIsResent)
+{
+
+    HvacControl hvac(comms, MakeConfig("heat"));
+    hvac.Start();
+    comms.CompleteHandshake();
+    Run(2 * Sec);
+    ASSERT_EQ(Fet::Heat, comms.GetAckedFetMask());
+
+    MetricCounter &timeouts = Metrics::Instance().Counter("backplate_fet_ack_timeouts_total", "");
+    uint64_t timeoutsBefore = timeouts.Value();
+    int writesBefore = backplate.fetWrites;
+    backplate.dropAcks = 2;
+    backplate.roomC = 22.0;
+    Run(6 * Sec);
+    EXPECT_EQ(3, backplate.fetWrites - writesBefore);
+    EXPECT_EQ(2u, timeouts.Value() - timeoutsBefore);
+    EXPECT_EQ(0, comms.GetAckedFetMask());
+}
+
+TEST_F(HvacLoopTest, FetCommandGivenUpOnIsWrittenAgain)
+{
+    HvacControl hvac(comms, MakeConfig("heat"));
+    hvac.Start();
+    comms.CompleteHandshake();
+    Run(2 * Sec);
+    ASSERT_EQ(Fet::Heat, comms.GetAckedFetMask());
+
+    // "All off" is never echoed: BackplateComms gives up after its attempts, then the
+    // control loop keeps writing it
+    int writesBefore = backplate.fetWrites;
+    backplate.dropAcks = 1000;
+    backplate.roomC = 22.0;
+    Run(5 * Sec);
+    EXPECT_GT(backplate.fetWrites - writesBefore, 4);
+    EXPECT_EQ(Fet::Heat, comms.GetAckedFetMask());
+    EXPECT_EQ(0, hvac.Controller().Outputs());
+
+    // Once an echo gets through the writes stop
+    backplate.dropAcks = 0;
+    Run(2 * Sec);
+    EXPECT_EQ(0, comms.GetAckedFetMask());
+    int writesSettled = backplate.fetWrites;
+    Run(5 * Sec);
+    EXPECT_EQ(writesSettled, backplate.fetWrites);
+}
+
+TEST_F(HvacLoopTest, SlowFetWriteCountsAsLate)
+{
+    MetricCounter &late = Metrics::Instance().Counter("hvac_actuation_late_total", "");
+    MetricHistogram &latency = Metrics::Instance().Histogram("hvac_actuation_latency_us", "");
+    uint64_t lateBefore = late.Value();
+    uint64_t recordedBefore = latency.Read().count;
+
+    ThermostatConfig config = MakeConfig("heat");
+    config.control_period_ms = 100;
+    HvacControl hvac(comms, config);
+    hvac.Start();
+    comms.CompleteHandshake();
+    backplate.writeDelayNs = 150000000ull;
+
+    Run(2 * Sec);
+    EXPECT_EQ(1u, latency.Read().count - recordedBefore);
+    EXPECT_EQ(1u, late.Value() - lateBefore);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+
+#include "TimerService.hpp"
+
+class TestTimerService : public ::testing::Test
+{
+protected:
+    TestTimerService() : timers([this]() { return now; }) {}
+
+    uint64_t now = 1000;
+    TimerService timers;
+};
+
+TEST_F(TestTimerService, OneShotRunsOnceAtItsDeadline)
+{
+    int runs = 0;
+    timers.ScheduleAfter(500, [&runs]() { runs++; });
+
+    now = 1499;
+    EXPECT_EQ(0, timers.RunExpired());
+    now = 1500;
+    EXPECT_EQ(1, timers.RunExpired());
+    now = 5000;
+    EXPECT_EQ(0, timers.RunExpired());
+    EXPECT_EQ(1, runs);
+    EXPECT_EQ(TimerService::NoDeadline, timers.NextDeadline());
+    EXPECT_EQ(-1, timers.TimeoutMs());
+}
+
+TEST_F(TestTimerService, RunsInDeadlineOrder)
+{
+    std::vector<std::string> order;
+    timers.ScheduleAfter(300, [&order]() { order.push_back("c"); });
+    timers.ScheduleAfter(100, [&order]() { order.push_back("a"); });
+    timers.ScheduleAfter(200, [&order]() { order.push_back("b"); });
+    timers.ScheduleAfter(200, [&order]() { order.push_back("b2"); });
+
+    EXPECT_EQ(1100u, timers.NextDeadline());
+    now = 2000;
+    EXPECT_EQ(4, timers.RunExpired());
+    EXPECT_EQ((std::vector<std::string>{ "a", "b", "b2", "c" }), order);
+}
+
+TEST_F(TestTimerService, PeriodicTimerKeepsItsPhaseAndSkipsMissedPeriods)
+{
+    int runs = 0;
+    TimerService::TimerId id = timers.ScheduleEvery(100, [&runs]() { runs++; });
+
+    now = 1130;
+    timers.RunExpired();
+    EXPECT_EQ(1, runs);
+    // Ran 30 late, next deadline stays on the 100 grid
+    EXPECT_EQ(1200u, timers.NextDeadline());
+
+    // A long stall runs the timer once, not once per missed period
+    now = 1750;
+    timers.RunExpired();
+    EXPECT_EQ(2, runs);
+    EXPECT_EQ(1800u, timers.NextDeadline());
+
+    EXPECT_TRUE(timers.Cancel(id));
+    EXPECT_FALSE(timers.IsScheduled(id));
+    now = 5000;
+    EXPECT_EQ(0, timers.RunExpired());
+}
+
+TEST_F(TestTimerService, RescheduleAndCancel)
+{
+    int runs = 0;
+    TimerService::TimerId id = timers.ScheduleAfter(100, [&runs]() { runs++; });
+
+    now = 1050;
+    EXPECT_TRUE(timers.Reschedule(id, 100));
+    EXPECT_EQ(1150u, timers.NextDeadline());
+    now = 1100;
+    EXPECT_EQ(0, timers.RunExpired());
+    now = 1150;
+    EXPECT_EQ(1, timers.RunExpired());
+    EXPECT_FALSE(timers.Reschedule(id, 100));
+    EXPECT_FALSE(timers.Cancel(id));
+    EXPECT_FALSE(timers.Cancel(0));
+    EXPECT_EQ(1, runs);
+}
+
+TEST_F(TestTimerService, CallbacksCanScheduleAndCancel)
+{
+    int runs = 0;
+    TimerService::TimerId other = timers.ScheduleAfter(200, [&runs]() { runs += 100; });
+    timers.ScheduleAfter(100, [this, &runs, other]() {
+        runs++;
+        timers.Cancel(other);
+        timers.ScheduleAfter(50, [&runs]() { runs++; });
+    });
+
+    now = 1300;
+    timers.RunExpired();
+    EXPECT_EQ(1, runs);
+    EXPECT_EQ(1350u, timers.NextDeadline());
+    now = 1350;
+    timers.RunExpired();
+    EXPECT_EQ(2, runs);
+}
+
+TEST(TestTimerServiceClock, TimerFdBecomesReadableAtTheDeadline)
+{
+    TimerService timers;
+    int fd = timers.Fd();
+    ASSERT_GE(fd, 0);
+
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    EXPECT_EQ(0, poll(&pfd, 1, 0));
+
+    bool ran = false;
+    timers.ScheduleAfter(TimerService::Ms(20), [&ran]() { ran = true; });
+    EXPECT_GT(timers.TimeoutMs(), 0);
+    EXPECT_LE(timers.TimeoutMs(), 20);
+
+    uint64_t start = TimerService::MonotonicNs();
+    ASSERT_EQ(1, poll(&pfd, 1, 1000));
+    EXPECT_GE(TimerService::MonotonicNs() - start, TimerService::Ms(15));
+    EXPECT_EQ(1, timers.RunExpired());
+    EXPECT_TRUE(ran);
+
+    // Nothing left: the fd is disarmed and quiet again
+    EXPECT_EQ(0, poll(&pfd, 1, 0));
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <json11.hpp>
+
+#undef CUCKOO_TRACE
+#define CUCKOO_TRACE 1
+#include "trace.h"
+
+using cuckoo_trace::SpanRecord;
+using cuckoo_trace::TraceRing;
+using cuckoo_trace::Tracer;
+
+static const uint32_t RingCapacity = TraceRing::Capacity;
+
+TEST(TestTrace, SpansAreExportedAsChromeTrace)
+{
+    std::thread worker([] {
+        TRACE_THREAD_NAME("test-worker");
+        TRACE_SCOPE("test-outer");
+        {
+            TRACE_SCOPE("test-inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    worker.join();
+
+    std::ostringstream out;
+    Tracer::write_chrome_json(out);
+    std::string error;
+    json11::Json trace = json11::Json::parse(out.str(), error);
+    ASSERT_TRUE(error.empty()) << error;
+
+    int tid = -1;
+    json11::Json outer, inner;
+    for (const auto &event : trace["traceEvents"].array_items())
+    {
+        if (event["ph"].string_value() == "M" && event["args"]["name"].string_value() == "test-worker")
+            tid = event["tid"].int_value();
+        if (event["name"].string_value() == "test-outer")
+            outer = event;
+        if (event["name"].string_value() == "test-inner")
+            inner = event;
+    }
+
+    ASSERT_NE(-1, tid);
+    ASSERT_TRUE(outer.is_object());
+    ASSERT_TRUE(inner.is_object());
+    EXPECT_EQ("X", outer["ph"].string_value());
+    EXPECT_EQ(tid, outer["tid"].int_value());
+    EXPECT_EQ(tid, inner["tid"].int_value());
+    EXPECT_GE(inner["dur"].number_value(), 1000.0);
+    EXPECT_LE(outer["ts"].number_value(), inner["ts"].number_value());
+    EXPECT_GE(outer["ts"].number_value() + outer["dur"].number_value(),
+              inner["ts"].number_value() + inner["dur"].number_value());
+}
+
+TEST(TestTrace, RingKeepsNewestSpans)
+{
+    TraceRing *ring = new TraceRing();
+    for (uint32_t i = 0; i < RingCapacity + 10; ++i)
+        ring->record("test-span", i * 1000, i * 1000 + 500);
+
+    std::vector<SpanRecord> spans;
+    Tracer::read(*ring, spans);
+    ASSERT_EQ(RingCapacity - 1, spans.size());
+    EXPECT_EQ(11000u, spans.front().begin_ns);
+    EXPECT_EQ((RingCapacity + 9) * 1000ull, spans.back().begin_ns);
+    delete ring;
+}
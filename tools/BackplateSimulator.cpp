@@ -0,0 +1,409 @@
+#include "BackplateSimulator.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace {
+
+const uint8_t CommandPreamble[3] = { 0xd5, 0xaa, 0x96 };
+// Preamble, command, length
+const size_t CommandHeaderLength = 3 + 2 + 2;
+const size_t MaxCommandPayload = 1024;
+// Longest poll, so Stop() is noticed
+const int MaxPollMs = 50;
+
+void PutU16(std::vector<uint8_t> &out, size_t at, uint32_t value)
+{
+    out[at] = static_cast<uint8_t>(value & 0xff);
+    out[at + 1] = static_cast<uint8_t>((value >> 8) & 0xff);
+}
+
+} // namespace
+
+BackplateSimulator::BackplateSimulator(const BackplateSimulatorOptions &options)
+    : options_(options)
+    , random_(options.seed)
+{
+    for (int i = 0; i < SentHistory; ++i)
+    {
+        sentNs_[i].store(0);
+        sentSequence_[i].store(0);
+    }
+}
+
+BackplateSimulator::~BackplateSimulator()
+{
+    Stop();
+}
+
+bool BackplateSimulator::Start()
+{
+    if (running_.load())
+        return true;
+
+    masterFd_ = posix_openpt(O_RDWR | O_NOCTTY);
+    char name[128];
+    if (masterFd_ < 0 || grantpt(masterFd_) != 0 || unlockpt(masterFd_) != 0
+        || ptsname_r(masterFd_, name, sizeof(name)) != 0)
+    {
+        std::fprintf(stderr, "BackplateSimulator: cannot create a pty: %s\n", std::strerror(errno));
+        Stop();
+        return false;
+    }
+    slavePath_ = name;
+
+    // Kept open so the master does not see a hangup while the host reopens the
+    // port, and raw so nothing the device sends is echoed back to it
+    slaveFd_ = ::open(name, O_RDWR | O_NOCTTY);
+    struct termios tty;
+    if (slaveFd_ < 0 || tcgetattr(slaveFd_, &tty) != 0)
+    {
+        std::fprintf(stderr, "BackplateSimulator: cannot open %s: %s\n", name, std::strerror(errno));
+        Stop();
+        return false;
+    }
+    cfmakeraw(&tty);
+    tcsetattr(slaveFd_, TCSANOW, &tty);
+    fcntl(masterFd_, F_SETFL, fcntl(masterFd_, F_GETFL) | O_NONBLOCK);
+
+    startNs_ = timers_.Now();
+    if (options_.stall_seconds > 0 && options_.stall_ms > 0)
+    {
+        timers_.ScheduleEvery(TimerService::Sec(options_.stall_seconds), [this]() {
+            stalledUntilNs_ = timers_.Now() + TimerService::Ms(options_.stall_ms);
+            stalls_++;
+        });
+    }
+
+    running_.store(true);
+    thread_ = std::thread([this]() { Run(); });
+    return true;
+}
+
+void BackplateSimulator::Stop()
+{
+    running_.store(false);
+    if (thread_.joinable())
+        thread_.join();
+    if (slaveFd_ >= 0)
+        ::close(slaveFd_);
+    if (masterFd_ >= 0)
+        ::close(masterFd_);
+    slaveFd_ = -1;
+    masterFd_ = -1;
+}
+
+BackplateSimulator::Stats BackplateSimulator::GetStats() const
+{
+    Stats stats;
+    stats.framesSent = framesSent_.load();
+    stats.bytesSent = bytesSent_.load();
+    stats.framesDropped = framesDropped_.load();
+    stats.framesCorrupted = framesCorrupted_.load();
+    stats.commandsReceived = commandsReceived_.load();
+    stats.bytesReceived = bytesReceived_.load();
+    stats.handshakes = handshakes_.load();
+    stats.stalls = stalls_.load();
+    stats.adcFramesSent = adcSequence_.load();
+    return stats;
+}
+
+uint64_t BackplateSimulator::SentNs(uint32_t sequence) const
+{
+    int slot = sequence % SentHistory;
+    uint64_t ns = sentNs_[slot].load();
+    return sentSequence_[slot].load() == sequence ? ns : 0;
+}
+
+uint32_t BackplateSimulator::AdcSequence(const uint8_t *payload, size_t length)
+{
+    if (payload == nullptr || length < 6)
+        return 0;
+    return static_cast<uint32_t>(payload[2]) | (static_cast<uint32_t>(payload[3]) << 8)
+        | (static_cast<uint32_t>(payload[4]) << 16) | (static_cast<uint32_t>(payload[5]) << 24);
+}
+
+void BackplateSimulator::Run()
+{
+    while (running_.load())
+    {
+        uint64_t now = timers_.Now();
+        bool stalled = now < stalledUntilNs_;
+        int timeout = timers_.TimeoutMs();
+        if (timeout < 0 || timeout > MaxPollMs)
+            timeout = MaxPollMs;
+        if (stalled)
+            timeout = std::min<int>(timeout, static_cast<int>((stalledUntilNs_ - now) / 1000000) + 1);
+
+        struct pollfd pfd = { masterFd_, POLLIN, 0 };
+        if (!tx_.empty() && !stalled)
+            pfd.events |= POLLOUT;
+        if (poll(&pfd, 1, timeout) > 0 && (pfd.revents & POLLIN))
+            ReadCommands();
+
+        timers_.RunExpired();
+        FlushTx();
+    }
+}
+
+void BackplateSimulator::ReadCommands()
+{
+    uint8_t buffer[512];
+    ssize_t n;
+    while ((n = ::read(masterFd_, buffer, sizeof(buffer))) > 0)
+    {
+        bytesReceived_ += static_cast<uint64_t>(n);
+        rx_.insert(rx_.end(), buffer, buffer + n);
+    }
+
+    while (true)
+    {
+        auto start = std::search(rx_.begin(), rx_.end(), CommandPreamble, CommandPreamble + 3);
+        rx_.erase(rx_.begin(), start);
+        if (rx_.size() < CommandHeaderLength)
+            return;
+
+        size_t length = rx_[5] | (rx_[6] << 8);
+        if (length > MaxCommandPayload)
+        {
+            rx_.erase(rx_.begin());
+            continue;
+        }
+        size_t total = CommandHeaderLength + length + 2;
+        if (rx_.size() < total)
+            return;
+
+        CommandMessage command;
+        if (command.ParseMessage(rx_.data(), total))
+        {
+            commandsReceived_++;
+            rx_.erase(rx_.begin(), rx_.begin() + total);
+            HandleCommand(command);
+        }
+        else
+            rx_.erase(rx_.begin());
+    }
+}
+
+void BackplateSimulator::HandleCommand(CommandMessage &command)
+{
+    switch (command.GetMessageCommand())
+    {
+        case MessageType::Reset:
+            // The burst the real backplate sends after a reset, ending with BRK
+            StopStreams();
+            handshakes_++;
+            SendAscii(MessageType::ResponseAscii, "TFE simulated backplate");
+            SendAscii(MessageType::ResponseAscii, "reset cause: host");
+            Send(MessageType::FetPresenceData, std::vector<uint8_t>{ 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00 });
+            SendAscii(MessageType::ResponseAscii, "BRK");
+            break;
+
+        case MessageType::FetPresenceAck:
+            StartStreams();
+            break;
+
+        case MessageType::GetTfeVersion:
+            SendAscii(MessageType::TfeVersion, "2.0.0-sim");
+            break;
+
+        case MessageType::GetTfeBuildInfo:
+            SendAscii(MessageType::TfeBuildInfo, "cuckoo_backplate_sim");
+            break;
+
+        case MessageType::GetBackplateModelAndBslId:
+            Send(MessageType::BackplateModelAndBslId, std::vector<uint8_t>{ 0x02, 0x00, 0x01, 0x00 });
+            break;
+
+        case MessageType::PeriodicStatusRequest:
+            Send(MessageType::BackplateState, std::vector<uint8_t>(8, 0));
+            break;
+
+        case MessageType::GetHistoricalDataBuffers:
+            for (int i = 0; i < options_.historical_buffers; ++i)
+            {
+                std::vector<uint8_t> record(16, 0);
+                PutU16(record, 0, static_cast<uint32_t>(i));
+                PutU16(record, 2, static_cast<uint32_t>(roomC_ * 100));
+                PutU16(record, 4, 450);
+                Send(MessageType::BufferedSensorData, record);
+            }
+            Send(MessageType::EndOfBuffersMessage, std::vector<uint8_t>());
+            break;
+
+        case MessageType::FetControl:
+            if (!command.GetPayload().empty())
+                fets_ = command.GetPayload()[0];
+            Send(MessageType::FetControl, std::vector<uint8_t>{ fets_ });
+            break;
+
+        default:
+            break;
+    }
+}
+
+void BackplateSimulator::StartStreams()
+{
+    if (streaming_.load())
+        return;
+    streaming_.store(true);
+
+    auto every = [this](double hz, std::function<void()> send) {
+        if (hz > 0)
+            streamTimers_.push_back(timers_.ScheduleEvery(static_cast<uint64_t>(1e9 / hz), send));
+    };
+    every(options_.temperature_hz, [this]() { SendTemperature(); });
+    every(options_.adc_hz, [this]() { SendAdc(); });
+    every(options_.pir_raw_hz, [this]() { SendPirRaw(); });
+    every(options_.proximity_hz, [this]() { SendProximity(); });
+    if (options_.motion_seconds > 0)
+    {
+        streamTimers_.push_back(timers_.ScheduleEvery(TimerService::Sec(options_.motion_seconds), [this]() {
+            OnMotionEdge(true);
+            motionEndTimer_ = timers_.ScheduleAfter(TimerService::Sec(options_.motion_length_seconds),
+                [this]() { OnMotionEdge(false); });
+        }));
+    }
+}
+
+void BackplateSimulator::StopStreams()
+{
+    for (TimerService::TimerId id : streamTimers_)
+        timers_.Cancel(id);
+    streamTimers_.clear();
+    timers_.Cancel(motionEndTimer_);
+    motionUntilNs_ = 0;
+    streaming_.store(false);
+}
+
+void BackplateSimulator::Send(MessageType type, const std::vector<uint8_t> &payload)
+{
+    ResponseMessage message(type);
+    message.SetPayload(payload);
+    std::vector<uint8_t> frame = message.GetRawMessage();
+
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    if (options_.junk_rate > 0 && chance(random_) < options_.junk_rate)
+    {
+        std::vector<uint8_t> junk(1 + random_() % 8);
+        for (uint8_t &b : junk)
+            b = static_cast<uint8_t>(random_());
+        frame.insert(frame.begin(), junk.begin(), junk.end());
+    }
+    if (options_.corrupt_rate > 0 && chance(random_) < options_.corrupt_rate)
+    {
+        // Past the preamble, so the host sees a frame with a bad CRC
+        frame[4 + random_() % (frame.size() - 4)] ^= static_cast<uint8_t>(1 + random_() % 255);
+        framesCorrupted_++;
+    }
+
+    if (tx_.size() + frame.size() > MaxTxQueue)
+    {
+        framesDropped_++;
+        return;
+    }
+    tx_.insert(tx_.end(), frame.begin(), frame.end());
+    framesSent_++;
+    FlushTx();
+}
+
+void BackplateSimulator::FlushTx()
+{
+    if (tx_.empty() || timers_.Now() < stalledUntilNs_)
+        return;
+    ssize_t n = ::write(masterFd_, tx_.data(), tx_.size());
+    if (n > 0)
+    {
+        bytesSent_ += static_cast<uint64_t>(n);
+        tx_.erase(tx_.begin(), tx_.begin() + n);
+    }
+}
+
+void BackplateSimulator::SendAscii(MessageType type, const std::string &text)
+{
+    Send(type, std::vector<uint8_t>(text.begin(), text.end()));
+}
+
+void BackplateSimulator::SendTemperature()
+{
+    // Heating and cooling move the room a little each frame
+    if (fets_ & 0x01)
+        roomC_ += 0.01;
+    if (fets_ & 0x02)
+        roomC_ -= 0.01;
+
+    std::vector<uint8_t> payload(4);
+    PutU16(payload, 0, static_cast<uint32_t>(static_cast<int>(roomC_ * 100) + static_cast<int>(random_() % 7) - 3));
+    PutU16(payload, 2, 450 + random_() % 11 - 5);
+    Send(MessageType::TempHumidityData, payload);
+}
+
+int BackplateSimulator::MotionAmplitude(uint64_t nowNs) const
+{
+    if (nowNs >= motionUntilNs_)
+        return 0;
+    // Half a hertz, as a person walking past a PIR lens
+    double t = static_cast<double>(nowNs - startNs_) / 1e9;
+    return static_cast<int>(150 * std::sin(2 * M_PI * 0.5 * t));
+}
+
+void BackplateSimulator::SendAdc()
+{
+    uint64_t now = timers_.Now();
+    std::vector<uint8_t> payload(14, 0);
+    PutU16(payload, 0, static_cast<uint32_t>(2048 + MotionAmplitude(now) + static_cast<int>(random_() % 9) - 4));
+    uint32_t sequence = adcSequence_.load() + 1;
+    PutU16(payload, 2, sequence & 0xffff);
+    PutU16(payload, 4, sequence >> 16);
+    PutU16(payload, 10, 300);
+    PutU16(payload, 12, 500);
+
+    int slot = sequence % SentHistory;
+    sentNs_[slot].store(now);
+    sentSequence_[slot].store(sequence);
+    adcSequence_.store(sequence);
+    Send(MessageType::RawAdcData, payload);
+}
+
+void BackplateSimulator::SendPirRaw()
+{
+    uint64_t now = timers_.Now();
+    int count = std::max(1, options_.pir_raw_samples);
+    uint64_t spacingNs = static_cast<uint64_t>(1e9 / options_.pir_raw_hz) / count;
+    std::vector<uint8_t> payload(2 * count);
+    for (int i = 0; i < count; ++i)
+    {
+        uint64_t at = now - (count - 1 - i) * spacingNs;
+        PutU16(payload, 2 * i, static_cast<uint32_t>(2048 + MotionAmplitude(at) + static_cast<int>(random_() % 9) - 4));
+    }
+    Send(MessageType::PirDataRaw, payload);
+}
+
+void BackplateSimulator::SendProximity()
+{
+    uint32_t value = timers_.Now() < motionUntilNs_ ? 10 + random_() % 5 : random_() % 2;
+    std::vector<uint8_t> payload(2);
+    PutU16(payload, 0, value);
+    Send(MessageType::ProxSensor, payload);
+}
+
+void BackplateSimulator::OnMotionEdge(bool started)
+{
+    if (started)
+        motionUntilNs_ = timers_.Now() + TimerService::Sec(options_.motion_length_seconds);
+    std::vector<uint8_t> payload(4, 0);
+    if (started)
+    {
+        PutU16(payload, 0, 1);
+        PutU16(payload, 2, 1);
+    }
+    Send(MessageType::PirMotionEvent, payload);
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+#include "Backplate/CommandMessage.hpp"
+#include "Backplate/ResponseMessage.hpp"
+#include "TimerService.hpp"
+
+struct BackplateSimulatorOptions
+{
+    // Frames per second of each stream once the handshake is done; 0 turns one off
+    double temperature_hz = 1.0;
+    double adc_hz = 10.0;
+    double pir_raw_hz = 2.0;
+    int pir_raw_samples = 16;
+    double proximity_hz = 2.0;
+    // Someone walks past every motion_seconds for motion_length_seconds
+    int motion_seconds = 30;
+    int motion_length_seconds = 3;
+    // BufferedSensorData frames answering GetHistoricalDataBuffers
+    int historical_buffers = 8;
+
+    // Chance per frame of a flipped byte, and of junk bytes before it
+    double corrupt_rate = 0.0;
+    double junk_rate = 0.0;
+    // The line goes quiet for stall_ms every stall_seconds
+    int stall_seconds = 0;
+    int stall_ms = 0;
+
+    uint32_t seed = 1;
+};
+
+/**
+ * @brief The backplate side of the serial protocol, on a pseudo-terminal
+ *
+ * Start() creates a pty pair and runs the device on its own thread: a Reset
+ * command is answered with the burst (ASCII lines, FetPresenceData and
+ * "BRK"), the Get* info commands with their responses, FetControl with its
+ * echo and GetHistoricalDataBuffers with BufferedSensorData frames and
+ * EndOfBuffersMessage. Once the FET presence data is acknowledged it streams
+ * TempHumidityData, RawAdcData, PirDataRaw and ProxSensor frames at the
+ * configured rates, with PirMotionEvent around each simulated walk past.
+ *
+ * The host side opens SlavePath() like the real /dev/ttyO2, so UnixSerialPort
+ * and BackplateComms run unmodified. Bytes 2..5 of each RawAdcData payload,
+ * channels the host ignores, carry a sequence number; SentNs() gives when
+ * that frame was written, for measuring delivery latency.
+ *
+ * Frames wait while the line is stalled or the pty buffer is full. Past
+ * MaxTxQueue bytes they are dropped and counted, as a UART without flow
+ * control would lose them.
+ */
+class BackplateSimulator
+{
+public:
+    explicit BackplateSimulator(const BackplateSimulatorOptions &options);
+    ~BackplateSimulator();
+
+    bool Start();
+    void Stop();
+
+    inline const std::string &SlavePath() const { return slavePath_; }
+    inline bool IsStreaming() const { return streaming_.load(); }
+
+    struct Stats
+    {
+        uint64_t framesSent = 0;
+        uint64_t bytesSent = 0;
+        uint64_t framesDropped = 0;
+        uint64_t framesCorrupted = 0;
+        uint64_t commandsReceived = 0;
+        uint64_t bytesReceived = 0;
+        uint64_t handshakes = 0;
+        uint64_t stalls = 0;
+        uint64_t adcFramesSent = 0;
+    };
+    Stats GetStats() const;
+
+    // When the RawAdcData frame with this sequence number was written, 0 if it
+    // was not or has been overwritten since
+    uint64_t SentNs(uint32_t sequence) const;
+    static uint32_t AdcSequence(const uint8_t *payload, size_t length);
+
+    static const int SentHistory = 4096;
+    // Bytes held while the line is stalled or the pty is full; more are dropped
+    static const size_t MaxTxQueue = 65536;
+
+private:
+    void Run();
+    void ReadCommands();
+    void HandleCommand(CommandMessage &command);
+    void StartStreams();
+    void StopStreams();
+    void Send(MessageType type, const std::vector<uint8_t> &payload);
+    void FlushTx();
+    void SendAscii(MessageType type, const std::string &text);
+
+    void SendTemperature();
+    void SendAdc();
+    void SendPirRaw();
+    void SendProximity();
+    // Height of the PIR swing at now, 0 when nobody is walking past
+    int MotionAmplitude(uint64_t nowNs) const;
+    void OnMotionEdge(bool started);
+
+    BackplateSimulatorOptions options_;
+    int masterFd_ = -1;
+    int slaveFd_ = -1;
+    std::string slavePath_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> streaming_{false};
+
+    // Sim thread only
+    TimerService timers_;
+    std::vector<TimerService::TimerId> streamTimers_;
+    TimerService::TimerId motionEndTimer_ = 0;
+    std::vector<uint8_t> rx_;
+    std::mt19937 random_;
+    uint64_t startNs_ = 0;
+    uint64_t stalledUntilNs_ = 0;
+    std::vector<uint8_t> tx_;  // written once the line is free
+    uint64_t motionUntilNs_ = 0;
+    uint8_t fets_ = 0;
+    double roomC_ = 21.0;
+
+    std::atomic<uint64_t> framesSent_{0};
+    std::atomic<uint64_t> bytesSent_{0};
+    std::atomic<uint64_t> framesDropped_{0};
+    std::atomic<uint64_t> framesCorrupted_{0};
+    std::atomic<uint64_t> commandsReceived_{0};
+    std::atomic<uint64_t> bytesReceived_{0};
+    std::atomic<uint64_t> handshakes_{0};
+    std::atomic<uint64_t> stalls_{0};
+    std::atomic<uint32_t> adcSequence_{0};
+    std::array<std::atomic<uint64_t>, SentHistory> sentNs_;
+    std::array<std::atomic<uint32_t>, SentHistory> sentSequence_;
+};
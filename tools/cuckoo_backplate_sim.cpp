@@ -0,0 +1,261 @@
+// Simulates the backplate on a pseudo-terminal, for running the serial stack
+// against real termios without the hardware.
+//
+// Without --soak it prints the pty path and serves it until interrupted; point
+// the hal "backplate_serial_device" of a host build at it. With --soak it runs
+// UnixSerialPort and BackplateComms in this process against the simulator for
+// the given number of seconds (0: until interrupted) and reports throughput,
+// loss and latency every --report seconds. Logging defaults to warn;
+// CUCKOO_LOG_LEVEL overrides it as for the app.
+//
+// Usage: cuckoo_backplate_sim [--soak SECONDS] [--reactor] [--report SECONDS]
+//            [--temp-hz N] [--adc-hz N] [--pir-hz N] [--pir-samples N] [--prox-hz N]
+//            [--motion-seconds N] [--history N] [--corrupt RATE] [--junk RATE]
+//            [--stall-seconds N] [--stall-ms N] [--fet-seconds N] [--seed N]
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <signal.h>
+
+#include "BackplateSimulator.hpp"
+#include "Backplate/BackplateComms.hpp"
+#include "Backplate/UnixSerialPort.hpp"
+#include "Metrics.hpp"
+#include "Reactor.hpp"
+#include "SystemDateTimeProvider.hpp"
+#include "TimerService.hpp"
+#include "logger.h"
+
+namespace {
+
+std::atomic<bool> interrupted(false);
+
+struct SoakOptions
+{
+    int seconds = -1;  // no soak: serve the pty only
+    bool reactor = false;
+    int report_seconds = 10;
+    int fet_seconds = 5;
+};
+
+void Usage(const char *program)
+{
+    std::fprintf(stderr,
+        "Usage: %s [--soak SECONDS] [--reactor] [--report SECONDS]\n"
+        "           [--temp-hz N] [--adc-hz N] [--pir-hz N] [--pir-samples N] [--prox-hz N]\n"
+        "           [--motion-seconds N] [--history N] [--corrupt RATE] [--junk RATE]\n"
+        "           [--stall-seconds N] [--stall-ms N] [--fet-seconds N] [--seed N]\n", program);
+}
+
+bool ParseArgs(int argc, char **argv, BackplateSimulatorOptions &sim, SoakOptions &soak)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--reactor")
+        {
+            soak.reactor = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+            return false;
+        const char *value = argv[++i];
+        if (arg == "--soak")
+            soak.seconds = atoi(value);
+        else if (arg == "--report")
+            soak.report_seconds = std::max(1, atoi(value));
+        else if (arg == "--fet-seconds")
+            soak.fet_seconds = atoi(value);
+        else if (arg == "--temp-hz")
+            sim.temperature_hz = atof(value);
+        else if (arg == "--adc-hz")
+            sim.adc_hz = atof(value);
+        else if (arg == "--pir-hz")
+            sim.pir_raw_hz = atof(value);
+        else if (arg == "--pir-samples")
+            sim.pir_raw_samples = atoi(value);
+        else if (arg == "--prox-hz")
+            sim.proximity_hz = atof(value);
+        else if (arg == "--motion-seconds")
+            sim.motion_seconds = atoi(value);
+        else if (arg == "--history")
+            sim.historical_buffers = atoi(value);
+        else if (arg == "--corrupt")
+            sim.corrupt_rate = atof(value);
+        else if (arg == "--junk")
+            sim.junk_rate = atof(value);
+        else if (arg == "--stall-seconds")
+            sim.stall_seconds = atoi(value);
+        else if (arg == "--stall-ms")
+            sim.stall_ms = atoi(value);
+        else if (arg == "--seed")
+            sim.seed = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        else
+            return false;
+    }
+    return true;
+}
+
+// What the host side saw, updated on the comms and PIR threads
+struct HostStats
+{
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> adcFrames{0};
+    std::atomic<uint64_t> temperatureUpdates{0};
+    std::atomic<uint64_t> occupancyChanges{0};
+    MetricHistogram adcLatencyUs;
+};
+
+double Ms(uint64_t us)
+{
+    return static_cast<double>(us) / 1000.0;
+}
+
+void Report(double elapsed, const BackplateSimulator::Stats &device, const BackplateSimulator::Stats &last,
+            double interval, const HostStats &host, const BackplateComms &comms)
+{
+    MetricHistogram::Snapshot latency = host.adcLatencyUs.Read();
+    MetricHistogram::Snapshot fetAck = Metrics::Instance().Histogram("backplate_fet_ack_us", "").Read();
+    uint64_t adcSent = device.adcFramesSent;
+    uint64_t adcReceived = host.adcFrames.load();
+    double lost = adcSent > 0 && adcReceived < adcSent ? 100.0 * (adcSent - adcReceived) / adcSent : 0.0;
+
+    std::printf("[%7.0f s] %s | device %llu frames, %.1f KB/s, %llu corrupted, %llu dropped, %llu stalls, %llu handshakes"
+                " | host %llu frames, adc loss %.2f%%, %llu temperature updates, %llu occupancy changes"
+                " | adc latency p50 %.2f ms p99 %.2f ms max %.2f ms | fet ack p50 %.2f ms p99 %.2f ms (%llu)\n",
+        elapsed, comms.IsReady() ? "ready" : "not ready",
+        static_cast<unsigned long long>(device.framesSent),
+        (device.bytesSent - last.bytesSent) / 1024.0 / interval,
+        static_cast<unsigned long long>(device.framesCorrupted),
+        static_cast<unsigned long long>(device.framesDropped),
+        static_cast<unsigned long long>(device.stalls),
+        static_cast<unsigned long long>(device.handshakes),
+        static_cast<unsigned long long>(host.frames.load()), lost,
+        static_cast<unsigned long long>(host.temperatureUpdates.load()),
+        static_cast<unsigned long long>(host.occupancyChanges.load()),
+        Ms(latency.Percentile(0.5)), Ms(latency.Percentile(0.99)), Ms(latency.max),
+        Ms(fetAck.Percentile(0.5)), Ms(fetAck.Percentile(0.99)), static_cast<unsigned long long>(fetAck.count));
+    std::fflush(stdout);
+}
+
+int Soak(BackplateSimulator &simulator, const SoakOptions &options)
+{
+    // Declared first so it outlives the comms registered with it
+    std::unique_ptr<Reactor> reactor;
+    UnixSerialPort port(simulator.SlavePath());
+    SystemDateTimeProvider clock;
+    BackplateComms comms(&port, &clock);
+    HostStats host;
+
+    comms.AddGenericEventCallback([&simulator, &host, &clock](uint16_t type, const uint8_t *payload, size_t length) {
+        host.frames++;
+        if (type != static_cast<uint16_t>(MessageType::RawAdcData))
+            return;
+        host.adcFrames++;
+        uint64_t sentNs = simulator.SentNs(BackplateSimulator::AdcSequence(payload, length));
+        if (sentNs != 0)
+            host.adcLatencyUs.Record((clock.monotonic_ns() - sentNs) / 1000);
+    });
+    comms.AddTemperatureCallback([&host](float) { host.temperatureUpdates++; });
+    comms.AddOccupancyCallback([&host](const Occupancy &) { host.occupancyChanges++; });
+    if (options.fet_seconds > 0)
+    {
+        // Toggle the heat FET to time the echo round trip
+        comms.AddCommsTask(TimerService::Sec(options.fet_seconds), [&comms]() {
+            if (comms.IsHandshakeComplete())
+                comms.SendFetControl(comms.GetAckedFetMask() == 1 ? 0 : 1);
+        });
+    }
+
+    if (options.reactor)
+    {
+        reactor.reset(new Reactor());
+        if (!reactor->IsValid())
+        {
+            std::fprintf(stderr, "Reactor not available\n");
+            return 1;
+        }
+        comms.Initialize(*reactor);
+    }
+    else
+        comms.Initialize();
+
+    uint64_t start = TimerService::MonotonicNs();
+    uint64_t nextReport = start + TimerService::Sec(options.report_seconds);
+    BackplateSimulator::Stats last;
+    while (!interrupted.load())
+    {
+        uint64_t now = TimerService::MonotonicNs();
+        bool done = options.seconds > 0 && now - start >= TimerService::Sec(options.seconds);
+        if (now >= nextReport || done)
+        {
+            BackplateSimulator::Stats device = simulator.GetStats();
+            Report(static_cast<double>(now - start) / 1e9, device, last, options.report_seconds, host, comms);
+            last = device;
+            nextReport += TimerService::Sec(options.report_seconds);
+        }
+        if (done)
+            break;
+
+        if (reactor)
+            reactor->RunOnce(100);
+        else
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    bool ok = comms.IsHandshakeComplete() && host.frames.load() > 0;
+    if (!ok)
+        std::fprintf(stderr, "Soak failed: %s\n", comms.IsHandshakeComplete() ? "no frames reached the host" : "no handshake");
+    return ok ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    BackplateSimulatorOptions simOptions;
+    SoakOptions soakOptions;
+    if (!ParseArgs(argc, argv, simOptions, soakOptions))
+    {
+        Usage(argv[0]);
+        return 2;
+    }
+
+    // Every frame is logged at info; the reports are what a soak is for
+    cuckoo_log::Logger::set_level(cuckoo_log::Level::Warn);
+    cuckoo_log::Logger::set_level_from_env();
+
+    signal(SIGINT, [](int) { interrupted.store(true); });
+    signal(SIGTERM, [](int) { interrupted.store(true); });
+
+    BackplateSimulator simulator(simOptions);
+    if (!simulator.Start())
+        return 1;
+
+    if (soakOptions.seconds >= 0)
+        return Soak(simulator, soakOptions);
+
+    std::printf("Backplate simulator on %s\n", simulator.SlavePath().c_str());
+    std::fflush(stdout);
+    BackplateSimulator::Stats last;
+    while (!interrupted.load())
+    {
+        std::this_thread::sleep_for(std::chrono::seconds(soakOptions.report_seconds));
+        BackplateSimulator::Stats stats = simulator.GetStats();
+        std::printf("%llu frames sent (%.1f KB/s), %llu commands, %llu handshakes, %llu dropped\n",
+            static_cast<unsigned long long>(stats.framesSent),
+            (stats.bytesSent - last.bytesSent) / 1024.0 / soakOptions.report_seconds,
+            static_cast<unsigned long long>(stats.commandsReceived),
+            static_cast<unsigned long long>(stats.handshakes),
+            static_cast<unsigned long long>(stats.framesDropped));
+        std::fflush(stdout);
+        last = stats;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Prints the binary log segments written by Logger::set_binary_sink() as text,
+// oldest segment first.
+// Usage: cuckoo_logdump <log dir | segment file>...
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "logger.h"
+
+namespace {
+
+struct Segment {
+    uint32_t sequence;
+    std::string path;
+    std::vector<cuckoo_log::binary::Line> lines;
+};
+
+void CollectPaths(const std::string &arg, std::vector<std::string> &paths)
+{
+    struct stat st;
+    if (stat(arg.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+    {
+        paths.push_back(arg);
+        return;
+    }
+    DIR *dir = opendir(arg.c_str());
+    if (dir == nullptr)
+        return;
+    while (struct dirent *entry = readdir(dir))
+    {
+        std::string name = entry->d_name;
+        if (name.compare(0, 4, "log.") == 0 && name.size() > 8 && name.compare(name.size() - 4, 4, ".bin") == 0)
+            paths.push_back(arg + "/" + name);
+    }
+    closedir(dir);
+}
+
+void PrintLine(const cuckoo_log::binary::Line &line)
+{
+    time_t second = static_cast<time_t>(line.time_us / 1000000);
+    std::tm tm{};
+    localtime_r(&second, &tm);
+    char time_text[32];
+    if (std::strftime(time_text, sizeof(time_text), "%Y-%m-%d %H:%M:%S", &tm) == 0)
+        time_text[0] = '\0';
+    std::printf("%s.%03d [%s] %s: %s\n", time_text, static_cast<int>((line.time_us / 1000) % 1000),
+                cuckoo_log::level_name(static_cast<cuckoo_log::Level>(line.level)), line.module.c_str(), line.text.c_str());
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <log dir | segment file>...\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; ++i)
+        CollectPaths(argv[i], paths);
+
+    std::vector<Segment> segments;
+    for (const auto &path : paths)
+    {
+        Segment segment;
+        segment.path = path;
+        if (!cuckoo_log::binary::read_segment(path, segment.sequence, segment.lines))
+        {
+            std::fprintf(stderr, "%s: not a log segment\n", path.c_str());
+            continue;
+        }
+        segments.push_back(segment);
+    }
+    std::sort(segments.begin(), segments.end(),
+              [](const Segment &a, const Segment &b) { return a.sequence < b.sequence; });
+
+    for (const auto &segment : segments)
+        for (const auto &line : segment.lines)
+            PrintLine(line);
+    return segments.empty() ? 1 : 0;
+}
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Pack an LVGL RGB565 C image array into an RLE-compressed asset source.
+
+Usage: tools/pack_image_rle.py <lvgl_image.c> <Name> <width> <height> > src/Assets/<Name>.cpp
+
+The input is the C array written by LVGL's image converter (RGB565, no alpha).
+The output defines `const PackedImage <Name>`, decoded at runtime by ImageRle.
+
+Stream format, in 16-bit little endian pixels:
+  control byte 0x80 | (n - 1), then one pixel    -> run of n identical pixels (n <= 128)
+  control byte (n - 1), then n pixels            -> n literal pixels (n <= 128)
+"""
+import re
+import sys
+
+MAX_CHUNK = 128
+LV_COLOR_FORMAT_RGB565 = 0x12
+
+
+def read_pixels(path):
+    text = open(path).read()
+    start = text.index('[] = {')
+    body = text[start:text.index('};', start)]
+    raw = bytes(int(x, 16) for x in re.findall(r'0x[0-9a-fA-F]{2}', body))
+    return raw, [raw[i] | (raw[i + 1] << 8) for i in range(0, len(raw), 2)]
+
+
+def encode(px):
+    out = bytearray()
+    literals = []
+
+    def flush():
+        while literals:
+            chunk = literals[:MAX_CHUNK]
+            del literals[:MAX_CHUNK]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend((p & 0xFF, p >> 8))
+
+    i = 0
+    while i < len(px):
+        j = i
+        while j < len(px) and px[j] == px[i] and j - i < MAX_CHUNK:
+            j += 1
+        if j - i >= 2:
+            flush()
+            out.append(0x80 | (j - i - 1))
+            out.extend((px[i] & 0xFF, px[i] >> 8))
+            i = j
+        else:
+            literals.append(px[i])
+            i += 1
+    flush()
+    return out
+
+
+def main():
+    if len(sys.argv) != 5:
+        sys.exit(__doc__)
+    path, name, width, height = sys.argv[1], sys.argv[2], int(sys.argv[3]), int(sys.argv[4])
+    raw, px = read_pixels(path)
+    if len(raw) != width * height * 2:
+        sys.exit('%s: expected %d bytes, found %d' % (path, width * height * 2, len(raw)))
+    packed = encode(px)
+
+    print('// Generated by tools/pack_image_rle.py from %s, do not edit.' % path.split('/')[-1])
+    print('// %dx%d RGB565, %d bytes raw, %d bytes packed' % (width, height, len(raw), len(packed)))
+    print('#include "%s.hpp"' % name)
+    print('')
+    print('static const uint8_t %s_rle[] = {' % name)
+    for k in range(0, len(packed), 16):
+        print('  ' + ', '.join('0x%02x' % v for v in packed[k:k + 16]) + ',')
+    print('};')
+    print('')
+    print('const PackedImage %s = {' % name)
+    print('    %d,                             // width' % width)
+    print('    %d,                             // height' % height)
+    print('    0x%02x,                            // color format (LV_COLOR_FORMAT_RGB565)' % LV_COLOR_FORMAT_RGB565)
+    print('    2,                               // bytes per pixel')
+    print('    %d,                          // raw size' % len(raw))
+    print('    %s_rle,' % name)
+    print('    sizeof(%s_rle)' % name)
+    print('};')
+
+
+if __name__ == '__main__':
+    main()